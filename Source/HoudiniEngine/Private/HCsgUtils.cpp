@@ -26,6 +26,8 @@
 
 #include "HCsgUtils.h"
 
+#include "HoudiniHashUtils.h"
+
 #include "Engine/Engine.h"
 #include "Engine/Polys.h"
 #include "Engine/Selection.h"
@@ -49,6 +51,94 @@ DEFINE_LOG_CATEGORY_STATIC(LogHCsgUtils, Log, All);
 #define THRESH_OPTGEOM_COPLANAR			(0.25)		/* Threshold for Bsp geometry optimization */
 #define THRESH_OPTGEOM_COSIDAL			(0.25)		/* Threshold for Bsp geometry optimization */
 
+namespace
+{
+	// State of a brush as it was when a cached model was built from it
+	struct FBrushModelCacheBrush
+	{
+		TWeakObjectPtr<const ABrush> Brush;
+		uint8 BrushType = 0;
+		uint32 PolyFlags = 0;
+		FMatrix Transform = FMatrix::Identity;
+		TArray<FPoly> Polys;
+
+		explicit FBrushModelCacheBrush(const ABrush* InBrush)
+			: Brush(InBrush)
+		{
+			if (!IsValid(InBrush))
+				return;
+
+			BrushType = InBrush->BrushType;
+			PolyFlags = InBrush->PolyFlags;
+			Transform = InBrush->GetActorTransform().ToMatrixWithScale();
+			if (IsValid(InBrush->Brush) && IsValid(InBrush->Brush->Polys))
+				Polys = InBrush->Brush->Polys->Element;
+		}
+
+		// Compares the same fields as UHCsgUtils::GetBrushesHash()
+		bool Matches(const ABrush* InBrush) const
+		{
+			if (Brush.Get() != InBrush)
+				return false;
+
+			if (!IsValid(InBrush))
+				return true;
+
+			if (InBrush->BrushType != BrushType || InBrush->PolyFlags != PolyFlags
+				|| !InBrush->GetActorTransform().ToMatrixWithScale().Equals(Transform, 0.0))
+				return false;
+
+			const bool bHasPolys = IsValid(InBrush->Brush) && IsValid(InBrush->Brush->Polys);
+			const TArray<FPoly>* CurrentPolys = bHasPolys ? &InBrush->Brush->Polys->Element : nullptr;
+			if ((CurrentPolys ? CurrentPolys->Num() : 0) != Polys.Num())
+				return false;
+
+			for (int32 PolyIdx = 0; PolyIdx < Polys.Num(); PolyIdx++)
+			{
+				const FPoly& Cached = Polys[PolyIdx];
+				const FPoly& Current = (*CurrentPolys)[PolyIdx];
+				if (Current.Vertices != Cached.Vertices
+					|| Current.Base != Cached.Base
+					|| Current.Normal != Cached.Normal
+					|| Current.TextureU != Cached.TextureU
+					|| Current.TextureV != Cached.TextureV
+					|| Current.PolyFlags != Cached.PolyFlags
+					|| Current.Material != Cached.Material)
+					return false;
+			}
+
+			return true;
+		}
+	};
+
+	struct FBrushModelCacheEntry
+	{
+		TWeakObjectPtr<UModel> Model;
+		TArray<FBrushModelCacheBrush> Brushes;
+
+		bool Matches(const TArray<ABrush*>& InBrushes) const
+		{
+			if (InBrushes.Num() != Brushes.Num())
+				return false;
+
+			for (int32 BrushIdx = 0; BrushIdx < Brushes.Num(); BrushIdx++)
+			{
+				if (!Brushes[BrushIdx].Matches(InBrushes[BrushIdx]))
+					return false;
+			}
+
+			return true;
+		}
+	};
+
+	// Models built from brushes, keyed on UHCsgUtils::GetBrushesHash().
+	// Entries keep the brushes' state to rule out hash collisions.
+	TMultiMap<uint64, FBrushModelCacheEntry> BrushModelCache;
+
+	// Past this number of entries, stale entries are removed before adding new ones.
+	constexpr int32 BrushModelCachePruneThreshold = 256;
+}
+
 
 UHCsgUtils::UHCsgUtils()
 {
@@ -892,6 +982,90 @@ UModel* UHCsgUtils::BuildModelFromBrushes(TArray<ABrush*>& Brushes)
 	return OutModel;
 }
 
+UModel* UHCsgUtils::FindOrBuildModelFromBrushes(TArray<ABrush*>& Brushes)
+{
+	const uint64 BrushesHash = GetBrushesHash(Brushes);
+	for (auto It = BrushModelCache.CreateKeyIterator(BrushesHash); It; ++It)
+	{
+		// Check the brushes to rule out hash collisions
+		if (!It.Value().Matches(Brushes))
+			continue;
+
+		UModel* CachedModel = It.Value().Model.Get();
+		if (IsValid(CachedModel))
+			return CachedModel;
+
+		// The cached model is gone, rebuild it below
+		It.RemoveCurrent();
+		break;
+	}
+
+	UModel* OutModel = BuildModelFromBrushes(Brushes);
+	if (!IsValid(OutModel))
+		return nullptr;
+
+	if (BrushModelCache.Num() >= BrushModelCachePruneThreshold)
+	{
+		for (auto It = BrushModelCache.CreateIterator(); It; ++It)
+		{
+			if (!IsValid(It.Value().Model.Get()))
+				It.RemoveCurrent();
+		}
+	}
+
+	FBrushModelCacheEntry& Entry = BrushModelCache.Add(BrushesHash);
+	Entry.Model = OutModel;
+	Entry.Brushes.Reserve(Brushes.Num());
+	for (const ABrush* Brush : Brushes)
+		Entry.Brushes.Emplace(Brush);
+
+	return OutModel;
+}
+
+uint64 UHCsgUtils::GetBrushesHash(const TArray<ABrush*>& Brushes)
+{
+	uint64 Hash = Brushes.Num();
+	for (const ABrush* Brush : Brushes)
+	{
+		if (!IsValid(Brush))
+		{
+			const uint8 InvalidBrush = 0;
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &InvalidBrush, sizeof(InvalidBrush));
+			continue;
+		}
+
+		const uint8 BrushType = Brush->BrushType;
+		const uint32 PolyFlags = Brush->PolyFlags;
+		const FMatrix Transform = Brush->GetActorTransform().ToMatrixWithScale();
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &BrushType, sizeof(BrushType));
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &PolyFlags, sizeof(PolyFlags));
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &Transform.M[0][0], sizeof(Transform.M));
+
+		if (!IsValid(Brush->Brush) || !IsValid(Brush->Brush->Polys))
+			continue;
+
+		for (const FPoly& Poly : Brush->Brush->Polys->Element)
+		{
+			// Materials are part of the output, their address is enough for an in-memory cache
+			const UMaterialInterface* Material = Poly.Material;
+			Hash = FHoudiniHashUtils::HashBytes(Hash, Poly.Vertices.GetData(), Poly.Vertices.Num() * sizeof(FVector3f));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Poly.Base, sizeof(Poly.Base));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Poly.Normal, sizeof(Poly.Normal));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Poly.TextureU, sizeof(Poly.TextureU));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Poly.TextureV, sizeof(Poly.TextureV));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Poly.PolyFlags, sizeof(Poly.PolyFlags));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Material, sizeof(Material));
+		}
+	}
+
+	return Hash;
+}
+
+void UHCsgUtils::EmptyModelCache()
+{
+	BrushModelCache.Empty();
+}
+
 int UHCsgUtils::ComposeBrushCSG
 (
 	ABrush*		Actor, 
@@ -80,6 +80,26 @@ public:
 	 */
 	static UModel* BuildModelFromBrushes(TArray<ABrush*>& Brushes);
 
+	/**
+	 * Returns the model built from the brushes, reusing the model previously built for the same brushes if their
+	 * order, types, transforms and polygons are unchanged. Cached models are shared and must not be modified.
+	 * The cache only holds weak references: models are kept alive by whoever uses them (e.g. UHoudiniInputBrush).
+	 *
+	 * @param	Brushes			The brushes to combine, in CSG order.
+	 *
+	 * @return					The cached or newly built model.
+	 */
+	static UModel* FindOrBuildModelFromBrushes(TArray<ABrush*>& Brushes);
+
+	/**
+	 * Hash of the brushes used as the key of the model cache.
+	 * Covers the brushes' order, types, poly flags, transforms and polygons.
+	 */
+	static uint64 GetBrushesHash(const TArray<ABrush*>& Brushes);
+
+	/** Empties the cache of models built from brushes. */
+	static void EmptyModelCache();
+
 	/**
 	 * Forked version of UEditorEngine::bspBrushCSG() from UnrealEd/Private/EditorBsp.cpp.
 	 * 
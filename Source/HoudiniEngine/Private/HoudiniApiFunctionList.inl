@@ -0,0 +1,396 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// All the FHoudiniApi functions returning a HAPI_Result, for the tools that wrap the FHoudiniApi table.
+// Define HOUDINI_API_RESULT_FUNCTION(FunctionName) before including this file.
+// No include guard: this file is meant to be included several times.
+
+HOUDINI_API_RESULT_FUNCTION(AddAttribute)
+HOUDINI_API_RESULT_FUNCTION(AddGroup)
+HOUDINI_API_RESULT_FUNCTION(BindCustomImplementation)
+HOUDINI_API_RESULT_FUNCTION(CancelPDGCook)
+HOUDINI_API_RESULT_FUNCTION(CheckForSpecificErrors)
+HOUDINI_API_RESULT_FUNCTION(Cleanup)
+HOUDINI_API_RESULT_FUNCTION(ClearConnectionError)
+HOUDINI_API_RESULT_FUNCTION(CloseSession)
+HOUDINI_API_RESULT_FUNCTION(CommitGeo)
+HOUDINI_API_RESULT_FUNCTION(CommitWorkItems)
+HOUDINI_API_RESULT_FUNCTION(CommitWorkitems)
+HOUDINI_API_RESULT_FUNCTION(ComposeChildNodeList)
+HOUDINI_API_RESULT_FUNCTION(ComposeNodeCookResult)
+HOUDINI_API_RESULT_FUNCTION(ComposeObjectList)
+HOUDINI_API_RESULT_FUNCTION(ConnectNodeInput)
+HOUDINI_API_RESULT_FUNCTION(ConvertMatrixToEuler)
+HOUDINI_API_RESULT_FUNCTION(ConvertMatrixToQuat)
+HOUDINI_API_RESULT_FUNCTION(ConvertTransform)
+HOUDINI_API_RESULT_FUNCTION(ConvertTransformEulerToMatrix)
+HOUDINI_API_RESULT_FUNCTION(ConvertTransformQuatToMatrix)
+HOUDINI_API_RESULT_FUNCTION(CookNode)
+HOUDINI_API_RESULT_FUNCTION(CookPDG)
+HOUDINI_API_RESULT_FUNCTION(CookPDGAllOutputs)
+HOUDINI_API_RESULT_FUNCTION(CreateCustomSession)
+HOUDINI_API_RESULT_FUNCTION(CreateHeightFieldInput)
+HOUDINI_API_RESULT_FUNCTION(CreateHeightfieldInputVolumeNode)
+HOUDINI_API_RESULT_FUNCTION(CreateInProcessSession)
+HOUDINI_API_RESULT_FUNCTION(CreateInputCurveNode)
+HOUDINI_API_RESULT_FUNCTION(CreateInputNode)
+HOUDINI_API_RESULT_FUNCTION(CreateNode)
+HOUDINI_API_RESULT_FUNCTION(CreateThriftNamedPipeSession)
+HOUDINI_API_RESULT_FUNCTION(CreateThriftSharedMemorySession)
+HOUDINI_API_RESULT_FUNCTION(CreateThriftSocketSession)
+HOUDINI_API_RESULT_FUNCTION(CreateWorkItem)
+HOUDINI_API_RESULT_FUNCTION(CreateWorkitem)
+HOUDINI_API_RESULT_FUNCTION(DeleteAttribute)
+HOUDINI_API_RESULT_FUNCTION(DeleteGroup)
+HOUDINI_API_RESULT_FUNCTION(DeleteNode)
+HOUDINI_API_RESULT_FUNCTION(DirtyPDGNode)
+HOUDINI_API_RESULT_FUNCTION(DisconnectNodeInput)
+HOUDINI_API_RESULT_FUNCTION(DisconnectNodeOutputsAt)
+HOUDINI_API_RESULT_FUNCTION(ExtractImageToFile)
+HOUDINI_API_RESULT_FUNCTION(ExtractImageToMemory)
+HOUDINI_API_RESULT_FUNCTION(GetActiveCacheCount)
+HOUDINI_API_RESULT_FUNCTION(GetActiveCacheNames)
+HOUDINI_API_RESULT_FUNCTION(GetAssetDefinitionParmCounts)
+HOUDINI_API_RESULT_FUNCTION(GetAssetDefinitionParmInfos)
+HOUDINI_API_RESULT_FUNCTION(GetAssetDefinitionParmValues)
+HOUDINI_API_RESULT_FUNCTION(GetAssetInfo)
+HOUDINI_API_RESULT_FUNCTION(GetAssetLibraryFilePath)
+HOUDINI_API_RESULT_FUNCTION(GetAssetLibraryIds)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeDictionaryArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeDictionaryArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeDictionaryData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeDictionaryDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloat64ArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloat64ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloat64Data)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloat64DataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloatArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloatArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloatData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeFloatDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInfo)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt16ArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt16ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt16Data)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt16DataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt64ArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt64ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt64Data)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt64DataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt8ArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt8ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt8Data)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeInt8DataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeIntArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeIntArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeIntData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeIntDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeNames)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeStringArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeStringArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeStringData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeStringDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeUInt8ArrayData)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeUInt8ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeUInt8Data)
+HOUDINI_API_RESULT_FUNCTION(GetAttributeUInt8DataAsync)
+HOUDINI_API_RESULT_FUNCTION(GetAvailableAssetCount)
+HOUDINI_API_RESULT_FUNCTION(GetAvailableAssets)
+HOUDINI_API_RESULT_FUNCTION(GetBoxInfo)
+HOUDINI_API_RESULT_FUNCTION(GetCacheProperty)
+HOUDINI_API_RESULT_FUNCTION(GetComposedChildNodeList)
+HOUDINI_API_RESULT_FUNCTION(GetComposedNodeCookResult)
+HOUDINI_API_RESULT_FUNCTION(GetComposedObjectList)
+HOUDINI_API_RESULT_FUNCTION(GetComposedObjectTransforms)
+HOUDINI_API_RESULT_FUNCTION(GetCompositorOptions)
+HOUDINI_API_RESULT_FUNCTION(GetConnectionError)
+HOUDINI_API_RESULT_FUNCTION(GetConnectionErrorLength)
+HOUDINI_API_RESULT_FUNCTION(GetCookingCurrentCount)
+HOUDINI_API_RESULT_FUNCTION(GetCookingTotalCount)
+HOUDINI_API_RESULT_FUNCTION(GetCurveCounts)
+HOUDINI_API_RESULT_FUNCTION(GetCurveInfo)
+HOUDINI_API_RESULT_FUNCTION(GetCurveKnots)
+HOUDINI_API_RESULT_FUNCTION(GetCurveOrders)
+HOUDINI_API_RESULT_FUNCTION(GetDisplayGeoInfo)
+HOUDINI_API_RESULT_FUNCTION(GetEdgeCountOfEdgeGroup)
+HOUDINI_API_RESULT_FUNCTION(GetEnvInt)
+HOUDINI_API_RESULT_FUNCTION(GetFaceCounts)
+HOUDINI_API_RESULT_FUNCTION(GetFirstVolumeTile)
+HOUDINI_API_RESULT_FUNCTION(GetGeoInfo)
+HOUDINI_API_RESULT_FUNCTION(GetGeoSize)
+HOUDINI_API_RESULT_FUNCTION(GetGroupCountOnPackedInstancePart)
+HOUDINI_API_RESULT_FUNCTION(GetGroupMembership)
+HOUDINI_API_RESULT_FUNCTION(GetGroupMembershipOnPackedInstancePart)
+HOUDINI_API_RESULT_FUNCTION(GetGroupNames)
+HOUDINI_API_RESULT_FUNCTION(GetGroupNamesOnPackedInstancePart)
+HOUDINI_API_RESULT_FUNCTION(GetHIPFileNodeCount)
+HOUDINI_API_RESULT_FUNCTION(GetHIPFileNodeIds)
+HOUDINI_API_RESULT_FUNCTION(GetHandleBindingInfo)
+HOUDINI_API_RESULT_FUNCTION(GetHandleInfo)
+HOUDINI_API_RESULT_FUNCTION(GetHeightFieldData)
+HOUDINI_API_RESULT_FUNCTION(GetImageFilePath)
+HOUDINI_API_RESULT_FUNCTION(GetImageInfo)
+HOUDINI_API_RESULT_FUNCTION(GetImageMemoryBuffer)
+HOUDINI_API_RESULT_FUNCTION(GetImagePlaneCount)
+HOUDINI_API_RESULT_FUNCTION(GetImagePlanes)
+HOUDINI_API_RESULT_FUNCTION(GetInputCurveInfo)
+HOUDINI_API_RESULT_FUNCTION(GetInstanceTransformsOnPart)
+HOUDINI_API_RESULT_FUNCTION(GetInstancedObjectIds)
+HOUDINI_API_RESULT_FUNCTION(GetInstancedPartIds)
+HOUDINI_API_RESULT_FUNCTION(GetInstancerPartTransforms)
+HOUDINI_API_RESULT_FUNCTION(GetJobStatus)
+HOUDINI_API_RESULT_FUNCTION(GetLoadedAssetLibraryCount)
+HOUDINI_API_RESULT_FUNCTION(GetManagerNodeId)
+HOUDINI_API_RESULT_FUNCTION(GetMaterialInfo)
+HOUDINI_API_RESULT_FUNCTION(GetMaterialNodeIdsOnFaces)
+HOUDINI_API_RESULT_FUNCTION(GetMessageNodeCount)
+HOUDINI_API_RESULT_FUNCTION(GetMessageNodeIds)
+HOUDINI_API_RESULT_FUNCTION(GetNextVolumeTile)
+HOUDINI_API_RESULT_FUNCTION(GetNodeCookResult)
+HOUDINI_API_RESULT_FUNCTION(GetNodeCookResultLength)
+HOUDINI_API_RESULT_FUNCTION(GetNodeFromPath)
+HOUDINI_API_RESULT_FUNCTION(GetNodeInfo)
+HOUDINI_API_RESULT_FUNCTION(GetNodeInputName)
+HOUDINI_API_RESULT_FUNCTION(GetNodeOutputName)
+HOUDINI_API_RESULT_FUNCTION(GetNodePath)
+HOUDINI_API_RESULT_FUNCTION(GetNumWorkItems)
+HOUDINI_API_RESULT_FUNCTION(GetNumWorkitems)
+HOUDINI_API_RESULT_FUNCTION(GetObjectInfo)
+HOUDINI_API_RESULT_FUNCTION(GetObjectTransform)
+HOUDINI_API_RESULT_FUNCTION(GetOutputGeoCount)
+HOUDINI_API_RESULT_FUNCTION(GetOutputGeoInfos)
+HOUDINI_API_RESULT_FUNCTION(GetOutputNodeId)
+HOUDINI_API_RESULT_FUNCTION(GetPDGEvents)
+HOUDINI_API_RESULT_FUNCTION(GetPDGGraphContextId)
+HOUDINI_API_RESULT_FUNCTION(GetPDGGraphContexts)
+HOUDINI_API_RESULT_FUNCTION(GetPDGGraphContextsCount)
+HOUDINI_API_RESULT_FUNCTION(GetPDGState)
+HOUDINI_API_RESULT_FUNCTION(GetParameters)
+HOUDINI_API_RESULT_FUNCTION(GetParmChoiceLists)
+HOUDINI_API_RESULT_FUNCTION(GetParmExpression)
+HOUDINI_API_RESULT_FUNCTION(GetParmFile)
+HOUDINI_API_RESULT_FUNCTION(GetParmFloatValue)
+HOUDINI_API_RESULT_FUNCTION(GetParmFloatValues)
+HOUDINI_API_RESULT_FUNCTION(GetParmIdFromName)
+HOUDINI_API_RESULT_FUNCTION(GetParmInfo)
+HOUDINI_API_RESULT_FUNCTION(GetParmInfoFromName)
+HOUDINI_API_RESULT_FUNCTION(GetParmIntValue)
+HOUDINI_API_RESULT_FUNCTION(GetParmIntValues)
+HOUDINI_API_RESULT_FUNCTION(GetParmNodeValue)
+HOUDINI_API_RESULT_FUNCTION(GetParmStringValue)
+HOUDINI_API_RESULT_FUNCTION(GetParmStringValues)
+HOUDINI_API_RESULT_FUNCTION(GetParmTagName)
+HOUDINI_API_RESULT_FUNCTION(GetParmTagValue)
+HOUDINI_API_RESULT_FUNCTION(GetParmWithTag)
+HOUDINI_API_RESULT_FUNCTION(GetPartInfo)
+HOUDINI_API_RESULT_FUNCTION(GetPreset)
+HOUDINI_API_RESULT_FUNCTION(GetPresetBufLength)
+HOUDINI_API_RESULT_FUNCTION(GetPresetCount)
+HOUDINI_API_RESULT_FUNCTION(GetPresetNames)
+HOUDINI_API_RESULT_FUNCTION(GetServerEnvInt)
+HOUDINI_API_RESULT_FUNCTION(GetServerEnvString)
+HOUDINI_API_RESULT_FUNCTION(GetServerEnvVarCount)
+HOUDINI_API_RESULT_FUNCTION(GetServerEnvVarList)
+HOUDINI_API_RESULT_FUNCTION(GetSessionEnvInt)
+HOUDINI_API_RESULT_FUNCTION(GetSessionSyncInfo)
+HOUDINI_API_RESULT_FUNCTION(GetSphereInfo)
+HOUDINI_API_RESULT_FUNCTION(GetStatus)
+HOUDINI_API_RESULT_FUNCTION(GetStatusString)
+HOUDINI_API_RESULT_FUNCTION(GetStatusStringBufLength)
+HOUDINI_API_RESULT_FUNCTION(GetString)
+HOUDINI_API_RESULT_FUNCTION(GetStringBatch)
+HOUDINI_API_RESULT_FUNCTION(GetStringBatchSize)
+HOUDINI_API_RESULT_FUNCTION(GetStringBufLength)
+HOUDINI_API_RESULT_FUNCTION(GetSupportedImageFileFormatCount)
+HOUDINI_API_RESULT_FUNCTION(GetSupportedImageFileFormats)
+HOUDINI_API_RESULT_FUNCTION(GetTime)
+HOUDINI_API_RESULT_FUNCTION(GetTimelineOptions)
+HOUDINI_API_RESULT_FUNCTION(GetTotalCookCount)
+HOUDINI_API_RESULT_FUNCTION(GetUseHoudiniTime)
+HOUDINI_API_RESULT_FUNCTION(GetVertexList)
+HOUDINI_API_RESULT_FUNCTION(GetViewport)
+HOUDINI_API_RESULT_FUNCTION(GetVolumeBounds)
+HOUDINI_API_RESULT_FUNCTION(GetVolumeInfo)
+HOUDINI_API_RESULT_FUNCTION(GetVolumeTileFloatData)
+HOUDINI_API_RESULT_FUNCTION(GetVolumeTileIntData)
+HOUDINI_API_RESULT_FUNCTION(GetVolumeVisualInfo)
+HOUDINI_API_RESULT_FUNCTION(GetVolumeVoxelFloatData)
+HOUDINI_API_RESULT_FUNCTION(GetVolumeVoxelIntData)
+HOUDINI_API_RESULT_FUNCTION(GetWorkItemAttributeSize)
+HOUDINI_API_RESULT_FUNCTION(GetWorkItemFloatAttribute)
+HOUDINI_API_RESULT_FUNCTION(GetWorkItemInfo)
+HOUDINI_API_RESULT_FUNCTION(GetWorkItemIntAttribute)
+HOUDINI_API_RESULT_FUNCTION(GetWorkItemOutputFiles)
+HOUDINI_API_RESULT_FUNCTION(GetWorkItemStringAttribute)
+HOUDINI_API_RESULT_FUNCTION(GetWorkItems)
+HOUDINI_API_RESULT_FUNCTION(GetWorkitemDataLength)
+HOUDINI_API_RESULT_FUNCTION(GetWorkitemFloatData)
+HOUDINI_API_RESULT_FUNCTION(GetWorkitemInfo)
+HOUDINI_API_RESULT_FUNCTION(GetWorkitemIntData)
+HOUDINI_API_RESULT_FUNCTION(GetWorkitemResultInfo)
+HOUDINI_API_RESULT_FUNCTION(GetWorkitemStringData)
+HOUDINI_API_RESULT_FUNCTION(GetWorkitems)
+HOUDINI_API_RESULT_FUNCTION(Initialize)
+HOUDINI_API_RESULT_FUNCTION(InsertMultiparmInstance)
+HOUDINI_API_RESULT_FUNCTION(Interrupt)
+HOUDINI_API_RESULT_FUNCTION(IsInitialized)
+HOUDINI_API_RESULT_FUNCTION(IsNodeValid)
+HOUDINI_API_RESULT_FUNCTION(IsSessionValid)
+HOUDINI_API_RESULT_FUNCTION(LoadAssetLibraryFromFile)
+HOUDINI_API_RESULT_FUNCTION(LoadAssetLibraryFromMemory)
+HOUDINI_API_RESULT_FUNCTION(LoadGeoFromFile)
+HOUDINI_API_RESULT_FUNCTION(LoadGeoFromMemory)
+HOUDINI_API_RESULT_FUNCTION(LoadHIPFile)
+HOUDINI_API_RESULT_FUNCTION(LoadNodeFromFile)
+HOUDINI_API_RESULT_FUNCTION(MergeHIPFile)
+HOUDINI_API_RESULT_FUNCTION(ParmHasExpression)
+HOUDINI_API_RESULT_FUNCTION(ParmHasTag)
+HOUDINI_API_RESULT_FUNCTION(PausePDGCook)
+HOUDINI_API_RESULT_FUNCTION(PythonThreadInterpreterLock)
+HOUDINI_API_RESULT_FUNCTION(QueryNodeInput)
+HOUDINI_API_RESULT_FUNCTION(QueryNodeOutputConnectedCount)
+HOUDINI_API_RESULT_FUNCTION(QueryNodeOutputConnectedNodes)
+HOUDINI_API_RESULT_FUNCTION(RemoveCustomString)
+HOUDINI_API_RESULT_FUNCTION(RemoveMultiparmInstance)
+HOUDINI_API_RESULT_FUNCTION(RemoveParmExpression)
+HOUDINI_API_RESULT_FUNCTION(RenameNode)
+HOUDINI_API_RESULT_FUNCTION(RenderCOPToImage)
+HOUDINI_API_RESULT_FUNCTION(RenderTextureToImage)
+HOUDINI_API_RESULT_FUNCTION(ResetSimulation)
+HOUDINI_API_RESULT_FUNCTION(RevertGeo)
+HOUDINI_API_RESULT_FUNCTION(RevertParmToDefault)
+HOUDINI_API_RESULT_FUNCTION(RevertParmToDefaults)
+HOUDINI_API_RESULT_FUNCTION(SaveGeoToFile)
+HOUDINI_API_RESULT_FUNCTION(SaveGeoToMemory)
+HOUDINI_API_RESULT_FUNCTION(SaveHIPFile)
+HOUDINI_API_RESULT_FUNCTION(SaveNodeToFile)
+HOUDINI_API_RESULT_FUNCTION(SetAnimCurve)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeDictionaryArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeDictionaryArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeDictionaryData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeDictionaryDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloat64ArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloat64ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloat64Data)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloat64DataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloat64UniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloat64UniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloatArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloatArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloatData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloatDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloatUniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeFloatUniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIndexedStringData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIndexedStringDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt16ArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt16ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt16Data)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt16DataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt16UniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt16UniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt64ArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt64ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt64Data)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt64DataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt64UniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt64UniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt8ArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt8ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt8Data)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt8DataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt8UniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeInt8UniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIntArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIntArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIntData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIntDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIntUniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeIntUniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeStringArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeStringArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeStringData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeStringDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeStringUniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeStringUniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeUInt8ArrayData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeUInt8ArrayDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeUInt8Data)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeUInt8DataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeUInt8UniqueData)
+HOUDINI_API_RESULT_FUNCTION(SetAttributeUInt8UniqueDataAsync)
+HOUDINI_API_RESULT_FUNCTION(SetCacheProperty)
+HOUDINI_API_RESULT_FUNCTION(SetCompositorOptions)
+HOUDINI_API_RESULT_FUNCTION(SetCurveCounts)
+HOUDINI_API_RESULT_FUNCTION(SetCurveInfo)
+HOUDINI_API_RESULT_FUNCTION(SetCurveKnots)
+HOUDINI_API_RESULT_FUNCTION(SetCurveOrders)
+HOUDINI_API_RESULT_FUNCTION(SetCustomString)
+HOUDINI_API_RESULT_FUNCTION(SetFaceCounts)
+HOUDINI_API_RESULT_FUNCTION(SetGroupMembership)
+HOUDINI_API_RESULT_FUNCTION(SetHeightFieldData)
+HOUDINI_API_RESULT_FUNCTION(SetImageInfo)
+HOUDINI_API_RESULT_FUNCTION(SetInputCurveInfo)
+HOUDINI_API_RESULT_FUNCTION(SetInputCurvePositions)
+HOUDINI_API_RESULT_FUNCTION(SetInputCurvePositionsRotationsScales)
+HOUDINI_API_RESULT_FUNCTION(SetNodeDisplay)
+HOUDINI_API_RESULT_FUNCTION(SetObjectTransform)
+HOUDINI_API_RESULT_FUNCTION(SetParmExpression)
+HOUDINI_API_RESULT_FUNCTION(SetParmFloatValue)
+HOUDINI_API_RESULT_FUNCTION(SetParmFloatValues)
+HOUDINI_API_RESULT_FUNCTION(SetParmIntValue)
+HOUDINI_API_RESULT_FUNCTION(SetParmIntValues)
+HOUDINI_API_RESULT_FUNCTION(SetParmNodeValue)
+HOUDINI_API_RESULT_FUNCTION(SetParmStringValue)
+HOUDINI_API_RESULT_FUNCTION(SetPartInfo)
+HOUDINI_API_RESULT_FUNCTION(SetPreset)
+HOUDINI_API_RESULT_FUNCTION(SetServerEnvInt)
+HOUDINI_API_RESULT_FUNCTION(SetServerEnvString)
+HOUDINI_API_RESULT_FUNCTION(SetSessionSync)
+HOUDINI_API_RESULT_FUNCTION(SetSessionSyncInfo)
+HOUDINI_API_RESULT_FUNCTION(SetTime)
+HOUDINI_API_RESULT_FUNCTION(SetTimelineOptions)
+HOUDINI_API_RESULT_FUNCTION(SetTransformAnimCurve)
+HOUDINI_API_RESULT_FUNCTION(SetUseHoudiniTime)
+HOUDINI_API_RESULT_FUNCTION(SetVertexList)
+HOUDINI_API_RESULT_FUNCTION(SetViewport)
+HOUDINI_API_RESULT_FUNCTION(SetVolumeInfo)
+HOUDINI_API_RESULT_FUNCTION(SetVolumeTileFloatData)
+HOUDINI_API_RESULT_FUNCTION(SetVolumeTileIntData)
+HOUDINI_API_RESULT_FUNCTION(SetVolumeVoxelFloatData)
+HOUDINI_API_RESULT_FUNCTION(SetVolumeVoxelIntData)
+HOUDINI_API_RESULT_FUNCTION(SetWorkItemFloatAttribute)
+HOUDINI_API_RESULT_FUNCTION(SetWorkItemIntAttribute)
+HOUDINI_API_RESULT_FUNCTION(SetWorkItemStringAttribute)
+HOUDINI_API_RESULT_FUNCTION(SetWorkitemFloatData)
+HOUDINI_API_RESULT_FUNCTION(SetWorkitemIntData)
+HOUDINI_API_RESULT_FUNCTION(SetWorkitemStringData)
+HOUDINI_API_RESULT_FUNCTION(Shutdown)
+HOUDINI_API_RESULT_FUNCTION(StartPerformanceMonitorProfile)
+HOUDINI_API_RESULT_FUNCTION(StartThriftNamedPipeServer)
+HOUDINI_API_RESULT_FUNCTION(StartThriftSharedMemoryServer)
+HOUDINI_API_RESULT_FUNCTION(StartThriftSocketServer)
+HOUDINI_API_RESULT_FUNCTION(StopPerformanceMonitorProfile)
@@ -0,0 +1,623 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApiRecorder.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include <atomic>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+namespace
+{
+	// A HAPI call, with the content of its output arguments after the call
+	struct FHoudiniApiRecordedCall
+	{
+		int32 FunctionIndex = INDEX_NONE;
+		// Hash of the value and string arguments
+		uint32 InputHash = 0;
+		int32 Result = HAPI_RESULT_SUCCESS;
+		// Size of each output argument, in order. Their data follows each other in OutputData.
+		TArray<int64> OutputSizes;
+		TArray<uint8> OutputData;
+
+		friend FArchive& operator<<(FArchive& Ar, FHoudiniApiRecordedCall& InCall)
+		{
+			Ar << InCall.FunctionIndex << InCall.InputHash << InCall.Result << InCall.OutputSizes << InCall.OutputData;
+			return Ar;
+		}
+	};
+
+	// Number of elements of the output argument at Index of the function in Slot, for the outputs whose size can't be
+	// found from the arguments following them. -1 uses the rules of THoudiniApiCallArguments::GetOutputSize().
+	template<auto* Slot, size_t Index>
+	struct THoudiniApiOutputNumElements
+	{
+		template<typename TupleType>
+		static int64 Get(const TupleType& InArgs) { return -1; }
+	};
+
+	// The matrices are 4x4
+	template<>
+	struct THoudiniApiOutputNumElements<&FHoudiniApi::ConvertTransformEulerToMatrix, 2>
+	{
+		template<typename TupleType>
+		static int64 Get(const TupleType& InArgs) { return 16; }
+	};
+
+	template<>
+	struct THoudiniApiOutputNumElements<&FHoudiniApi::ConvertTransformQuatToMatrix, 2>
+	{
+		template<typename TupleType>
+		static int64 Get(const TupleType& InArgs) { return 16; }
+	};
+
+	// The names are followed by the ids, both arrays hold length elements
+	template<>
+	struct THoudiniApiOutputNumElements<&FHoudiniApi::GetPDGGraphContexts, 1>
+	{
+		template<typename TupleType>
+		static int64 Get(const TupleType& InArgs) { return std::get<4>(InArgs); }
+	};
+
+	// Gives the inputs and outputs of a call to the function in Slot from its arguments. See FHoudiniApiRecorder for the rules.
+	template<auto* Slot, typename... ArgTypes>
+	struct THoudiniApiCallArguments
+	{
+		using FTuple = std::tuple<ArgTypes...>;
+		static constexpr size_t NumArgs = sizeof...(ArgTypes);
+
+		template<size_t Index>
+		using TArg = std::tuple_element_t<Index, FTuple>;
+
+		// Outputs are pointers to non-const data that isn't a pointer itself (const char** are input arrays)
+		template<size_t Index>
+		static constexpr bool IsOutput()
+		{
+			using ArgType = TArg<Index>;
+			if constexpr (std::is_pointer_v<ArgType>)
+			{
+				using ElementType = std::remove_pointer_t<ArgType>;
+				return !std::is_const_v<ElementType> && !std::is_pointer_v<ElementType> && !std::is_void_v<ElementType>;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		// Gets the last int of the int arguments starting at Index. Returns false if the argument at Index isn't an int.
+		template<size_t Index>
+		static bool GetLength(const FTuple& InArgs, int64& OutLength)
+		{
+			if constexpr (Index < NumArgs)
+			{
+				if constexpr (std::is_same_v<TArg<Index>, int>)
+				{
+					OutLength = std::get<Index>(InArgs);
+					GetLength<Index + 1>(InArgs, OutLength);
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// Number of values per element of the attribute data functions: their stride if given, the attribute's tuple size otherwise
+		template<size_t Index = 0>
+		static int64 GetAttributeValuesPerElement(const FTuple& InArgs)
+		{
+			if constexpr (Index < NumArgs)
+			{
+				if constexpr (std::is_same_v<TArg<Index>, HAPI_AttributeInfo*>)
+				{
+					int64 Stride = -1;
+					if constexpr (Index + 1 < NumArgs)
+					{
+						if constexpr (std::is_same_v<TArg<Index + 1>, int>)
+							Stride = std::get<Index + 1>(InArgs);
+					}
+
+					if (Stride > 0)
+						return Stride;
+
+					const HAPI_AttributeInfo* AttributeInfo = std::get<Index>(InArgs);
+					return AttributeInfo ? FMath::Max(AttributeInfo->tupleSize, 1) : 1;
+				}
+				else
+				{
+					return GetAttributeValuesPerElement<Index + 1>(InArgs);
+				}
+			}
+			else
+			{
+				return 1;
+			}
+		}
+
+		template<size_t Index>
+		static int64 GetOutputSize(const FTuple& InArgs, bool bInAttributeData)
+		{
+			using ElementType = std::remove_pointer_t<TArg<Index>>;
+			if (!std::get<Index>(InArgs))
+				return 0;
+
+			// The attribute info comes before the stride, it's never an array
+			if constexpr (std::is_same_v<ElementType, HAPI_AttributeInfo>)
+			{
+				return sizeof(HAPI_AttributeInfo);
+			}
+			else
+			{
+				int64 NumElements = THoudiniApiOutputNumElements<Slot, Index>::Get(InArgs);
+				if (NumElements >= 0)
+					return NumElements * (int64)sizeof(ElementType);
+
+				NumElements = 1;
+				if (GetLength<Index + 1>(InArgs, NumElements))
+				{
+					NumElements = FMath::Max<int64>(NumElements, 0);
+					if (bInAttributeData)
+						NumElements *= GetAttributeValuesPerElement(InArgs);
+				}
+
+				return NumElements * (int64)sizeof(ElementType);
+			}
+		}
+
+		template<size_t Index = 0>
+		static uint32 HashInputs(const FTuple& InArgs, uint32 InHash = 0)
+		{
+			if constexpr (Index < NumArgs)
+			{
+				using ArgType = TArg<Index>;
+				if constexpr (std::is_arithmetic_v<ArgType> || std::is_enum_v<ArgType>)
+				{
+					const ArgType& Arg = std::get<Index>(InArgs);
+					InHash = FCrc::MemCrc32(&Arg, sizeof(ArgType), InHash);
+				}
+				else if constexpr (std::is_same_v<ArgType, const char*>)
+				{
+					if (const char* Arg = std::get<Index>(InArgs))
+						InHash = FCrc::MemCrc32(Arg, (int32)strlen(Arg), InHash);
+				}
+
+				return HashInputs<Index + 1>(InArgs, InHash);
+			}
+			else
+			{
+				return InHash;
+			}
+		}
+
+		template<size_t Index = 0>
+		static void SaveOutputs(const FTuple& InArgs, bool bInAttributeData, FHoudiniApiRecordedCall& OutCall)
+		{
+			if constexpr (Index < NumArgs)
+			{
+				if constexpr (IsOutput<Index>())
+				{
+					const int64 Size = GetOutputSize<Index>(InArgs, bInAttributeData);
+					OutCall.OutputSizes.Add(Size);
+					if (Size > 0)
+						OutCall.OutputData.Append((const uint8*)std::get<Index>(InArgs), Size);
+				}
+
+				SaveOutputs<Index + 1>(InArgs, bInAttributeData, OutCall);
+			}
+		}
+
+		template<size_t Index = 0>
+		static void LoadOutputs(const FTuple& InArgs, bool bInAttributeData, const FHoudiniApiRecordedCall& InCall, int32 InOutputIndex = 0, int64 InOffset = 0)
+		{
+			if constexpr (Index < NumArgs)
+			{
+				if constexpr (IsOutput<Index>())
+				{
+					if (InCall.OutputSizes.IsValidIndex(InOutputIndex))
+					{
+						// Never write more than the arguments say the output can hold
+						const int64 RecordedSize = InCall.OutputSizes[InOutputIndex];
+						const int64 Size = FMath::Min(RecordedSize, GetOutputSize<Index>(InArgs, bInAttributeData));
+						if (Size > 0 && InOffset + RecordedSize <= InCall.OutputData.Num())
+							FMemory::Memcpy(std::get<Index>(InArgs), InCall.OutputData.GetData() + InOffset, Size);
+
+						InOffset += RecordedSize;
+					}
+
+					InOutputIndex++;
+				}
+
+				LoadOutputs<Index + 1>(InArgs, bInAttributeData, InCall, InOutputIndex, InOffset);
+			}
+		}
+	};
+
+	// Function index, input hash
+	using FHoudiniApiReplayKey = TPair<int32, uint32>;
+
+	// Recorded calls matching an input, in order
+	struct FHoudiniApiReplayQueue
+	{
+		TArray<int32> Calls;
+		int32 Next = 0;
+	};
+
+	FCriticalSection RecorderLock;
+	TArray<FHoudiniApiRecordedCall> RecordedCalls;
+	TMap<FHoudiniApiReplayKey, FHoudiniApiReplayQueue> ReplayQueues;
+	TSet<int32> MissedFunctions;
+
+	std::atomic<bool> bRecording(false);
+	std::atomic<bool> bReplaying(false);
+	std::atomic<int32> NumReplayMisses(0);
+
+	void AddRecordedCall(FHoudiniApiRecordedCall&& InCall)
+	{
+		FScopeLock ScopeLock(&RecorderLock);
+		RecordedCalls.Add(MoveTemp(InCall));
+	}
+
+	const TCHAR* GetRecordedFunctionName(int32 InFunctionIndex);
+
+	// The recorded calls are not modified while replaying, the returned call stays valid until the replay stops
+	const FHoudiniApiRecordedCall* FindReplayedCall(int32 InFunctionIndex, uint32 InInputHash)
+	{
+		FScopeLock ScopeLock(&RecorderLock);
+		FHoudiniApiReplayQueue* Queue = ReplayQueues.Find(FHoudiniApiReplayKey(InFunctionIndex, InInputHash));
+		if (!Queue || Queue->Calls.Num() <= 0)
+		{
+			NumReplayMisses++;
+			bool bAlreadyMissed = false;
+			MissedFunctions.Add(InFunctionIndex, &bAlreadyMissed);
+			if (!bAlreadyMissed)
+				HOUDINI_LOG_WARNING(TEXT("HAPI replay: %s was called with arguments that were not recorded."), GetRecordedFunctionName(InFunctionIndex));
+
+			return nullptr;
+		}
+
+		// Serve the last call again once they have all been served: polling functions (GetStatus...) can be
+		// called more often than during the recording
+		const int32 CallIndex = Queue->Calls[FMath::Min(Queue->Next, Queue->Calls.Num() - 1)];
+		Queue->Next++;
+		return &RecordedCalls[CallIndex];
+	}
+
+	// Wrapper installed in place of a FHoudiniApi function, which records the calls or replays them
+	template<auto* Slot, typename FuncPtrType = std::remove_pointer_t<decltype(Slot)>>
+	struct THoudiniApiRecordedFunction;
+
+	template<auto* Slot, typename... ArgTypes>
+	struct THoudiniApiRecordedFunction<Slot, HAPI_Result(*)(ArgTypes...)>
+	{
+		using FFuncPtr = HAPI_Result(*)(ArgTypes...);
+		using FArguments = THoudiniApiCallArguments<Slot, ArgTypes...>;
+
+		static inline FFuncPtr Original = nullptr;
+		static inline int32 FunctionIndex = INDEX_NONE;
+		static inline bool bAttributeData = false;
+
+		static HAPI_Result Record(ArgTypes... InArgs)
+		{
+			const HAPI_Result Result = Original(InArgs...);
+
+			const typename FArguments::FTuple Args(InArgs...);
+			FHoudiniApiRecordedCall Call;
+			Call.FunctionIndex = FunctionIndex;
+			Call.InputHash = FArguments::HashInputs(Args);
+			Call.Result = (int32)Result;
+			FArguments::SaveOutputs(Args, bAttributeData, Call);
+
+			AddRecordedCall(MoveTemp(Call));
+			return Result;
+		}
+
+		static HAPI_Result Replay(ArgTypes... InArgs)
+		{
+			const typename FArguments::FTuple Args(InArgs...);
+			const FHoudiniApiRecordedCall* Call = FindReplayedCall(FunctionIndex, FArguments::HashInputs(Args));
+			if (!Call)
+				return HAPI_RESULT_FAILURE;
+
+			FArguments::LoadOutputs(Args, bAttributeData, *Call);
+			return (HAPI_Result)Call->Result;
+		}
+
+		static void Install(int32 InFunctionIndex, bool bInAttributeData, bool bInReplay)
+		{
+			if (*Slot == &Record || *Slot == &Replay)
+				return;
+
+			Original = *Slot;
+			FunctionIndex = InFunctionIndex;
+			bAttributeData = bInAttributeData;
+			*Slot = bInReplay ? &Replay : &Record;
+		}
+
+		static void Uninstall()
+		{
+			// Leave the function alone if it has been replaced since
+			if (*Slot == &Record || *Slot == &Replay)
+				*Slot = Original;
+		}
+	};
+
+	struct FHoudiniApiRecordedFunctionEntry
+	{
+		const TCHAR* Name;
+		void (*Install)(int32, bool, bool);
+		void (*Uninstall)();
+	};
+
+	const FHoudiniApiRecordedFunctionEntry RecordedFunctions[] =
+	{
+#define HOUDINI_API_RESULT_FUNCTION(FunctionName) \
+		{ TEXT(#FunctionName), &THoudiniApiRecordedFunction<&FHoudiniApi::FunctionName>::Install, &THoudiniApiRecordedFunction<&FHoudiniApi::FunctionName>::Uninstall },
+#include "HoudiniApiFunctionList.inl"
+#undef HOUDINI_API_RESULT_FUNCTION
+	};
+
+	const TCHAR* GetRecordedFunctionName(int32 InFunctionIndex)
+	{
+		return InFunctionIndex >= 0 && InFunctionIndex < (int32)UE_ARRAY_COUNT(RecordedFunctions)
+			? RecordedFunctions[InFunctionIndex].Name : TEXT("Unknown function");
+	}
+
+	// GetAttributeFloatData, GetAttributeStringData... fill length * tuple size values.
+	// The array variants are given the full size of their data.
+	bool IsAttributeDataFunction(const FString& InName)
+	{
+		return InName.StartsWith(TEXT("GetAttribute")) && InName.EndsWith(TEXT("Data")) && !InName.Contains(TEXT("ArrayData"));
+	}
+
+	void InstallRecordedFunctions(bool bInReplay)
+	{
+		for (int32 Idx = 0; Idx < (int32)UE_ARRAY_COUNT(RecordedFunctions); ++Idx)
+			RecordedFunctions[Idx].Install(Idx, IsAttributeDataFunction(RecordedFunctions[Idx].Name), bInReplay);
+	}
+
+	void UninstallRecordedFunctions()
+	{
+		for (const FHoudiniApiRecordedFunctionEntry& Function : RecordedFunctions)
+			Function.Uninstall();
+	}
+
+	constexpr uint32 RecordingMagic = 0x43455248; // "HREC"
+	constexpr int32 RecordingVersion = 1;
+
+	void HandleRecordHAPICommand(const TArray<FString>& InArgs)
+	{
+		const FString Command = InArgs.Num() > 0 ? InArgs[0] : FString();
+		if (Command.Equals(TEXT("Start"), ESearchCase::IgnoreCase))
+		{
+			FHoudiniApiRecorder::StartRecording();
+			HOUDINI_LOG_MESSAGE(TEXT("Started recording HAPI calls."));
+		}
+		else if (Command.Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+		{
+			const FString FilePath = InArgs.Num() > 1 ? InArgs[1] : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"),
+				FString::Printf(TEXT("HAPIRecording-%s.hapirec"), *FDateTime::Now().ToString()));
+			if (FHoudiniApiRecorder::StopRecording(FilePath))
+				HOUDINI_LOG_MESSAGE(TEXT("Saved the recorded HAPI calls to %s."), *FilePath);
+		}
+		else if (Command.Equals(TEXT("Replay"), ESearchCase::IgnoreCase) && InArgs.Num() > 1)
+		{
+			if (FHoudiniApiRecorder::StartReplay(InArgs[1]))
+				HOUDINI_LOG_MESSAGE(TEXT("Replaying %d HAPI calls from %s."), FHoudiniApiRecorder::GetNumCalls(), *InArgs[1]);
+		}
+		else if (Command.Equals(TEXT("StopReplay"), ESearchCase::IgnoreCase))
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Stopped replaying HAPI calls, %d calls were not found in the recording."), FHoudiniApiRecorder::GetNumReplayMisses());
+			FHoudiniApiRecorder::StopReplay();
+		}
+		else
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Usage: HoudiniEngine.RecordHAPI Start|Stop [FilePath]|Replay FilePath|StopReplay"));
+		}
+	}
+
+	FAutoConsoleCommand CCmdRecordHAPI(
+		TEXT("HoudiniEngine.RecordHAPI"),
+		TEXT("Records the HAPI calls made by Houdini Engine, or replays them without Houdini.\n")
+		TEXT("Start: start recording the HAPI calls\n")
+		TEXT("Stop [FilePath]: stop recording and save the calls (to Saved/HoudiniEngine if no path is given)\n")
+		TEXT("Replay FilePath: serve the HAPI calls from a recording\n")
+		TEXT("StopReplay: restore the HAPI functions"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleRecordHAPICommand));
+}
+
+void
+FHoudiniApiRecorder::StartRecording()
+{
+	StopReplay();
+
+	FScopeLock ScopeLock(&RecorderLock);
+	RecordedCalls.Empty();
+	InstallRecordedFunctions(false);
+	bRecording = true;
+}
+
+void
+FHoudiniApiRecorder::StopRecording(TArray<uint8>& OutRecording)
+{
+	FScopeLock ScopeLock(&RecorderLock);
+	if (bRecording)
+	{
+		UninstallRecordedFunctions();
+		bRecording = false;
+	}
+
+	OutRecording.Empty();
+	FMemoryWriter Writer(OutRecording);
+
+	uint32 Magic = RecordingMagic;
+	int32 Version = RecordingVersion;
+	Writer << Magic << Version;
+
+	// Calls refer to functions by name, so that recordings survive changes to the function table
+	TArray<FString> FunctionNames;
+	for (const FHoudiniApiRecordedFunctionEntry& Function : RecordedFunctions)
+		FunctionNames.Add(Function.Name);
+	Writer << FunctionNames;
+
+	Writer << RecordedCalls;
+	RecordedCalls.Empty();
+}
+
+bool
+FHoudiniApiRecorder::StopRecording(const FString& InFilePath)
+{
+	TArray<uint8> Recording;
+	StopRecording(Recording);
+
+	if (!FFileHelper::SaveArrayToFile(Recording, *InFilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to save the recorded HAPI calls to %s."), *InFilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniApiRecorder::IsRecording()
+{
+	return bRecording;
+}
+
+bool
+FHoudiniApiRecorder::StartReplay(const TArray<uint8>& InRecording)
+{
+	if (bRecording)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Cannot replay HAPI calls while recording them."));
+		return false;
+	}
+
+	StopReplay();
+
+	FMemoryReader Reader(InRecording);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != RecordingMagic || Version != RecordingVersion)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Invalid HAPI recording."));
+		return false;
+	}
+
+	TArray<FString> FunctionNames;
+	TArray<FHoudiniApiRecordedCall> Calls;
+	Reader << FunctionNames;
+	Reader << Calls;
+	if (Reader.IsError())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Invalid HAPI recording."));
+		return false;
+	}
+
+	// Map the recorded functions to the current table
+	TMap<FString, int32> FunctionIndices;
+	for (int32 Idx = 0; Idx < (int32)UE_ARRAY_COUNT(RecordedFunctions); ++Idx)
+		FunctionIndices.Add(RecordedFunctions[Idx].Name, Idx);
+
+	FScopeLock ScopeLock(&RecorderLock);
+	RecordedCalls.Empty(Calls.Num());
+	ReplayQueues.Empty();
+	MissedFunctions.Empty();
+	NumReplayMisses = 0;
+	for (FHoudiniApiRecordedCall& Call : Calls)
+	{
+		const int32* FunctionIndex = FunctionNames.IsValidIndex(Call.FunctionIndex)
+			? FunctionIndices.Find(FunctionNames[Call.FunctionIndex]) : nullptr;
+		if (!FunctionIndex)
+			continue;
+
+		Call.FunctionIndex = *FunctionIndex;
+		ReplayQueues.FindOrAdd(FHoudiniApiReplayKey(Call.FunctionIndex, Call.InputHash)).Calls.Add(RecordedCalls.Num());
+		RecordedCalls.Add(MoveTemp(Call));
+	}
+
+	InstallRecordedFunctions(true);
+	bReplaying = true;
+	return true;
+}
+
+bool
+FHoudiniApiRecorder::StartReplay(const FString& InFilePath)
+{
+	TArray<uint8> Recording;
+	if (!FFileHelper::LoadFileToArray(Recording, *InFilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to load the HAPI recording %s."), *InFilePath);
+		return false;
+	}
+
+	return StartReplay(Recording);
+}
+
+void
+FHoudiniApiRecorder::StopReplay()
+{
+	FScopeLock ScopeLock(&RecorderLock);
+	if (!bReplaying)
+		return;
+
+	UninstallRecordedFunctions();
+	RecordedCalls.Empty();
+	ReplayQueues.Empty();
+	bReplaying = false;
+}
+
+bool
+FHoudiniApiRecorder::IsReplaying()
+{
+	return bReplaying;
+}
+
+int32
+FHoudiniApiRecorder::GetNumCalls()
+{
+	FScopeLock ScopeLock(&RecorderLock);
+	return RecordedCalls.Num();
+}
+
+int32
+FHoudiniApiRecorder::GetNumReplayMisses()
+{
+	return NumReplayMisses;
+}
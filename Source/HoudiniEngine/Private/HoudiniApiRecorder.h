@@ -0,0 +1,67 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Records the HAPI calls made through FHoudiniApi with the data they returned, and replays them without Houdini.
+//
+// While recording, every HAPI_Result function of the FHoudiniApi table is wrapped: each call is forwarded to
+// the original function, then its result and the content of its output arguments are stored. Outputs are the
+// non-const pointer arguments; their size is given by the int arguments that directly follow them (the
+// length of HAPI's Start/Length style arrays), or is a single element. Attribute data also accounts for the
+// stride and tuple size of the attribute. Outputs that don't follow these rules (matrices, arrays followed by
+// another array) have their size given per function by THoudiniApiOutputNumElements.
+//
+// While replaying, the FHoudiniApi functions are replaced by ones serving the recorded calls: a call is matched
+// on its function and its value and string arguments, in the order they were recorded, and gets the recorded
+// outputs and result. Once the calls matching an input have all been served, the last one is served again.
+// Calls that were never recorded fail.
+//
+// Also available through the "HoudiniEngine.RecordHAPI" console command.
+struct HOUDINIENGINE_API FHoudiniApiRecorder
+{
+	// Starts recording the calls made through FHoudiniApi. Drops the calls recorded previously.
+	static void StartRecording();
+	// Stops recording and returns the recorded calls.
+	static void StopRecording(TArray<uint8>& OutRecording);
+	// Stops recording and writes the recorded calls to a file.
+	static bool StopRecording(const FString& InFilePath);
+	static bool IsRecording();
+
+	// Replaces the FHoudiniApi functions with the recorded calls.
+	static bool StartReplay(const TArray<uint8>& InRecording);
+	static bool StartReplay(const FString& InFilePath);
+	// Restores the FHoudiniApi functions.
+	static void StopReplay();
+	static bool IsReplaying();
+
+	// Number of calls recorded, or available for replay
+	static int32 GetNumCalls();
+	// Number of calls that could not be found in the recording since the replay started
+	static int32 GetNumReplayMisses();
+};
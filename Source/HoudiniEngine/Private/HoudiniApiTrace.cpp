@@ -0,0 +1,476 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApiTrace.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include <atomic>
+#include <type_traits>
+
+namespace
+{
+	struct FHoudiniApiTraceRecord
+	{
+		int64 NumCalls = 0;
+		int64 NumFailures = 0;
+		uint64 TotalCycles = 0;
+		uint64 MaxCycles = 0;
+		int64 PayloadBytes = 0;
+		int64 LatencyHistogram[FHoudiniApiCallStats::NumLatencyBuckets] = {};
+	};
+
+	// Function index, session id, context index
+	using FHoudiniApiTraceRecordKey = TTuple<int32, int64, int32>;
+
+	FCriticalSection TraceLock;
+	TMap<FHoudiniApiTraceRecordKey, FHoudiniApiTraceRecord> TraceRecords;
+	TArray<FString> TraceContexts;
+	TMap<FString, int32> TraceContextIndices;
+
+	std::atomic<bool> bTracing(false);
+
+	// Context set on the game thread, used by the threads that did not set their own
+	std::atomic<int32> GlobalTraceContextIndex(INDEX_NONE);
+	thread_local int32 ThreadTraceContextIndex = INDEX_NONE;
+
+	// Extracts the session and estimates the payload of a HAPI call from its arguments.
+	// HAPI functions transferring arrays end with the array's length, so the payload is estimated as that length
+	// times the size of the last numeric array argument, times the tuple size of the attribute info if there is one.
+	struct FHoudiniApiCallArguments
+	{
+		int64 SessionId = -1;
+		int64 ElementSize = 0;
+		int64 TupleSize = 1;
+		int64 LastLength = 0;
+		bool bEndsWithLength = false;
+
+		template<typename ArgType>
+		void Visit(ArgType InArg)
+		{
+			bEndsWithLength = false;
+			if constexpr (std::is_pointer_v<ArgType>)
+			{
+				using ElementType = std::remove_cv_t<std::remove_pointer_t<ArgType>>;
+				if constexpr (std::is_same_v<ElementType, HAPI_Session>)
+				{
+					if (InArg && SessionId < 0)
+						SessionId = InArg->id;
+				}
+				else if constexpr (std::is_same_v<ElementType, HAPI_AttributeInfo>)
+				{
+					if (InArg)
+						TupleSize = FMath::Max(InArg->tupleSize, 1);
+				}
+				else if constexpr (std::is_arithmetic_v<ElementType>)
+				{
+					ElementSize = sizeof(ElementType);
+				}
+			}
+			else if constexpr (std::is_same_v<ArgType, int>)
+			{
+				LastLength = InArg;
+				bEndsWithLength = true;
+			}
+		}
+
+		int64 GetPayloadBytes() const
+		{
+			return bEndsWithLength ? FMath::Max<int64>(LastLength, 0) * ElementSize * TupleSize : 0;
+		}
+	};
+
+	// Wrapper installed in place of a FHoudiniApi function, which forwards the call to the original function and records it
+	template<auto* Slot, typename FuncPtrType = std::remove_pointer_t<decltype(Slot)>>
+	struct THoudiniApiTracedFunction;
+
+	template<auto* Slot, typename... ArgTypes>
+	struct THoudiniApiTracedFunction<Slot, HAPI_Result(*)(ArgTypes...)>
+	{
+		using FFuncPtr = HAPI_Result(*)(ArgTypes...);
+
+		static inline FFuncPtr Original = nullptr;
+		static inline int32 FunctionIndex = INDEX_NONE;
+
+		static HAPI_Result Call(ArgTypes... InArgs)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const HAPI_Result Result = Original(InArgs...);
+			const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+			FHoudiniApiCallArguments Arguments;
+			(Arguments.Visit(InArgs), ...);
+
+			FHoudiniApiTrace::RecordCall(FunctionIndex, Arguments.SessionId, Cycles, Arguments.GetPayloadBytes(), Result == HAPI_RESULT_SUCCESS);
+			return Result;
+		}
+
+		static void Install(int32 InFunctionIndex)
+		{
+			if (*Slot == &Call)
+				return;
+
+			Original = *Slot;
+			FunctionIndex = InFunctionIndex;
+			*Slot = &Call;
+		}
+
+		static void Uninstall()
+		{
+			// Leave the function alone if it has been replaced since
+			if (*Slot == &Call)
+				*Slot = Original;
+		}
+	};
+
+	struct FHoudiniApiTracedFunctionEntry
+	{
+		const TCHAR* Name;
+		void (*Install)(int32);
+		void (*Uninstall)();
+	};
+
+#define HOUDINI_API_TRACED_FUNCTION(FunctionName) \
+	{ TEXT(#FunctionName), &THoudiniApiTracedFunction<&FHoudiniApi::FunctionName>::Install, &THoudiniApiTracedFunction<&FHoudiniApi::FunctionName>::Uninstall }
+
+	// All the FHoudiniApi functions returning a HAPI_Result
+	const FHoudiniApiTracedFunctionEntry TracedFunctions[] =
+	{
+#define HOUDINI_API_RESULT_FUNCTION(FunctionName) HOUDINI_API_TRACED_FUNCTION(FunctionName),
+#include "HoudiniApiFunctionList.inl"
+#undef HOUDINI_API_RESULT_FUNCTION
+	};
+
+#undef HOUDINI_API_TRACED_FUNCTION
+
+	int32 GetLatencyBucket(double InSeconds)
+	{
+		const double Microseconds = InSeconds * 1000000.0;
+		if (Microseconds < 1.0)
+			return 0;
+
+		const int32 Bucket = (int32)FMath::FloorLog2_64((uint64)Microseconds) + 1;
+		return FMath::Min(Bucket, FHoudiniApiCallStats::NumLatencyBuckets - 1);
+	}
+
+	FString GetLatencyBucketName(int32 InBucket)
+	{
+		if (InBucket < FHoudiniApiCallStats::NumLatencyBuckets - 1)
+			return FString::Printf(TEXT("<%.0fus"), FHoudiniApiCallStats::GetLatencyBucketLimit(InBucket));
+
+		return FString::Printf(TEXT(">=%.0fus"), FHoudiniApiCallStats::GetLatencyBucketLimit(InBucket - 1));
+	}
+
+	void HandleTraceHAPICommand(const TArray<FString>& InArgs)
+	{
+		const FString Command = InArgs.Num() > 0 ? InArgs[0] : FString();
+		if (Command.Equals(TEXT("Start"), ESearchCase::IgnoreCase))
+		{
+			FHoudiniApiTrace::Start();
+			HOUDINI_LOG_MESSAGE(TEXT("Started tracing HAPI calls."));
+		}
+		else if (Command.Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+		{
+			FHoudiniApiTrace::Stop();
+			HOUDINI_LOG_MESSAGE(TEXT("Stopped tracing HAPI calls."));
+		}
+		else if (Command.Equals(TEXT("Reset"), ESearchCase::IgnoreCase))
+		{
+			FHoudiniApiTrace::Reset();
+		}
+		else if (Command.Equals(TEXT("Print"), ESearchCase::IgnoreCase))
+		{
+			const int32 MaxLines = InArgs.Num() > 1 ? FCString::Atoi(*InArgs[1]) : 20;
+			const TArray<FHoudiniApiCallStats> Stats = FHoudiniApiTrace::GetStats();
+			for (int32 Idx = 0; Idx < Stats.Num() && Idx < MaxLines; ++Idx)
+			{
+				const FHoudiniApiCallStats& Stat = Stats[Idx];
+				HOUDINI_LOG_MESSAGE(TEXT("%s (session %lld%s%s): %lld calls, %lld failed, %.3fms total, %.1fus max, %lld bytes"),
+					*Stat.FunctionName, Stat.SessionId, Stat.Context.IsEmpty() ? TEXT("") : TEXT(", "), *Stat.Context,
+					Stat.NumCalls, Stat.NumFailures, Stat.TotalSeconds * 1000.0, Stat.MaxSeconds * 1000000.0, Stat.PayloadBytes);
+			}
+		}
+		else if (Command.Equals(TEXT("Dump"), ESearchCase::IgnoreCase))
+		{
+			if (InArgs.Num() > 1)
+			{
+				FHoudiniApiTrace::DumpToFile(InArgs[1]);
+			}
+			else
+			{
+				// Dump both formats to the saved folder
+				const FString BasePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"),
+					FString::Printf(TEXT("HAPITrace-%s"), *FDateTime::Now().ToString()));
+				FHoudiniApiTrace::DumpToFile(BasePath + TEXT(".csv"));
+				FHoudiniApiTrace::DumpToFile(BasePath + TEXT(".json"));
+			}
+		}
+		else
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Usage: HoudiniEngine.TraceHAPI Start|Stop|Reset|Print [NumLines]|Dump [FilePath]"));
+		}
+	}
+
+	FAutoConsoleCommand CCmdTraceHAPI(
+		TEXT("HoudiniEngine.TraceHAPI"),
+		TEXT("Traces the HAPI calls made by Houdini Engine.\n")
+		TEXT("Start: start recording the HAPI calls\n")
+		TEXT("Stop: stop recording the HAPI calls\n")
+		TEXT("Reset: clear the recorded calls\n")
+		TEXT("Print [NumLines]: log the most expensive functions\n")
+		TEXT("Dump [FilePath]: write the recorded calls to a .csv or .json file (both in Saved/HoudiniEngine if no path is given)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleTraceHAPICommand));
+}
+
+double
+FHoudiniApiCallStats::GetLatencyBucketLimit(int32 InBucket)
+{
+	if (InBucket >= NumLatencyBuckets - 1)
+		return TNumericLimits<double>::Max();
+
+	return (double)(1ull << InBucket);
+}
+
+void
+FHoudiniApiTrace::Start()
+{
+	FScopeLock ScopeLock(&TraceLock);
+	for (int32 Idx = 0; Idx < (int32)UE_ARRAY_COUNT(TracedFunctions); ++Idx)
+		TracedFunctions[Idx].Install(Idx);
+
+	bTracing = true;
+}
+
+void
+FHoudiniApiTrace::Stop()
+{
+	FScopeLock ScopeLock(&TraceLock);
+	for (const FHoudiniApiTracedFunctionEntry& Function : TracedFunctions)
+		Function.Uninstall();
+
+	bTracing = false;
+}
+
+bool
+FHoudiniApiTrace::IsTracing()
+{
+	return bTracing;
+}
+
+void
+FHoudiniApiTrace::Reset()
+{
+	FScopeLock ScopeLock(&TraceLock);
+	TraceRecords.Empty();
+}
+
+void
+FHoudiniApiTrace::RecordCall(int32 InFunctionIndex, int64 InSessionId, uint64 InCycles, int64 InPayloadBytes, bool bInSuccess)
+{
+	const int32 ContextIndex = ThreadTraceContextIndex != INDEX_NONE ? ThreadTraceContextIndex : GlobalTraceContextIndex.load();
+	const int32 Bucket = GetLatencyBucket(FPlatformTime::ToSeconds64(InCycles));
+
+	FScopeLock ScopeLock(&TraceLock);
+	FHoudiniApiTraceRecord& Record = TraceRecords.FindOrAdd(FHoudiniApiTraceRecordKey(InFunctionIndex, InSessionId, ContextIndex));
+	Record.NumCalls++;
+	if (!bInSuccess)
+		Record.NumFailures++;
+	Record.TotalCycles += InCycles;
+	Record.MaxCycles = FMath::Max(Record.MaxCycles, InCycles);
+	Record.PayloadBytes += InPayloadBytes;
+	Record.LatencyHistogram[Bucket]++;
+}
+
+TArray<FHoudiniApiCallStats>
+FHoudiniApiTrace::GetStats()
+{
+	TArray<FHoudiniApiCallStats> Stats;
+	{
+		FScopeLock ScopeLock(&TraceLock);
+		Stats.Reserve(TraceRecords.Num());
+		for (const TPair<FHoudiniApiTraceRecordKey, FHoudiniApiTraceRecord>& Pair : TraceRecords)
+		{
+			const FHoudiniApiTraceRecord& Record = Pair.Value;
+
+			FHoudiniApiCallStats& Stat = Stats.AddDefaulted_GetRef();
+			Stat.FunctionName = TracedFunctions[Pair.Key.Get<0>()].Name;
+			Stat.SessionId = Pair.Key.Get<1>();
+			if (TraceContexts.IsValidIndex(Pair.Key.Get<2>()))
+				Stat.Context = TraceContexts[Pair.Key.Get<2>()];
+
+			Stat.NumCalls = Record.NumCalls;
+			Stat.NumFailures = Record.NumFailures;
+			Stat.TotalSeconds = FPlatformTime::ToSeconds64(Record.TotalCycles);
+			Stat.MaxSeconds = FPlatformTime::ToSeconds64(Record.MaxCycles);
+			Stat.PayloadBytes = Record.PayloadBytes;
+			FMemory::Memcpy(Stat.LatencyHistogram, Record.LatencyHistogram, sizeof(Stat.LatencyHistogram));
+		}
+	}
+
+	Stats.Sort([](const FHoudiniApiCallStats& A, const FHoudiniApiCallStats& B) { return A.TotalSeconds > B.TotalSeconds; });
+	return Stats;
+}
+
+FString
+FHoudiniApiTrace::ToCSV(const TArray<FHoudiniApiCallStats>& InStats)
+{
+	FString CSV = TEXT("Function,Session,Context,Calls,Failures,TotalMs,AverageUs,MaxUs,PayloadBytes");
+	for (int32 Bucket = 0; Bucket < FHoudiniApiCallStats::NumLatencyBuckets; ++Bucket)
+		CSV += TEXT(",") + GetLatencyBucketName(Bucket);
+	CSV += LINE_TERMINATOR;
+
+	for (const FHoudiniApiCallStats& Stat : InStats)
+	{
+		CSV += FString::Printf(TEXT("%s,%lld,\"%s\",%lld,%lld,%.3f,%.3f,%.3f,%lld"),
+			*Stat.FunctionName, Stat.SessionId, *Stat.Context.Replace(TEXT("\""), TEXT("\"\"")),
+			Stat.NumCalls, Stat.NumFailures, Stat.TotalSeconds * 1000.0,
+			Stat.NumCalls > 0 ? Stat.TotalSeconds * 1000000.0 / Stat.NumCalls : 0.0,
+			Stat.MaxSeconds * 1000000.0, Stat.PayloadBytes);
+
+		for (int32 Bucket = 0; Bucket < FHoudiniApiCallStats::NumLatencyBuckets; ++Bucket)
+			CSV += FString::Printf(TEXT(",%lld"), Stat.LatencyHistogram[Bucket]);
+		CSV += LINE_TERMINATOR;
+	}
+
+	return CSV;
+}
+
+FString
+FHoudiniApiTrace::ToJson(const TArray<FHoudiniApiCallStats>& InStats)
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+
+	TArray<TSharedPtr<FJsonValue>> BucketNames;
+	for (int32 Bucket = 0; Bucket < FHoudiniApiCallStats::NumLatencyBuckets; ++Bucket)
+		BucketNames.Add(MakeShared<FJsonValueString>(GetLatencyBucketName(Bucket)));
+	Root->SetArrayField(TEXT("latency_buckets"), BucketNames);
+
+	TArray<TSharedPtr<FJsonValue>> Calls;
+	for (const FHoudiniApiCallStats& Stat : InStats)
+	{
+		TSharedRef<FJsonObject> Call = MakeShared<FJsonObject>();
+		Call->SetStringField(TEXT("function"), Stat.FunctionName);
+		Call->SetNumberField(TEXT("session"), (double)Stat.SessionId);
+		Call->SetStringField(TEXT("context"), Stat.Context);
+		Call->SetNumberField(TEXT("calls"), (double)Stat.NumCalls);
+		Call->SetNumberField(TEXT("failures"), (double)Stat.NumFailures);
+		Call->SetNumberField(TEXT("total_ms"), Stat.TotalSeconds * 1000.0);
+		Call->SetNumberField(TEXT("max_us"), Stat.MaxSeconds * 1000000.0);
+		Call->SetNumberField(TEXT("payload_bytes"), (double)Stat.PayloadBytes);
+
+		TArray<TSharedPtr<FJsonValue>> Histogram;
+		for (int32 Bucket = 0; Bucket < FHoudiniApiCallStats::NumLatencyBuckets; ++Bucket)
+			Histogram.Add(MakeShared<FJsonValueNumber>((double)Stat.LatencyHistogram[Bucket]));
+		Call->SetArrayField(TEXT("latency_histogram"), Histogram);
+
+		Calls.Add(MakeShared<FJsonValueObject>(Call));
+	}
+	Root->SetArrayField(TEXT("calls"), Calls);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Json;
+}
+
+bool
+FHoudiniApiTrace::DumpToFile(const FString& InFilePath)
+{
+	const TArray<FHoudiniApiCallStats> Stats = GetStats();
+	const bool bJson = FPaths::GetExtension(InFilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	if (!FFileHelper::SaveStringToFile(bJson ? ToJson(Stats) : ToCSV(Stats), *InFilePath))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Could not write the HAPI trace to %s."), *InFilePath);
+		return false;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Wrote the HAPI trace (%d entries) to %s."), Stats.Num(), *InFilePath);
+	return true;
+}
+
+int32
+FHoudiniApiTrace::GetContextIndex(const FString& InContext)
+{
+	FScopeLock ScopeLock(&TraceLock);
+	if (const int32* Found = TraceContextIndices.Find(InContext))
+		return *Found;
+
+	const int32 Index = TraceContexts.Add(InContext);
+	TraceContextIndices.Add(InContext, Index);
+	return Index;
+}
+
+FHoudiniApiTraceScope::FHoudiniApiTraceScope(const FString& InContext)
+{
+	if (FHoudiniApiTrace::IsTracing())
+		Enter(InContext);
+}
+
+FHoudiniApiTraceScope::FHoudiniApiTraceScope(const UObject* InContext)
+{
+	if (FHoudiniApiTrace::IsTracing() && IsValid(InContext))
+		Enter(InContext->GetPathName());
+}
+
+void
+FHoudiniApiTraceScope::Enter(const FString& InContext)
+{
+	const int32 ContextIndex = FHoudiniApiTrace::GetContextIndex(InContext);
+
+	bEntered = true;
+	bGlobal = IsInGameThread();
+	if (bGlobal)
+	{
+		PreviousContextIndex = GlobalTraceContextIndex.exchange(ContextIndex);
+	}
+	else
+	{
+		PreviousContextIndex = ThreadTraceContextIndex;
+		ThreadTraceContextIndex = ContextIndex;
+	}
+}
+
+FHoudiniApiTraceScope::~FHoudiniApiTraceScope()
+{
+	if (!bEntered)
+		return;
+
+	if (bGlobal)
+		GlobalTraceContextIndex = PreviousContextIndex;
+	else
+		ThreadTraceContextIndex = PreviousContextIndex;
+}
@@ -0,0 +1,111 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UObject;
+
+// Statistics of the calls made to one HAPI function, in one session, for one context (usually a Houdini Asset Component)
+struct HOUDINIENGINE_API FHoudiniApiCallStats
+{
+	// Buckets of the latency histogram: bucket 0 counts calls under 1us, bucket N calls in [2^(N-1), 2^N) us,
+	// and the last bucket all the slower calls.
+	static constexpr int32 NumLatencyBuckets = 20;
+
+	FString FunctionName;
+	// Id of the session the call was made on, -1 for functions that do not take a session
+	int64 SessionId = -1;
+	// Context the calls were made in, empty if none
+	FString Context;
+
+	int64 NumCalls = 0;
+	int64 NumFailures = 0;
+	double TotalSeconds = 0.0;
+	double MaxSeconds = 0.0;
+	// Estimated size of the arrays sent/received by the calls
+	int64 PayloadBytes = 0;
+	int64 LatencyHistogram[NumLatencyBuckets] = {};
+
+	// Returns the upper bound of a latency bucket, in microseconds (the last bucket has none)
+	static double GetLatencyBucketLimit(int32 InBucket);
+};
+
+// Opt-in instrumentation of the HAPI calls made through FHoudiniApi.
+// When started, every HAPI_Result function of the FHoudiniApi table is replaced by a wrapper that times the call
+// and records it, per function, per session and per context. Stopping restores the original functions.
+// Also available through the "HoudiniEngine.TraceHAPI" console command.
+struct HOUDINIENGINE_API FHoudiniApiTrace
+{
+	// Installs the wrappers on the functions currently in the FHoudiniApi table.
+	static void Start();
+	// Restores the functions that were wrapped. The recorded stats are kept.
+	static void Stop();
+	static bool IsTracing();
+
+	// Clears the recorded stats
+	static void Reset();
+
+	// Returns the recorded stats, sorted by decreasing total time
+	static TArray<FHoudiniApiCallStats> GetStats();
+
+	static FString ToCSV(const TArray<FHoudiniApiCallStats>& InStats);
+	static FString ToJson(const TArray<FHoudiniApiCallStats>& InStats);
+
+	// Writes the recorded stats to a file, as JSON if its extension is .json, as CSV otherwise
+	static bool DumpToFile(const FString& InFilePath);
+
+	// Adds a call to the recorded stats. Used by the wrappers.
+	static void RecordCall(int32 InFunctionIndex, int64 InSessionId, uint64 InCycles, int64 InPayloadBytes, bool bInSuccess);
+
+private:
+	friend class FHoudiniApiTraceScope;
+
+	// Returns the index of a context name, adding it if needed
+	static int32 GetContextIndex(const FString& InContext);
+};
+
+// Attributes the HAPI calls made in its scope to a context while tracing.
+// On the game thread, the context also applies to the calls made by the worker threads it dispatches work to;
+// on other threads it only applies to the calls made by that thread.
+class HOUDINIENGINE_API FHoudiniApiTraceScope
+{
+public:
+	explicit FHoudiniApiTraceScope(const FString& InContext);
+	explicit FHoudiniApiTraceScope(const UObject* InContext);
+	~FHoudiniApiTraceScope();
+
+	FHoudiniApiTraceScope(const FHoudiniApiTraceScope&) = delete;
+	FHoudiniApiTraceScope& operator=(const FHoudiniApiTraceScope&) = delete;
+
+private:
+	void Enter(const FString& InContext);
+
+	bool bEntered = false;
+	bool bGlobal = false;
+	int32 PreviousContextIndex = INDEX_NONE;
+};
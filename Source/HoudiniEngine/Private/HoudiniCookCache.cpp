@@ -0,0 +1,847 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniCookCache.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniHashUtils.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+#include "HoudiniOutput.h"
+#include "HoudiniParameter.h"
+#include "HoudiniParameterFile.h"
+#include "HoudiniParameterString.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectHash.h"
+
+namespace
+{
+	// Changes to what the keys hash, or to what is cached, must bump this so that older entries are never matched
+	constexpr uint64 CookCacheVersion = 3;
+
+	uint64 HashTransform(uint64 Hash, const FTransform& InTransform)
+	{
+		const FVector Location = InTransform.GetLocation();
+		const FQuat Rotation = InTransform.GetRotation();
+		const FVector Scale = InTransform.GetScale3D();
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &Location, sizeof(Location));
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &Rotation, sizeof(Rotation));
+		return FHoudiniHashUtils::HashBytes(Hash, &Scale, sizeof(Scale));
+	}
+
+	// Hashes a file's path, size and timestamp. Returns false if it does not exist.
+	bool HashFile(uint64& Hash, const FString& InFileName)
+	{
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*InFileName);
+		if (!StatData.bIsValid || StatData.bIsDirectory)
+			return false;
+
+		const int64 Ticks = StatData.ModificationTime.GetTicks();
+		Hash = FHoudiniHashUtils::HashString(Hash, FPaths::ConvertRelativePathToFull(InFileName).ToLower());
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &StatData.FileSize, sizeof(StatData.FileSize));
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &Ticks, sizeof(Ticks));
+		return true;
+	}
+
+	// Hashes the saved state of a package. Returns false if it has never been saved, or has unsaved changes.
+	bool HashSavedPackage(uint64& Hash, const FString& InPackageName)
+	{
+		const UPackage* Package = FindPackage(nullptr, *InPackageName);
+		if (Package && (Package->IsDirty() || Package->HasAnyFlags(RF_Transient)))
+			return false;
+
+		FString FileName;
+		if (!FPackageName::DoesPackageExist(InPackageName, &FileName))
+			return false;
+
+		return HashFile(Hash, FileName);
+	}
+
+	// Hashes the values of the parameters, then the content of the files and assets they refer to.
+	// Returns false if a parameter's value cannot be fingerprinted.
+	bool HashParameters(uint64& Hash, const TArray<UHoudiniParameter*>& InParameters)
+	{
+		Hash = FHoudiniHashUtils::HashParameterValues(Hash, InParameters);
+
+		for (UHoudiniParameter* Parameter : InParameters)
+		{
+			if (UHoudiniParameterString* StringParameter = Cast<UHoudiniParameterString>(Parameter))
+			{
+				// Asset references are uploaded as the asset's data, which must not have changed either
+				if (StringParameter->GetParameterType() != EHoudiniParameterType::StringAssetRef)
+					continue;
+
+				for (int32 Idx = 0; Idx < StringParameter->GetNumberOfValues(); ++Idx)
+				{
+					const FString Value = StringParameter->GetValueAt(Idx);
+					if (!Value.IsEmpty() && !HashSavedPackage(Hash, FPackageName::ObjectPathToPackageName(Value)))
+						return false;
+				}
+			}
+			else if (UHoudiniParameterFile* FileParameter = Cast<UHoudiniParameterFile>(Parameter))
+			{
+				// Files we can't stat (missing files, paths only Houdini can expand like $HIP/...) could change unnoticed
+				for (int32 Idx = 0; Idx < FileParameter->GetNumValues(); ++Idx)
+				{
+					const FString Value = FileParameter->GetValueAt(Idx);
+					if (!Value.IsEmpty() && !HashFile(Hash, Value))
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	// Hashes the inputs' objects and settings. Only geometry inputs made of saved assets can be fingerprinted:
+	// curves and world inputs depend on the level's content.
+	bool HashInputs(uint64& Hash, const TArray<UHoudiniInput*>& InInputs)
+	{
+		for (const UHoudiniInput* Input : InInputs)
+		{
+			if (!IsValid(Input))
+				continue;
+
+			const EHoudiniInputType Type = Input->GetInputType();
+			Hash = FHoudiniHashUtils::HashString(Hash, Input->GetInputName());
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Type, sizeof(Type));
+
+			const TArray<UHoudiniInputObject*>* InputObjects = Input->GetHoudiniInputObjectArray(Type);
+			if (!InputObjects || InputObjects->Num() == 0)
+				continue;
+
+			if (Type != EHoudiniInputType::Geometry)
+				return false;
+
+			const bool Settings[] = {
+				Input->GetKeepWorldTransform(),
+				Input->GetPackBeforeMerge(),
+				Input->GetImportAsReference(),
+				Input->GetImportAsReferenceRotScaleEnabled(),
+				Input->GetImportAsReferenceBboxEnabled(),
+				Input->GetImportAsReferenceMaterialEnabled(),
+				Input->GetExportLODs(),
+				Input->GetExportSockets(),
+				Input->GetPreferNaniteFallbackMesh(),
+				Input->GetExportColliders(),
+				Input->GetExportMaterialParameters() };
+			Hash = FHoudiniHashUtils::HashBytes(Hash, Settings, sizeof(Settings));
+
+			for (const UHoudiniInputObject* InputObject : *InputObjects)
+			{
+				if (!IsValid(InputObject))
+					continue;
+
+				UObject* Object = InputObject->GetObject();
+				if (!IsValid(Object))
+					return false;
+
+				switch (UHoudiniInputObject::GetInputObjectTypeFromObject(Object))
+				{
+					case EHoudiniInputObjectType::StaticMesh:
+					case EHoudiniInputObjectType::SkeletalMesh:
+					case EHoudiniInputObjectType::DataTable:
+					case EHoudiniInputObjectType::FoliageType_InstancedStaticMesh:
+					case EHoudiniInputObjectType::GeometryCollection:
+					case EHoudiniInputObjectType::Animation:
+					case EHoudiniInputObjectType::Blueprint:
+						break;
+
+					default:
+						return false;
+				}
+
+				Hash = FHoudiniHashUtils::HashString(Hash, Object->GetPathName());
+				if (!HashSavedPackage(Hash, Object->GetPackage()->GetName()))
+					return false;
+
+				Hash = HashTransform(Hash, InputObject->GetTransform());
+			}
+		}
+
+		return true;
+	}
+
+	// Hashes the global settings used to translate the cooked geometry, and to marshall the inputs
+	uint64 HashRuntimeSettings(uint64 Hash)
+	{
+#if WITH_EDITOR
+		static const TSet<FString> HashedCategories = {
+			TEXT("GeometryMarshalling"),
+			TEXT("GeneratedStaticMeshSettings"),
+			TEXT("HoudiniMeshGeneration | StaticMeshGeneration"),
+			TEXT("Static Mesh"),
+			TEXT("StaticMeshBuildSettings") };
+
+		const UHoudiniRuntimeSettings* Settings = GetDefault<UHoudiniRuntimeSettings>();
+		for (TFieldIterator<FProperty> It(Settings->GetClass()); It; ++It)
+		{
+			if (!HashedCategories.Contains(It->GetMetaData(TEXT("Category"))))
+				continue;
+
+			FString Value;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 1
+			It->ExportTextItem(Value, It->ContainerPtrToValuePtr<void>(Settings), nullptr, nullptr, PPF_None);
+#else
+			It->ExportTextItem_InContainer(Value, Settings, nullptr, nullptr, PPF_None);
+#endif
+			Hash = FHoudiniHashUtils::HashString(Hash, It->GetName());
+			Hash = FHoudiniHashUtils::HashString(Hash, Value);
+		}
+#endif
+		return Hash;
+	}
+
+	// Only static mesh outputs are cached: their meshes are restored in place, in the components created by the cook.
+	// The key doesn't capture the materials generated by the cook or the overrides the cook applied to the components,
+	// so outputs that have any are not cached.
+	bool IsCacheableOutput(const UHoudiniOutput* Output)
+	{
+		if (!IsValid(Output) || Output->GetType() != EHoudiniOutputType::Mesh)
+			return false;
+
+		UHoudiniOutput* MutableOutput = const_cast<UHoudiniOutput*>(Output);
+		if (MutableOutput->GetAssignementMaterials().Num() > 0 || MutableOutput->GetReplacementMaterials().Num() > 0)
+			return false;
+
+		for (const FHoudiniGeoPartObject& HGPO : Output->GetHoudiniGeoPartObjects())
+		{
+			if (HGPO.GenericPropertyAttributes.Num() > 0)
+				return false;
+		}
+
+		for (const auto& OutputObjectPair : Output->GetOutputObjects())
+		{
+			const FHoudiniOutputObject& OutputObject = OutputObjectPair.Value;
+			if (OutputObject.bProxyIsCurrent || !IsValid(Cast<UStaticMesh>(OutputObject.OutputObject)))
+				return false;
+
+			for (UObject* Component : OutputObject.OutputComponents)
+			{
+				const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component);
+				if (!IsValid(StaticMeshComponent) || StaticMeshComponent->OverrideMaterials.Num() > 0)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	struct FCookCacheObject
+	{
+		// The identifier's object and geo ids are node ids, which differ between sessions
+		int32 PartId = -1;
+		FString SplitIdentifier;
+		FString PartName;
+		FString MeshPath;
+
+		bool Matches(const FHoudiniOutputObjectIdentifier& InIdentifier) const
+		{
+			return InIdentifier.PartId == PartId && InIdentifier.SplitIdentifier == SplitIdentifier && InIdentifier.PartName == PartName;
+		}
+	};
+
+	struct FCookCacheEntry
+	{
+		FDateTime LastUsed;
+		int64 SizeBytes = 0;
+		// The cached objects of each of the HAC's outputs
+		TArray<TArray<FCookCacheObject>> Outputs;
+	};
+
+	struct FCookCacheState
+	{
+		// Entries by key, as hexadecimal strings
+		TMap<FString, FCookCacheEntry> Entries;
+		bool bIndexLoaded = false;
+
+		// Keys of the cooks in progress, to store once they are processed
+		TMap<TWeakObjectPtr<UHoudiniAssetComponent>, uint64> PendingKeys;
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> Restored;
+
+		int32 NumHits = 0;
+		int32 NumMisses = 0;
+	};
+
+	FCookCacheState& GetCookCacheState()
+	{
+		static FCookCacheState State;
+		return State;
+	}
+
+	FString KeyToString(uint64 InKey)
+	{
+		return FString::Printf(TEXT("%016llx"), InKey);
+	}
+
+	// The /Temp/ root is mounted on the project's Saved folder, so the cached meshes are stored next to the index
+	FString GetCachePackageRoot()
+	{
+		return TEXT("/Temp/HoudiniEngine/CookCache");
+	}
+
+	void LoadIndex(FCookCacheState& State)
+	{
+		if (State.bIndexLoaded)
+			return;
+
+		State.bIndexLoaded = true;
+
+		FString Json;
+		TSharedPtr<FJsonObject> Root;
+		if (!FFileHelper::LoadFileToString(Json, *FHoudiniCookCache::GetIndexFilePath()) || !FHoudiniEngineUtils::JSONFromString(Json, Root))
+			return;
+
+		const TArray<TSharedPtr<FJsonValue>>* JsonEntries = nullptr;
+		if (!Root->TryGetArrayField(TEXT("entries"), JsonEntries))
+			return;
+
+		for (const TSharedPtr<FJsonValue>& JsonEntryValue : *JsonEntries)
+		{
+			const TSharedPtr<FJsonObject> JsonEntry = JsonEntryValue->AsObject();
+			FString Key;
+			FString LastUsed;
+			const TArray<TSharedPtr<FJsonValue>>* JsonOutputs = nullptr;
+			if (!JsonEntry.IsValid() || !JsonEntry->TryGetStringField(TEXT("key"), Key) || !JsonEntry->TryGetArrayField(TEXT("outputs"), JsonOutputs))
+				continue;
+
+			FCookCacheEntry Entry;
+			if (JsonEntry->TryGetStringField(TEXT("last_used"), LastUsed))
+				FDateTime::ParseIso8601(*LastUsed, Entry.LastUsed);
+			JsonEntry->TryGetNumberField(TEXT("size"), Entry.SizeBytes);
+
+			for (const TSharedPtr<FJsonValue>& JsonOutput : *JsonOutputs)
+			{
+				TArray<FCookCacheObject>& Objects = Entry.Outputs.AddDefaulted_GetRef();
+				for (const TSharedPtr<FJsonValue>& JsonObjectValue : JsonOutput->AsArray())
+				{
+					const TSharedPtr<FJsonObject> JsonObject = JsonObjectValue->AsObject();
+					if (!JsonObject.IsValid())
+						continue;
+
+					FCookCacheObject& Object = Objects.AddDefaulted_GetRef();
+					JsonObject->TryGetNumberField(TEXT("part"), Object.PartId);
+					JsonObject->TryGetStringField(TEXT("split"), Object.SplitIdentifier);
+					JsonObject->TryGetStringField(TEXT("part_name"), Object.PartName);
+					JsonObject->TryGetStringField(TEXT("mesh"), Object.MeshPath);
+				}
+			}
+
+			State.Entries.Add(Key, MoveTemp(Entry));
+		}
+	}
+
+	void SaveIndex(const FCookCacheState& State)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonEntries;
+		for (const auto& EntryPair : State.Entries)
+		{
+			const FCookCacheEntry& Entry = EntryPair.Value;
+			TSharedPtr<FJsonObject> JsonEntry = MakeShared<FJsonObject>();
+			JsonEntry->SetStringField(TEXT("key"), EntryPair.Key);
+			JsonEntry->SetStringField(TEXT("last_used"), Entry.LastUsed.ToIso8601());
+			JsonEntry->SetNumberField(TEXT("size"), (double)Entry.SizeBytes);
+
+			TArray<TSharedPtr<FJsonValue>> JsonOutputs;
+			for (const TArray<FCookCacheObject>& Objects : Entry.Outputs)
+			{
+				TArray<TSharedPtr<FJsonValue>> JsonObjects;
+				for (const FCookCacheObject& Object : Objects)
+				{
+					TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+					JsonObject->SetNumberField(TEXT("part"), Object.PartId);
+					JsonObject->SetStringField(TEXT("split"), Object.SplitIdentifier);
+					JsonObject->SetStringField(TEXT("part_name"), Object.PartName);
+					JsonObject->SetStringField(TEXT("mesh"), Object.MeshPath);
+					JsonObjects.Add(MakeShared<FJsonValueObject>(JsonObject));
+				}
+				JsonOutputs.Add(MakeShared<FJsonValueArray>(JsonObjects));
+			}
+			JsonEntry->SetArrayField(TEXT("outputs"), JsonOutputs);
+
+			JsonEntries.Add(MakeShared<FJsonValueObject>(JsonEntry));
+		}
+
+		TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetArrayField(TEXT("entries"), JsonEntries);
+
+		const FString IndexFilePath = FHoudiniCookCache::GetIndexFilePath();
+		if (!FFileHelper::SaveStringToFile(FHoudiniEngineUtils::JSONToString(Root), *IndexFilePath))
+			HOUDINI_LOG_WARNING(TEXT("Could not write the cook cache index to %s."), *IndexFilePath);
+	}
+
+	void DeleteEntryFiles(const FCookCacheEntry& InEntry)
+	{
+		// The entry's packages may still be being written
+		UPackage::WaitForAsyncFileWrites();
+
+		for (const TArray<FCookCacheObject>& Objects : InEntry.Outputs)
+		{
+			for (const FCookCacheObject& Object : Objects)
+			{
+				const FString PackageName = FPackageName::ObjectPathToPackageName(Object.MeshPath);
+				if (UPackage* Package = FindPackage(nullptr, *PackageName))
+				{
+					// Release the package's file, and let its objects be garbage collected
+					ResetLoaders(Package);
+					ForEachObjectWithPackage(Package, [](UObject* InObject)
+					{
+						InObject->ClearFlags(RF_Standalone);
+						return true;
+					}, false);
+				}
+
+				FString FileName;
+				if (FPackageName::TryConvertLongPackageNameToFilename(PackageName, FileName, FPackageName::GetAssetPackageExtension()))
+					IFileManager::Get().Delete(*FileName, false, true, true);
+			}
+		}
+	}
+
+	int64 GetTotalSizeBytes(const FCookCacheState& State)
+	{
+		int64 TotalSizeBytes = 0;
+		for (const auto& EntryPair : State.Entries)
+			TotalSizeBytes += EntryPair.Value.SizeBytes;
+		return TotalSizeBytes;
+	}
+
+	// Evicts the least recently used entries until the cache fits in its limits.
+	// The entry to keep is only evicted if it does not fit in the limits by itself.
+	void Evict(FCookCacheState& State, const FString& InKeyToKeep)
+	{
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		const int32 MaxEntries = FMath::Max(1, HoudiniRuntimeSettings->CookCacheMaxEntries);
+		const int64 MaxSizeBytes = (int64)FMath::Max(1, HoudiniRuntimeSettings->CookCacheMaxSizeMB) * 1024 * 1024;
+
+		int64 TotalSizeBytes = GetTotalSizeBytes(State);
+		while (State.Entries.Num() > 0 && (State.Entries.Num() > MaxEntries || TotalSizeBytes > MaxSizeBytes))
+		{
+			const FString* EvictedKey = nullptr;
+			for (const auto& EntryPair : State.Entries)
+			{
+				if (EntryPair.Key != InKeyToKeep && (!EvictedKey || EntryPair.Value.LastUsed < State.Entries[*EvictedKey].LastUsed))
+					EvictedKey = &EntryPair.Key;
+			}
+
+			const FString Key = EvictedKey ? *EvictedKey : InKeyToKeep;
+			const FCookCacheEntry& Entry = State.Entries[Key];
+			TotalSizeBytes -= Entry.SizeBytes;
+			DeleteEntryFiles(Entry);
+			State.Entries.Remove(Key);
+		}
+	}
+
+	// Pairs the HAC's output objects with the entry's cached meshes. Fails if the HAC's outputs do not have the same
+	// layout as the cached ones, or if a cached mesh cannot be loaded.
+	bool MatchEntry(UHoudiniAssetComponent* HAC, const FCookCacheEntry& InEntry, TArray<TPair<FHoudiniOutputObject*, UStaticMesh*>>& OutRestores)
+	{
+		TArray<UHoudiniOutput*>& Outputs = HAC->GetOutputs();
+		if (Outputs.Num() != InEntry.Outputs.Num())
+			return false;
+
+		for (int32 OutputIdx = 0; OutputIdx < Outputs.Num(); ++OutputIdx)
+		{
+			UHoudiniOutput* Output = Outputs[OutputIdx];
+			if (!IsCacheableOutput(Output))
+				return false;
+
+			TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = Output->GetOutputObjects();
+			const TArray<FCookCacheObject>& CachedObjects = InEntry.Outputs[OutputIdx];
+			if (OutputObjects.Num() != CachedObjects.Num())
+				return false;
+
+			for (const FCookCacheObject& CachedObject : CachedObjects)
+			{
+				FHoudiniOutputObject* OutputObject = nullptr;
+				for (auto& OutputObjectPair : OutputObjects)
+				{
+					if (CachedObject.Matches(OutputObjectPair.Key))
+					{
+						OutputObject = &OutputObjectPair.Value;
+						break;
+					}
+				}
+
+				if (!OutputObject)
+					return false;
+
+				UStaticMesh* CachedMesh = FindObject<UStaticMesh>(nullptr, *CachedObject.MeshPath);
+				if (!IsValid(CachedMesh))
+				{
+					// Make sure the package was fully written before loading it
+					UPackage::WaitForAsyncFileWrites();
+					CachedMesh = LoadObject<UStaticMesh>(nullptr, *CachedObject.MeshPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+				}
+				if (!IsValid(CachedMesh))
+					return false;
+
+				// Materials are referenced by the cached meshes, not cached with them
+				for (const FStaticMaterial& Material : CachedMesh->GetStaticMaterials())
+				{
+					if (!IsValid(Material.MaterialInterface))
+						return false;
+				}
+
+				OutRestores.Emplace(OutputObject, CachedMesh);
+			}
+		}
+
+		return true;
+	}
+
+	void HandleCookCacheCommand(const TArray<FString>& Args)
+	{
+		const FString Command = Args.Num() > 0 ? Args[0] : FString();
+		if (Command.Equals(TEXT("Clear"), ESearchCase::IgnoreCase))
+		{
+			FHoudiniCookCache::Clear();
+			HOUDINI_LOG_MESSAGE(TEXT("Cleared the cook cache."));
+		}
+		else if (Command.Equals(TEXT("Stats"), ESearchCase::IgnoreCase))
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Cook cache: %s, %d entries, %.1f MB, %d hits, %d misses."),
+				FHoudiniCookCache::IsEnabled() ? TEXT("enabled") : TEXT("disabled"),
+				FHoudiniCookCache::GetNumEntries(), FHoudiniCookCache::GetTotalSizeBytes() / (1024.0 * 1024.0),
+				FHoudiniCookCache::GetNumHits(), FHoudiniCookCache::GetNumMisses());
+		}
+		else
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Usage: HoudiniEngine.CookCache Clear|Stats"));
+		}
+	}
+
+	FAutoConsoleCommand CCmdCookCache(
+		TEXT("HoudiniEngine.CookCache"),
+		TEXT("Manages the cook cache.\n")
+		TEXT("Clear: remove all the cached cooks\n")
+		TEXT("Stats: log the size and the hit rate of the cache"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleCookCacheCommand));
+}
+
+bool
+FHoudiniCookCache::IsEnabled()
+{
+#if WITH_EDITOR
+	return GetDefault<UHoudiniRuntimeSettings>()->bEnableCookCache;
+#else
+	return false;
+#endif
+}
+
+uint64
+FHoudiniCookCache::GetCookKey(UHoudiniAssetComponent* HAC)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniCookCache::GetCookKey);
+
+	if (!IsEnabled() || !IsValid(HAC))
+		return 0;
+
+	// PDG and duplicated components have state the key does not capture
+	if (IsValid(HAC->GetPDGAssetLink()) || HAC->HasBeenDuplicated())
+		return 0;
+
+	const uint64 AssetHash = FHoudiniEngineUtils::GetHoudiniAssetContentHash(HAC->GetHoudiniAsset());
+	if (AssetHash == 0)
+		return 0;
+
+	uint64 Hash = FHoudiniHashUtils::HashBytes(CookCacheVersion, &AssetHash, sizeof(AssetHash));
+	Hash = FHoudiniHashUtils::HashString(Hash, HAC->GetHapiAssetName());
+
+	const bool Options[] = {
+		HAC->bUseOutputNodes, HAC->bOutputTemplateGeos, HAC->bUploadTransformsToHoudiniEngine, HAC->IsProxyStaticMeshEnabled() };
+	Hash = FHoudiniHashUtils::HashBytes(Hash, Options, sizeof(Options));
+	if (HAC->bUploadTransformsToHoudiniEngine)
+		Hash = HashTransform(Hash, HAC->GetComponentTransform());
+
+	// The settings the meshes are built with
+	Hash = FHoudiniHashUtils::HashStruct(Hash, HAC->StaticMeshGenerationProperties);
+	Hash = FHoudiniHashUtils::HashStruct(Hash, HAC->StaticMeshBuildSettings);
+	Hash = HashRuntimeSettings(Hash);
+
+	if (!HashParameters(Hash, HAC->GetParameters()) || !HashInputs(Hash, HAC->GetInputs()))
+		return 0;
+
+	// 0 is reserved for components that cannot be cached
+	return Hash != 0 ? Hash : 1;
+}
+
+void
+FHoudiniCookCache::BeginCook(UHoudiniAssetComponent* HAC, uint64 InKey)
+{
+	FCookCacheState& State = GetCookCacheState();
+	if (InKey != 0 && IsValid(HAC))
+		State.PendingKeys.Add(HAC, InKey);
+	else
+		State.PendingKeys.Remove(HAC);
+}
+
+bool
+FHoudiniCookCache::TryRestore(UHoudiniAssetComponent* HAC, uint64 InKey)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniCookCache::TryRestore);
+
+	if (!IsValid(HAC) || InKey == 0)
+		return false;
+
+	FCookCacheState& State = GetCookCacheState();
+	LoadIndex(State);
+
+	FCookCacheEntry* Entry = State.Entries.Find(KeyToString(InKey));
+	TArray<TPair<FHoudiniOutputObject*, UStaticMesh*>> Restores;
+	if (!Entry || !MatchEntry(HAC, *Entry, Restores))
+	{
+		State.NumMisses++;
+		return false;
+	}
+
+	for (const TPair<FHoudiniOutputObject*, UStaticMesh*>& Restore : Restores)
+	{
+		FHoudiniOutputObject& OutputObject = *Restore.Key;
+		UStaticMesh* ExistingMesh = Cast<UStaticMesh>(OutputObject.OutputObject);
+
+		// Restore into a new mesh, in a new package next to the existing mesh's, so that the existing mesh
+		// is never modified while it is in use
+		UStaticMesh* RestoredMesh = nullptr;
+		const FString PackageName = FString::Printf(TEXT("%s_%s"),
+			*ExistingMesh->GetPackage()->GetName(), *FGuid::NewGuid().ToString().Left(8));
+		UPackage* Package = CreatePackage(*PackageName);
+		if (IsValid(Package))
+		{
+			Package->FullyLoad();
+			RestoredMesh = DuplicateObject<UStaticMesh>(Restore.Value, Package, ExistingMesh->GetFName());
+		}
+
+		if (!IsValid(RestoredMesh))
+		{
+			// The outputs that were restored are consistent with the others once the upcoming cook updates them all
+			HOUDINI_LOG_WARNING(TEXT("Could not restore %s from the cook cache."), *ExistingMesh->GetPathName());
+			State.Restored.Add(HAC);
+			State.NumMisses++;
+			return false;
+		}
+
+		RestoredMesh->SetFlags(RF_Public | RF_Standalone);
+		FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+			Package, RestoredMesh, HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT, TEXT("true"));
+		FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+			Package, RestoredMesh, HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *RestoredMesh->GetName());
+		FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+			Package, RestoredMesh, HAPI_UNREAL_PACKAGE_META_COMPONENT_GUID, HAC->GetComponentGUID().ToString());
+		RestoredMesh->MarkPackageDirty();
+
+		// Swap the meshes through the output, then let the replaced mesh be garbage collected
+		OutputObject.OutputObject = RestoredMesh;
+		for (UObject* Component : OutputObject.OutputComponents)
+		{
+			UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component);
+			if (IsValid(StaticMeshComponent) && StaticMeshComponent->GetStaticMesh() != RestoredMesh)
+				StaticMeshComponent->SetStaticMesh(RestoredMesh);
+		}
+		ExistingMesh->ClearFlags(RF_Standalone);
+	}
+
+	State.PendingKeys.Remove(HAC);
+	State.Restored.Add(HAC);
+	State.NumHits++;
+
+	Entry->LastUsed = FDateTime::UtcNow();
+	SaveIndex(State);
+
+	return true;
+}
+
+bool
+FHoudiniCookCache::Store(UHoudiniAssetComponent* HAC)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniCookCache::Store);
+
+#if WITH_EDITOR
+	FCookCacheState& State = GetCookCacheState();
+	uint64 Key = 0;
+	if (!State.PendingKeys.RemoveAndCopyValue(HAC, Key) || !IsEnabled() || !IsValid(HAC) || !HAC->WasLastCookSuccessful())
+		return false;
+
+	const TArray<UHoudiniOutput*>& Outputs = HAC->GetOutputs();
+	for (const UHoudiniOutput* Output : Outputs)
+	{
+		if (!IsCacheableOutput(Output))
+			return false;
+	}
+
+	LoadIndex(State);
+
+	// Replace the entry previously stored under the same key, if its meshes could not be restored
+	const FString KeyString = KeyToString(Key);
+	if (const FCookCacheEntry* PreviousEntry = State.Entries.Find(KeyString))
+	{
+		DeleteEntryFiles(*PreviousEntry);
+		State.Entries.Remove(KeyString);
+	}
+
+	const FString PackageRoot = GetCachePackageRoot() / KeyString;
+	FCookCacheEntry Entry;
+	Entry.LastUsed = FDateTime::UtcNow();
+	bool bSuccess = true;
+	for (int32 OutputIdx = 0; OutputIdx < Outputs.Num() && bSuccess; ++OutputIdx)
+	{
+		TArray<FCookCacheObject>& CachedObjects = Entry.Outputs.AddDefaulted_GetRef();
+		for (const auto& OutputObjectPair : Outputs[OutputIdx]->GetOutputObjects())
+		{
+			const FString AssetName = FString::Printf(TEXT("SM_%d_%d"), OutputIdx, CachedObjects.Num());
+			const FString PackageName = PackageRoot / AssetName;
+			UPackage* Package = CreatePackage(*PackageName);
+			if (!IsValid(Package))
+			{
+				bSuccess = false;
+				break;
+			}
+			Package->FullyLoad();
+
+			UStaticMesh* CachedMesh = DuplicateObject<UStaticMesh>(Cast<UStaticMesh>(OutputObjectPair.Value.OutputObject), Package, *AssetName);
+			if (!IsValid(CachedMesh))
+			{
+				bSuccess = false;
+				break;
+			}
+			CachedMesh->SetFlags(RF_Public | RF_Standalone);
+
+			// Serialize the package on the game thread, but let the engine write the file in the background
+			const FString FileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+			SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+			const FSavePackageResultStruct SaveResult = UPackage::Save(Package, CachedMesh, *FileName, SaveArgs);
+			const bool bSaved = SaveResult.IsSuccessful();
+
+			// The cached mesh is only needed on disk
+			CachedMesh->ClearFlags(RF_Standalone);
+
+			FCookCacheObject& CachedObject = CachedObjects.AddDefaulted_GetRef();
+			CachedObject.PartId = OutputObjectPair.Key.PartId;
+			CachedObject.SplitIdentifier = OutputObjectPair.Key.SplitIdentifier;
+			CachedObject.PartName = OutputObjectPair.Key.PartName;
+			CachedObject.MeshPath = CachedMesh->GetPathName();
+			if (!bSaved)
+			{
+				bSuccess = false;
+				break;
+			}
+
+			Entry.SizeBytes += FMath::Max<int64>(0, SaveResult.TotalFileSize);
+		}
+	}
+
+	if (!bSuccess)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Could not store %s in the cook cache."), *HAC->GetDisplayName());
+		DeleteEntryFiles(Entry);
+		return false;
+	}
+
+	State.Entries.Add(KeyString, MoveTemp(Entry));
+	Evict(State, KeyString);
+	SaveIndex(State);
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool
+FHoudiniCookCache::ConsumeRestored(UHoudiniAssetComponent* HAC)
+{
+	return GetCookCacheState().Restored.Remove(HAC) > 0;
+}
+
+void
+FHoudiniCookCache::Clear()
+{
+	FCookCacheState& State = GetCookCacheState();
+	LoadIndex(State);
+	for (const auto& EntryPair : State.Entries)
+		DeleteEntryFiles(EntryPair.Value);
+
+	State.Entries.Empty();
+	SaveIndex(State);
+}
+
+int32
+FHoudiniCookCache::GetNumEntries()
+{
+	FCookCacheState& State = GetCookCacheState();
+	LoadIndex(State);
+	return State.Entries.Num();
+}
+
+int64
+FHoudiniCookCache::GetTotalSizeBytes()
+{
+	FCookCacheState& State = GetCookCacheState();
+	LoadIndex(State);
+	return ::GetTotalSizeBytes(State);
+}
+
+int32
+FHoudiniCookCache::GetNumHits()
+{
+	return GetCookCacheState().NumHits;
+}
+
+int32
+FHoudiniCookCache::GetNumMisses()
+{
+	return GetCookCacheState().NumMisses;
+}
+
+void
+FHoudiniCookCache::ResetStats()
+{
+	FCookCacheState& State = GetCookCacheState();
+	State.NumHits = 0;
+	State.NumMisses = 0;
+}
+
+FString
+FHoudiniCookCache::GetIndexFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("CookCache"), TEXT("Index.json"));
+}
@@ -0,0 +1,72 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UHoudiniAssetComponent;
+
+// On-disk cache of the results of cooks, keyed by the HDA's content, its parameter values and its inputs.
+// When a Houdini Asset Component is about to cook in a state it was already cooked in, its static mesh outputs are
+// restored from the cache, skipping both the cook and the output translation.
+// Only components whose outputs are all static meshes, and whose inputs are all saved assets, are cached.
+// The cached meshes and the index are saved under Saved/HoudiniEngine/CookCache. The meshes are written in the background.
+// Enabled and limited by the Cook cache runtime settings, also available through the "HoudiniEngine.CookCache" console command.
+struct HOUDINIENGINE_API FHoudiniCookCache
+{
+	static bool IsEnabled();
+
+	// Returns the key of the HAC's current state, or 0 if the HAC cannot be cached
+	static uint64 GetCookKey(UHoudiniAssetComponent* HAC);
+
+	// Records the key the results of the HAC's upcoming cook are stored under by Store(), 0 to not store them
+	static void BeginCook(UHoudiniAssetComponent* HAC, uint64 InKey);
+
+	// Restores the HAC's outputs from the entry with the given key, in which case the upcoming cook is cancelled.
+	// If there is none, or if it does not match the HAC's current outputs, nothing is modified.
+	static bool TryRestore(UHoudiniAssetComponent* HAC, uint64 InKey);
+
+	// Stores the HAC's outputs under the key passed to BeginCook(), then evicts the least recently used entries
+	// until the cache fits in its limits
+	static bool Store(UHoudiniAssetComponent* HAC);
+
+	// Returns true once after a HAC was restored: its Houdini node was not cooked in the restored state,
+	// so its next cook must update all its outputs.
+	static bool ConsumeRestored(UHoudiniAssetComponent* HAC);
+
+	// Removes all the entries and their files
+	static void Clear();
+
+	static int32 GetNumEntries();
+	static int64 GetTotalSizeBytes();
+
+	static int32 GetNumHits();
+	static int32 GetNumMisses();
+	static void ResetStats();
+
+	static FString GetIndexFilePath();
+};
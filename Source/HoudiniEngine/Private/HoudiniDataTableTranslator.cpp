@@ -8,6 +8,7 @@
 #include "HoudiniPackageParams.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "EdGraph/EdGraphPin.h"
 #include "Engine/DataTable.h"
 #include "Kismet2/StructureEditorUtils.h"
@@ -88,14 +89,13 @@ namespace
 	bool
 	WriteAttributeDataToStruct(const void* AttrData,
 		uint32 RowSize,
-		const HAPI_AttributeInfo& AttribInfo,
+		uint32 NumRows,
+		uint32 TupleSize,
 		uint8* PropData,
 		FProperty* Prop,
 		// Take in the attrib name for the transforms special case
 		const FString& AttribName)
 	{
-		uint32 NumRows = AttribInfo.count;
-		uint32 TupleSize = AttribInfo.tupleSize;
 		uint32 Offset = Prop->GetOffset_ForInternal();
 		if (Prop->IsA<FBoolProperty>())
 		{
@@ -363,6 +363,70 @@ namespace
 		return true;
 	}
 
+	// The values of one attribute, fetched before the rows are filled.
+	struct FHoudiniDataTableColumn
+	{
+		virtual ~FHoudiniDataTableColumn() {}
+
+		// Fetches all the attribute's values.
+		virtual bool Fetch(FHoudiniHapiAccessor& Accessor) = 0;
+
+		// Writes the values of rows [RowStart, RowStart + RowCount[ to their property.
+		virtual void WriteRows(int32 RowStart, int32 RowCount, int32 StructSize, uint8* RowData) const = 0;
+
+		// Text properties can't be imported from several threads.
+		bool CanWriteInParallel() const { return !Prop->IsA<FTextProperty>(); }
+
+		FString AttribName;
+		HAPI_AttributeInfo AttribInfo;
+		FProperty* Prop = nullptr;
+	};
+
+	template<typename T>
+	struct THoudiniDataTableNumericColumn : public FHoudiniDataTableColumn
+	{
+		virtual bool Fetch(FHoudiniHapiAccessor& Accessor) override
+		{
+			return Accessor.GetAttributeData(AttribInfo, Values);
+		}
+
+		virtual void WriteRows(int32 RowStart, int32 RowCount, int32 StructSize, uint8* RowData) const override
+		{
+			WriteAttributeDataToStruct<T>(&Values[RowStart * AttribInfo.tupleSize],
+				StructSize,
+				RowCount,
+				AttribInfo.tupleSize,
+				&RowData[RowStart * StructSize],
+				Prop,
+				AttribName);
+		}
+
+		TArray<T> Values;
+	};
+
+	struct FHoudiniDataTableStringColumn : public FHoudiniDataTableColumn
+	{
+		virtual bool Fetch(FHoudiniHapiAccessor& Accessor) override
+		{
+			return Accessor.GetAttributeData(AttribInfo, Values);
+		}
+
+		virtual void WriteRows(int32 RowStart, int32 RowCount, int32 StructSize, uint8* RowData) const override
+		{
+			const int32 Offset = Prop->GetOffset_ForInternal();
+			for (int32 Idx = RowStart; Idx < RowStart + RowCount; ++Idx)
+			{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+				Prop->ImportText_Direct(*Values[Idx], &RowData[Idx * StructSize + Offset], nullptr, PPF_ExternalEditor);
+#else
+				Prop->ImportText(*Values[Idx], &RowData[Idx * StructSize + Offset], PPF_ExternalEditor, nullptr);
+#endif
+			}
+		}
+
+		TArray<FString> Values;
+	};
+
 };
 
 void
@@ -1124,18 +1188,20 @@ FHoudiniDataTableTranslator::PopulateRowData(int32 GeoId,
 	int32 NumRows,
 	uint8* RowData)
 {
-	int32 RowIdx = 0;
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniDataTableTranslator::PopulateRowData);
+
+	// Fetch all the columns first, through the accessor so large attributes are chunked and
+	// spread over the available sessions. The rows are then filled in parallel.
+	TArray<TUniquePtr<FHoudiniDataTableColumn>> Columns;
+	Columns.Reserve(FoundProps.Num());
 	for (auto&& KV : FoundProps)
 	{
-		HAPI_Result Result = HAPI_RESULT_FAILURE;
-
 		auto Src = StringCast<ANSICHAR>(*KV.Key);
 		const ANSICHAR* AttribName = Src.Get();
 
 		FProperty* Prop = KV.Value;
-		int32 Offset = Prop->GetOffset_ForInternal();
 
-		HAPI_AttributeInfo AttribInfo = FoundInfos[KV.Key];
+		const HAPI_AttributeInfo& AttribInfo = FoundInfos[KV.Key];
 		if (AttribInfo.count < 1)
 		{
 			HOUDINI_LOG_WARNING(TEXT("[FHoudiniDataTableTranslator::PopulateRowData]: Attribute %s has no values."), *KV.Key);
@@ -1156,90 +1222,37 @@ FHoudiniDataTableTranslator::PopulateRowData(int32 GeoId,
 			continue;
 		}
 
-		void* Data = nullptr;
-
+		TUniquePtr<FHoudiniDataTableColumn> Column;
 		if (AttribInfo.storage == HAPI_STORAGETYPE_INT)
 		{
-			Data = FMemory::Malloc(AttribInfo.count * AttribInfo.tupleSize * sizeof(int32));
-			Result = FHoudiniApi::GetAttributeIntData(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, static_cast<int32*>(Data), 0, AttribInfo.count);
-
-			WriteAttributeDataToStruct<int32>(Data, StructSize, AttribInfo, RowData, Prop, KV.Key);
+			Column = MakeUnique<THoudiniDataTableNumericColumn<int32>>();
 		}
 		else if (AttribInfo.storage == HAPI_STORAGETYPE_INT64)
 		{
-			Data = FMemory::Malloc(AttribInfo.count * AttribInfo.tupleSize * sizeof(int64));
-			// int64 might be different from HAPI_Int64 on some linux platforms
-#if PLATFORM_LINUX
-			if (sizeof(int64) != sizeof(HAPI_Int64))
-			{
-				TArray<HAPI_Int64> HData;
-				HData.Reserve(AttribInfo.count * AttribInfo.tupleSize);
-				Result = FHoudiniApi::GetAttributeInt64Data(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, HData.GetData(), 0, AttribInfo.count);
-				int32 Idx = 0;
-				int64* Ptr = static_cast<int64*>(Data);
-				for (const HAPI_Int64& Item : HData)
-				{
-					Ptr[Idx++] = static_cast<int64>(Item);
-				}
-			}
-			else
-			{
-				Result = FHoudiniApi::GetAttributeInt64Data(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, reinterpret_cast<HAPI_Int64*>(Data), 0, AttribInfo.count);
-			}
-#else
-			Result = FHoudiniApi::GetAttributeInt64Data(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, static_cast<int64*>(Data), 0, AttribInfo.count);
-#endif
-			WriteAttributeDataToStruct<int64>(Data, StructSize, AttribInfo, RowData, Prop, KV.Key);
+			Column = MakeUnique<THoudiniDataTableNumericColumn<int64>>();
 		}
 		else if (AttribInfo.storage == HAPI_STORAGETYPE_FLOAT)
 		{
-			Data = FMemory::Malloc(AttribInfo.count * AttribInfo.tupleSize * sizeof(float));
-			Result = FHoudiniApi::GetAttributeFloatData(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, static_cast<float*>(Data), 0, AttribInfo.count);
-
-			WriteAttributeDataToStruct<float>(Data, StructSize, AttribInfo, RowData, Prop, KV.Key);
+			Column = MakeUnique<THoudiniDataTableNumericColumn<float>>();
 		}
 		else if (AttribInfo.storage == HAPI_STORAGETYPE_FLOAT64)
 		{
-			Data = FMemory::Malloc(AttribInfo.count * AttribInfo.tupleSize * sizeof(double));
-			Result = FHoudiniApi::GetAttributeFloat64Data(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, static_cast<double*>(Data), 0, AttribInfo.count);
-
-			WriteAttributeDataToStruct<double>(Data, StructSize, AttribInfo, RowData, Prop, KV.Key);
+			Column = MakeUnique<THoudiniDataTableNumericColumn<double>>();
 		}
 		else if (AttribInfo.storage == HAPI_STORAGETYPE_UINT8)
 		{
-			Data = FMemory::Malloc(AttribInfo.count * AttribInfo.tupleSize * sizeof(uint8));
-			Result = FHoudiniApi::GetAttributeUInt8Data(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, static_cast<uint8*>(Data), 0, AttribInfo.count);
-
-			WriteAttributeDataToStruct<uint8>(Data, StructSize, AttribInfo, RowData, Prop, KV.Key);
+			Column = MakeUnique<THoudiniDataTableNumericColumn<uint8>>();
 		}
 		else if (AttribInfo.storage == HAPI_STORAGETYPE_INT8)
 		{
-			Data = FMemory::Malloc(AttribInfo.count * AttribInfo.tupleSize * sizeof(int8));
-			Result = FHoudiniApi::GetAttributeInt8Data(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, static_cast<int8*>(Data), 0, AttribInfo.count);
-
-			WriteAttributeDataToStruct<int8>(Data, StructSize, AttribInfo, RowData, Prop, KV.Key);
+			Column = MakeUnique<THoudiniDataTableNumericColumn<int8>>();
 		}
-		else if (AttribInfo.storage == HAPI_STORAGETYPE_INT16) 
+		else if (AttribInfo.storage == HAPI_STORAGETYPE_INT16)
 		{
-			Data = FMemory::Malloc(AttribInfo.count * AttribInfo.tupleSize * sizeof(int16));
-			Result = FHoudiniApi::GetAttributeInt16Data(FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, &AttribInfo, -1, static_cast<int16*>(Data), 0, AttribInfo.count);
-
-			WriteAttributeDataToStruct<int16>(Data, StructSize, AttribInfo, RowData, Prop, KV.Key);
+			Column = MakeUnique<THoudiniDataTableNumericColumn<int16>>();
 		}
-		else if (AttribInfo.storage == HAPI_STORAGETYPE_STRING) 
+		else if (AttribInfo.storage == HAPI_STORAGETYPE_STRING)
 		{
-			TArray<FString> StringData;
-			StringData.Reserve(NumRows);
-
-
-			FHoudiniHapiAccessor Accessor(GeoId, PartId, AttribName);
-			bool bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_INVALID, StringData);
-
-			if (!bSuccess)
-				Result = HAPI_RESULT_FAILURE;
-			else
-				Result = HAPI_RESULT_SUCCESS;
-
 			if (AttribInfo.tupleSize != 1)
 			{
 				HOUDINI_LOG_WARNING(TEXT("[FHoudiniDataTableTranslator::PopulateRowData]: Tuples of strings are not supported, skipping attribute %s."), *KV.Key);
@@ -1250,34 +1263,51 @@ FHoudiniDataTableTranslator::PopulateRowData(int32 GeoId,
 				HOUDINI_LOG_WARNING(TEXT("[FHoudiniDataTableTranslator::PopulateRowData]: Cannot convert Houdini string attribute to non string property, skipping attribute %s."), *KV.Key);
 				return false;
 			}
-			for (int32 Idx = 0; Idx < NumRows; ++Idx)
-			{
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-				Prop->ImportText_Direct(*StringData[Idx], &RowData[Idx * StructSize + Offset], nullptr, PPF_ExternalEditor);
-#else
-				Prop->ImportText(*StringData[Idx], &RowData[Idx * StructSize + Offset], PPF_ExternalEditor, nullptr);				
-#endif
-			}
+
+			Column = MakeUnique<FHoudiniDataTableStringColumn>();
 		}
-		else 
+		else
 		{
 			HOUDINI_LOG_WARNING(TEXT("[FHoudiniDataTableTranslator::PopulateRowData]: Unknown attribute type %d."), AttribInfo.storage);
 			return false;
 		}
 
-		if (Data)
+		Column->AttribName = KV.Key;
+		Column->AttribInfo = AttribInfo;
+		Column->Prop = Prop;
+
+		FHoudiniHapiAccessor Accessor(GeoId, PartId, AttribName);
+		if (!Column->Fetch(Accessor))
 		{
-			FMemory::Free(Data);
-			Data = nullptr;
+			HOUDINI_LOG_WARNING(TEXT("[FHoudiniDataTableTranslator::PopulateRowData]: Failed to get values for attribute %s."), *KV.Key);
+			return false;
 		}
 
-		if (Result != HAPI_RESULT_SUCCESS)
+		Columns.Add(MoveTemp(Column));
+	}
+
+	// Each chunk of rows is filled by a single task, so no two tasks write to the same row.
+	constexpr int32 RowsPerChunk = 1024;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumRows, RowsPerChunk);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 RowStart = ChunkIdx * RowsPerChunk;
+		for (const TUniquePtr<FHoudiniDataTableColumn>& Column : Columns)
 		{
-			HOUDINI_LOG_WARNING(TEXT("[FHoudiniDataTableTranslator::PopulateRowData]: Error %d when trying to get values for attribute %s."), Result, *KV.Key);
-			return false;
+			if (!Column->CanWriteInParallel())
+				continue;
+
+			const int32 ColumnRows = FMath::Min(NumRows, Column->AttribInfo.count);
+			const int32 RowCount = FMath::Min(RowsPerChunk, ColumnRows - RowStart);
+			if (RowCount > 0)
+				Column->WriteRows(RowStart, RowCount, StructSize, RowData);
 		}
+	});
 
-		++RowIdx;
+	for (const TUniquePtr<FHoudiniDataTableColumn>& Column : Columns)
+	{
+		if (!Column->CanWriteInParallel())
+			Column->WriteRows(0, FMath::Min(NumRows, Column->AttribInfo.count), StructSize, RowData);
 	}
 
 	return true;
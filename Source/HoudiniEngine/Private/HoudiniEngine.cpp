@@ -38,6 +38,7 @@
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "HoudiniMeshTranslator.h"
 #include "HoudiniAssetComponent.h"
 #include "UnrealObjectInputManager.h"
 #include "UnrealObjectInputManagerImpl.h"
@@ -833,6 +834,9 @@ FHoudiniEngine::StartSessions(
 
 	// Empty and reserve space
 	Sessions.Empty(NumSessions);
+	FHoudiniEngineString::InvalidateStringCache();
+	FHoudiniEngineUtils::InvalidateAssetLibraryCache();
+	FHoudiniMeshTranslator::EmptyCollisionFitCache();
 
 	// Create the sessions...
 	for (int32 i = 0; i < NumSessions; ++i)
@@ -1088,6 +1092,9 @@ FHoudiniEngine::InitializeHAPISession()
 		HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Session Sync enabled."));		
 	}
 
+	// Load the HDAs that should be ready for instantiation in all the sessions
+	FHoudiniEngineUtils::PreloadHoudiniAssets();
+
 	return true;
 }
 
@@ -1098,6 +1105,7 @@ FHoudiniEngine::OnSessionLost()
 	// Mark the session as invalid
 	Sessions.Empty();
 	SetSessionStatus(EHoudiniSessionStatus::Lost);
+	FHoudiniEngineUtils::InvalidateAssetLibraryCache();
 
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
@@ -1125,6 +1133,9 @@ FHoudiniEngine::StopSession()
 
 	Sessions.Empty();
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
+	FHoudiniEngineString::InvalidateStringCache();
+	FHoudiniEngineUtils::InvalidateAssetLibraryCache();
+	FHoudiniMeshTranslator::EmptyCollisionFitCache();
 	bEnableSessionSync = false;
 
 	HoudiniEngineManager->StopHoudiniTicking();
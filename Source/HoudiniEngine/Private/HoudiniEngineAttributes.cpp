@@ -72,9 +72,17 @@ FHoudiniHapiAccessor::GetInfo(HAPI_AttributeInfo& OutAttributeInfo, const HAPI_A
 
 	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
 
+	const FHoudiniPartAttributeManifest* Manifest = FHoudiniPartAttributeManifest::Find(NodeId, PartId);
+
 	const auto GetInfoLambda =
 		[&](const HAPI_AttributeOwner Owner) -> bool
 	{
+		if (Manifest && Manifest->IsAttributeMissing(AttributeName, Owner))
+		{
+			OutAttributeInfo.exists = false;
+			return false;
+		}
+
 		const HAPI_Result Result = FHoudiniApi::GetAttributeInfo(
 			FHoudiniEngine::Get().GetSession(),
 			NodeId,
@@ -1366,3 +1374,104 @@ IMPLEMENT_HOUDINI_ACCESSOR(int);
 IMPLEMENT_HOUDINI_ACCESSOR(float);
 IMPLEMENT_HOUDINI_ACCESSOR(double);
 IMPLEMENT_HOUDINI_ACCESSOR(FString);
+
+const FHoudiniPartAttributeManifest* FHoudiniPartAttributeManifest::Active = nullptr;
+
+bool
+FHoudiniPartAttributeManifest::Build(HAPI_NodeId InGeoId, HAPI_PartId InPartId, const HAPI_PartInfo& InPartInfo)
+{
+	H_SCOPED_FUNCTION_TIMER()
+
+	GeoId = InGeoId;
+	PartId = InPartId;
+	bIsValid = false;
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+	{
+		AttributeNames[OwnerIdx].Reset();
+		AttributeNameSets[OwnerIdx].Reset();
+
+		const int32 Count = InPartInfo.attributeCounts[OwnerIdx];
+		if (Count <= 0)
+			continue;
+
+		TArray<HAPI_StringHandle> NameHandles;
+		NameHandles.SetNum(Count);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			GeoId, PartId, static_cast<HAPI_AttributeOwner>(OwnerIdx),
+			NameHandles.GetData(), Count))
+		{
+			return false;
+		}
+
+		if (!FHoudiniEngineString::SHArrayToFStringArray(NameHandles, AttributeNames[OwnerIdx]))
+			return false;
+
+		AttributeNameSets[OwnerIdx].Append(AttributeNames[OwnerIdx]);
+	}
+
+	bIsValid = true;
+	return true;
+}
+
+bool
+FHoudiniPartAttributeManifest::Matches(HAPI_NodeId InGeoId, HAPI_PartId InPartId) const
+{
+	return bIsValid && GeoId == InGeoId && PartId == InPartId;
+}
+
+bool
+FHoudiniPartAttributeManifest::IsAttributeMissing(const char* InAttributeName, HAPI_AttributeOwner InOwner) const
+{
+	if (!bIsValid || !InAttributeName)
+		return false;
+
+	const FString Name = UTF8_TO_TCHAR(InAttributeName);
+	if (InOwner == HAPI_ATTROWNER_INVALID)
+	{
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+		{
+			if (AttributeNameSets[OwnerIdx].Contains(Name))
+				return false;
+		}
+		return true;
+	}
+
+	if (InOwner < 0 || InOwner >= HAPI_ATTROWNER_MAX)
+		return false;
+
+	return !AttributeNameSets[InOwner].Contains(Name);
+}
+
+const TArray<FString>&
+FHoudiniPartAttributeManifest::GetAttributeNames(HAPI_AttributeOwner InOwner) const
+{
+	check(InOwner >= 0 && InOwner < HAPI_ATTROWNER_MAX);
+	return AttributeNames[InOwner];
+}
+
+const FHoudiniPartAttributeManifest*
+FHoudiniPartAttributeManifest::Find(HAPI_NodeId InGeoId, HAPI_PartId InPartId)
+{
+	// The manifest is only used by the output processing on the game thread,
+	// probes made from worker threads always go through HAPI.
+	if (!Active || !IsInGameThread())
+		return nullptr;
+
+	return Active->Matches(InGeoId, InPartId) ? Active : nullptr;
+}
+
+FHoudiniScopedPartAttributeManifest::FHoudiniScopedPartAttributeManifest(HAPI_NodeId InGeoId, HAPI_PartId InPartId, const HAPI_PartInfo& InPartInfo)
+{
+	check(IsInGameThread());
+	Manifest.Build(InGeoId, InPartId, InPartInfo);
+
+	PreviousManifest = FHoudiniPartAttributeManifest::Active;
+	FHoudiniPartAttributeManifest::Active = &Manifest;
+}
+
+FHoudiniScopedPartAttributeManifest::~FHoudiniScopedPartAttributeManifest()
+{
+	FHoudiniPartAttributeManifest::Active = PreviousManifest;
+}
@@ -133,5 +133,52 @@ protected:
 
 };
 
+// The names of all the attributes of a part, for every owner, fetched with one GetAttributeNames call per owner.
+// While a FHoudiniScopedPartAttributeManifest is active, attribute existence probes on that part
+// (FHoudiniHapiAccessor::GetInfo, FHoudiniEngineUtils::HapiCheckAttributeExists...) for attributes that are
+// not in the manifest are answered locally instead of with a GetAttributeInfo call.
+struct HOUDINIENGINE_API FHoudiniPartAttributeManifest
+{
+	// Fetches the attribute names of the part. Returns false if any of the names could not be fetched.
+	bool Build(HAPI_NodeId InGeoId, HAPI_PartId InPartId, const HAPI_PartInfo& InPartInfo);
+
+	bool IsValid() const { return bIsValid; }
+
+	// Returns true if the manifest is for the given part.
+	bool Matches(HAPI_NodeId InGeoId, HAPI_PartId InPartId) const;
+
+	// Returns true if we know the attribute doesn't exist on the given owner (on any owner if InOwner is invalid).
+	// Names are compared case insensitively, so a false result only means HAPI has to be asked.
+	bool IsAttributeMissing(const char* InAttributeName, HAPI_AttributeOwner InOwner) const;
+
+	// The attribute names for the given owner.
+	const TArray<FString>& GetAttributeNames(HAPI_AttributeOwner InOwner) const;
+
+	// Returns the manifest of the given part if one is active on the game thread, null otherwise.
+	static const FHoudiniPartAttributeManifest* Find(HAPI_NodeId InGeoId, HAPI_PartId InPartId);
+
+protected:
+	friend struct FHoudiniScopedPartAttributeManifest;
 
+	HAPI_NodeId GeoId = -1;
+	HAPI_PartId PartId = -1;
+	bool bIsValid = false;
+
+	TArray<FString> AttributeNames[HAPI_ATTROWNER_MAX];
+	TSet<FString> AttributeNameSets[HAPI_ATTROWNER_MAX];
+
+	static const FHoudiniPartAttributeManifest* Active;
+};
 
+// Builds the attribute manifest of a part and makes it active for the duration of the scope.
+// Scopes can be nested, the previous manifest is restored on destruction.
+struct HOUDINIENGINE_API FHoudiniScopedPartAttributeManifest
+{
+	FHoudiniScopedPartAttributeManifest(HAPI_NodeId InGeoId, HAPI_PartId InPartId, const HAPI_PartInfo& InPartInfo);
+	~FHoudiniScopedPartAttributeManifest();
+
+	FHoudiniPartAttributeManifest Manifest;
+
+private:
+	const FHoudiniPartAttributeManifest* PreviousManifest = nullptr;
+};
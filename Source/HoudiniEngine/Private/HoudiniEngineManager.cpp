@@ -27,6 +27,8 @@
 #include "HoudiniEngineManager.h"
 
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApiTrace.h"
+#include "HoudiniCookCache.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
@@ -35,7 +37,9 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
+#include "HoudiniSessionJournal.h"
 #include "HoudiniInputTranslator.h"
+#include "HoudiniMeshTranslator.h"
 #include "HoudiniNodeSyncComponent.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
@@ -154,6 +158,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		return true;
 	}
 
+	// Carry on restoring the HACs from the session journal after a session restart
+	FHoudiniSessionJournal::UpdateRehydrate();
+
 	// Build a set of components that need to be processed
 	// 1 - selected HACs
 	// 2 - "Active" HACs
@@ -183,6 +190,11 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				// Component being deleted, do not process
 				continue;
 			}
+			else if (FHoudiniSessionJournal::IsRehydrating(CurrentComponent))
+			{
+				// Component being restored from the session journal, do not process until it has its new node
+				continue;
+			}
 			
 			{
 				UWorld* World = CurrentComponent->GetHACWorld();
@@ -472,6 +484,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 	if (!IsValid(HAC))
 		return;
 
+	// Attribute the HAPI calls made while processing to this component
+	FHoudiniApiTraceScope ApiTraceScope(HAC);
+
 	bool bIsNodeSyncComponent = HAC->IsA<UHoudiniNodeSyncComponent>();
 	// No need to process a component not tied to an asset..
 	if (!bIsNodeSyncComponent && !HAC->GetHoudiniAsset())
@@ -588,6 +603,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 				UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
 				if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), TaskGuid, HapiAssetName))
 				{
+					// The asset may have changed, don't reuse the colliders fitted for its previous outputs
+					FHoudiniMeshTranslator::EmptyCollisionFitCache();
+
 					// Update the HAC's state
 					HAC->SetAssetState(EHoudiniAssetState::Instantiating);
 
@@ -638,7 +656,23 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 			// Create a Cooking task only if necessary
 			bool bCookStarted = false;
+			bool bRestoredFromCache = false;
 			if (IsCookingEnabledForHoudiniAsset(HAC))
+			{
+				const uint64 CookKey = FHoudiniCookCache::GetCookKey(HAC);
+				FHoudiniCookCache::BeginCook(HAC, CookKey);
+
+				// Restore the outputs of a state that was already cooked instead of cooking it again,
+				// unless a recook/rebuild was explicitly requested
+				if (!HAC->HasRecookBeenRequested() && !HAC->HasRebuildBeenRequested())
+					bRestoredFromCache = FHoudiniCookCache::TryRestore(HAC, CookKey);
+			}
+
+			if (bRestoredFromCache)
+			{
+				FinishRestoredCook(HAC);
+			}
+			else if (IsCookingEnabledForHoudiniAsset(HAC))
 			{
 				// Gather output nodes for the HAC
 				TArray<int32> OutputNodes;
@@ -661,7 +695,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 				}
 			}
 			
-			if(!bCookStarted)
+			if(!bCookStarted && !bRestoredFromCache)
 			{
 #if WITH_EDITORONLY_DATA
 				// Just refresh editor properties?
@@ -696,6 +730,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			// Handle PostCook
 			EHoudiniAssetState NewState = EHoudiniAssetState::None;
 			bool bSuccess = HAC->bLastCookSuccess;
+
+			// The outputs are read from the new cook results, don't reuse strings resolved before it
+			FHoudiniEngineString::InvalidateStringCache();
 			HAC->HandleOnPreOutputProcessing();
 			HAC->OnPreOutputProcessing();
 			
@@ -722,6 +759,8 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		case EHoudiniAssetState::Processing:
 		{
 			UpdateProcess(HAC);
+			FHoudiniCookCache::Store(HAC);
+			FHoudiniSessionJournal::Record(HAC);
 
 			HAC->HandleOnPostOutputProcessing();
 			HAC->OnPostOutputProcessing();
@@ -1282,7 +1321,10 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 		FHoudiniInputTranslator::UpdateInputs(HAC);
 
 		bool bHasHoudiniStaticMeshOutput = false;
+		// Outputs restored from the cook cache do not match the node's previous cook anymore
 		bool ForceUpdate = HAC->HasRebuildBeenRequested() || HAC->HasRecookBeenRequested();
+		ForceUpdate |= FHoudiniCookCache::ConsumeRestored(HAC);
+		ForceUpdate |= FHoudiniSessionJournal::ConsumeRehydrated(HAC);
 		FHoudiniOutputTranslator::UpdateOutputs(HAC, ForceUpdate, bHasHoudiniStaticMeshOutput);
 		HAC->SetNoProxyMeshNextCookRequested(false);
 
@@ -1362,6 +1404,35 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 	return bCookSuccess;
 }
 
+void
+FHoudiniEngineManager::FinishRestoredCook(UHoudiniAssetComponent* HAC)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::FinishRestoredCook);
+
+	// The outputs are now what the cook would have processed, finish as PostCook and Processing would
+	HAC->bLastCookSuccess = true;
+	HAC->SetHasBeenLoaded(false);
+
+	HAC->UpdatePhysicsState();
+	HAC->MarkRenderStateDirty();
+	HAC->UpdateBounds();
+
+#if WITH_EDITORONLY_DATA
+	HAC->bNeedToUpdateEditorProperties = true;
+#endif
+
+	// If we have downstream HDAs, we need to tell them we're done cooking
+	HAC->NotifyCookedToDownstreamAssets();
+
+	HAC->SetRecookRequested(false);
+	HAC->SetRebuildRequested(false);
+	HAC->SetAssetState(EHoudiniAssetState::None);
+
+	HAC->HandleOnPostOutputProcessing();
+	HAC->OnPostOutputProcessing();
+	FHoudiniEngineUtils::UpdateBlueprintEditor(HAC);
+}
+
 bool
 FHoudiniEngineManager::StartTaskAssetProcess(UHoudiniAssetComponent* HAC)
 {
@@ -135,6 +135,9 @@ protected:
 		const bool& bSuccess,
 		const HAPI_NodeId& TaskAssetId);
 
+	// Called instead of cooking when the HAC's outputs were restored from the cook cache
+	void FinishRestoredCook(UHoudiniAssetComponent* HAC);
+
 	bool StartTaskAssetProcess(UHoudiniAssetComponent* HAC);
 
 	bool UpdateProcess(UHoudiniAssetComponent* HAC);
@@ -57,4 +57,15 @@ void FHoudiniEngineOutputStats::NotifyObjectsReplaced(const FString& ObjectTypeN
 {
 	const int32 Count = OutputObjectsReplaced.FindOrAdd(ObjectTypeName, 0);
 	OutputObjectsReplaced[ObjectTypeName] = Count + NumReplaced;
-}
\ No newline at end of file
+}
+
+void FHoudiniEngineOutputStats::NotifyPhaseTime(const FString& PhaseName, double Seconds)
+{
+	PhaseSeconds.FindOrAdd(PhaseName, 0.0) += Seconds;
+}
+
+double FHoudiniEngineOutputStats::GetPhaseTime(const FString& PhaseName) const
+{
+	const double* Seconds = PhaseSeconds.Find(PhaseName);
+	return Seconds ? *Seconds : 0.0;
+}
@@ -42,6 +42,12 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	TMap<FString, int32> OutputObjectsUpdated;
 	TMap<FString, int32> OutputObjectsReplaced;
 
+	// Time spent in each phase (ie duplicate, build, save), in seconds
+	TMap<FString, double> PhaseSeconds;
+
+	// Number of phase timers currently open for each phase, so that nested timers are only counted once
+	TMap<FString, int32> OpenPhaseTimers;
+
 	void NotifyPackageCreated(int32 NumCreated);
 	void NotifyPackageUpdated(int32 NumUpdated);
 
@@ -68,4 +74,33 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	{
 		NotifyObjectsReplaced( UEnum::GetValueAsString(EnumValue), NumReplaced );
 	}
+
+	// Phase timings
+	void NotifyPhaseTime(const FString& PhaseName, double Seconds);
+	double GetPhaseTime(const FString& PhaseName) const;
+};
+
+// Adds the time spent in its scope to a phase of a FHoudiniEngineOutputStats.
+// Timers opened for a phase while another one is open for it (ie, when duplicating the materials of a duplicated
+// mesh) are ignored, only the outermost one adds its time.
+struct HOUDINIENGINE_API FHoudiniScopedOutputStatsPhaseTimer
+{
+	FHoudiniScopedOutputStatsPhaseTimer(FHoudiniEngineOutputStats& InStats, const FString& InPhaseName)
+		: Stats(InStats)
+		, PhaseName(InPhaseName)
+		, StartTime(FPlatformTime::Seconds())
+	{
+		Stats.OpenPhaseTimers.FindOrAdd(PhaseName)++;
+	}
+
+	~FHoudiniScopedOutputStatsPhaseTimer()
+	{
+		int32& NumOpen = Stats.OpenPhaseTimers.FindChecked(PhaseName);
+		if (--NumOpen == 0)
+			Stats.NotifyPhaseTime(PhaseName, FPlatformTime::Seconds() - StartTime);
+	}
+
+	FHoudiniEngineOutputStats& Stats;
+	FString PhaseName;
+	double StartTime;
 };
@@ -26,6 +26,7 @@
 
 #include "HoudiniEngineScheduler.h"
 
+#include "HoudiniApiTrace.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
@@ -325,6 +326,9 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	EHoudiniEngineTaskState GlobalTaskResult = EHoudiniEngineTaskState::Success;
 	for (auto& CurrentNodeId : NodesToCook)
 	{
+		// String handles fetched before the cook might not be valid after it
+		FHoudiniEngineString::InvalidateStringCache();
+
 		Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentNodeId, &CookOptions);
 		if (Result != HAPI_RESULT_SUCCESS)
 		{
@@ -412,6 +416,9 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		}
 	}	
 
+	// Drop the strings that might have been resolved while cooking
+	FHoudiniEngineString::InvalidateStringCache();
+
 	switch (GlobalTaskResult)
 	{
 		case EHoudiniEngineTaskState::Success:
@@ -526,6 +533,7 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 
 			bool bTaskProcessed = true;
 
+			FHoudiniApiTraceScope ApiTraceScope(Task.ActorName);
 			switch (Task.TaskType)
 			{
 				case EHoudiniEngineTaskType::AssetInstantiation:
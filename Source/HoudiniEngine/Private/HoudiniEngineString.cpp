@@ -30,9 +30,107 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEnginePrivatePCH.h"
 
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
 #include <vector>
 
-FCriticalSection FHoudiniEngineString::GetStringCriticalSection;
+// Strings resolved for a HAPI session, valid for the current cook generation only.
+// Resolvers only take a shared lock on the shard of the handle they look up, so concurrent
+// conversions don't wait on each other unless they add strings to the same shard.
+class FHoudiniEngineSessionStringCache
+{
+public:
+
+	bool Find(HAPI_StringHandle InHandle, uint64 InGeneration, FString& OutString)
+	{
+		FShard& Shard = GetShard(InHandle);
+		FReadScopeLock ScopeLock(Shard.Lock);
+		if (Shard.Generation != InGeneration)
+			return false;
+
+		const FString* Found = Shard.Strings.Find(InHandle);
+		if (!Found)
+			return false;
+
+		OutString = *Found;
+		return true;
+	}
+
+	void Add(HAPI_StringHandle InHandle, const FString& InString, uint64 InGeneration)
+	{
+		FShard& Shard = GetShard(InHandle);
+		FWriteScopeLock ScopeLock(Shard.Lock);
+		if (Shard.Generation != InGeneration)
+		{
+			// The string was resolved before a cook, it might not be valid anymore
+			if (InGeneration != FHoudiniEngineSessionStringCache::GetGeneration())
+				return;
+
+			// Drop the strings of the previous cooks
+			Shard.Strings.Reset();
+			Shard.Generation = InGeneration;
+		}
+
+		Shard.Strings.Add(InHandle, InString);
+	}
+
+	// GetStringBatchSize/GetStringBatch must be called in pairs on a session, otherwise another
+	// thread could replace the batch before we retrieve it.
+	FCriticalSection StringBatchLock;
+
+	static FHoudiniEngineSessionStringCache& Get(const HAPI_Session* InSession)
+	{
+		{
+			FReadScopeLock ScopeLock(SessionCachesLock);
+			if (const TUniquePtr<FHoudiniEngineSessionStringCache>* Found = SessionCaches.Find(InSession))
+				return **Found;
+		}
+
+		FWriteScopeLock ScopeLock(SessionCachesLock);
+		TUniquePtr<FHoudiniEngineSessionStringCache>& Cache = SessionCaches.FindOrAdd(InSession);
+		if (!Cache)
+			Cache = MakeUnique<FHoudiniEngineSessionStringCache>();
+
+		return *Cache;
+	}
+
+	static uint64 GetGeneration() { return Generation.load(std::memory_order_acquire); }
+	static void Invalidate() { Generation.fetch_add(1, std::memory_order_acq_rel); }
+
+	static std::atomic<bool> bEnabled;
+
+	// The cache is not used in Session Sync: Houdini can cook at any time, without the plugin being notified.
+	static bool IsUsable() { return bEnabled && !FHoudiniEngine::Get().IsSessionSyncEnabled(); }
+
+private:
+
+	static constexpr int32 NumShards = 16;
+
+	struct FShard
+	{
+		FRWLock Lock;
+		uint64 Generation = 0;
+		TMap<HAPI_StringHandle, FString> Strings;
+	};
+
+	FShard& GetShard(HAPI_StringHandle InHandle) { return Shards[static_cast<uint32>(InHandle) % NumShards]; }
+
+	FShard Shards[NumShards];
+
+	// Caches are never removed, session pointers can be reused after a restart but the generation
+	// is bumped when sessions are started or stopped.
+	static FRWLock SessionCachesLock;
+	static TMap<const HAPI_Session*, TUniquePtr<FHoudiniEngineSessionStringCache>> SessionCaches;
+
+	// Incremented every time the handles might have become invalid
+	static std::atomic<uint64> Generation;
+};
+
+FRWLock FHoudiniEngineSessionStringCache::SessionCachesLock;
+TMap<const HAPI_Session*, TUniquePtr<FHoudiniEngineSessionStringCache>> FHoudiniEngineSessionStringCache::SessionCaches;
+std::atomic<uint64> FHoudiniEngineSessionStringCache::Generation(1);
+std::atomic<bool> FHoudiniEngineSessionStringCache::bEnabled(true);
 
 FHoudiniEngineString::FHoudiniEngineString()
 	: StringId(-1)
@@ -132,11 +230,22 @@ bool
 FHoudiniEngineString::ToFString(FString& String, const HAPI_Session* InSession) const
 {
 	String = TEXT("");
-	std::string NamePlain = "";
+	if (StringId <= 0)
+		return false;
 
-	if (ToStdString(NamePlain, InSession))
+	const HAPI_Session* Session = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+	const bool bUseCache = FHoudiniEngineSessionStringCache::IsUsable();
+	const uint64 Generation = FHoudiniEngineSessionStringCache::GetGeneration();
+	if (bUseCache && FHoudiniEngineSessionStringCache::Get(Session).Find(StringId, Generation, String))
+		return true;
+
+	std::string NamePlain = "";
+	if (ToStdString(NamePlain, Session))
 	{
 		String = UTF8_TO_TCHAR(NamePlain.c_str());
+		if (bUseCache)
+			FHoudiniEngineSessionStringCache::Get(Session).Add(StringId, String, Generation);
+
 		return true;
 	}
 
@@ -214,10 +323,47 @@ FHoudiniEngineString::SHArrayToFStringArray(
 	FString* OutStringArray,
 	const HAPI_Session* InSession)
 {
-	if (SHArrayToFStringArray_Batch(InStringIdArray, OutStringArray, InSession))
+	const HAPI_Session* Session = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+	if (!FHoudiniEngineSessionStringCache::IsUsable())
+	{
+		if (SHArrayToFStringArray_Batch(InStringIdArray, OutStringArray, Session))
+			return true;
+
+		return SHArrayToFStringArray_Singles(InStringIdArray, OutStringArray, Session);
+	}
+
+	// Use the cached strings, and only ask HAPI for the missing ones
+	FHoudiniEngineSessionStringCache& Cache = FHoudiniEngineSessionStringCache::Get(Session);
+	const uint64 Generation = FHoudiniEngineSessionStringCache::GetGeneration();
+
+	TArray<int32> MissingIds;
+	TArray<int32> MissingIndices;
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		if (!Cache.Find(InStringIdArray[IdxSH], Generation, OutStringArray[IdxSH]))
+		{
+			MissingIds.Add(InStringIdArray[IdxSH]);
+			MissingIndices.Add(IdxSH);
+		}
+	}
+
+	if (MissingIds.Num() <= 0)
 		return true;
 
-	return SHArrayToFStringArray_Singles(InStringIdArray, OutStringArray, InSession);
+	TArray<FString> MissingStrings;
+	MissingStrings.SetNum(MissingIds.Num());
+	const bool bSuccess = SHArrayToFStringArray_Batch(MissingIds, MissingStrings.GetData(), Session)
+		|| SHArrayToFStringArray_Singles(MissingIds, MissingStrings.GetData(), Session);
+
+	for (int32 Idx = 0; Idx < MissingIds.Num(); Idx++)
+	{
+		if (bSuccess)
+			Cache.Add(MissingIds[Idx], MissingStrings[Idx], Generation);
+
+		OutStringArray[MissingIndices[Idx]] = MoveTemp(MissingStrings[Idx]);
+	}
+
+	return bSuccess;
 }
 
 bool
@@ -236,23 +382,24 @@ FHoudiniEngineString::SHArrayToFStringArray_Batch(
 
     TArray<int32> UniqueSHArray = UniqueSH.Array();
 
+	const HAPI_Session* Session = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+
 	int32 BufferSize = 0;
 	TArray<char> Buffer;
 	{
-		// We can only get one string batch at a time. Otherwise another thread could clear the 
+		// We can only get one string batch at a time per session. Otherwise another thread could clear the 
 		// string table data before actually get to retrieve it.
-		FScopeLock GetStringDataScopeLock(&GetStringCriticalSection);
+		FScopeLock GetStringDataScopeLock(&FHoudiniEngineSessionStringCache::Get(Session).StringBatchLock);
 
 		if (HAPI_RESULT_SUCCESS
-			!= FHoudiniApi::GetStringBatchSize(InSession ? InSession : FHoudiniEngine::Get().GetSession(), UniqueSHArray.GetData(),
-											   UniqueSHArray.Num(), &BufferSize))
+			!= FHoudiniApi::GetStringBatchSize(Session, UniqueSHArray.GetData(), UniqueSHArray.Num(), &BufferSize))
 			return false;
 
 		if (BufferSize <= 0)
 			return false;
 
 		Buffer.SetNumZeroed(BufferSize);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(InSession ? InSession : FHoudiniEngine::Get().GetSession(), &Buffer[0], BufferSize))
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(Session, &Buffer[0], BufferSize))
 			return false;
 	}
 
@@ -318,6 +465,25 @@ FHoudiniEngineString::SHArrayToFStringArray_Singles(
 	return bReturn;
 }
 
+void
+FHoudiniEngineString::InvalidateStringCache()
+{
+	FHoudiniEngineSessionStringCache::Invalidate();
+}
+
+void
+FHoudiniEngineString::SetStringCacheEnabled(bool bInEnabled)
+{
+	FHoudiniEngineSessionStringCache::bEnabled = bInEnabled;
+	FHoudiniEngineSessionStringCache::Invalidate();
+}
+
+bool
+FHoudiniEngineString::IsStringCacheEnabled()
+{
+	return FHoudiniEngineSessionStringCache::bEnabled;
+}
+
 const FString& FHoudiniEngineIndexedStringMap::GetStringForIndex(int Index) const
 {
     StringId Id = Ids[Index];
@@ -71,7 +71,7 @@ class HOUDINIENGINE_API FHoudiniEngineString
 			FText& Text,
 			const HAPI_Session* InSession = nullptr);
 
-		// Array converter, uses a map to avoid redudant calls to HAPI
+		// Array converter, uses the string cache and string batches to avoid redudant calls to HAPI
 		static bool SHArrayToFStringArray( const TArray<int32>& InStringIdArray, FString* OutStringArray, const HAPI_Session* InSession = nullptr);
 		static bool SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString> & OutStringArray, const HAPI_Session* InSession = nullptr);
 
@@ -87,6 +87,15 @@ class HOUDINIENGINE_API FHoudiniEngineString
 			FString*  OutStringArray,
 			const HAPI_Session* InSession = nullptr);
 
+		// Drops the strings cached for all sessions.
+		// String handles are only valid until the next cook, so this must be called when a cook starts or finishes.
+		static void InvalidateStringCache();
+
+		// Enables/disables the session string cache. When disabled, every conversion goes through HAPI.
+		// The cache is never used in Session Sync, as Houdini can then cook without the plugin knowing.
+		static void SetStringCacheEnabled(bool bInEnabled);
+		static bool IsStringCacheEnabled();
+
 		// Return id of this string.
 		int32 GetId() const;
 
@@ -97,12 +106,6 @@ class HOUDINIENGINE_API FHoudiniEngineString
 
 		// Id of the underlying Houdini Engine string.
 		int32 StringId;
-
-	private:
-
-		// Needed to lock the HAPI string table, otherwise it may get cleared by a HAPI call from
-		// another thread.
-		static FCriticalSection GetStringCriticalSection;
 };
 
 class FHoudiniEngineRawStrings
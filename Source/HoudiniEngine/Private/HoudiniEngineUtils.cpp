@@ -52,9 +52,11 @@
 #include "HoudiniEngineTimers.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniHashUtils.h"
 #include "HoudiniInput.h"
 #include "HoudiniParameter.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniSessionJournal.h"
 
 #if WITH_EDITOR
 	#include "SAssetSelectionWidget.h"
@@ -76,6 +78,7 @@
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
 #include "InstancedFoliageActor.h"
 #include "Interfaces/IPluginManager.h"
 #include "LandscapeStreamingProxy.h"
@@ -359,11 +362,16 @@ FHoudiniEngineUtils::GetConnectionError()
 void
 FHoudiniEngineUtils::MarkAllHACsAsNeedInstantiation()
 {	
-	// Notify all the HoudiniAssetComponents that they need to re instantiate themselves in the new Houdini engine session.
+	// Restore the HACs recorded in the session journal directly in the new session, without recooking them.
+	// This carries on over the next ticks of the Houdini Engine manager.
+	TSet<UHoudiniAssetComponent*> RehydratingHACs;
+	FHoudiniSessionJournal::StartRehydrate(RehydratingHACs);
+
+	// Notify all the other HoudiniAssetComponents that they need to re instantiate themselves in the new Houdini engine session.
 	for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
 	{
 		UHoudiniAssetComponent * HoudiniAssetComponent = *Itr;
-		if (!IsValid(HoudiniAssetComponent))
+		if (!IsValid(HoudiniAssetComponent) || RehydratingHACs.Contains(HoudiniAssetComponent))
 			continue;
 
 		HoudiniAssetComponent->MarkAsNeedInstantiation();
@@ -1650,8 +1658,137 @@ FHoudiniEngineUtils::LocateLibHAPIInRegistry(
 }
 #endif
 
+namespace
+{
+	// Asset libraries loaded in each session, keyed on the session and the content of the HDA they were loaded from.
+	// HAPI keeps a library loaded for the lifetime of the session, so loading the same content again can reuse its id.
+	class FHoudiniAssetLibraryRegistry
+	{
+	public:
+		using FKey = TTuple<int32, int64, uint64>;
+
+		static FKey MakeKey(const HAPI_Session* InSession, uint64 InContentHash)
+		{
+			return FKey((int32)InSession->type, (int64)InSession->id, InContentHash);
+		}
+
+		static bool Find(const FKey& InKey, HAPI_AssetLibraryId& OutAssetLibraryId)
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (const HAPI_AssetLibraryId* Found = Libraries.Find(InKey))
+			{
+				OutAssetLibraryId = *Found;
+				return true;
+			}
+			return false;
+		}
+
+		static void Add(const FKey& InKey, HAPI_AssetLibraryId InAssetLibraryId)
+		{
+			FScopeLock ScopeLock(&Lock);
+			Libraries.Add(InKey, InAssetLibraryId);
+		}
+
+		static void Empty()
+		{
+			FScopeLock ScopeLock(&Lock);
+			Libraries.Empty();
+		}
+
+		static std::atomic<bool> bEnabled;
+
+	private:
+		static FCriticalSection Lock;
+		static TMap<FKey, HAPI_AssetLibraryId> Libraries;
+	};
+
+	FCriticalSection FHoudiniAssetLibraryRegistry::Lock;
+	TMap<FHoudiniAssetLibraryRegistry::FKey, HAPI_AssetLibraryId> FHoudiniAssetLibraryRegistry::Libraries;
+	std::atomic<bool> FHoudiniAssetLibraryRegistry::bEnabled(true);
+
+	uint64 HashFileStat(const FString& InFileName, const FFileStatData& InStatData, uint64 InSeed)
+	{
+		const FString NormalizedName = InFileName.ToLower();
+		uint64 Hash = CityHash64WithSeed(reinterpret_cast<const char*>(*NormalizedName), NormalizedName.Len() * sizeof(TCHAR), InSeed);
+		const int64 Size = InStatData.FileSize;
+		const int64 Ticks = InStatData.ModificationTime.GetTicks();
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Size), sizeof(Size), Hash);
+		return CityHash64WithSeed(reinterpret_cast<const char*>(&Ticks), sizeof(Ticks), Hash);
+	}
+
+	// Hashes what LoadHoudiniAsset can load for an HDA: its memory copy, and its source file's (or expanded
+	// directory's) paths, sizes and timestamps, so that any change to the HDA results in a different hash.
+	uint64 GetHoudiniAssetContentHash(const UHoudiniAsset* InHoudiniAsset, const FString& InAssetFileName, bool bInCanLoadFromMemory, bool bInCanLoadFromFile)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(GetHoudiniAssetContentHash);
+
+		uint64 Hash = 0;
+		if (bInCanLoadFromMemory)
+		{
+			Hash = CityHash64WithSeed(
+				reinterpret_cast<const char*>(InHoudiniAsset->GetAssetBytes()), InHoudiniAsset->GetAssetBytesCount(), Hash);
+		}
+
+		if (bInCanLoadFromFile)
+		{
+			IFileManager& FileManager = IFileManager::Get();
+			if (InHoudiniAsset->IsExpandedHDA())
+			{
+				// Combine the files of the expanded HDA independently of the order they are visited in
+				uint64 FilesHash = 0;
+				FileManager.IterateDirectoryStatRecursively(*InAssetFileName,
+					[&FilesHash](const TCHAR* InFileName, const FFileStatData& InStatData)
+					{
+						if (!InStatData.bIsDirectory)
+							FilesHash ^= HashFileStat(InFileName, InStatData, 0);
+						return true;
+					});
+				Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&FilesHash), sizeof(FilesHash), Hash);
+			}
+			else
+			{
+				Hash = HashFileStat(InAssetFileName, FileManager.GetStatData(*InAssetFileName), Hash);
+			}
+		}
+
+		return Hash;
+	}
+
+	// Resolves where LoadHoudiniAsset can load an HDA from: its source file (or expanded directory) and/or its memory copy
+	void GetHoudiniAssetSource(const UHoudiniAsset* InHoudiniAsset, FString& OutAssetFileName, bool& bOutCanLoadFromMemory, bool& bOutCanLoadFromFile)
+	{
+		// Get the HDA's file path, using the AssetImportData if we have it
+		OutAssetFileName = (InHoudiniAsset->AssetImportData != nullptr) ? InHoudiniAsset->AssetImportData->GetFirstFilename() : InHoudiniAsset->GetAssetFileName();
+		// We need to convert relative file path to absolute
+		if (FPaths::IsRelative(OutAssetFileName))
+			OutAssetFileName = FPaths::ConvertRelativePathToFull(OutAssetFileName);
+
+		// We need to modify the file name for expanded .hdas
+		FString FileExtension = FPaths::GetExtension(OutAssetFileName);
+		if (FileExtension.Compare(TEXT("hdalibrary"), ESearchCase::IgnoreCase) == 0)
+		{
+			// the .hda directory is what we should be loading
+			OutAssetFileName = FPaths::GetPath(OutAssetFileName);
+		}
+
+		//Check whether we can Load from file/memory
+		bOutCanLoadFromMemory = (!InHoudiniAsset->IsExpandedHDA() && InHoudiniAsset->GetAssetBytesCount() > 0);
+		
+		// If the hda file exists, we can simply load it directly
+		bOutCanLoadFromFile = false;
+		if ( !OutAssetFileName.IsEmpty() )
+		{
+			if (FPaths::FileExists(OutAssetFileName)
+				|| (InHoudiniAsset->IsExpandedHDA() && FPaths::DirectoryExists(OutAssetFileName)))
+			{
+				bOutCanLoadFromFile = true;
+			}
+		}
+	}
+}
+
 bool
-FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId& OutAssetLibraryId)
+FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId& OutAssetLibraryId, const HAPI_Session* InSession)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::LoadHoudiniAsset);
 
@@ -1660,6 +1797,10 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 	if (!IsValid(HoudiniAsset))
 		return false;
 
+	const HAPI_Session* Session = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+	if (!Session)
+		return false;
+
 	if (!FHoudiniEngineUtils::IsInitialized())
 	{
 		// If we're not initialized now, it likely means the session has been lost
@@ -1673,32 +1814,20 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 	if (HoudiniRuntimeSettings)
 		bMemoryCopyFirst = HoudiniRuntimeSettings->bPreferHdaMemoryCopyOverHdaSourceFile;
 
-	// Get the HDA's file path, using the AssetImportData if we have it
-	FString AssetFileName = (HoudiniAsset->AssetImportData != nullptr) ? HoudiniAsset->AssetImportData->GetFirstFilename() : HoudiniAsset->GetAssetFileName();
-	// We need to convert relative file path to absolute
-	if (FPaths::IsRelative(AssetFileName))
-		AssetFileName = FPaths::ConvertRelativePathToFull(AssetFileName);
-
-	// We need to modify the file name for expanded .hdas
-	FString FileExtension = FPaths::GetExtension(AssetFileName);
-	if (FileExtension.Compare(TEXT("hdalibrary"), ESearchCase::IgnoreCase) == 0)
-	{
-		// the .hda directory is what we should be loading
-		AssetFileName = FPaths::GetPath(AssetFileName);
-	}
-
-	//Check whether we can Load from file/memory
-	bool bCanLoadFromMemory = (!HoudiniAsset->IsExpandedHDA() && HoudiniAsset->GetAssetBytesCount() > 0);
-		
-	// If the hda file exists, we can simply load it directly
+	FString AssetFileName;
+	bool bCanLoadFromMemory = false;
 	bool bCanLoadFromFile = false;
-	if ( !AssetFileName.IsEmpty() )
+	GetHoudiniAssetSource(HoudiniAsset, AssetFileName, bCanLoadFromMemory, bCanLoadFromFile);
+
+	// Reuse the library if this HDA has already been loaded in this session
+	const bool bUseLibraryRegistry = IsAssetLibraryCacheEnabled() && (bCanLoadFromMemory || bCanLoadFromFile);
+	FHoudiniAssetLibraryRegistry::FKey LibraryKey;
+	if (bUseLibraryRegistry)
 	{
-		if (FPaths::FileExists(AssetFileName)
-			|| (HoudiniAsset->IsExpandedHDA() && FPaths::DirectoryExists(AssetFileName)))
-		{
-			bCanLoadFromFile = true;
-		}
+		LibraryKey = FHoudiniAssetLibraryRegistry::MakeKey(
+			Session, GetHoudiniAssetContentHash(HoudiniAsset, AssetFileName, bCanLoadFromMemory, bCanLoadFromFile));
+		if (FHoudiniAssetLibraryRegistry::Find(LibraryKey, OutAssetLibraryId))
+			return true;
 	}
 
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
@@ -1728,22 +1857,22 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 	};
 
 	// Lambda to load an HDA from file
-	auto LoadAssetFromFile = [&Result, &OutAssetLibraryId](const FString& InAssetFileName)
+	auto LoadAssetFromFile = [&Result, &OutAssetLibraryId, Session](const FString& InAssetFileName)
 	{
 		// Load the asset from file.
 		std::string AssetFileNamePlain;
 		FHoudiniEngineUtils::ConvertUnrealString(InAssetFileName, AssetFileNamePlain);
 		Result = FHoudiniApi::LoadAssetLibraryFromFile(
-			FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &OutAssetLibraryId);
+			Session, AssetFileNamePlain.c_str(), true, &OutAssetLibraryId);
 
 	};
 
 	// Lambda to load an HDA from memory
-	auto LoadAssetFromMemory = [&Result, &OutAssetLibraryId](const UHoudiniAsset* InHoudiniAsset)
+	auto LoadAssetFromMemory = [&Result, &OutAssetLibraryId, Session](const UHoudiniAsset* InHoudiniAsset)
 	{
 		// Load the asset from the cached memory buffer
 		Result = FHoudiniApi::LoadAssetLibraryFromMemory(
-			FHoudiniEngine::Get().GetSession(),
+			Session,
 			reinterpret_cast<const char *>(InHoudiniAsset->GetAssetBytes()),
 			InHoudiniAsset->GetAssetBytesCount(), 
 			true,
@@ -1825,9 +1954,91 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 		return false;
 	}
 
+	if (bUseLibraryRegistry)
+		FHoudiniAssetLibraryRegistry::Add(LibraryKey, OutAssetLibraryId);
+
 	return true;
 }
 
+void
+FHoudiniEngineUtils::PreloadHoudiniAssets()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::PreloadHoudiniAssets);
+
+	// Loading the HDA uobjects requires the game thread
+	if (!IsInGameThread())
+		return;
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || HoudiniRuntimeSettings->PreloadedHoudiniAssets.Num() <= 0)
+		return;
+
+	// Without the registry, the preloaded libraries could not be reused
+	if (!IsAssetLibraryCacheEnabled())
+		return;
+
+	for (const TSoftObjectPtr<UHoudiniAsset>& PreloadedAsset : HoudiniRuntimeSettings->PreloadedHoudiniAssets)
+	{
+		const UHoudiniAsset* HoudiniAsset = PreloadedAsset.LoadSynchronous();
+		if (!IsValid(HoudiniAsset))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Could not preload HDA %s: the asset could not be loaded."), *PreloadedAsset.ToString());
+			continue;
+		}
+
+		for (int32 SessionIndex = 0; SessionIndex < FHoudiniEngine::Get().GetNumSessions(); SessionIndex++)
+		{
+			const HAPI_Session* Session = FHoudiniEngine::Get().GetSession(SessionIndex);
+			if (!Session)
+				continue;
+
+			HAPI_AssetLibraryId AssetLibraryId = -1;
+			if (!LoadHoudiniAsset(HoudiniAsset, AssetLibraryId, Session))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Could not preload HDA %s in session %d."), *HoudiniAsset->GetPathName(), SessionIndex);
+				// A failed load can stop the sessions (e.g. license failure)
+				if (!FHoudiniEngine::Get().GetSession())
+					return;
+			}
+		}
+	}
+}
+
+void
+FHoudiniEngineUtils::InvalidateAssetLibraryCache()
+{
+	FHoudiniAssetLibraryRegistry::Empty();
+}
+
+void
+FHoudiniEngineUtils::SetAssetLibraryCacheEnabled(bool bInEnabled)
+{
+	FHoudiniAssetLibraryRegistry::bEnabled = bInEnabled;
+	FHoudiniAssetLibraryRegistry::Empty();
+}
+
+bool
+FHoudiniEngineUtils::IsAssetLibraryCacheEnabled()
+{
+	return FHoudiniAssetLibraryRegistry::bEnabled;
+}
+
+uint64
+FHoudiniEngineUtils::GetHoudiniAssetContentHash(const UHoudiniAsset* HoudiniAsset)
+{
+	if (!IsValid(HoudiniAsset))
+		return 0;
+
+	FString AssetFileName;
+	bool bCanLoadFromMemory = false;
+	bool bCanLoadFromFile = false;
+	GetHoudiniAssetSource(HoudiniAsset, AssetFileName, bCanLoadFromMemory, bCanLoadFromFile);
+	if (!bCanLoadFromMemory && !bCanLoadFromFile)
+		return 0;
+
+	return ::GetHoudiniAssetContentHash(HoudiniAsset, AssetFileName, bCanLoadFromMemory, bCanLoadFromFile);
+}
+
 bool
 FHoudiniEngineUtils::GetSubAssetNames(
 	const HAPI_AssetLibraryId& AssetLibraryId,
@@ -4855,6 +5066,11 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	}
 	else
 	{
+		// Skip the HAPI call if the part's attribute manifest already tells us the attribute is not there
+		const FHoudiniPartAttributeManifest* Manifest = FHoudiniPartAttributeManifest::Find(GeoId, PartId);
+		if (Manifest && Manifest->IsAttributeMissing(AttribName, Owner))
+			return false;
+
 		HAPI_AttributeInfo AttribInfo;
 		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
 
@@ -4897,6 +5113,17 @@ FHoudiniEngineUtils::IsAttributeInstancer(const HAPI_NodeId& GeoId, const HAPI_P
 
 bool FHoudiniEngineUtils::IsValidDataTable(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId)
 {
+	const auto IsDataTableAttribute = [](const FString& Name)
+	{
+		return Name.StartsWith(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX)
+			&& Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWNAME
+			&& Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWSTRUCT;
+	};
+
+	// Use the part's attribute manifest if we have one
+	if (const FHoudiniPartAttributeManifest* Manifest = FHoudiniPartAttributeManifest::Find(GeoId, PartId))
+		return Manifest->GetAttributeNames(HAPI_ATTROWNER_POINT).ContainsByPredicate(IsDataTableAttribute);
+
 	HAPI_PartInfo PartInfo;
 	HAPI_Result Error = FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(),
 		GeoId, PartId, &PartInfo);
@@ -4918,15 +5145,7 @@ bool FHoudiniEngineUtils::IsValidDataTable(const HAPI_NodeId& GeoId, const HAPI_
 	}
 	TArray<FString> AttribNames;
 	FHoudiniEngineString::SHArrayToFStringArray(AttribNameHandles, AttribNames);
-	for (const FString & Name : AttribNames)
-	{
-		if (Name.StartsWith(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX) && Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWNAME && Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWSTRUCT)
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return AttribNames.ContainsByPredicate(IsDataTableAttribute);
 }
 
 bool
@@ -5928,24 +6147,34 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::GetGenericAttributeList);
 	
-	// Get the part info to get the attribute counts for the specified owner
-	HAPI_PartInfo PartInfo;
-	FHoudiniApi::PartInfo_Init(&PartInfo);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
-		FHoudiniEngine::Get().GetSession(), InGeoNodeId, InPartId, &PartInfo), false);
-	
-	int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
-
-	// Get all attribute names for that part
-	TArray<HAPI_StringHandle> AttribNameSHArray;
-	AttribNameSHArray.SetNum(nAttribCount);
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
-		FHoudiniEngine::Get().GetSession(),
-		InGeoNodeId, InPartId, AttributeOwner,
-		AttribNameSHArray.GetData(), nAttribCount))
+	// Get all attribute names for that part, from its attribute manifest if we have one
+	TArray<FString> AttribNames;
+	if (const FHoudiniPartAttributeManifest* Manifest = FHoudiniPartAttributeManifest::Find(InGeoNodeId, InPartId))
 	{
-		return 0;
-	}	
+		AttribNames = Manifest->GetAttributeNames(AttributeOwner);
+	}
+	else
+	{
+		// Get the part info to get the attribute counts for the specified owner
+		HAPI_PartInfo PartInfo;
+		FHoudiniApi::PartInfo_Init(&PartInfo);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
+			FHoudiniEngine::Get().GetSession(), InGeoNodeId, InPartId, &PartInfo), false);
+
+		int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
+
+		TArray<HAPI_StringHandle> AttribNameSHArray;
+		AttribNameSHArray.SetNum(nAttribCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoNodeId, InPartId, AttributeOwner,
+			AttribNameSHArray.GetData(), nAttribCount))
+		{
+			return 0;
+		}
+
+		FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNames);
+	}
 
 	// For everything but detail attribute,
 	// if an attribute index was specified, only extract the attribute value for that specific index
@@ -5960,11 +6189,8 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 	}
 
 	int32 FoundCount = 0;
-	for (int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx)
+	for (const FString& AttribName : AttribNames)
 	{
-		int32 AttribNameSH = (int32)AttribNameSHArray[Idx];
-		FString AttribName = TEXT("");
-		FHoudiniEngineString::ToFString(AttribNameSH, AttribName);
 		if (!AttribName.StartsWith(InGenericAttributePrefix, ESearchCase::IgnoreCase))
 			continue;
 
@@ -6993,6 +7219,233 @@ FHoudiniEngineUtils::HapiGetCookCount(const HAPI_NodeId& InNodeId)
 	return CookCount;
 }
 
+namespace
+{
+	// Combines InOutHash with the values of an attribute, read as the widest type of their storage
+	bool HashAttributeValues(FHoudiniHapiAccessor& InAccessor, const HAPI_AttributeInfo& InAttributeInfo, HAPI_AttributeOwner InOwner, uint64& InOutHash)
+	{
+		auto HashValues = [&InOutHash](const auto& InValues)
+		{
+			InOutHash = FHoudiniHashUtils::HashBytes(InOutHash, InValues.GetData(), InValues.Num() * InValues.GetTypeSize());
+		};
+
+		auto HashStrings = [&InOutHash](const TArray<FString>& InValues)
+		{
+			for (const FString& Value : InValues)
+				InOutHash = FHoudiniHashUtils::HashString(InOutHash, Value);
+		};
+
+		switch (InAttributeInfo.storage)
+		{
+			case HAPI_STORAGETYPE_FLOAT:
+			case HAPI_STORAGETYPE_FLOAT64:
+			{
+				TArray<double> Values;
+				if (!InAccessor.GetAttributeData(InAttributeInfo, Values))
+					return false;
+				HashValues(Values);
+				return true;
+			}
+
+			case HAPI_STORAGETYPE_INT:
+			case HAPI_STORAGETYPE_INT64:
+			case HAPI_STORAGETYPE_INT8:
+			case HAPI_STORAGETYPE_UINT8:
+			case HAPI_STORAGETYPE_INT16:
+			{
+				TArray<int64> Values;
+				if (!InAccessor.GetAttributeData(InAttributeInfo, Values))
+					return false;
+				HashValues(Values);
+				return true;
+			}
+
+			case HAPI_STORAGETYPE_STRING:
+			{
+				TArray<FString> Values;
+				if (!InAccessor.GetAttributeData(InAttributeInfo, Values))
+					return false;
+				HashStrings(Values);
+				return true;
+			}
+
+			case HAPI_STORAGETYPE_FLOAT_ARRAY:
+			case HAPI_STORAGETYPE_FLOAT64_ARRAY:
+			{
+				TArray<double> Values;
+				TArray<int> Sizes;
+				if (!InAccessor.GetAttributeArrayData(InOwner, Values, Sizes))
+					return false;
+				HashValues(Sizes);
+				HashValues(Values);
+				return true;
+			}
+
+			case HAPI_STORAGETYPE_INT_ARRAY:
+			case HAPI_STORAGETYPE_INT64_ARRAY:
+			case HAPI_STORAGETYPE_INT8_ARRAY:
+			case HAPI_STORAGETYPE_UINT8_ARRAY:
+			case HAPI_STORAGETYPE_INT16_ARRAY:
+			{
+				TArray<int64> Values;
+				TArray<int> Sizes;
+				if (!InAccessor.GetAttributeArrayData(InOwner, Values, Sizes))
+					return false;
+				HashValues(Sizes);
+				HashValues(Values);
+				return true;
+			}
+
+			case HAPI_STORAGETYPE_STRING_ARRAY:
+			{
+				TArray<FString> Values;
+				TArray<int> Sizes;
+				if (!InAccessor.GetAttributeArrayData(InOwner, Values, Sizes))
+					return false;
+				HashValues(Sizes);
+				HashStrings(Values);
+				return true;
+			}
+
+			default:
+				// Dictionaries can't be read by the accessor
+				return false;
+		}
+	}
+}
+
+bool
+FHoudiniEngineUtils::HapiGetGeoContentHash(const HAPI_NodeId& InGeoId, uint64& OutHash)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::HapiGetGeoContentHash);
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	HAPI_GeoInfo GeoInfo;
+	FHoudiniApi::GeoInfo_Init(&GeoInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetGeoInfo(Session, InGeoId, &GeoInfo), false);
+
+	const int32 GeoHeader[] = { (int32)GeoInfo.type, GeoInfo.partCount };
+	uint64 Hash = FHoudiniHashUtils::HashBytes(0, GeoHeader, sizeof(GeoHeader));
+
+	for (int32 PartIdx = 0; PartIdx < GeoInfo.partCount; PartIdx++)
+	{
+		HAPI_PartInfo PartInfo;
+		FHoudiniApi::PartInfo_Init(&PartInfo);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(Session, InGeoId, PartIdx, &PartInfo), false);
+
+		// Voxels are not hashed
+		if (PartInfo.type == HAPI_PARTTYPE_VOLUME)
+			return false;
+
+		const int32 PartHeader[] = {
+			(int32)PartInfo.type, PartInfo.faceCount, PartInfo.vertexCount, PartInfo.pointCount,
+			PartInfo.instancedPartCount, PartInfo.instanceCount };
+		Hash = FHoudiniHashUtils::HashBytes(Hash, PartHeader, sizeof(PartHeader));
+
+		// Topology
+		if (PartInfo.type == HAPI_PARTTYPE_MESH)
+		{
+			TArray<int32> FaceCounts;
+			FaceCounts.SetNumUninitialized(PartInfo.faceCount);
+			if (PartInfo.faceCount > 0)
+			{
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetFaceCounts(
+					Session, InGeoId, PartIdx, FaceCounts.GetData(), 0, PartInfo.faceCount), false);
+			}
+
+			TArray<int32> VertexList;
+			VertexList.SetNumUninitialized(PartInfo.vertexCount);
+			if (PartInfo.vertexCount > 0)
+			{
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetVertexList(
+					Session, InGeoId, PartIdx, VertexList.GetData(), 0, PartInfo.vertexCount), false);
+			}
+
+			Hash = FHoudiniHashUtils::HashBytes(Hash, FaceCounts.GetData(), FaceCounts.Num() * sizeof(int32));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, VertexList.GetData(), VertexList.Num() * sizeof(int32));
+		}
+		else if (PartInfo.type == HAPI_PARTTYPE_CURVE)
+		{
+			HAPI_CurveInfo CurveInfo;
+			FHoudiniApi::CurveInfo_Init(&CurveInfo);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetCurveInfo(Session, InGeoId, PartIdx, &CurveInfo), false);
+
+			TArray<int32> CurveCounts;
+			CurveCounts.SetNumUninitialized(CurveInfo.curveCount);
+			if (CurveInfo.curveCount > 0)
+			{
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetCurveCounts(
+					Session, InGeoId, PartIdx, CurveCounts.GetData(), 0, CurveInfo.curveCount), false);
+			}
+
+			const int32 CurveHeader[] = {
+				(int32)CurveInfo.curveType, CurveInfo.order, CurveInfo.isPeriodic, CurveInfo.isRational, CurveInfo.isClosed };
+			Hash = FHoudiniHashUtils::HashBytes(Hash, CurveHeader, sizeof(CurveHeader));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, CurveCounts.GetData(), CurveCounts.Num() * sizeof(int32));
+		}
+		else if (PartInfo.type == HAPI_PARTTYPE_INSTANCER)
+		{
+			TArray<HAPI_PartId> InstancedPartIds;
+			InstancedPartIds.SetNumUninitialized(PartInfo.instancedPartCount);
+			if (PartInfo.instancedPartCount > 0)
+			{
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetInstancedPartIds(
+					Session, InGeoId, PartIdx, InstancedPartIds.GetData(), 0, PartInfo.instancedPartCount), false);
+			}
+
+			TArray<HAPI_Transform> InstanceTransforms;
+			InstanceTransforms.SetNumUninitialized(PartInfo.instanceCount);
+			if (PartInfo.instanceCount > 0)
+			{
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetInstancerPartTransforms(
+					Session, InGeoId, PartIdx, HAPI_RSTORDER_DEFAULT, InstanceTransforms.GetData(), 0, PartInfo.instanceCount), false);
+			}
+
+			Hash = FHoudiniHashUtils::HashBytes(Hash, InstancedPartIds.GetData(), InstancedPartIds.Num() * sizeof(HAPI_PartId));
+			for (const HAPI_Transform& Transform : InstanceTransforms)
+			{
+				Hash = FHoudiniHashUtils::HashBytes(Hash, Transform.position, sizeof(Transform.position));
+				Hash = FHoudiniHashUtils::HashBytes(Hash, Transform.rotationQuaternion, sizeof(Transform.rotationQuaternion));
+				Hash = FHoudiniHashUtils::HashBytes(Hash, Transform.scale, sizeof(Transform.scale));
+				Hash = FHoudiniHashUtils::HashBytes(Hash, Transform.shear, sizeof(Transform.shear));
+			}
+		}
+
+		// Attributes, with their values
+		FHoudiniPartAttributeManifest Manifest;
+		if (!Manifest.Build(InGeoId, PartIdx, PartInfo))
+			return false;
+
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+		{
+			const HAPI_AttributeOwner Owner = (HAPI_AttributeOwner)OwnerIdx;
+			for (const FString& AttributeName : Manifest.GetAttributeNames(Owner))
+			{
+				// The accessor keeps a pointer to the name
+				const FTCHARToUTF8 AttributeNameUtf8(*AttributeName);
+				FHoudiniHapiAccessor Accessor(InGeoId, PartIdx, AttributeNameUtf8.Get());
+
+				HAPI_AttributeInfo AttributeInfo;
+				FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+				if (!Accessor.GetInfo(AttributeInfo, Owner))
+					return false;
+
+				const int64 AttributeHeader[] = {
+					OwnerIdx, (int64)AttributeInfo.storage, AttributeInfo.tupleSize, AttributeInfo.count, AttributeInfo.totalArrayElements };
+				Hash = FHoudiniHashUtils::HashString(Hash, AttributeName);
+				Hash = FHoudiniHashUtils::HashBytes(Hash, AttributeHeader, sizeof(AttributeHeader));
+
+				if (!HashAttributeValues(Accessor, AttributeInfo, Owner, Hash))
+					return false;
+			}
+		}
+	}
+
+	OutHash = Hash;
+	return true;
+}
+
 bool
 FHoudiniEngineUtils::GetLevelPathAttribute(
 	const HAPI_NodeId& InGeoId,
@@ -7753,6 +8206,9 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	if (InNodeId < 0)
 		return false;
 
+	// String handles fetched before the cook might not be valid after it
+	FHoudiniEngineString::InvalidateStringCache();
+
 	// No Cook Options were specified, use the default one
 	if (InCookOptions == nullptr)
 	{
@@ -7781,6 +8237,9 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
 			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
+		if (Status <= HAPI_STATE_MAX_READY_STATE)
+			FHoudiniEngineString::InvalidateStringCache();
+
 		if (Status == HAPI_STATE_READY)
 		{
 			// The cook has been successful.
@@ -124,6 +124,7 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 
 		// Helper function used to indicate to all HAC that they need to be instantiated in the new HE session
 		// Needs to be call after starting/restarting/connecting/session syncing a HE session..
+		// HACs recorded in the session journal are restored directly in the new session instead.
 		static void MarkAllHACsAsNeedInstantiation();
 
 		// Return the errors, warning and messages on a specified node
@@ -152,6 +153,10 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 
 		static int32 HapiGetCookCount(const HAPI_NodeId& InNodeId);
 
+		// HAPI : Hash of a cooked SOP node's geometry: its parts' topology, instances and attribute values.
+		// Returns false if the geometry could not be read, or has parts whose content is not hashed (volumes, dictionaries).
+		static bool HapiGetGeoContentHash(const HAPI_NodeId& InGeoId, uint64& OutHash);
+
 		// HAPI : Retrieve the asset node's object transform. **/
 		static bool HapiGetAssetTransform(const HAPI_NodeId& InNodeId, FTransform& OutTransform);
 
@@ -409,9 +414,24 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		static bool DeleteHoudiniNode(const HAPI_NodeId& InNodeId);
 
 		// Loads an HDA file and returns its AssetLibraryId
+		// Libraries are registered per session on the HDA's content, so loading the same HDA again reuses its library.
 		static bool LoadHoudiniAsset(
 			const UHoudiniAsset * HoudiniAsset,
-			HAPI_AssetLibraryId & OutAssetLibraryId);
+			HAPI_AssetLibraryId & OutAssetLibraryId,
+			const HAPI_Session* InSession = nullptr);
+
+		// Loads the HDAs listed in the runtime settings' PreloadedHoudiniAssets in every session
+		static void PreloadHoudiniAssets();
+
+		// Forget the libraries loaded by LoadHoudiniAsset, needed when sessions are stopped or restarted
+		static void InvalidateAssetLibraryCache();
+
+		// Enables/disables reusing the libraries loaded by LoadHoudiniAsset. Disabling it also empties it.
+		static void SetAssetLibraryCacheEnabled(bool bInEnabled);
+		static bool IsAssetLibraryCacheEnabled();
+
+		// Returns a hash of the HDA content LoadHoudiniAsset would load, or 0 if it cannot be loaded
+		static uint64 GetHoudiniAssetContentHash(const UHoudiniAsset* HoudiniAsset);
 		
 		// Returns the name of the available subassets in a loaded HDA
 		static bool GetSubAssetNames(
@@ -46,6 +46,11 @@
 #include "Rendering/SlateRenderer.h"
 #include "Framework/Application/SlateApplication.h"
 #include "HAL/ThreadManager.h"
+#include "HAL/FileManager.h"
+#include "Async/Async.h"
+#include "Misc/SecureHash.h"
+#include "Misc/FileHelper.h"
+#include "Dom/JsonObject.h"
 
 #include "HoudiniPackageParams.h"
 #include "HoudiniGeoImporter.h"
@@ -82,7 +87,11 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"guid",
 		"watch",
 		"managerpid",
-		"bake"
+		"bake",
+		"debounce",
+		"workers",
+		"manifest",
+		"scan"
 	};
 
 	HelpParamDescriptions = {
@@ -91,7 +100,11 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"Specify a GUID for the commandlet. Useful to identify the commandlet when the messaging system is used.",
 		"A directory to watch for new .bgeo files to import.",
 		"The PID of the owner/manager process. If the manager process dies the commandlet also quits.",
-		"Bake generated assets. Instancers are baked to blueprints. Not supported in -listen mode."
+		"Bake generated assets. Instancers are baked to blueprints. Not supported in -listen mode.",
+		"In -watch mode, the number of seconds a file's size and modification time must remain stable before it is imported (default 1).",
+		"In -watch mode, the maximum number of files hashed concurrently (default 4).",
+		"In -watch mode, the path of the content hash manifest used to skip unchanged files across runs. Use -manifest=none to disable it.",
+		"In -watch mode, also queue the .bgeo files already present in the watched directory."
 	};
 
 	IsClient = false;
@@ -105,6 +118,10 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 
 	Mode = EHoudiniGeoImportCommandletMode::None;
 	bBakeOutputs = false;
+
+	DebounceSeconds = 1.0;
+	MaxWorkers = 4;
+	MaxImportsPerTick = 1;
 }
 
 void UHoudiniGeoImportCommandlet::PrintUsage() const
@@ -153,32 +170,222 @@ void UHoudiniGeoImportCommandlet::PopulatePackageParams(const FString &InBGEOFil
 
 void UHoudiniGeoImportCommandlet::TickDiscoveredFiles()
 {
-	for (auto &FileDataEntry : DiscoveredFiles)
+	const double Now = FPlatformTime::Seconds();
+
+	// 1. Debounce pending files: wait until their size and modification time stop changing,
+	// then hand them to the worker pool to compute their content hash.
+	for (auto& FileDataEntry : DiscoveredFiles)
 	{
-		FDiscoveredFileData &FileData = FileDataEntry.Value;
-		if (FileData.bImportNextTick && !FileData.bImported)
+		FDiscoveredFileData& FileData = FileDataEntry.Value;
+		if (FileData.State != EDiscoveredFileState::Pending)
+			continue;
+
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*FileData.FileName);
+		if (!StatData.bIsValid || StatData.bIsDirectory)
 		{
-			FileData.bImportNextTick = false;
-			FileData.ImportAttempts++;
-			
-			FHoudiniPackageParams PackageParams;
-			PopulatePackageParams(FileData.FileName, PackageParams);
-			TArray<UHoudiniOutput*> Outputs;
-			int32 Error = ImportBGEO(FileData.FileName, PackageParams, Outputs);
-			if (Error == 0)
-			{
-				FileData.bImported = true;
-				HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Done"), *FileData.FileName);
-			}
-			else
-			{
-				FileData.bImported = false;
-				HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Failed (%d)"), *FileData.FileName, Error);
-			}
+			// The file might not be fully created yet, keep waiting.
+			FileData.LastChangeTime = Now;
+			continue;
+		}
+
+		if (StatData.FileSize != FileData.LastFileSize || StatData.ModificationTime != FileData.LastModificationTime)
+		{
+			// Still being written
+			FileData.LastFileSize = StatData.FileSize;
+			FileData.LastModificationTime = StatData.ModificationTime;
+			FileData.LastChangeTime = Now;
+			continue;
+		}
+
+		if (Now - FileData.LastChangeTime < DebounceSeconds)
+			continue;
+
+		if (PendingHashes.Num() >= MaxWorkers)
+			continue;
+
+		const FString FileName = FileData.FileName;
+		PendingHashes.Add(FileName, Async(EAsyncExecution::ThreadPool, [FileName]()
+		{
+			return LexToString(FMD5Hash::HashFile(*FileName));
+		}));
+		FileData.State = EDiscoveredFileState::Hashing;
+		FileData.bChangedWhileHashing = false;
+	}
+
+	// 2. Collect the finished hashes, skip files whose content was already imported
+	// and queue the others for import.
+	for (auto It = PendingHashes.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsReady())
+			continue;
+
+		const FString Hash = It.Value().Get();
+		FDiscoveredFileData* FileData = DiscoveredFiles.Find(It.Key());
+		It.RemoveCurrent();
+
+		// The file was removed while we were hashing it
+		if (!FileData || FileData->State != EDiscoveredFileState::Hashing)
+			continue;
+
+		if (FileData->bChangedWhileHashing || Hash.IsEmpty())
+		{
+			// The hash is stale (or the file could not be read), wait for the file to stabilize again
+			FileData->State = EDiscoveredFileState::Pending;
+			FileData->LastChangeTime = Now;
+			continue;
 		}
+
+		FileData->ContentHash = Hash;
+		const FString* ImportedHash = ImportManifest.Find(FileData->FileName);
+		if (ImportedHash && *ImportedHash == Hash)
+		{
+			FileData->State = EDiscoveredFileState::Imported;
+			HOUDINI_LOG_DISPLAY(TEXT("Skipping %s, its content has not changed since the last import."), *FileData->FileName);
+			continue;
+		}
+
+		FileData->State = EDiscoveredFileState::Queued;
+		ImportQueue.Add(FileData->FileName);
+	}
+
+	// 3. Import queued files. Import creates UObjects and talks to the HAPI session, so it has to run on
+	// the game thread: limit the number of imports per tick to keep processing change events.
+	int32 NumImported = 0;
+	while (ImportQueue.Num() > 0 && NumImported < MaxImportsPerTick)
+	{
+		const FString FileName = ImportQueue[0];
+		ImportQueue.RemoveAt(0);
+
+		FDiscoveredFileData* FileData = DiscoveredFiles.Find(FileName);
+		if (!FileData || FileData->State != EDiscoveredFileState::Queued)
+			continue;
+
+		ImportDiscoveredFile(*FileData);
+		NumImported++;
 	}
 }
 
+void UHoudiniGeoImportCommandlet::ImportDiscoveredFile(FDiscoveredFileData& InFileData)
+{
+	const uint32 MaxImportAttempts = 3;
+
+	InFileData.ImportAttempts++;
+
+	FHoudiniPackageParams PackageParams;
+	PopulatePackageParams(InFileData.FileName, PackageParams);
+	TArray<UHoudiniOutput*> Outputs;
+	int32 Error = ImportBGEO(InFileData.FileName, PackageParams, Outputs);
+
+	for (UHoudiniOutput* Output : Outputs)
+	{
+		if (IsValid(Output))
+			Output->RemoveFromRoot();
+	}
+	Outputs.Empty();
+
+	if (Error == 0)
+	{
+		InFileData.State = EDiscoveredFileState::Imported;
+		HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Done"), *InFileData.FileName);
+
+		ImportManifest.Add(InFileData.FileName, InFileData.ContentHash);
+		SaveImportManifest();
+	}
+	else if (InFileData.ImportAttempts < MaxImportAttempts)
+	{
+		// Try again once the file is stable, it might have been incomplete
+		InFileData.State = EDiscoveredFileState::Pending;
+		InFileData.LastChangeTime = FPlatformTime::Seconds();
+		HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Failed (%d)"), *InFileData.FileName, Error);
+	}
+	else
+	{
+		InFileData.State = EDiscoveredFileState::Failed;
+		HOUDINI_LOG_WARNING(TEXT("Importing %s... Failed (%d), max attempts exceeded %d"), *InFileData.FileName, Error, InFileData.ImportAttempts);
+	}
+}
+
+void UHoudiniGeoImportCommandlet::NotifyFileChanged(const FString& InFileName)
+{
+	FDiscoveredFileData* FileData = DiscoveredFiles.Find(InFileName);
+	if (!FileData)
+		FileData = &DiscoveredFiles.Add(InFileName, FDiscoveredFileData(InFileName));
+
+	FileData->NumChangeEvents++;
+	FileData->LastChangeTime = FPlatformTime::Seconds();
+
+	switch (FileData->State)
+	{
+		case EDiscoveredFileState::Pending:
+			// Already waiting for the file to stabilize, the new event only extends the debounce
+			break;
+
+		case EDiscoveredFileState::Hashing:
+			FileData->bChangedWhileHashing = true;
+			break;
+
+		case EDiscoveredFileState::Queued:
+			// The stale queue entry is skipped when it is reached
+			FileData->State = EDiscoveredFileState::Pending;
+			break;
+
+		case EDiscoveredFileState::Imported:
+		case EDiscoveredFileState::Failed:
+			// New content: give it a fresh set of attempts
+			FileData->State = EDiscoveredFileState::Pending;
+			FileData->ImportAttempts = 0;
+			break;
+	}
+}
+
+void UHoudiniGeoImportCommandlet::LoadImportManifest()
+{
+	ImportManifest.Empty();
+	if (ManifestFilePath.IsEmpty())
+		return;
+
+	FString ManifestString;
+	if (!FFileHelper::LoadFileToString(ManifestString, *ManifestFilePath))
+		return;
+
+	TSharedPtr<FJsonObject> ManifestJSON;
+	if (!FHoudiniEngineUtils::JSONFromString(ManifestString, ManifestJSON))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Could not parse the import manifest %s, all files will be imported."), *ManifestFilePath);
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* FilesJSON = nullptr;
+	if (!ManifestJSON->TryGetObjectField(TEXT("files"), FilesJSON) || !FilesJSON)
+		return;
+
+	for (const auto& Entry : (*FilesJSON)->Values)
+	{
+		FString Hash;
+		if (Entry.Value.IsValid() && Entry.Value->TryGetString(Hash))
+			ImportManifest.Add(Entry.Key, Hash);
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("Loaded import manifest %s (%d files)"), *ManifestFilePath, ImportManifest.Num());
+}
+
+void UHoudiniGeoImportCommandlet::SaveImportManifest() const
+{
+	if (ManifestFilePath.IsEmpty())
+		return;
+
+	TSharedPtr<FJsonObject> FilesJSON = MakeShared<FJsonObject>();
+	for (const auto& Entry : ImportManifest)
+		FilesJSON->SetStringField(Entry.Key, Entry.Value);
+
+	TSharedPtr<FJsonObject> ManifestJSON = MakeShared<FJsonObject>();
+	ManifestJSON->SetStringField(TEXT("directory"), DirectoryToWatch);
+	ManifestJSON->SetObjectField(TEXT("files"), FilesJSON);
+
+	if (!FFileHelper::SaveStringToFile(FHoudiniEngineUtils::JSONToString(ManifestJSON), *ManifestFilePath))
+		HOUDINI_LOG_WARNING(TEXT("Could not save the import manifest %s"), *ManifestFilePath);
+}
+
 int32 UHoudiniGeoImportCommandlet::MainLoop()
 {
 	GIsRunning = true;
@@ -632,23 +839,11 @@ void UHoudiniGeoImportCommandlet::HandleDirectoryChanged(const TArray<FFileChang
 		if (BGEOMatcher.FindNext() && BGEOMatcher.GetCaptureGroup(2).StartsWith(TEXT("bgeo")))
 		{
 			HOUDINI_LOG_DISPLAY(TEXT("Updating entry for %s..."), *FileChangeData.Filename);
-			const uint32 MaxImportAttempts = 3;
 			switch(FileChangeData.Action)
 			{
 				case FFileChangeData::FCA_Added:
 				case FFileChangeData::FCA_Modified:
-					if (DiscoveredFiles.Contains(FileChangeData.Filename))
-					{
-						FDiscoveredFileData &FileData = DiscoveredFiles[FileChangeData.Filename];
-						if (!FileData.bImported && FileData.ImportAttempts < MaxImportAttempts)
-							FileData.bImportNextTick = true;
-						else if (FileData.ImportAttempts >= MaxImportAttempts)
-							HOUDINI_LOG_WARNING(TEXT("Not importing %s, max attempts exceeded %d"), *FileData.FileName, FileData.ImportAttempts);
-					}
-					else
-					{
-						DiscoveredFiles.Add(FileChangeData.Filename, FDiscoveredFileData(FileChangeData.Filename, true));
-					}
+					NotifyFileChanged(FileChangeData.Filename);
 				break;
 
 				case FFileChangeData::FCA_Removed:
@@ -739,6 +934,35 @@ int32 UHoudiniGeoImportCommandlet::Main(const FString& InParams)
 
 			HOUDINI_LOG_DISPLAY(TEXT("Watching %s"), *DirectoryToWatch);
 
+			if (Params.Contains(TEXT("debounce")))
+				DebounceSeconds = FMath::Max(0.0, FCString::Atod(*Params.FindChecked(TEXT("debounce"))));
+			if (Params.Contains(TEXT("workers")))
+				MaxWorkers = FMath::Max(1, FCString::Atoi(*Params.FindChecked(TEXT("workers"))));
+
+			// By default, the manifest is stored in the project's saved folder, one per watched directory
+			if (Params.Contains(TEXT("manifest")))
+				ManifestFilePath = Params.FindChecked(TEXT("manifest"));
+			else
+				ManifestFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"),
+					FString::Printf(TEXT("GeoImportManifest_%08x.json"), GetTypeHash(DirectoryToWatch)));
+
+			if (ManifestFilePath.Equals(TEXT("none"), ESearchCase::IgnoreCase))
+				ManifestFilePath.Empty();
+			else if (FPaths::IsRelative(ManifestFilePath))
+				ManifestFilePath = FPaths::ConvertRelativePathToFull(ManifestFilePath);
+
+			LoadImportManifest();
+
+			if (Switches.Contains(TEXT("scan")))
+			{
+				TArray<FString> ExistingFiles;
+				IFileManager::Get().FindFiles(ExistingFiles, *FPaths::Combine(DirectoryToWatch, TEXT("*.bgeo*")), true, false);
+				for (const FString& ExistingFile : ExistingFiles)
+					NotifyFileChanged(FPaths::Combine(DirectoryToWatch, ExistingFile));
+
+				HOUDINI_LOG_DISPLAY(TEXT("Found %d existing files in %s"), ExistingFiles.Num(), *DirectoryToWatch);
+			}
+
 			DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
 				DirectoryToWatch,
 				IDirectoryWatcher::FDirectoryChanged::CreateUObject(this, &UHoudiniGeoImportCommandlet::HandleDirectoryChanged),
@@ -30,6 +30,7 @@
 #include "UObject/ObjectMacros.h"
 #include "Commandlets/Commandlet.h"
 #include "MessageEndpoint.h"
+#include "Async/Future.h"
 
 #include "HoudiniEngine.h"
 #include "HoudiniGenericAttribute.h"
@@ -57,26 +58,53 @@ enum class EHoudiniGeoImportCommandletMode : uint8
 	Listen
 };
 
+enum class EDiscoveredFileState : uint8
+{
+	// Waiting for the file size and modification time to stabilize
+	Pending,
+	// The content hash is being computed on a worker thread
+	Hashing,
+	// Stable and changed, waiting for its turn in the import queue
+	Queued,
+	// Imported, or skipped because its content matches the manifest
+	Imported,
+	// Import failed too many times
+	Failed
+};
+
 struct FDiscoveredFileData
 {
 public:
-	FDiscoveredFileData() : FileName(), bImportNextTick(false), ImportAttempts(0), bImported(false) {}
+	FDiscoveredFileData() : FileName(), ImportAttempts(0) {}
 
-	FDiscoveredFileData(const FString& InFileName, bool bInImportNextTick=false) : FileName(InFileName), bImportNextTick(bInImportNextTick), ImportAttempts(0), bImported(false) {}
+	FDiscoveredFileData(const FString& InFileName) : FileName(InFileName), ImportAttempts(0) {}
 
-	FDiscoveredFileData(FString&& InFileName, bool bInImportNextTick=false) : FileName(InFileName), bImportNextTick(bInImportNextTick), ImportAttempts(0), bImported(false) {}
+	FDiscoveredFileData(FString&& InFileName) : FileName(InFileName), ImportAttempts(0) {}
 	
 	// Full/absolute file path
 	FString FileName;
 
-	// Try to import this file on the next tick
-	bool bImportNextTick;
-
 	// Number of attempts at importing this file
 	uint32 ImportAttempts;
 
-	// The file has been imported successfully
-	bool bImported;
+	// Current stage of the file in the watch-mode import pipeline
+	EDiscoveredFileState State = EDiscoveredFileState::Pending;
+
+	// File size and modification time at the last poll, used to debounce files that are still being written
+	int64 LastFileSize = -1;
+	FDateTime LastModificationTime = FDateTime::MinValue();
+
+	// Time (FPlatformTime::Seconds) of the last change event or the last observed size/mtime change
+	double LastChangeTime = 0.0;
+
+	// Number of change events received for this file (repeated events are coalesced)
+	uint32 NumChangeEvents = 0;
+
+	// A change event arrived while the content hash was being computed, so the hash is stale
+	bool bChangedWhileHashing = false;
+
+	// MD5 of the file content at the time it was last hashed
+	FString ContentHash;
 };
 
 UCLASS()
@@ -124,6 +152,16 @@ protected:
 
 	void TickDiscoveredFiles();
 
+	// Adds or refreshes the pipeline entry of a file after a change event (or initial directory scan)
+	void NotifyFileChanged(const FString& InFileName);
+
+	// Imports a single discovered file, and updates its state and the manifest
+	void ImportDiscoveredFile(FDiscoveredFileData& InFileData);
+
+	// Loads / saves the content hash manifest used to skip unchanged files across runs
+	void LoadImportManifest();
+	void SaveImportManifest() const;
+
 private:
 
 	// Messaging end point for receiving messages from PDG manager
@@ -147,6 +185,28 @@ private:
 	// Keep track of files discovered by the watcher, and their state
 	TMap<FString, FDiscoveredFileData> DiscoveredFiles;
 
+	// Files that are stable and hashed, in the order they should be imported.
+	// Entries whose state is no longer Queued are stale and simply skipped.
+	TArray<FString> ImportQueue;
+
+	// Content hashes being computed on worker threads, per file
+	TMap<FString, TFuture<FString>> PendingHashes;
+
+	// Content hash of every successfully imported file, persisted to ManifestFilePath
+	TMap<FString, FString> ImportManifest;
+
+	// Path of the manifest file, empty if the manifest is disabled
+	FString ManifestFilePath;
+
+	// Seconds a file's size and modification time must remain unchanged before it is imported
+	double DebounceSeconds;
+
+	// Maximum number of files hashed concurrently by the worker pool
+	int32 MaxWorkers;
+
+	// Maximum number of imports done per main loop tick, so the loop stays responsive
+	int32 MaxImportsPerTick;
+
 	// Mode in which commandlet is running
 	EHoudiniGeoImportCommandletMode Mode;
 	
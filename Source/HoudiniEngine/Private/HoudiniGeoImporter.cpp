@@ -1095,6 +1095,9 @@ UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniGeoImporter::CookFileNode);
 
+	// String handles fetched before the cook might not be valid after it
+	FHoudiniEngineString::InvalidateStringCache();
+
 	// Cook the node    
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
@@ -1116,6 +1119,8 @@ UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 			FPlatformProcess::Sleep(0.5f);
 	}
 
+	FHoudiniEngineString::InvalidateStringCache();
+
 	if (status != HAPI_STATE_READY)
 	{
 		// There was some cook errors
@@ -0,0 +1,116 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniHashUtils.h"
+
+#include "HoudiniParameter.h"
+#include "HoudiniParameterChoice.h"
+#include "HoudiniParameterColor.h"
+#include "HoudiniParameterFile.h"
+#include "HoudiniParameterFloat.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniParameterMultiParm.h"
+#include "HoudiniParameterString.h"
+#include "HoudiniParameterToggle.h"
+
+uint64
+FHoudiniHashUtils::HashParameterValues(uint64 InHash, const TArray<UHoudiniParameter*>& InParameters)
+{
+	TArray<UHoudiniParameter*> SortedParameters;
+	for (UHoudiniParameter* Parameter : InParameters)
+	{
+		if (IsValid(Parameter))
+			SortedParameters.Add(Parameter);
+	}
+	SortedParameters.Sort([](const UHoudiniParameter& A, const UHoudiniParameter& B)
+	{
+		return A.GetParameterName() < B.GetParameterName();
+	});
+
+	for (UHoudiniParameter* Parameter : SortedParameters)
+	{
+		const EHoudiniParameterType Type = Parameter->GetParameterType();
+		InHash = HashString(InHash, Parameter->GetParameterName());
+		InHash = HashBytes(InHash, &Type, sizeof(Type));
+
+		if (UHoudiniParameterFloat* FloatParameter = Cast<UHoudiniParameterFloat>(Parameter))
+		{
+			for (int32 Idx = 0; Idx < FloatParameter->GetNumberOfValues(); ++Idx)
+			{
+				float Value = 0.0f;
+				FloatParameter->GetValueAt(Idx, Value);
+				InHash = HashBytes(InHash, &Value, sizeof(Value));
+			}
+		}
+		else if (UHoudiniParameterInt* IntParameter = Cast<UHoudiniParameterInt>(Parameter))
+		{
+			for (int32 Idx = 0; Idx < IntParameter->GetNumberOfValues(); ++Idx)
+			{
+				int32 Value = 0;
+				IntParameter->GetValueAt(Idx, Value);
+				InHash = HashBytes(InHash, &Value, sizeof(Value));
+			}
+		}
+		else if (UHoudiniParameterToggle* ToggleParameter = Cast<UHoudiniParameterToggle>(Parameter))
+		{
+			for (int32 Idx = 0; Idx < ToggleParameter->GetNumValues(); ++Idx)
+			{
+				const bool bValue = ToggleParameter->GetValueAt(Idx);
+				InHash = HashBytes(InHash, &bValue, sizeof(bValue));
+			}
+		}
+		else if (UHoudiniParameterChoice* ChoiceParameter = Cast<UHoudiniParameterChoice>(Parameter))
+		{
+			const int32 Value = ChoiceParameter->GetIntValueIndex();
+			InHash = HashBytes(InHash, &Value, sizeof(Value));
+			InHash = HashString(InHash, ChoiceParameter->GetStringValue());
+		}
+		else if (UHoudiniParameterColor* ColorParameter = Cast<UHoudiniParameterColor>(Parameter))
+		{
+			const FLinearColor Value = ColorParameter->GetColorValue();
+			InHash = HashBytes(InHash, &Value, sizeof(Value));
+		}
+		else if (UHoudiniParameterString* StringParameter = Cast<UHoudiniParameterString>(Parameter))
+		{
+			for (int32 Idx = 0; Idx < StringParameter->GetNumberOfValues(); ++Idx)
+				InHash = HashString(InHash, StringParameter->GetValueAt(Idx));
+		}
+		else if (UHoudiniParameterFile* FileParameter = Cast<UHoudiniParameterFile>(Parameter))
+		{
+			for (int32 Idx = 0; Idx < FileParameter->GetNumValues(); ++Idx)
+				InHash = HashString(InHash, FileParameter->GetValueAt(Idx));
+		}
+		else if (UHoudiniParameterMultiParm* MultiParmParameter = Cast<UHoudiniParameterMultiParm>(Parameter))
+		{
+			// Ramps are multiparms too, their points are hashed as their child parameters
+			const int32 Value = MultiParmParameter->GetValue();
+			InHash = HashBytes(InHash, &Value, sizeof(Value));
+		}
+		// Buttons, folders, labels and separators have no value, and operator path inputs are hashed with the inputs
+	}
+
+	return InHash;
+}
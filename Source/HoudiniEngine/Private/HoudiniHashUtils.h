@@ -0,0 +1,65 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/CityHash.h"
+#include "UObject/Class.h"
+
+class UHoudiniParameter;
+
+// Helpers for the caches keyed on the content they were built from
+struct FHoudiniHashUtils
+{
+	// Combines InHash with the hash of InSize bytes at InData
+	static uint64 HashBytes(uint64 InHash, const void* InData, int32 InSize)
+	{
+		return CityHash64WithSeed(static_cast<const char*>(InData), InSize, InHash);
+	}
+
+	// Combines InHash with the hash of InString's length and characters
+	static uint64 HashString(uint64 InHash, const FString& InString)
+	{
+		const int32 Len = InString.Len();
+		InHash = HashBytes(InHash, &Len, sizeof(Len));
+		return HashBytes(InHash, *InString, Len * sizeof(TCHAR));
+	}
+
+	// Combines InHash with the text export of all the properties of a USTRUCT
+	template<typename StructType>
+	static uint64 HashStruct(uint64 InHash, const StructType& InStruct)
+	{
+		FString Text;
+		StructType::StaticStruct()->ExportText(Text, &InStruct, nullptr, nullptr, PPF_None, nullptr);
+		return HashString(InHash, Text);
+	}
+
+	// Combines InHash with the names, types and values of the parameters, sorted by name so that the hash does not
+	// depend on their order. Only the values are hashed, not the content of the files or assets they refer to.
+	static uint64 HashParameterValues(uint64 InHash, const TArray<UHoudiniParameter*>& InParameters);
+};
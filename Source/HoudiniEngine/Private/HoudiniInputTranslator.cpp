@@ -773,90 +773,103 @@ FHoudiniInputTranslator::UploadChangedInputs(UHoudiniAssetComponent * HAC)
 	// Disabled, this seems to be unused and is fairly costly to run in large levels/worlds
 	//HoudiniUnrealDataLayersCache DataLayerCache = FHoudiniUnrealDataLayersCache::MakeCache(HAC->GetWorld());
 
+	FTransform OwnerTransform = FTransform::Identity;
+	AActor * OwnerActor = HAC->GetOwner();
+	if (OwnerActor)
+	{
+		OwnerTransform = OwnerActor->GetTransform();
+	}
+
 	//for (auto CurrentInput : HAC->Inputs)
 	for(int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); InputIdx++)
 	{
-		UHoudiniInput*& CurrentInput = HAC->Inputs[InputIdx];
+		UHoudiniInput* CurrentInput = HAC->Inputs[InputIdx];
 		if (!IsValid(CurrentInput) || !CurrentInput->HasChanged())
 			continue;
 
-		// Delete any previous InputNodeIds of this HoudiniInput that are pending delete
-		for (const HAPI_NodeId InputNodeIdPendingDelete : CurrentInput->GetInputNodesPendingDelete())
-		{
-			if (InputNodeIdPendingDelete < 0)
-				continue;
+		UploadChangedInput(CurrentInput, OwnerTransform);
+	}
 
-			HAPI_NodeInfo NodeInfo;
-			FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	return true;
+}
 
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(
-				FHoudiniEngine::Get().GetSession(), InputNodeIdPendingDelete, &NodeInfo))
-			{
-				continue;
-			}
+bool
+FHoudiniInputTranslator::UploadChangedInput(UHoudiniInput* InInput, const FTransform& InOwnerTransform)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniInputTranslator::UploadChangedInput);
 
-			HAPI_NodeId NodeToDelete = InputNodeIdPendingDelete;
-			if (NodeInfo.type == HAPI_NODETYPE_SOP)
-			{
-				// Input nodes are Merge SOPs in a geo object, delete the geo object
-				const HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId(InputNodeIdPendingDelete);
-				NodeToDelete = ParentId != -1 ? ParentId : InputNodeIdPendingDelete;
-			}
+	if (!IsValid(InInput))
+		return false;
 
-			HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NodeToDelete));
-		}
-		CurrentInput->ClearInputNodesPendingDelete();
+	// Delete any previous InputNodeIds of this HoudiniInput that are pending delete
+	for (const HAPI_NodeId InputNodeIdPendingDelete : InInput->GetInputNodesPendingDelete())
+	{
+		if (InputNodeIdPendingDelete < 0)
+			continue;
 
-		// First thing, see if we need to change the input type
-		if (CurrentInput->HasInputTypeChanged())
-		{
-			ChangeInputType(CurrentInput, false);
-		}
+		HAPI_NodeInfo NodeInfo;
+		FHoudiniApi::NodeInfo_Init(&NodeInfo);
 
-		if ((CurrentInput->IsLandscapeInput())
-			&& CurrentInput->HasLandscapeExportTypeChanged()) 
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(
+			FHoudiniEngine::Get().GetSession(), InputNodeIdPendingDelete, &NodeInfo))
 		{
-			DisconnectAndDestroyInput(CurrentInput, CurrentInput->GetInputType());
-			CurrentInput->MarkAllInputObjectsChanged(true);
-			CurrentInput->SetHasLandscapeExportTypeChanged(false);
+			continue;
 		}
 
-		bool bSuccess = true;
-		if (CurrentInput->IsDataUploadNeeded())
+		HAPI_NodeId NodeToDelete = InputNodeIdPendingDelete;
+		if (NodeInfo.type == HAPI_NODETYPE_SOP)
 		{
-			FTransform OwnerTransform = FTransform::Identity;
-			AActor * OwnerActor = HAC->GetOwner();
-			if (OwnerActor)
-			{
-				OwnerTransform = OwnerActor->GetTransform();
-			}
-			
-			bSuccess &= UploadInputData(CurrentInput, OwnerTransform);
-			CurrentInput->MarkDataUploadNeeded(!bSuccess);
+			// Input nodes are Merge SOPs in a geo object, delete the geo object
+			const HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId(InputNodeIdPendingDelete);
+			NodeToDelete = ParentId != -1 ? ParentId : InputNodeIdPendingDelete;
 		}
 
-		if (CurrentInput->IsTransformUploadNeeded())
-		{
-			bSuccess &= UploadInputTransform(CurrentInput);
-		}
+		HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NodeToDelete));
+	}
+	InInput->ClearInputNodesPendingDelete();
 
-		// Update the input properties AFTER eventually uploading it
-		bSuccess = UpdateInputProperties(CurrentInput);
+	// First thing, see if we need to change the input type
+	if (InInput->HasInputTypeChanged())
+	{
+		ChangeInputType(InInput, false);
+	}
 
-		if (bSuccess)
-		{
-			CurrentInput->MarkChanged(false);
-			CurrentInput->MarkAllInputObjectsChanged(false);
-		}
+	if ((InInput->IsLandscapeInput())
+		&& InInput->HasLandscapeExportTypeChanged()) 
+	{
+		DisconnectAndDestroyInput(InInput, InInput->GetInputType());
+		InInput->MarkAllInputObjectsChanged(true);
+		InInput->SetHasLandscapeExportTypeChanged(false);
+	}
 
-		if (CurrentInput->HasInputTypeChanged())
-			CurrentInput->SetPreviousInputType(EHoudiniInputType::Invalid);
+	bool bSuccess = true;
+	if (InInput->IsDataUploadNeeded())
+	{
+		bSuccess &= UploadInputData(InInput, InOwnerTransform);
+		InInput->MarkDataUploadNeeded(!bSuccess);
+	}
 
-		// Even if we failed, no need to try updating again.
-		CurrentInput->SetNeedsToTriggerUpdate(false);
+	if (InInput->IsTransformUploadNeeded())
+	{
+		bSuccess &= UploadInputTransform(InInput);
 	}
 
-	return true;
+	// Update the input properties AFTER eventually uploading it
+	bSuccess = UpdateInputProperties(InInput);
+
+	if (bSuccess)
+	{
+		InInput->MarkChanged(false);
+		InInput->MarkAllInputObjectsChanged(false);
+	}
+
+	if (InInput->HasInputTypeChanged())
+		InInput->SetPreviousInputType(EHoudiniInputType::Invalid);
+
+	// Even if we failed, no need to try updating again.
+	InInput->SetNeedsToTriggerUpdate(false);
+
+	return bSuccess;
 }
 
 bool
@@ -3766,14 +3779,25 @@ FHoudiniInputTranslator::HapiCreateInputNodeForSplineMeshComponents(
 	FMeshMergingSettings Settings;
 	UStaticMesh* SM = nullptr;
 
+	// Reuse the merged mesh if the spline mesh components have not changed since it was generated
 	FVector MergedLocation = FVector::ZeroVector;
-	if (!FHoudiniMeshUtils::MergeMeshes(MeshComponents, PackageParams, Settings, SM, MergedLocation))
-		return true;
+	const uint64 MergeHash = FHoudiniMeshUtils::GetMergeMeshesHash(MeshComponents);
+	if (MergeHash == InParentActorObject->GetGeneratedSplinesMeshHash() && IsValid(InParentActorObject->GetGeneratedSplineMesh()))
+	{
+		SM = InParentActorObject->GetGeneratedSplineMesh();
+		MergedLocation = InParentActorObject->GetGeneratedSplinesMeshLocation();
+	}
+	else
+	{
+		if (!FHoudiniMeshUtils::MergeMeshes(MeshComponents, PackageParams, Settings, SM, MergedLocation))
+			return true;
 
-	if (!IsValid(SM))
-		return true;
+		if (!IsValid(SM))
+			return true;
 
-	InParentActorObject->SetGeneratedSplineMesh(SM);
+		InParentActorObject->SetGeneratedSplineMesh(SM);
+		InParentActorObject->SetGeneratedSplinesMeshHash(MergeHash, MergedLocation);
+	}
 	
 	HAPI_NodeId CreatedNodeId = InParentActorObject->SplinesMeshNodeId;
 
@@ -98,6 +98,9 @@ struct HOUDINIENGINE_API FHoudiniInputTranslator
 	// Update all the inputs that have been marked as change
 	static bool UploadChangedInputs(UHoudiniAssetComponent * HAC);
 
+	// Update an input that has been marked as changed. InOwnerTransform is the transform of the actor owning its HAC.
+	static bool UploadChangedInput(UHoudiniInput* InInput, const FTransform& InOwnerTransform);
+
 	// Only update simple input properties
 	static bool UpdateInputProperties(UHoudiniInput* InInput);
 
@@ -45,174 +45,6 @@
 #include "WorldPartition/WorldPartition.h"
 
 
-/** Per mesh attribute data for a landscape spline segment. */
-struct FLandscapeSplineSegmentMeshAttributes
-{
-	/** Mesh ref */
-	bool bHasMeshRefAttribute = false;
-	TArray<FString> MeshRef;
-	
-	/** Mesh material override, the outer index is material 0, 1, 2 ... */
-	TArray<TArray<FString>> MeshMaterialOverrideRefs;
-
-	/** Mesh scale. */
-	bool bHasMeshScaleAttribute = false;
-	TArray<float> MeshScale;
-
-	/** Center Adjust. */
-	bool bHasMeshCenterAdjustAttribute = false;
-	TArray<float> CenterAdjust;
-};
-
-
-/** Attribute data extracted from curve points and prims. */
-struct FLandscapeSplineCurveAttributes
-{
-	//
-	// Point Attributes
-	//
-	
-	/** Resampled point positions. */
-	TArray<float> PointPositions;
-	
-	/** Point rotations. */
-	bool bHasPointRotationAttribute = false;
-	TArray<float> PointRotations;
-	
-	/** Point paint layer names */
-	bool bHasPointPaintLayerNameAttribute = false;
-	TArray<FString> PointPaintLayerNames;
-	
-	/** Point bRaiseTerrain */
-	bool bHasPointRaiseTerrainAttribute = false;
-	TArray<int32> PointRaiseTerrains;
-	
-	/** Point bLowerTerrain */
-	bool bHasPointLowerTerrainAttribute = false;
-	TArray<int32> PointLowerTerrains;
-
-	/** The StaticMesh ref per point. */
-	bool bHasPointMeshRefAttribute = false;
-	TArray<FString> PointMeshRefs;
-
-	/**
-	 * The Material Override refs of each point. The outer index material override index, the inner index
-	 * is point index.
-	 */
-	TArray<TArray<FString>> PerMaterialOverridePointRefs;
-
-	/** The static mesh scale of each point. */
-	bool bHasPointMeshScaleAttribute = false;
-	TArray<float> PointMeshScales;
-
-	/** The ids of the control points. */
-	bool bHasPointIdAttribute = false;
-	TArray<int32> PointIds;
-
-	/** The point half-width. */
-	bool bHasPointHalfWidthAttribute = false;
-	TArray<float> PointHalfWidths;
-
-	/** The point side-falloff. */
-	bool bHasPointSideFalloffAttribute = false;
-	TArray<float> PointSideFalloffs;
-
-	/** The point end-falloff. */
-	bool bHasPointEndFalloffAttribute = false;
-	TArray<float> PointEndFalloffs;
-
-	//
-	// Although the following properties are named Vertex... they are point attributes in HAPI (but are intended to be
-	// authored as vertex attributes in Houdini). When curves are extracted via HAPI points and vertices are the same.
-	//
-	
-	/**
-	 * The mesh socket names on the splines' vertices. The outer index is the near side (0) and far side (1) of the
-	 * segment connection. The inner index is a vertex index.
-	 */
-	bool bHasVertexConnectionSocketNameAttribute[2] { false, false };
-	TArray<FString> VertexConnectionSocketNames[2];
-
-	/**
-	 * Tangent length point attribute, for segment connections. The outer index is the near side (0) and far side (1)
-	 * of the segment connection. The inner index is a vertex index.
-	 */
-	bool bHasVertexConnectionTangentLengthAttribute[2] { false, false };
-	TArray<float> VertexConnectionTangentLengths[2];
-
-	/** Vertex/segment paint layer name */
-	bool bHasVertexPaintLayerNameAttribute = false;
-	TArray<FString> VertexPaintLayerNames;
-
-	/** Vertex/segment bRaiseTerrain */
-	bool bHasVertexRaiseTerrainAttribute = false;
-	TArray<int32> VertexRaiseTerrains;
-
-	/** Vertex/segment bLowerTerrain */
-	bool bHasVertexLowerTerrainAttribute = false;
-	TArray<int32> VertexLowerTerrains;
-
-	/** Edit layer name */
-	bool bHasVertexEditLayerAttribute = false;
-	TArray<FString> VertexEditLayers;
-
-	/** Edit layer: clear */
-	bool bHasVertexEditLayerClearAttribute = false;
-	TArray<int32> VertexEditLayersClear;
-
-	/** Edit layer: add after */
-	bool bHasVertexEditLayerAfterAttribute = false;
-	TArray<FString> VertexEditLayersAfter;
-
-	/** Static mesh attributes on vertices. Outer index is mesh 0, 1, 2 ... */
-	TArray<FLandscapeSplineSegmentMeshAttributes> VertexPerMeshSegmentData;
-
-	//
-	// Primitive attributes
-	//
-	
-	/**
-	 * The mesh socket names on the splines' prims. The index is the near side (0) and far side (1) of the
-	 * segment connection.
-	 */
-	bool bHasPrimConnectionSocketNameAttribute[2] { false, false };
-	FString PrimConnectionSocketNames[2];
-
-	/**
-	 * Tangent length point attribute, for segment connections. The index is the near side (0) and far side (1)
-	 * of the segment connection.
-	 */
-	bool bHasPrimConnectionTangentLengthAttribute[2] { false, false };
-	float PrimConnectionTangentLengths[2];
-
-	/** Prim/segment paint layer name */
-	bool bHasPrimPaintLayerNameAttribute = false;
-	FString PrimPaintLayerName;
-
-	/** Prim/segment bRaiseTerrain */
-	bool bHasPrimRaiseTerrainAttribute = false;
-	int32 bPrimRaiseTerrain;
-
-	/** Prim/segment bLowerTerrain */
-	bool bHasPrimLowerTerrainAttribute = false;
-	int32 bPrimLowerTerrain;
-
-	/** Edit layer name */
-	bool bHasPrimEditLayerAttribute = false;
-	FString PrimEditLayer;
-
-	/** Edit layer: clear */
-	bool bHasPrimEditLayerClearAttribute = false;
-	bool bPrimEditLayerClear;
-
-	/** Edit layer: add after */
-	bool bHasPrimEditLayerAfterAttribute = false;
-	FString PrimEditLayerAfter;
-
-	/** Static mesh attribute from primitives, the index is mesh 0, 1, 2 ... */
-	TArray<FLandscapeSplineSegmentMeshAttributes> PrimPerMeshSegmentData;
-};
-
 /**
  * Transient/transactional struct for processing landscape spline output. Used in
  * CreateOutputLandscapeSplinesFromHoudiniGeoPartObject(). This is not a UStruct / does n0t use UProperties. We do not
@@ -286,6 +118,243 @@ struct FLandscapeSplineInfo
 };
 
 
+/**
+ * A landscape spline attribute of a part, fetched once for every element of its owner. The attributes of each curve
+ * are then copied from memory instead of being fetched from HAPI curve by curve.
+ */
+template<typename DataType>
+struct TLandscapeSplinePartAttribute
+{
+	bool bExists = false;
+	int32 TupleSize = 1;
+	int32 Count = 0;
+	TArray<DataType> Values;
+
+	/**
+	 * Fetch the attribute for the whole part, looking it up like FHoudiniHapiAccessor::GetAttributeData does.
+	 * If InTupleSize > 0 it replaces the attribute's tuple size.
+	 */
+	void Fetch(const HAPI_NodeId InNodeId, const HAPI_PartId InPartId, const char* InName, const HAPI_AttributeOwner InOwner, const int32 InTupleSize)
+	{
+		FHoudiniHapiAccessor Accessor(InNodeId, InPartId, InName);
+		HAPI_AttributeInfo AttrInfo;
+		bExists = false;
+		if (!Accessor.GetInfo(AttrInfo, InOwner))
+			return;
+
+		if (InTupleSize > 0)
+			AttrInfo.tupleSize = InTupleSize;
+
+		TupleSize = AttrInfo.tupleSize;
+		Count = AttrInfo.count;
+		bExists = Accessor.GetAttributeData(AttrInfo, Values);
+	}
+
+	/**
+	 * Copy InCount elements, starting at InStartIndex, or all of them if InCount < 0. Returns false if the attribute
+	 * does not exist or if the range is out of bounds, as fetching the range from HAPI would.
+	 */
+	bool Get(TArray<DataType>& OutValues, const int32 InStartIndex = 0, int32 InCount = -1) const
+	{
+		if (!bExists)
+			return false;
+
+		if (InCount < 0)
+			InCount = Count;
+
+		OutValues.SetNum(InCount * TupleSize);
+		if (InStartIndex < 0 || InStartIndex + InCount > Count)
+			return false;
+
+		const DataType* const Source = Values.GetData() + InStartIndex * TupleSize;
+		for (int32 ValueIdx = 0; ValueIdx < OutValues.Num(); ++ValueIdx)
+			OutValues[ValueIdx] = Source[ValueIdx];
+
+		return true;
+	}
+};
+
+
+/** Per mesh segment attributes of a part, see FLandscapeSplineSegmentMeshAttributes. */
+struct FLandscapeSplinePartSegmentMeshAttributes
+{
+	TLandscapeSplinePartAttribute<FString> MeshRef;
+	TLandscapeSplinePartAttribute<float> PointMeshScale;
+	TLandscapeSplinePartAttribute<float> PrimMeshScale;
+	TLandscapeSplinePartAttribute<float> PointCenterAdjust;
+	TLandscapeSplinePartAttribute<float> PrimCenterAdjust;
+	/** The material override attributes that exist: material 0, 1, 2 ... */
+	TArray<TLandscapeSplinePartAttribute<FString>> MaterialOverrides;
+
+	/** Fetch the attributes of the mesh MeshIndex. Returns false if the part has none. */
+	bool Fetch(HAPI_NodeId InNodeId, HAPI_PartId InPartId, int32 InMeshIndex);
+};
+
+
+/** All the landscape spline attributes of a part, see FLandscapeSplineCurveAttributes. */
+struct FLandscapeSplinePartAttributes
+{
+	TLandscapeSplinePartAttribute<float> PointPositions;
+	TLandscapeSplinePartAttribute<float> PointRotations;
+	TLandscapeSplinePartAttribute<FString> PointPaintLayerNames;
+	TLandscapeSplinePartAttribute<int32> PointRaiseTerrains;
+	TLandscapeSplinePartAttribute<int32> PointLowerTerrains;
+	TLandscapeSplinePartAttribute<FString> PointMeshRefs;
+	/** The control point material override attributes that exist: material 0, 1, 2 ... */
+	TArray<TLandscapeSplinePartAttribute<FString>> PointMaterialOverrides;
+	TLandscapeSplinePartAttribute<float> PointMeshScales;
+	TLandscapeSplinePartAttribute<int32> PointIds;
+	TLandscapeSplinePartAttribute<float> PointHalfWidths;
+	TLandscapeSplinePartAttribute<float> PointSideFalloffs;
+	TLandscapeSplinePartAttribute<float> PointEndFalloffs;
+
+	TLandscapeSplinePartAttribute<FString> PrimConnectionSocketNames[2];
+	TLandscapeSplinePartAttribute<float> PointConnectionTangentLengths[2];
+	TLandscapeSplinePartAttribute<float> PrimConnectionTangentLengths[2];
+
+	TLandscapeSplinePartAttribute<FString> PrimSegmentPaintLayerNames;
+	TLandscapeSplinePartAttribute<int32> PointSegmentRaiseTerrains;
+	/** Segment raise terrain on any owner */
+	TLandscapeSplinePartAttribute<int32> SegmentRaiseTerrains;
+	TLandscapeSplinePartAttribute<int32> PointSegmentLowerTerrains;
+	TLandscapeSplinePartAttribute<int32> PrimSegmentLowerTerrains;
+	TLandscapeSplinePartAttribute<FString> PointEditLayers;
+	TLandscapeSplinePartAttribute<FString> PrimEditLayers;
+	TLandscapeSplinePartAttribute<int32> PointEditLayersClear;
+	TLandscapeSplinePartAttribute<int32> PrimEditLayersClear;
+	TLandscapeSplinePartAttribute<FString> PointEditLayersAfter;
+	TLandscapeSplinePartAttribute<FString> PrimEditLayersAfter;
+
+	/** Segment mesh attributes, mesh 0, 1, 2 ... */
+	TArray<FLandscapeSplinePartSegmentMeshAttributes> SegmentMeshes;
+
+	/** Fetch all the landscape spline attributes of the part. */
+	void Fetch(HAPI_NodeId InNodeId, HAPI_PartId InPartId);
+};
+
+
+bool
+FLandscapeSplinePartSegmentMeshAttributes::Fetch(const HAPI_NodeId InNodeId, const HAPI_PartId InPartId, const int32 InMeshIndex)
+{
+	// If MeshIndex == 0 then don't add the numeric suffix
+	const FString AttrNamePrefix = InMeshIndex > 0
+		? FString::Printf(TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_MESH "%d"), InMeshIndex)
+		: FString(TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_MESH));
+
+	MeshRef.Fetch(InNodeId, InPartId, TCHAR_TO_ANSI(*AttrNamePrefix), HAPI_ATTROWNER_PRIM, 1);
+
+	// mesh scale
+	static constexpr int32 MeshScaleTupleSize = 3;
+	const FString MeshScaleAttrName = AttrNamePrefix + TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_SCALE_SUFFIX);
+	PointMeshScale.Fetch(InNodeId, InPartId, TCHAR_TO_ANSI(*MeshScaleAttrName), HAPI_ATTROWNER_POINT, MeshScaleTupleSize);
+	PrimMeshScale.Fetch(InNodeId, InPartId, TCHAR_TO_ANSI(*MeshScaleAttrName), HAPI_ATTROWNER_PRIM, MeshScaleTupleSize);
+
+	// center adjust
+	static constexpr int32 MeshCenterAdjustTupleSize = 2;
+	const FString MeshCenterAdjustAttrName = AttrNamePrefix + TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_CENTER_ADJUST_SUFFIX);
+	PointCenterAdjust.Fetch(InNodeId, InPartId, TCHAR_TO_ANSI(*MeshCenterAdjustAttrName), HAPI_ATTROWNER_POINT, MeshCenterAdjustTupleSize);
+	PrimCenterAdjust.Fetch(InNodeId, InPartId, TCHAR_TO_ANSI(*MeshCenterAdjustAttrName), HAPI_ATTROWNER_PRIM, MeshCenterAdjustTupleSize);
+
+	// material overrides: loop until the first index where we cannot find a material override attribute
+	const FString MaterialAttrNamePrefix = AttrNamePrefix + TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_MATERIAL_OVERRIDE_SUFFIX);
+	MaterialOverrides.Reset();
+	for (int32 MaterialOverrideIdx = 0; ; ++MaterialOverrideIdx)
+	{
+		const FString MaterialOverrideAttrName = MaterialOverrideIdx > 0
+			? MaterialAttrNamePrefix + FString::Printf(TEXT("%d"), MaterialOverrideIdx)
+			: MaterialAttrNamePrefix;
+
+		TLandscapeSplinePartAttribute<FString> MaterialOverride;
+		MaterialOverride.Fetch(InNodeId, InPartId, TCHAR_TO_ANSI(*MaterialOverrideAttrName), HAPI_ATTROWNER_INVALID, 1);
+		if (!MaterialOverride.bExists)
+			break;
+
+		MaterialOverrides.Emplace(MoveTemp(MaterialOverride));
+	}
+
+	return MeshRef.bExists || PointMeshScale.bExists || PrimMeshScale.bExists || PointCenterAdjust.bExists
+		|| PrimCenterAdjust.bExists || MaterialOverrides.Num() > 0;
+}
+
+
+void
+FLandscapeSplinePartAttributes::Fetch(const HAPI_NodeId InNodeId, const HAPI_PartId InPartId)
+{
+	PointPositions.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, 3);
+	PointRotations.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_ROTATION, HAPI_ATTROWNER_POINT, 4);
+	PointPaintLayerNames.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_PAINT_LAYER_NAME, HAPI_ATTROWNER_POINT, 1);
+	PointRaiseTerrains.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_RAISE_TERRAIN, HAPI_ATTROWNER_POINT, 1);
+	PointLowerTerrains.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_LOWER_TERRAIN, HAPI_ATTROWNER_POINT, 1);
+	PointMeshRefs.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_MESH, HAPI_ATTROWNER_POINT, 1);
+
+	// control point material overrides: loop until the first index where we don't find a material override attribute
+	const FString ControlPointMaterialOverrideAttrNamePrefix = TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_MATERIAL_OVERRIDE_SUFFIX);
+	PointMaterialOverrides.Reset();
+	for (int32 MaterialOverrideIdx = 0; ; ++MaterialOverrideIdx)
+	{
+		const FString AttrName = MaterialOverrideIdx > 0
+			? ControlPointMaterialOverrideAttrNamePrefix + FString::Printf(TEXT("%d"), MaterialOverrideIdx)
+			: ControlPointMaterialOverrideAttrNamePrefix;
+
+		TLandscapeSplinePartAttribute<FString> MaterialOverride;
+		MaterialOverride.Fetch(InNodeId, InPartId, TCHAR_TO_ANSI(*AttrName), HAPI_ATTROWNER_PRIM, 1);
+		if (!MaterialOverride.bExists)
+			break;
+
+		PointMaterialOverrides.Emplace(MoveTemp(MaterialOverride));
+	}
+
+	PointMeshScales.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_MESH HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_SCALE_SUFFIX, HAPI_ATTROWNER_POINT, 3);
+	PointIds.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_ID, HAPI_ATTROWNER_POINT, 1);
+	PointHalfWidths.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_HALF_WIDTH, HAPI_ATTROWNER_POINT, 1);
+	PointSideFalloffs.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SIDE_FALLOFF, HAPI_ATTROWNER_POINT, 1);
+	PointEndFalloffs.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_END_FALLOFF, HAPI_ATTROWNER_POINT, 1);
+
+	// Connection attributes -- there are separate attributes for the two ends of the connection
+	static const char* ConnectionMeshSocketNameAttrNames[]
+	{
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION0_MESH_SOCKET_NAME,
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION1_MESH_SOCKET_NAME
+	};
+	static const char* ConnectionTangentLengthAttrNames[]
+	{
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION0_TANGENT_LENGTH,
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION1_TANGENT_LENGTH
+	};
+	for (int32 ConnectionIndex = 0; ConnectionIndex < 2; ++ConnectionIndex)
+	{
+		PrimConnectionSocketNames[ConnectionIndex].Fetch(InNodeId, InPartId, ConnectionMeshSocketNameAttrNames[ConnectionIndex], HAPI_ATTROWNER_PRIM, 1);
+		PointConnectionTangentLengths[ConnectionIndex].Fetch(InNodeId, InPartId, ConnectionTangentLengthAttrNames[ConnectionIndex], HAPI_ATTROWNER_POINT, 1);
+		PrimConnectionTangentLengths[ConnectionIndex].Fetch(InNodeId, InPartId, ConnectionTangentLengthAttrNames[ConnectionIndex], HAPI_ATTROWNER_PRIM, 1);
+	}
+
+	// segment attributes
+	PrimSegmentPaintLayerNames.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME, HAPI_ATTROWNER_PRIM, 1);
+	PointSegmentRaiseTerrains.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_RAISE_TERRAIN, HAPI_ATTROWNER_POINT, 1);
+	SegmentRaiseTerrains.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_RAISE_TERRAIN, HAPI_ATTROWNER_INVALID, 1);
+	PointSegmentLowerTerrains.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_LOWER_TERRAIN, HAPI_ATTROWNER_POINT, 1);
+	PrimSegmentLowerTerrains.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_LOWER_TERRAIN, HAPI_ATTROWNER_PRIM, 0);
+	PointEditLayers.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_NAME, HAPI_ATTROWNER_POINT, 1);
+	PrimEditLayers.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_NAME, HAPI_ATTROWNER_PRIM, 1);
+	PointEditLayersClear.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_CLEAR, HAPI_ATTROWNER_POINT, 1);
+	PrimEditLayersClear.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_CLEAR, HAPI_ATTROWNER_PRIM, 1);
+	PointEditLayersAfter.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_AFTER, HAPI_ATTROWNER_POINT, 1);
+	PrimEditLayersAfter.Fetch(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_AFTER, HAPI_ATTROWNER_PRIM, 1);
+
+	// Segment mesh attributes, with MeshIndex as a suffix (when > 0). Stop as soon as we cannot find any segment mesh
+	// attribute for a MeshIndex.
+	SegmentMeshes.Reset();
+	for (int32 MeshIndex = 0; ; ++MeshIndex)
+	{
+		FLandscapeSplinePartSegmentMeshAttributes SegmentMesh;
+		if (!SegmentMesh.Fetch(InNodeId, InPartId, MeshIndex))
+			break;
+
+		SegmentMeshes.Emplace(MoveTemp(SegmentMesh));
+	}
+}
+
+
 FVector 
 ConvertPositionToVector(const float* InPosition)
 {
@@ -718,6 +787,11 @@ FHoudiniLandscapeSplineTranslator::CreateOutputLandscapeSplinesFromHoudiniGeoPar
 		Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, OutputNames);
 	}
 
+	// Fetch the landscape spline attributes of all curves at once
+	TArray<FLandscapeSplineCurveAttributes> AllCurveAttributes;
+	CopyCurveAttributesFromHoudini(CurveNodeId, CurvePartId, CurvePointCounts, AllCurveAttributes);
+	AllCurveAttributes.SetNum(NumCurves);
+
 	// Iterate over curves first, use prim attributes to find the landscape that the splines should be attached to,
 	// and for world partition look at unreal_output_name to determine the landscape spline actor name.
 	TMap<FString, FLandscapeSplineInfo> LandscapeSplineInfos;
@@ -906,14 +980,8 @@ FHoudiniLandscapeSplineTranslator::CreateOutputLandscapeSplinesFromHoudiniGeoPar
 		const int32 CurveFirstPointIndex = NextCurveStartPointIdx - NumPointsInCurve;
 		SplineInfo->PerCurveFirstPointIndex.Add(CurveFirstPointIndex);
 
-		// Copy the attributes for this curve primitive from Houdini / HAPI
-		CopyCurveAttributesFromHoudini(
-			CurveNodeId,
-			CurvePartId,
-			CurveIdx,
-			CurveFirstPointIndex,
-			NumPointsInCurve,
-			SplineInfo->CurveAttributes.AddDefaulted_GetRef());
+		// Take the attributes of this curve primitive, fetched from Houdini / HAPI before the loop
+		SplineInfo->CurveAttributes.Add(MoveTemp(AllCurveAttributes[CurveIdx]));
 
 		// Ensure that NextControlPointId is greater than all of the PointIds from this curve
 		FLandscapeSplineCurveAttributes& CurveAttributes = SplineInfo->CurveAttributes.Last();
@@ -1204,9 +1272,8 @@ FHoudiniLandscapeSplineTranslator::GetOrCreateControlPoint(FLandscapeSplineInfo&
 
 
 bool
-FHoudiniLandscapeSplineTranslator::CopySegmentMeshAttributesFromHoudini(
-	const HAPI_NodeId InNodeId,
-	const HAPI_PartId InPartId,
+FHoudiniLandscapeSplineTranslator::CopySegmentMeshAttributes(
+	const TArray<FLandscapeSplinePartSegmentMeshAttributes>& InPartAttributes,
 	const HAPI_AttributeOwner InAttrOwner,
 	const int32 InStartIndex,
 	const int32 InCount,
@@ -1214,86 +1281,44 @@ FHoudiniLandscapeSplineTranslator::CopySegmentMeshAttributesFromHoudini(
 {
 	OutAttributes.Reset();
 
-	// Loop look for segment mesh attributes with MeshIndex as a suffix (when > 0). Break out of the loop as soon as
-	// we cannot find any segment mesh attribute for the given MeshIndex.
-	int32 MeshIndex = 0;
-	while (true)
+	// Loop over the segment mesh attributes of the part (MeshIndex 0, 1, 2 ...). Break out of the loop as soon as
+	// we cannot find any segment mesh attribute for the given MeshIndex and owner.
+	for (const FLandscapeSplinePartSegmentMeshAttributes& PartSegmentMesh : InPartAttributes)
 	{
-		// If MeshIndex == 0 then don't add the numeric suffix
-		const FString AttrNamePrefix = MeshIndex > 0
-			? FString::Printf(TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_MESH "%d"), MeshIndex)
-			: FString(TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_MESH));
-
 		bool bFoundDataForMeshIndex = false;
 		
 		FLandscapeSplineSegmentMeshAttributes SegmentAttributes;
 
-		FHoudiniHapiAccessor Accessor;
-		Accessor.Init(InNodeId, InPartId, TCHAR_TO_ANSI(*AttrNamePrefix));
-		SegmentAttributes.bHasMeshRefAttribute = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, SegmentAttributes.MeshRef);
-
+		SegmentAttributes.bHasMeshRefAttribute = PartSegmentMesh.MeshRef.Get(SegmentAttributes.MeshRef);
 		if (SegmentAttributes.bHasMeshRefAttribute)
 			bFoundDataForMeshIndex = true;
 
 		// mesh scale
-		{
-			static constexpr int32 MeshScaleTupleSize = 3;
-			const FString MeshScaleAttrName = FString::Printf(TEXT("%s%s"), *AttrNamePrefix, TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_SCALE_SUFFIX));
-
-			Accessor.Init(InNodeId, InPartId, TCHAR_TO_ANSI(*MeshScaleAttrName));
-			SegmentAttributes.bHasMeshScaleAttribute = Accessor.GetAttributeData(InAttrOwner, 3, SegmentAttributes.MeshScale, InStartIndex, InCount );
-
-			if (SegmentAttributes.bHasMeshScaleAttribute)
-				bFoundDataForMeshIndex = true;
-		}
+		const TLandscapeSplinePartAttribute<float>& MeshScale = InAttrOwner == HAPI_ATTROWNER_POINT
+			? PartSegmentMesh.PointMeshScale : PartSegmentMesh.PrimMeshScale;
+		SegmentAttributes.bHasMeshScaleAttribute = MeshScale.Get(SegmentAttributes.MeshScale, InStartIndex, InCount);
+		if (SegmentAttributes.bHasMeshScaleAttribute)
+			bFoundDataForMeshIndex = true;
 
 		// center adjust
-		{
-			static constexpr int32 MeshCenterAdjustTupleSize = 2;
-			const FString MeshCenterAdjustAttrName = FString::Printf(TEXT("%s%s"), *AttrNamePrefix, TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_CENTER_ADJUST_SUFFIX));
-
-			Accessor.Init(InNodeId, InPartId, TCHAR_TO_ANSI(*MeshCenterAdjustAttrName));
-			SegmentAttributes.bHasMeshCenterAdjustAttribute = Accessor.GetAttributeData(InAttrOwner, MeshCenterAdjustTupleSize, SegmentAttributes.CenterAdjust, InStartIndex, InCount);
+		const TLandscapeSplinePartAttribute<float>& CenterAdjust = InAttrOwner == HAPI_ATTROWNER_POINT
+			? PartSegmentMesh.PointCenterAdjust : PartSegmentMesh.PrimCenterAdjust;
+		SegmentAttributes.bHasMeshCenterAdjustAttribute = CenterAdjust.Get(SegmentAttributes.CenterAdjust, InStartIndex, InCount);
+		if (SegmentAttributes.bHasMeshCenterAdjustAttribute)
+			bFoundDataForMeshIndex = true;
 
-			if (SegmentAttributes.bHasMeshCenterAdjustAttribute)
-				bFoundDataForMeshIndex = true;
-		}
 		// material overrides
-		const FString MaterialAttrNamePrefix = AttrNamePrefix + TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_MATERIAL_OVERRIDE_SUFFIX);
-		SegmentAttributes.MeshMaterialOverrideRefs.Reset();
-
-		// The same as with the MeshIndex above, loop until the first iteration where we cannot find a material
-		// override attribute
-		int32 MaterialOverrideIdx = 0;
-		while (true)
+		SegmentAttributes.MeshMaterialOverrideRefs.Reset(PartSegmentMesh.MaterialOverrides.Num());
+		for (const TLandscapeSplinePartAttribute<FString>& MaterialOverride : PartSegmentMesh.MaterialOverrides)
 		{
-			TArray<FString> MaterialOverrides;
-
-			// Add the MaterialOverrideIdx as a suffix to the attribute name when > 0
-			const FString MaterialOverrideAttrName = MaterialOverrideIdx > 0
-				? MaterialAttrNamePrefix + FString::Printf(TEXT("%d"), MaterialOverrideIdx)
-				: MaterialAttrNamePrefix;
-
-			Accessor.Init(InNodeId, InPartId, TCHAR_TO_ANSI(*MaterialOverrideAttrName));
-			bool bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_INVALID, 1, MaterialOverrides);
-
-			if (!bSuccess)
-			{
-				break;
-			}
-			
-			SegmentAttributes.MeshMaterialOverrideRefs.Emplace(MoveTemp(MaterialOverrides));
+			MaterialOverride.Get(SegmentAttributes.MeshMaterialOverrideRefs.AddDefaulted_GetRef());
 			bFoundDataForMeshIndex = true;
-			MaterialOverrideIdx++;
 		}
-		SegmentAttributes.MeshMaterialOverrideRefs.Shrink();
 
 		if (!bFoundDataForMeshIndex)
 			break;
 
 		OutAttributes.Emplace(MoveTemp(SegmentAttributes));
-
-		MeshIndex++;
 	}
 	OutAttributes.Shrink();
 
@@ -1301,120 +1326,57 @@ FHoudiniLandscapeSplineTranslator::CopySegmentMeshAttributesFromHoudini(
 }
 
 bool
-FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
-	const HAPI_NodeId InNodeId,
-	const HAPI_PartId InPartId,
+FHoudiniLandscapeSplineTranslator::CopyCurveAttributes(
+	const FLandscapeSplinePartAttributes& InPartAttributes,
 	const int32 InPrimIndex,
 	const int32 InFirstPointIndex,
 	const int32 InNumPoints,
 	FLandscapeSplineCurveAttributes& OutCurveAttributes)
 {
-	// Some constants that are reused
-	// Tuple size of 1
-	static constexpr int32 TupleSizeOne = 1;
 	// Prim attribute data count of 1
 	static constexpr int32 NumPrimsOne = 1;
 
+	const FLandscapeSplinePartAttributes& Part = InPartAttributes;
+
 	// point positions
-	FHoudiniHapiAccessor Accessor(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_POSITION);
-	Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 3, OutCurveAttributes.PointPositions, InFirstPointIndex, InNumPoints);
+	Part.PointPositions.Get(OutCurveAttributes.PointPositions, InFirstPointIndex, InNumPoints);
 
 	// rot attribute (quaternion) -- control point rotations
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_ROTATION);
-	bool bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 4, OutCurveAttributes.PointRotations, InFirstPointIndex, InNumPoints);
-	OutCurveAttributes.bHasPointRotationAttribute = bSuccess;
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_PAINT_LAYER_NAME);
-	Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointPaintLayerNames, InFirstPointIndex, InNumPoints);
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_RAISE_TERRAIN);
-	Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointRaiseTerrains, InFirstPointIndex, InNumPoints);
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_LOWER_TERRAIN);
-	Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointLowerTerrains, InFirstPointIndex, InNumPoints);
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_MESH);
-	Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointMeshRefs, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasPointRotationAttribute = Part.PointRotations.Get(OutCurveAttributes.PointRotations, InFirstPointIndex, InNumPoints);
 
+	Part.PointPaintLayerNames.Get(OutCurveAttributes.PointPaintLayerNames, InFirstPointIndex, InNumPoints);
+	Part.PointRaiseTerrains.Get(OutCurveAttributes.PointRaiseTerrains, InFirstPointIndex, InNumPoints);
+	Part.PointLowerTerrains.Get(OutCurveAttributes.PointLowerTerrains, InFirstPointIndex, InNumPoints);
+	Part.PointMeshRefs.Get(OutCurveAttributes.PointMeshRefs, InFirstPointIndex, InNumPoints);
 
 	// control point material overrides
-	OutCurveAttributes.PerMaterialOverridePointRefs.Reset();
-	const FString ControlPointMaterialOverrideAttrNamePrefix = TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_MATERIAL_OVERRIDE_SUFFIX);
-
-	// Loop until the first iteration where we don't find any material override attributes.
-	int32 MaterialOverrideIdx = 0;
-	while (true)
-	{
-		TArray<FString> MaterialOverrides;
-
-		// If the index > 0 add it as a suffix to the attribute name
-		const FString AttrName = MaterialOverrideIdx > 0
-			? ControlPointMaterialOverrideAttrNamePrefix + FString::Printf(TEXT("%d"), MaterialOverrideIdx)
-			: ControlPointMaterialOverrideAttrNamePrefix;
-
-		Accessor.Init(InNodeId, InPartId, TCHAR_TO_ANSI(*AttrName));
-		bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, MaterialOverrides);
-
-		if (!bSuccess)
-		{
-			break;
-		}
-		
-		OutCurveAttributes.PerMaterialOverridePointRefs.Emplace(MoveTemp(MaterialOverrides));
-		MaterialOverrideIdx++;
-	}
+	OutCurveAttributes.PerMaterialOverridePointRefs.Reset(Part.PointMaterialOverrides.Num());
+	for (const TLandscapeSplinePartAttribute<FString>& MaterialOverride : Part.PointMaterialOverrides)
+		MaterialOverride.Get(OutCurveAttributes.PerMaterialOverridePointRefs.AddDefaulted_GetRef());
 
 	// control point mesh scales
-
-	Accessor.Init(InNodeId,InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_MESH HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_SCALE_SUFFIX);
-	OutCurveAttributes.bHasPointIdAttribute = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 3, OutCurveAttributes.PointMeshScales, InFirstPointIndex, InNumPoints);
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_ID);
-	OutCurveAttributes.bHasPointMeshScaleAttribute = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointIds, InFirstPointIndex, InNumPoints);
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_HALF_WIDTH);
-	OutCurveAttributes.bHasPointHalfWidthAttribute = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointHalfWidths, InFirstPointIndex, InNumPoints);
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SIDE_FALLOFF);
-	OutCurveAttributes.bHasPointSideFalloffAttribute = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointSideFalloffs, InFirstPointIndex, InNumPoints);
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_END_FALLOFF);
-	OutCurveAttributes.bHasPointEndFalloffAttribute = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointEndFalloffs, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasPointIdAttribute = Part.PointMeshScales.Get(OutCurveAttributes.PointMeshScales, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasPointMeshScaleAttribute = Part.PointIds.Get(OutCurveAttributes.PointIds, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasPointHalfWidthAttribute = Part.PointHalfWidths.Get(OutCurveAttributes.PointHalfWidths, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasPointSideFalloffAttribute = Part.PointSideFalloffs.Get(OutCurveAttributes.PointSideFalloffs, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasPointEndFalloffAttribute = Part.PointEndFalloffs.Get(OutCurveAttributes.PointEndFalloffs, InFirstPointIndex, InNumPoints);
 
 	// Connection attributes -- there are separate attributes for the two ends of the connection
-	static const char* ConnectionMeshSocketNameAttrNames[]
-	{
-		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION0_MESH_SOCKET_NAME,
-		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION1_MESH_SOCKET_NAME
-	};
-	static const char* ConnectionTangentLengthAttrNames[]
-	{
-		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION0_TANGENT_LENGTH,
-		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION1_TANGENT_LENGTH
-	};
 	for (int32 ConnectionIndex = 0; ConnectionIndex < 2; ++ConnectionIndex)
 	{
 		// segment connection[ConnectionIndex] socket names -- vertex/point attribute
+		OutCurveAttributes.bHasVertexConnectionSocketNameAttribute[ConnectionIndex] =
+			Part.PrimConnectionSocketNames[ConnectionIndex].Get(OutCurveAttributes.VertexConnectionSocketNames[ConnectionIndex]);
 
-		Accessor.Init(InNodeId, InPartId, ConnectionMeshSocketNameAttrNames[ConnectionIndex]);
-		bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, OutCurveAttributes.VertexConnectionSocketNames[ConnectionIndex]);
-
-		OutCurveAttributes.bHasVertexConnectionSocketNameAttribute[ConnectionIndex] = bSuccess;
-
-
-		Accessor.Init(InNodeId, InPartId, ConnectionTangentLengthAttrNames[ConnectionIndex]);
 		OutCurveAttributes.bHasVertexConnectionTangentLengthAttribute[ConnectionIndex] = 
-			Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.PointEndFalloffs, InFirstPointIndex, InNumPoints);
+			Part.PointConnectionTangentLengths[ConnectionIndex].Get(OutCurveAttributes.PointEndFalloffs, InFirstPointIndex, InNumPoints);
 
-			// segment connection[ConnectionIndex] socket names -- prim attribute
+		// segment connection[ConnectionIndex] socket names -- prim attribute
 		if (!OutCurveAttributes.bHasVertexConnectionSocketNameAttribute[ConnectionIndex])
 		{
 			TArray<FString> SocketNames;
-			Accessor.Init(InNodeId, InPartId, ConnectionMeshSocketNameAttrNames[ConnectionIndex]);
-			bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, SocketNames, InPrimIndex, NumPrimsOne);
-
-			OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex] = bSuccess;
-				
+			OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex] =
+				Part.PrimConnectionSocketNames[ConnectionIndex].Get(SocketNames, InPrimIndex, NumPrimsOne);
 
 			if (OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex] && SocketNames.Num() > 0)
 			{
@@ -1430,9 +1392,8 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 		if (!OutCurveAttributes.bHasVertexConnectionTangentLengthAttribute[ConnectionIndex])
 		{
 			TArray<float> Tangents;
-			Accessor.Init(InNodeId, InPartId, ConnectionTangentLengthAttrNames[ConnectionIndex]);
-			bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, Tangents, InFirstPointIndex, NumPrimsOne);
-			OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex] = bSuccess;
+			OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex] =
+				Part.PrimConnectionTangentLengths[ConnectionIndex].Get(Tangents, InFirstPointIndex, NumPrimsOne);
 
 			if (OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex] && Tangents.Num() > 0)
 			{
@@ -1446,42 +1407,28 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 	}
 
 	// segment paint layer name -- vertex/point
-	
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME);
-	bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, OutCurveAttributes.VertexPaintLayerNames, InFirstPointIndex, InNumPoints);
-	OutCurveAttributes.bHasVertexPaintLayerNameAttribute = bSuccess;
-
-	// segment raise terrains -- vertex/point
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_RAISE_TERRAIN);
-	bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1,  OutCurveAttributes.VertexRaiseTerrains, InFirstPointIndex, InNumPoints);
-	OutCurveAttributes.bHasVertexRaiseTerrainAttribute = bSuccess;
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_LOWER_TERRAIN);
-	bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.VertexLowerTerrains, InFirstPointIndex, InNumPoints);
-	OutCurveAttributes.bHasVertexLowerTerrainAttribute = bSuccess;
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_NAME);
-	bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.VertexEditLayers, InFirstPointIndex, InNumPoints);
-	OutCurveAttributes.bHasVertexEditLayerAttribute = bSuccess;
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_CLEAR);
-	bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.VertexEditLayersClear, InFirstPointIndex, InNumPoints);
-	OutCurveAttributes.bHasVertexEditLayerClearAttribute = bSuccess;
-
-	Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_AFTER);
-	bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, OutCurveAttributes.VertexEditLayersAfter, InFirstPointIndex, InNumPoints);
-	OutCurveAttributes.bHasVertexEditLayerAfterAttribute = bSuccess;
+	OutCurveAttributes.bHasVertexPaintLayerNameAttribute =
+		Part.PrimSegmentPaintLayerNames.Get(OutCurveAttributes.VertexPaintLayerNames, InFirstPointIndex, InNumPoints);
+
+	// segment raise / lower terrains -- vertex/point
+	OutCurveAttributes.bHasVertexRaiseTerrainAttribute =
+		Part.PointSegmentRaiseTerrains.Get(OutCurveAttributes.VertexRaiseTerrains, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasVertexLowerTerrainAttribute =
+		Part.PointSegmentLowerTerrains.Get(OutCurveAttributes.VertexLowerTerrains, InFirstPointIndex, InNumPoints);
+
+	// segment edit layers -- vertex/point
+	OutCurveAttributes.bHasVertexEditLayerAttribute =
+		Part.PointEditLayers.Get(OutCurveAttributes.VertexEditLayers, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasVertexEditLayerClearAttribute =
+		Part.PointEditLayersClear.Get(OutCurveAttributes.VertexEditLayersClear, InFirstPointIndex, InNumPoints);
+	OutCurveAttributes.bHasVertexEditLayerAfterAttribute =
+		Part.PointEditLayersAfter.Get(OutCurveAttributes.VertexEditLayersAfter, InFirstPointIndex, InNumPoints);
 
 	// segment paint layer name
 	if (!OutCurveAttributes.bHasVertexPaintLayerNameAttribute)
 	{
 		TArray<FString> SegmentPaintLayerName;
-
-		Accessor.Init(InNodeId, InPartId,HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME);
-		bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, SegmentPaintLayerName, InPrimIndex, NumPrimsOne);
-
-		if (bSuccess && SegmentPaintLayerName.Num() > 0)
+		if (Part.PrimSegmentPaintLayerNames.Get(SegmentPaintLayerName, InPrimIndex, NumPrimsOne) && SegmentPaintLayerName.Num() > 0)
 		{
 			OutCurveAttributes.PrimPaintLayerName = SegmentPaintLayerName[0];
 			OutCurveAttributes.bHasPrimPaintLayerNameAttribute = true;
@@ -1501,14 +1448,7 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 	if (!OutCurveAttributes.bHasVertexRaiseTerrainAttribute)
 	{
 		TArray<int32> RaiseTerrains;
-		HAPI_AttributeInfo PrimRaiseTerrainAttrInfo;
-
-		Accessor.Init(InNodeId,InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_RAISE_TERRAIN);
-		Accessor.GetInfo(PrimRaiseTerrainAttrInfo, HAPI_ATTROWNER_INVALID);
-		PrimRaiseTerrainAttrInfo.tupleSize = 1;
-		bSuccess = Accessor.GetAttributeData(PrimRaiseTerrainAttrInfo, RaiseTerrains, InPrimIndex, NumPrimsOne);
-
-		if (bSuccess && RaiseTerrains.Num() > 0)
+		if (Part.SegmentRaiseTerrains.Get(RaiseTerrains, InPrimIndex, NumPrimsOne) && RaiseTerrains.Num() > 0)
 		{
 			OutCurveAttributes.bPrimRaiseTerrain = RaiseTerrains[0];
 			OutCurveAttributes.bHasPrimRaiseTerrainAttribute = true;
@@ -1528,13 +1468,7 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 	if (!OutCurveAttributes.bHasVertexLowerTerrainAttribute)
 	{
 		TArray<int32> LowerTerrains;
-
-		HAPI_AttributeInfo PrimLowerTerrainAttrInfo;
-		Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_LOWER_TERRAIN);
-		Accessor.GetInfo(PrimLowerTerrainAttrInfo, HAPI_ATTROWNER_PRIM);
-		bSuccess = Accessor.GetAttributeData(PrimLowerTerrainAttrInfo, LowerTerrains);
-
-		if (bSuccess && LowerTerrains.Num() > 0)
+		if (Part.PrimSegmentLowerTerrains.Get(LowerTerrains) && LowerTerrains.Num() > 0)
 		{
 			OutCurveAttributes.bPrimLowerTerrain = LowerTerrains[0];
 			OutCurveAttributes.bHasPrimLowerTerrainAttribute = true;
@@ -1554,10 +1488,7 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 	if (!OutCurveAttributes.bHasVertexEditLayerAttribute)
 	{
 		TArray<FString> EditLayers;
-		Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_NAME);
-		bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, EditLayers);
-
-		if (bSuccess && EditLayers.Num() > 0)
+		if (Part.PrimEditLayers.Get(EditLayers) && EditLayers.Num() > 0)
 		{
 			OutCurveAttributes.PrimEditLayer = EditLayers[0];
 			OutCurveAttributes.bHasPrimEditLayerAttribute = true;
@@ -1576,13 +1507,7 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 	if (!OutCurveAttributes.bHasVertexEditLayerClearAttribute)
 	{
 		TArray<int32> EditLayersClear;
-		HAPI_AttributeInfo PrimEditLayerClearAttrInfo;
-
-		Accessor.Init(InNodeId,InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_CLEAR);
-
-		bSuccess = Accessor.GetAttributeData(PrimEditLayerClearAttrInfo, EditLayersClear, InPrimIndex, NumPrimsOne);
-
-		if (bSuccess && EditLayersClear.Num() > 0)
+		if (Part.PrimEditLayersClear.Get(EditLayersClear, InPrimIndex, NumPrimsOne) && EditLayersClear.Num() > 0)
 		{
 			OutCurveAttributes.bPrimEditLayerClear = static_cast<bool>(EditLayersClear[0]);
 			OutCurveAttributes.bHasPrimEditLayerClearAttribute = true;
@@ -1601,10 +1526,7 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 	if (!OutCurveAttributes.bHasVertexEditLayerAfterAttribute)
 	{
 		TArray<FString> EditLayersAfter;
-		Accessor.Init(InNodeId, InPartId, HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_AFTER);
-		bSuccess = Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, EditLayersAfter, InPrimIndex, NumPrimsOne);
-
-		if (bSuccess && EditLayersAfter.Num() > 0)
+		if (Part.PrimEditLayersAfter.Get(EditLayersAfter, InPrimIndex, NumPrimsOne) && EditLayersAfter.Num() > 0)
 		{
 			OutCurveAttributes.PrimEditLayerAfter = EditLayersAfter[0];
 			OutCurveAttributes.bHasPrimEditLayerAfterAttribute = true;
@@ -1619,16 +1541,16 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 		OutCurveAttributes.bHasPrimEditLayerAfterAttribute = false;
 	}
 
-	// Copy segment mesh attributes from Houdini -- vertex/point attributes
-	if (!CopySegmentMeshAttributesFromHoudini(
-			InNodeId, InPartId, HAPI_ATTROWNER_POINT, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexPerMeshSegmentData))
+	// Copy segment mesh attributes -- vertex/point attributes
+	if (!CopySegmentMeshAttributes(
+			Part.SegmentMeshes, HAPI_ATTROWNER_POINT, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexPerMeshSegmentData))
 	{
 		return false;
 	}
 
-	// Copy segment mesh attributes from Houdini -- prim attributes
-	if (!CopySegmentMeshAttributesFromHoudini(
-			InNodeId, InPartId, HAPI_ATTROWNER_PRIM, InPrimIndex, 1, OutCurveAttributes.PrimPerMeshSegmentData))
+	// Copy segment mesh attributes -- prim attributes
+	if (!CopySegmentMeshAttributes(
+			Part.SegmentMeshes, HAPI_ATTROWNER_PRIM, InPrimIndex, 1, OutCurveAttributes.PrimPerMeshSegmentData))
 	{
 		return false;
 	}
@@ -1636,6 +1558,41 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 	return true;
 }
 
+bool
+FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
+	const HAPI_NodeId InNodeId,
+	const HAPI_PartId InPartId,
+	const TArray<int32>& InCurvePointCounts,
+	TArray<FLandscapeSplineCurveAttributes>& OutCurveAttributes)
+{
+	// Answer the probes for attributes the part does not have locally, unless the caller already did.
+	TOptional<FHoudiniScopedPartAttributeManifest> ScopedManifest;
+	if (!FHoudiniPartAttributeManifest::Find(InNodeId, InPartId))
+	{
+		HAPI_PartInfo PartInfo;
+		FHoudiniApi::PartInfo_Init(&PartInfo);
+		if (FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), InNodeId, InPartId, &PartInfo) == HAPI_RESULT_SUCCESS)
+			ScopedManifest.Emplace(InNodeId, InPartId, PartInfo);
+	}
+
+	// Fetch every landscape spline attribute of the part once, then copy each curve's range from memory.
+	FLandscapeSplinePartAttributes PartAttributes;
+	PartAttributes.Fetch(InNodeId, InPartId);
+
+	OutCurveAttributes.Reset(InCurvePointCounts.Num());
+	int32 FirstPointIndex = 0;
+	for (int32 CurveIdx = 0; CurveIdx < InCurvePointCounts.Num(); ++CurveIdx)
+	{
+		const int32 NumPointsInCurve = InCurvePointCounts[CurveIdx];
+		if (!CopyCurveAttributes(PartAttributes, CurveIdx, FirstPointIndex, NumPointsInCurve, OutCurveAttributes.AddDefaulted_GetRef()))
+			return false;
+
+		FirstPointIndex += NumPointsInCurve;
+	}
+
+	return true;
+}
+
 bool
 FHoudiniLandscapeSplineTranslator::UpdateControlPointFromAttributes(
 		ULandscapeSplineControlPoint* const InPoint,
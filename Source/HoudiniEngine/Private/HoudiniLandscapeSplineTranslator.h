@@ -45,11 +45,181 @@ struct FLandscapeSplineSegmentConnection;
 class UHoudiniAssetComponent;
 struct FHoudiniPackageParams;
 struct FLandscapeSplineInfo;
-struct FLandscapeSplineCurveAttributes;
-struct FLandscapeSplineSegmentMeshAttributes;
+struct FLandscapeSplinePartAttributes;
+struct FLandscapeSplinePartSegmentMeshAttributes;
 struct FHoudiniLandscapeSplineApplyLayerData;
 
 
+/** Per mesh attribute data for a landscape spline segment. */
+struct FLandscapeSplineSegmentMeshAttributes
+{
+	/** Mesh ref */
+	bool bHasMeshRefAttribute = false;
+	TArray<FString> MeshRef;
+	
+	/** Mesh material override, the outer index is material 0, 1, 2 ... */
+	TArray<TArray<FString>> MeshMaterialOverrideRefs;
+
+	/** Mesh scale. */
+	bool bHasMeshScaleAttribute = false;
+	TArray<float> MeshScale;
+
+	/** Center Adjust. */
+	bool bHasMeshCenterAdjustAttribute = false;
+	TArray<float> CenterAdjust;
+};
+
+
+/** Attribute data extracted from curve points and prims. */
+struct FLandscapeSplineCurveAttributes
+{
+	//
+	// Point Attributes
+	//
+	
+	/** Resampled point positions. */
+	TArray<float> PointPositions;
+	
+	/** Point rotations. */
+	bool bHasPointRotationAttribute = false;
+	TArray<float> PointRotations;
+	
+	/** Point paint layer names */
+	bool bHasPointPaintLayerNameAttribute = false;
+	TArray<FString> PointPaintLayerNames;
+	
+	/** Point bRaiseTerrain */
+	bool bHasPointRaiseTerrainAttribute = false;
+	TArray<int32> PointRaiseTerrains;
+	
+	/** Point bLowerTerrain */
+	bool bHasPointLowerTerrainAttribute = false;
+	TArray<int32> PointLowerTerrains;
+
+	/** The StaticMesh ref per point. */
+	bool bHasPointMeshRefAttribute = false;
+	TArray<FString> PointMeshRefs;
+
+	/**
+	 * The Material Override refs of each point. The outer index material override index, the inner index
+	 * is point index.
+	 */
+	TArray<TArray<FString>> PerMaterialOverridePointRefs;
+
+	/** The static mesh scale of each point. */
+	bool bHasPointMeshScaleAttribute = false;
+	TArray<float> PointMeshScales;
+
+	/** The ids of the control points. */
+	bool bHasPointIdAttribute = false;
+	TArray<int32> PointIds;
+
+	/** The point half-width. */
+	bool bHasPointHalfWidthAttribute = false;
+	TArray<float> PointHalfWidths;
+
+	/** The point side-falloff. */
+	bool bHasPointSideFalloffAttribute = false;
+	TArray<float> PointSideFalloffs;
+
+	/** The point end-falloff. */
+	bool bHasPointEndFalloffAttribute = false;
+	TArray<float> PointEndFalloffs;
+
+	//
+	// Although the following properties are named Vertex... they are point attributes in HAPI (but are intended to be
+	// authored as vertex attributes in Houdini). When curves are extracted via HAPI points and vertices are the same.
+	//
+	
+	/**
+	 * The mesh socket names on the splines' vertices. The outer index is the near side (0) and far side (1) of the
+	 * segment connection. The inner index is a vertex index.
+	 */
+	bool bHasVertexConnectionSocketNameAttribute[2] { false, false };
+	TArray<FString> VertexConnectionSocketNames[2];
+
+	/**
+	 * Tangent length point attribute, for segment connections. The outer index is the near side (0) and far side (1)
+	 * of the segment connection. The inner index is a vertex index.
+	 */
+	bool bHasVertexConnectionTangentLengthAttribute[2] { false, false };
+	TArray<float> VertexConnectionTangentLengths[2];
+
+	/** Vertex/segment paint layer name */
+	bool bHasVertexPaintLayerNameAttribute = false;
+	TArray<FString> VertexPaintLayerNames;
+
+	/** Vertex/segment bRaiseTerrain */
+	bool bHasVertexRaiseTerrainAttribute = false;
+	TArray<int32> VertexRaiseTerrains;
+
+	/** Vertex/segment bLowerTerrain */
+	bool bHasVertexLowerTerrainAttribute = false;
+	TArray<int32> VertexLowerTerrains;
+
+	/** Edit layer name */
+	bool bHasVertexEditLayerAttribute = false;
+	TArray<FString> VertexEditLayers;
+
+	/** Edit layer: clear */
+	bool bHasVertexEditLayerClearAttribute = false;
+	TArray<int32> VertexEditLayersClear;
+
+	/** Edit layer: add after */
+	bool bHasVertexEditLayerAfterAttribute = false;
+	TArray<FString> VertexEditLayersAfter;
+
+	/** Static mesh attributes on vertices. Outer index is mesh 0, 1, 2 ... */
+	TArray<FLandscapeSplineSegmentMeshAttributes> VertexPerMeshSegmentData;
+
+	//
+	// Primitive attributes
+	//
+	
+	/**
+	 * The mesh socket names on the splines' prims. The index is the near side (0) and far side (1) of the
+	 * segment connection.
+	 */
+	bool bHasPrimConnectionSocketNameAttribute[2] { false, false };
+	FString PrimConnectionSocketNames[2];
+
+	/**
+	 * Tangent length point attribute, for segment connections. The index is the near side (0) and far side (1)
+	 * of the segment connection.
+	 */
+	bool bHasPrimConnectionTangentLengthAttribute[2] { false, false };
+	float PrimConnectionTangentLengths[2];
+
+	/** Prim/segment paint layer name */
+	bool bHasPrimPaintLayerNameAttribute = false;
+	FString PrimPaintLayerName;
+
+	/** Prim/segment bRaiseTerrain */
+	bool bHasPrimRaiseTerrainAttribute = false;
+	int32 bPrimRaiseTerrain;
+
+	/** Prim/segment bLowerTerrain */
+	bool bHasPrimLowerTerrainAttribute = false;
+	int32 bPrimLowerTerrain;
+
+	/** Edit layer name */
+	bool bHasPrimEditLayerAttribute = false;
+	FString PrimEditLayer;
+
+	/** Edit layer: clear */
+	bool bHasPrimEditLayerClearAttribute = false;
+	bool bPrimEditLayerClear;
+
+	/** Edit layer: add after */
+	bool bHasPrimEditLayerAfterAttribute = false;
+	FString PrimEditLayerAfter;
+
+	/** Static mesh attribute from primitives, the index is mesh 0, 1, 2 ... */
+	TArray<FLandscapeSplineSegmentMeshAttributes> PrimPerMeshSegmentData;
+};
+
+
+
 struct HOUDINIENGINE_API FHoudiniLandscapeSplineTranslator
 {
 	/**
@@ -102,6 +272,21 @@ struct HOUDINIENGINE_API FHoudiniLandscapeSplineTranslator
 		TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputSplines,
 		UHoudiniAssetComponent* InHAC=nullptr);
 
+	/**
+	 * @brief Copy the landscape spline attributes of every curve of a part. Each attribute is fetched once for the
+	 * whole part, then split per curve.
+	 * @param InNodeId The node of the part.
+	 * @param InPartId The part containing the curves.
+	 * @param InCurvePointCounts The number of points of each curve of the part.
+	 * @param OutCurveAttributes The attributes of each curve, in the same order as InCurvePointCounts.
+	 * @return True if the attributes were copied.
+	 */
+	static bool CopyCurveAttributesFromHoudini(
+		HAPI_NodeId InNodeId,
+		HAPI_PartId InPartId,
+		const TArray<int32>& InCurvePointCounts,
+		TArray<FLandscapeSplineCurveAttributes>& OutCurveAttributes);
+
 private:
 	static void DeleteTempLandscapeLayers(UHoudiniOutput* InOutput);
 
@@ -121,17 +306,15 @@ private:
 	static ULandscapeSplineControlPoint* GetOrCreateControlPoint(
 		FLandscapeSplineInfo& SplineInfo, int32 InControlPointId, bool& bOutCreated);
 	
-	static bool CopySegmentMeshAttributesFromHoudini(
-		HAPI_NodeId InNodeId,
-		HAPI_PartId InPartId,
+	static bool CopySegmentMeshAttributes(
+		const TArray<FLandscapeSplinePartSegmentMeshAttributes>& InPartAttributes,
 		HAPI_AttributeOwner InAttrOwner,
 		int32 InStartIndex,
 		int32 InCount,
 		TArray<FLandscapeSplineSegmentMeshAttributes>& OutAttributes);
 
-	static bool CopyCurveAttributesFromHoudini(
-		HAPI_NodeId InNodeId,
-		HAPI_PartId InPartId,
+	static bool CopyCurveAttributes(
+		const FLandscapeSplinePartAttributes& InPartAttributes,
 		int32 InPrimIndex,
 		int32 InFirstPointIndex,
 		int32 InNumPoints,
@@ -67,6 +67,8 @@
 #include "Components/SkeletalMeshComponent.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
 
 #include "EditorSupportDelegates.h"
 #include "HoudiniGeometryCollectionTranslator.h"
@@ -87,6 +89,117 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+namespace
+{
+	// Fitted colliders, keyed on the collider type and the positions they were fitted to.
+	// Recooks that output the same collision geometry reuse the previous fit.
+	class FHoudiniCollisionFitCache
+	{
+	public:
+		// Past this amount of memory, the cache is emptied before adding new fits
+		static constexpr SIZE_T MaxSize = 64 * 1024 * 1024;
+
+		static bool Find(uint32 InFitType, const TArray<FVector>& InPositions, FKAggregateGeom& OutAggregateCollisions)
+		{
+			const uint64 Hash = HashPositions(InFitType, InPositions);
+
+			FScopeLock ScopeLock(&CriticalSection);
+			TArray<const FEntry*> Candidates;
+			Entries.MultiFindPointer(Hash, Candidates);
+			for (const FEntry* Entry : Candidates)
+			{
+				// Check the positions to rule out hash collisions
+				if (Entry->FitType != InFitType || Entry->Positions != InPositions)
+					continue;
+
+				OutAggregateCollisions = Entry->AggregateCollisions;
+				return true;
+			}
+
+			return false;
+		}
+
+		static void Add(uint32 InFitType, const TArray<FVector>& InPositions, const FKAggregateGeom& InAggregateCollisions)
+		{
+			const uint64 Hash = HashPositions(InFitType, InPositions);
+
+			const SIZE_T EntrySize = GetEntrySize(InPositions, InAggregateCollisions);
+			if (EntrySize > MaxSize)
+				return;
+
+			FScopeLock ScopeLock(&CriticalSection);
+			if (CurrentSize + EntrySize > MaxSize)
+			{
+				Entries.Empty();
+				CurrentSize = 0;
+			}
+
+			FEntry& Entry = Entries.Add(Hash);
+			Entry.FitType = InFitType;
+			Entry.Positions = InPositions;
+			Entry.AggregateCollisions = InAggregateCollisions;
+			CurrentSize += EntrySize;
+		}
+
+		static void Empty()
+		{
+			FScopeLock ScopeLock(&CriticalSection);
+			Entries.Empty();
+			CurrentSize = 0;
+		}
+
+		static int32 Num()
+		{
+			FScopeLock ScopeLock(&CriticalSection);
+			return Entries.Num();
+		}
+
+	private:
+		struct FEntry
+		{
+			uint32 FitType = 0;
+			TArray<FVector> Positions;
+			FKAggregateGeom AggregateCollisions;
+		};
+
+		static uint64 HashPositions(uint32 InFitType, const TArray<FVector>& InPositions)
+		{
+			return CityHash64WithSeed(
+				reinterpret_cast<const char*>(InPositions.GetData()), InPositions.Num() * sizeof(FVector), InFitType);
+		}
+
+		// Approximate memory used by an entry: the positions, and the convex hulls' data
+		static SIZE_T GetEntrySize(const TArray<FVector>& InPositions, const FKAggregateGeom& InAggregateCollisions)
+		{
+			SIZE_T Size = sizeof(FEntry) + InPositions.Num() * sizeof(FVector);
+			for (const FKConvexElem& ConvexElem : InAggregateCollisions.ConvexElems)
+				Size += sizeof(FKConvexElem) + ConvexElem.VertexData.Num() * sizeof(FVector) + ConvexElem.IndexData.Num() * sizeof(int32);
+
+			return Size;
+		}
+
+		static FCriticalSection CriticalSection;
+		static TMultiMap<uint64, FEntry> Entries;
+		static SIZE_T CurrentSize;
+	};
+
+	FCriticalSection FHoudiniCollisionFitCache::CriticalSection;
+	TMultiMap<uint64, FHoudiniCollisionFitCache::FEntry> FHoudiniCollisionFitCache::Entries;
+	SIZE_T FHoudiniCollisionFitCache::CurrentSize = 0;
+
+	// Fit type used to cache multi hull convex decompositions, past the simple collision types
+	constexpr uint32 ConvexDecompositionFitType = 0x100;
+
+	void AppendAggregateCollisions(const FKAggregateGeom& InAggregateCollisions, FKAggregateGeom& OutAggregateCollisions)
+	{
+		OutAggregateCollisions.SphereElems.Append(InAggregateCollisions.SphereElems);
+		OutAggregateCollisions.BoxElems.Append(InAggregateCollisions.BoxElems);
+		OutAggregateCollisions.SphylElems.Append(InAggregateCollisions.SphylElems);
+		OutAggregateCollisions.ConvexElems.Append(InAggregateCollisions.ConvexElems);
+		OutAggregateCollisions.TaperedCapsuleElems.Append(InAggregateCollisions.TaperedCapsuleElems);
+	}
+}
+
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	UHoudiniOutput* InOutput, 
@@ -1939,6 +2052,23 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	// Map of object identifiers to package params
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniPackageParams> ObjectIdentifiersToPackageParams;
 
+	// Fit all the simple colliders up front, so independent splits can be fitted in parallel
+	TMap<FString, FKAggregateGeom> FittedSimpleCollisions;
+	{
+		TArray<FString> SimpleCollisionSplits;
+		for (const FString& SplitGroupName : AllSplitGroups)
+		{
+			const EHoudiniSplitType SplitType = GetSplitTypeFromSplitName(SplitGroupName);
+			if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider || SplitType == EHoudiniSplitType::RenderedSimpleCollider)
+				SimpleCollisionSplits.Add(SplitGroupName);
+		}
+
+		TArray<FKAggregateGeom> FittedCollisions;
+		FitSplitSimpleCollisions(SimpleCollisionSplits, FittedCollisions);
+		for (int32 Idx = 0; Idx < SimpleCollisionSplits.Num(); Idx++)
+			FittedSimpleCollisions.Add(SimpleCollisionSplits[Idx], MoveTemp(FittedCollisions[Idx]));
+	}
+
 	// Iterate through all detected split groups we care about and split geometry.
 	// The split are ordered in the following way:
 	// Invisible Simple/Convex Colliders > LODs > MainGeo > Visible Colliders > Invisible Colliders
@@ -2008,11 +2138,14 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		else if (SplitType == EHoudiniSplitType::InvisibleSimpleCollider || SplitType == EHoudiniSplitType::RenderedSimpleCollider)
 		{
 			MainStaticMeshCTF = ECollisionTraceFlag::CTF_UseDefault;
-			// Get the part position if needed
-			UpdatePartPositionIfNeeded();
 
-			// Create the simple colliders and add them to the aggregate
-			if (!AddSimpleCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			// Add the simple colliders fitted before the loop to the aggregate
+			const FKAggregateGeom* FittedCollisions = FittedSimpleCollisions.Find(SplitGroupName);
+			if (FittedCollisions && FittedCollisions->GetElementCount() > 0)
+			{
+				AppendAggregateCollisions(*FittedCollisions, AggregateCollisions);
+			}
+			else
 			{
 				// Failed to generate a convex collider
 				HOUDINI_LOG_WARNING(
@@ -4592,37 +4725,64 @@ FHoudiniMeshTranslator::GetSplitTypeFromSplitName(const FString& InSplitName)
 	//return EHoudiniSplitType::Normal;
 }
 
-bool
-FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+void
+FHoudiniMeshTranslator::GetSplitUniquePositions(const FString& SplitGroupName, TArray<FVector>& OutPositions) const
 {
+	OutPositions.Reset();
+
 	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
+	const TArray<int32>* SplitGroupVertexList = AllSplitVertexLists.Find(SplitGroupName);
+	if (!SplitGroupVertexList)
+		return;
 
 	// We're only interested in unique vertices
-	TArray<int32> UniqueVertexIndexes;
-	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
+	const int32 NumPoints = PartPositions.Num() / 3;
+	TBitArray<> UsedPoints(false, NumPoints);
+	for (const int32 Index : *SplitGroupVertexList)
 	{
-		int32 Index = SplitGroupVertexList[VertexIdx];
-		if (!PartPositions.IsValidIndex(Index))
+		if (Index < 0 || Index >= NumPoints || UsedPoints[Index])
 			continue;
 
-		UniqueVertexIndexes.AddUnique(Index);
+		UsedPoints[Index] = true;
+
+		// Extract the collision geo's vertices
+		OutPositions.Emplace(
+			PartPositions[Index * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+			PartPositions[Index * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+			PartPositions[Index * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
 	}
+}
 
-	// Extract the collision geo's vertices
-	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
-	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
-	{
-		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
-			continue;
+void
+FHoudiniMeshTranslator::FitSplitSimpleCollisions(const TArray<FString>& InSplitGroupNames, TArray<FKAggregateGeom>& OutAggregateCollisions)
+{
+	OutAggregateCollisions.Reset();
+	if (InSplitGroupNames.Num() <= 0)
+		return;
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+	// Get the part position if needed
+	UpdatePartPositionIfNeeded();
+
+	TArray<EHoudiniCollisionType> CollisionTypes;
+	TArray<TArray<FVector>> PositionArrays;
+	CollisionTypes.SetNum(InSplitGroupNames.Num());
+	PositionArrays.SetNum(InSplitGroupNames.Num());
+	for (int32 Idx = 0; Idx < InSplitGroupNames.Num(); Idx++)
+	{
+		CollisionTypes[Idx] = GetSimpleCollisionTypeFromSplitName(InSplitGroupNames[Idx]);
+		GetSplitUniquePositions(InSplitGroupNames[Idx], PositionArrays[Idx]);
 	}
 
+	FitSimpleCollisions(CollisionTypes, PositionArrays, OutAggregateCollisions);
+}
+
+bool
+FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+{
+	// Extract the collision geo's unique vertices
+	TArray<FVector> VertexArray;
+	GetSplitUniquePositions(SplitGroupName, VertexArray);
+
 #if WITH_EDITOR
 	// Do we want to create multiple convex hulls?
 	bool bDoMultiHullDecomp = false;
@@ -4637,48 +4797,62 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 		// Look for extra attributes for the decomposition parameters? (HullCount/MaxHullVerts)
 	}
 
-	if (bDoMultiHullDecomp && (VertexArray.Num() >= 3 || UniqueVertexIndexes.Num() >= 3))
+	if (bDoMultiHullDecomp && VertexArray.Num() >= 3)
 	{
 		// creating multiple convex hull collision
 		// ... this might take a while
 
 		// We're only interested in the valid indices!
+		const int32 NumPoints = PartPositions.Num() / 3;
+		const TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
 		TArray<uint32> Indices;
-		for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
+		TArray<FVector> TrianglePositions;
+		Indices.Reserve(SplitGroupVertexList.Num());
+		TrianglePositions.Reserve(SplitGroupVertexList.Num());
+		for (const int32 Index : SplitGroupVertexList)
 		{
-			int32 Index = SplitGroupVertexList[VertexIdx];
-			if (!PartPositions.IsValidIndex(Index))
+			if (Index < 0 || Index >= NumPoints)
 				continue;
 
 			Indices.Add(Index);
+			TrianglePositions.Emplace(
+				PartPositions[Index * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+				PartPositions[Index * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+				PartPositions[Index * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
 		}
 
-		// But we need all the positions as vertex
-		TArray<FVector3f> Vertices;
-		Vertices.SetNum(PartPositions.Num() / 3);
-
-		for (int32 Idx = 0; Idx < Vertices.Num(); Idx++)
+		// The decomposition only depends on the triangles, reuse it if they haven't changed
+		FKAggregateGeom DecomposedCollisions;
+		if (!FHoudiniCollisionFitCache::Find(ConvexDecompositionFitType, TrianglePositions, DecomposedCollisions))
 		{
-			Vertices[Idx].X = PartPositions[Idx * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Y = PartPositions[Idx * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Z = PartPositions[Idx * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		}
+			// But we need all the positions as vertex
+			TArray<FVector3f> Vertices;
+			Vertices.SetNum(NumPoints);
 
-		// We are using Unreal's DecomposeMeshToHulls() 
-		// We need a BodySetup so create a fake/transient one
-		UBodySetup* BodySetup = NewObject<UBodySetup>();
+			for (int32 Idx = 0; Idx < Vertices.Num(); Idx++)
+			{
+				Vertices[Idx].X = PartPositions[Idx * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+				Vertices[Idx].Y = PartPositions[Idx * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+				Vertices[Idx].Z = PartPositions[Idx * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			}
+
+			// We are using Unreal's DecomposeMeshToHulls() 
+			// We need a BodySetup so create a fake/transient one
+			UBodySetup* BodySetup = NewObject<UBodySetup>();
 
-		// Run actual util to do the work (if we have some valid input)
-		DecomposeMeshToHulls(BodySetup, Vertices, Indices, HullCount, MaxHullVerts);
+			// Run actual util to do the work (if we have some valid input)
+			DecomposeMeshToHulls(BodySetup, Vertices, Indices, HullCount, MaxHullVerts);
+
+			DecomposedCollisions.ConvexElems = BodySetup->AggGeom.ConvexElems;
+			FHoudiniCollisionFitCache::Add(ConvexDecompositionFitType, TrianglePositions, DecomposedCollisions);
+		}
 
 		// If we succeed, return here
 		// If not, keep going and we'll try to do a single hull decomposition
-		if (BodySetup->AggGeom.ConvexElems.Num() > 0)
+		if (DecomposedCollisions.ConvexElems.Num() > 0)
 		{
 			// Copy the convex elem to our aggregate
-			for (int32 n = 0; n < BodySetup->AggGeom.ConvexElems.Num(); n++)
-				AggCollisions.ConvexElems.Add(BodySetup->AggGeom.ConvexElems[n]);
-
+			AggCollisions.ConvexElems.Append(DecomposedCollisions.ConvexElems);
 			return true;
 		}
 	}
@@ -4697,87 +4871,161 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 bool
 FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
 {
-	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
-
-	// We're only interested in unique vertices
-	TArray<int32> UniqueVertexIndexes;
+	TArray<TArray<FVector>> PositionArrays;
+	GetSplitUniquePositions(SplitGroupName, PositionArrays.AddDefaulted_GetRef());
 
-	for (int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++)
-	{
-		int32 Index = SplitGroupVertexList[VertexIdx];
-		if (!PartPositions.IsValidIndex(Index))
-			continue;
-
-		UniqueVertexIndexes.AddUnique(Index);
-	}
-
-	// Extract the collision geo's vertices
-	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
-	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
-	{
-		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
-			continue;
+	TArray<FKAggregateGeom> FittedCollisions;
+	FitSimpleCollisions({ GetSimpleCollisionTypeFromSplitName(SplitGroupName) }, PositionArrays, FittedCollisions);
+	AppendAggregateCollisions(FittedCollisions[0], AggCollisions);
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	return (FittedCollisions[0].GetElementCount() > 0);
+}
 
-	int32 NewColliders = 0;
+EHoudiniCollisionType
+FHoudiniMeshTranslator::GetSimpleCollisionTypeFromSplitName(const FString& SplitGroupName)
+{
 	if (SplitGroupName.Contains("Box"))
-	{
-		NewColliders = FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(VertexArray, AggCollisions);
-	}
+		return EHoudiniCollisionType::SimpleBox;
 	else if (SplitGroupName.Contains("Sphere"))
-	{
-		NewColliders = FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(VertexArray, AggCollisions);
-	}
+		return EHoudiniCollisionType::SimpleSphere;
 	else if (SplitGroupName.Contains("Capsule"))
+		return EHoudiniCollisionType::SimpleCapsule;
+	else if (SplitGroupName.Contains("kdop10X"))
+		return EHoudiniCollisionType::Kdop10x;
+	else if (SplitGroupName.Contains("kdop10Y"))
+		return EHoudiniCollisionType::Kdop10y;
+	else if (SplitGroupName.Contains("kdop10Z"))
+		return EHoudiniCollisionType::Kdop10z;
+	else if (SplitGroupName.Contains("kdop18"))
+		return EHoudiniCollisionType::Kdop18;
+
+	// by default, a kdop26 will be created
+	return EHoudiniCollisionType::Kdop26;
+}
+
+int32
+FHoudiniMeshTranslator::FitSimpleCollision(EHoudiniCollisionType InCollisionType, const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions)
+{
+	switch (InCollisionType)
 	{
-		NewColliders = FHoudiniMeshTranslator::GenerateOrientedSphylAsSimpleCollision(VertexArray, AggCollisions);
+		case EHoudiniCollisionType::SimpleBox:
+			return FHoudiniMeshTranslator::GenerateOrientedBoxAsSimpleCollision(InPositionArray, OutAggregateCollisions);
+
+		case EHoudiniCollisionType::SimpleSphere:
+			return FHoudiniMeshTranslator::GenerateSphereAsSimpleCollision(InPositionArray, OutAggregateCollisions);
+
+		case EHoudiniCollisionType::SimpleCapsule:
+			return FHoudiniMeshTranslator::GenerateOrientedSphylAsSimpleCollision(InPositionArray, OutAggregateCollisions);
+
+		default:
+			break;
 	}
-	else
+
+	// We need to see what type of KDop the user wants
+	uint32 NumDirections = 26;
+	const FVector* Directions = KDopDir26;
+	switch (InCollisionType)
 	{
-		// We need to see what type of collision the user wants
-		// by default, a kdop26 will be created
-		uint32 NumDirections = 26;
-		const FVector* Directions = KDopDir26;
-		if (SplitGroupName.Contains("kdop10X"))
-		{
+		case EHoudiniCollisionType::Kdop10x:
 			NumDirections = 10;
 			Directions = KDopDir10X;
-		}
-		else if (SplitGroupName.Contains("kdop10Y"))
-		{
+			break;
+
+		case EHoudiniCollisionType::Kdop10y:
 			NumDirections = 10;
 			Directions = KDopDir10Y;
-		}
-		else if (SplitGroupName.Contains("kdop10Z"))
-		{
+			break;
+
+		case EHoudiniCollisionType::Kdop10z:
 			NumDirections = 10;
 			Directions = KDopDir10Z;
-		}
-		else if (SplitGroupName.Contains("kdop18"))
-		{
+			break;
+
+		case EHoudiniCollisionType::Kdop18:
 			NumDirections = 18;
 			Directions = KDopDir18;
-		}
+			break;
+
+		default:
+			break;
+	}
+
+	// Converting the directions to a TArray
+	TArray<FVector> DirArray;
+	DirArray.SetNum(NumDirections);
+	for (uint32 DirectionIndex = 0; DirectionIndex < NumDirections; DirectionIndex++)
+	{
+		DirArray[DirectionIndex] = Directions[DirectionIndex];
+	}
+
+	return FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(InPositionArray, DirArray, OutAggregateCollisions);
+}
 
-		// Converting the directions to a TArray
-		TArray<FVector> DirArray;
-		DirArray.SetNum(NumDirections);
-		for (uint32 DirectionIndex = 0; DirectionIndex < NumDirections; DirectionIndex++)
+void
+FHoudiniMeshTranslator::FitSimpleCollisions(
+	const TArray<EHoudiniCollisionType>& InCollisionTypes,
+	const TArray<TArray<FVector>>& InPositionArrays,
+	TArray<FKAggregateGeom>& OutAggregateCollisions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::FitSimpleCollisions);
+
+	check(InCollisionTypes.Num() == InPositionArrays.Num());
+
+	const int32 NumSplits = InCollisionTypes.Num();
+	OutAggregateCollisions.Empty(NumSplits);
+	OutAggregateCollisions.SetNum(NumSplits);
+
+	// Reuse the cached fits, and sort the others between the thread safe fits and the KDops,
+	// which create a UModel and have to stay on the game thread
+	TArray<int32> ParallelFits;
+	TArray<int32> GameThreadFits;
+	for (int32 SplitIdx = 0; SplitIdx < NumSplits; SplitIdx++)
+	{
+		const EHoudiniCollisionType CollisionType = InCollisionTypes[SplitIdx];
+		if (FHoudiniCollisionFitCache::Find((uint32)CollisionType, InPositionArrays[SplitIdx], OutAggregateCollisions[SplitIdx]))
+			continue;
+
+		if (CollisionType == EHoudiniCollisionType::SimpleBox
+			|| CollisionType == EHoudiniCollisionType::SimpleSphere
+			|| CollisionType == EHoudiniCollisionType::SimpleCapsule)
 		{
-			DirArray[DirectionIndex] = Directions[DirectionIndex];
+			ParallelFits.Add(SplitIdx);
+		}
+		else
+		{
+			GameThreadFits.Add(SplitIdx);
 		}
-
-		NewColliders = FHoudiniMeshTranslator::GenerateKDopAsSimpleCollision(VertexArray, DirArray, AggCollisions);
 	}
 
-	return (NewColliders > 0);
+	ParallelFor(ParallelFits.Num(), [&](int32 FitIdx)
+	{
+		const int32 SplitIdx = ParallelFits[FitIdx];
+		FitSimpleCollision(InCollisionTypes[SplitIdx], InPositionArrays[SplitIdx], OutAggregateCollisions[SplitIdx]);
+	});
+
+	for (const int32 SplitIdx : GameThreadFits)
+		FitSimpleCollision(InCollisionTypes[SplitIdx], InPositionArrays[SplitIdx], OutAggregateCollisions[SplitIdx]);
+
+	// Cache the new fits, failed ones included so they aren't attempted again
+	auto CacheFits = [&](const TArray<int32>& Fits)
+	{
+		for (const int32 SplitIdx : Fits)
+			FHoudiniCollisionFitCache::Add((uint32)InCollisionTypes[SplitIdx], InPositionArrays[SplitIdx], OutAggregateCollisions[SplitIdx]);
+	};
+	CacheFits(ParallelFits);
+	CacheFits(GameThreadFits);
+}
+
+void
+FHoudiniMeshTranslator::EmptyCollisionFitCache()
+{
+	FHoudiniCollisionFitCache::Empty();
+}
+
+int32
+FHoudiniMeshTranslator::GetCollisionFitCacheNum()
+{
+	return FHoudiniCollisionFitCache::Num();
 }
 
 int32
@@ -7225,17 +7473,26 @@ FKAggregateGeom FHoudiniMeshTranslator::BuildAggregateCollision(FHoudiniSplitGro
 {
 	FKAggregateGeom AggregateCollisions;
 
-	UpdatePartPositionIfNeeded();
-
+	// Fit all the simple collision splits together
+	TArray<FString> SimpleCollisionSplits;
+	SimpleCollisionSplits.Reserve(Mesh.SimpleCollisions.Num());
 	for(int Index : Mesh.SimpleCollisions)
+		SimpleCollisionSplits.Add(Mesh.SplitMeshData[Index].SplitGroupName);
+
+	TArray<FKAggregateGeom> FittedCollisions;
+	FitSplitSimpleCollisions(SimpleCollisionSplits, FittedCollisions);
+
+	// Add the simple colliders to the aggregate, in split order
+	for (const FKAggregateGeom& Fitted : FittedCollisions)
 	{
-		const FHoudiniGroupedMeshPrimitives& SplitMesh = Mesh.SplitMeshData[Index];
-		// Create the simple colliders and add them to the aggregate
-		if (!AddSimpleCollisionToAggregate(SplitMesh.SplitGroupName, AggregateCollisions))
+		if (Fitted.GetElementCount() <= 0)
 		{
 			// Failed to generate a convex collider
 			HOUDINI_LOG_WARNING(TEXT("failed to create simple collider."));
+			continue;
 		}
+
+		AppendAggregateCollisions(Fitted, AggregateCollisions);
 	}
 
 	return AggregateCollisions;
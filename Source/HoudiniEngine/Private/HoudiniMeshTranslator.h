@@ -384,6 +384,23 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		bool AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
 		// Create simple colliders for a split and add to the aggregate
 		bool AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
+		// Gather the unique positions used by a split, in the order they are first referenced
+		void GetSplitUniquePositions(const FString& SplitGroupName, TArray<FVector>& OutPositions) const;
+		// Fit the simple colliders of the given splits, one aggregate per split (see FitSimpleCollisions)
+		void FitSplitSimpleCollisions(const TArray<FString>& InSplitGroupNames, TArray<FKAggregateGeom>& OutAggregateCollisions);
+
+		// Returns the simple collider type requested by a split's name (Box, Sphere, Capsule or one of the KDops)
+		static EHoudiniCollisionType GetSimpleCollisionTypeFromSplitName(const FString& SplitGroupName);
+		// Fit a simple collider of the given type to the positions and add it to the aggregate.
+		// KDops use a temporary UModel and must be fitted on the game thread, the other types are thread safe.
+		static int32 FitSimpleCollision(EHoudiniCollisionType InCollisionType, const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
+		// Fit the simple colliders of multiple splits, one aggregate per split, in parallel when possible.
+		// Fits are cached on the split's positions so unchanged collision geometry is not refitted on recook.
+		static void FitSimpleCollisions(const TArray<EHoudiniCollisionType>& InCollisionTypes, const TArray<TArray<FVector>>& InPositionArrays, TArray<FKAggregateGeom>& OutAggregateCollisions);
+		// Empties the fitted collider cache, done when the session restarts or an asset is instantiated
+		static void EmptyCollisionFitCache();
+		// Number of fits currently held by the fitted collider cache
+		static int32 GetCollisionFitCacheNum();
 		
 		// Helper functions to generate the simple colliders and add them to the aggregate
 		static int32 GenerateBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
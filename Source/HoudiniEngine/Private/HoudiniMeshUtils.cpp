@@ -30,6 +30,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "ComponentReregisterContext.h"
 #include "Components/PrimitiveComponent.h"
+#include "Components/SplineMeshComponent.h"
 #include "ContentBrowserModule.h"
 // #include "IContentBrowserSingleton.h"
 #include "Editor.h"
@@ -38,6 +39,8 @@
 #include "IMeshMergeUtilities.h"
 #include "MeshMergeModule.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 	#include "MeshMergeHelpers.h"
@@ -50,8 +53,39 @@
 #endif
 
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniHashUtils.h"
 #include "HoudiniPackageParams.h"
 
+namespace
+{
+	// Finds the components using the static meshes of InPackage, which are about to be replaced by a merge.
+	// Returns false if the package has assets other than static meshes, whose users we cannot find.
+	bool FindComponentsUsingPackageMeshes(UPackage* InPackage, TArray<UActorComponent*>& OutComponents)
+	{
+		TSet<const UStaticMesh*> Meshes;
+		bool bOnlyMeshes = true;
+		ForEachObjectWithPackage(InPackage, [&Meshes, &bOnlyMeshes](UObject* InObject)
+		{
+			if (const UStaticMesh* Mesh = Cast<UStaticMesh>(InObject))
+				Meshes.Add(Mesh);
+			else if (InObject->IsAsset())
+				bOnlyMeshes = false;
+			return bOnlyMeshes;
+		}, false);
+
+		if (!bOnlyMeshes)
+			return false;
+
+		for (TObjectIterator<UStaticMeshComponent> It; It; ++It)
+		{
+			if (IsValid(*It) && It->IsRegistered() && Meshes.Contains(It->GetStaticMesh()))
+				OutComponents.Add(*It);
+		}
+
+		return true;
+	}
+}
+
 
 bool FHoudiniMeshUtils::MergeMeshes(
 	const TArray<UPrimitiveComponent*>& InMeshComponents,
@@ -97,8 +131,16 @@ bool FHoudiniMeshUtils::MergeMeshes(
 	const FString PackageName = FPaths::Combine(InPackageParams.GetPackagePath(), InPackageParams.GetPackageName());
 	
 	// If the merge destination package already exists, it is possible that the mesh is already used in a scene somewhere, or its materials or even just its textures.
-	// Static primitives uniform buffers could become invalid after the operation completes and lead to memory corruption. To avoid it, we force a global reregister.
-	if (FindObject<UObject>(nullptr, *PackageName))
+	// Static primitives uniform buffers could become invalid after the operation completes and lead to memory corruption. To avoid it, we reregister
+	// the components using the mesh. Merged materials and textures can be used by anything, so we then force a global reregister.
+	TArray<UActorComponent*> ComponentsToReregister;
+	UPackage* const ExistingPackage = FindObject<UPackage>(nullptr, *PackageName);
+	if (ExistingPackage && !InSettings.bMergeMaterials && FindComponentsUsingPackageMeshes(ExistingPackage, ComponentsToReregister))
+	{
+		FMultiComponentReregisterContext Reregister(ComponentsToReregister);
+		MeshUtilities.MergeComponentsToStaticMesh(MeshComponents, World, InSettings, nullptr, nullptr, PackageName, AssetsToSync, OutMergedLocation, ScreenAreaSize, true);
+	}
+	else if (ExistingPackage)
 	{
 		FGlobalComponentReregisterContext GlobalReregister;
 		MeshUtilities.MergeComponentsToStaticMesh(MeshComponents, World, InSettings, nullptr, nullptr, PackageName, AssetsToSync, OutMergedLocation, ScreenAreaSize, true);
@@ -134,6 +176,68 @@ bool FHoudiniMeshUtils::MergeMeshes(
 	return true;
 }
 
+uint64
+FHoudiniMeshUtils::GetMergeMeshesHash(const TArray<UPrimitiveComponent*>& InMeshComponents)
+{
+	uint64 Hash = InMeshComponents.Num();
+	for (const UPrimitiveComponent* Component : InMeshComponents)
+	{
+		if (!IsValid(Component))
+		{
+			const uint8 InvalidComponent = 0;
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &InvalidComponent, sizeof(InvalidComponent));
+			continue;
+		}
+
+		// Meshes and materials are the merge's inputs, their address is enough for an in-memory cache. The mesh's
+		// lighting guid changes when it is edited.
+		const UClass* Class = Component->GetClass();
+		const FMatrix Transform = Component->GetComponentTransform().ToMatrixWithScale();
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &Class, sizeof(Class));
+		Hash = FHoudiniHashUtils::HashBytes(Hash, &Transform.M[0][0], sizeof(Transform.M));
+
+		for (int32 MaterialIdx = 0; MaterialIdx < Component->GetNumMaterials(); ++MaterialIdx)
+		{
+			const UMaterialInterface* Material = Component->GetMaterial(MaterialIdx);
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Material, sizeof(Material));
+		}
+
+		if (const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Component))
+		{
+			const UStaticMesh* Mesh = MeshComponent->GetStaticMesh();
+			const FGuid LightingGuid = IsValid(Mesh) ? Mesh->GetLightingGuid() : FGuid();
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Mesh, sizeof(Mesh));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &LightingGuid, sizeof(LightingGuid));
+		}
+
+		if (const USplineMeshComponent* SplineMeshComponent = Cast<USplineMeshComponent>(Component))
+		{
+			const FSplineMeshParams& Params = SplineMeshComponent->SplineParams;
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.StartPos, sizeof(Params.StartPos));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.StartTangent, sizeof(Params.StartTangent));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.StartScale, sizeof(Params.StartScale));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.StartRoll, sizeof(Params.StartRoll));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.StartOffset, sizeof(Params.StartOffset));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.EndPos, sizeof(Params.EndPos));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.EndTangent, sizeof(Params.EndTangent));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.EndScale, sizeof(Params.EndScale));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.EndRoll, sizeof(Params.EndRoll));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &Params.EndOffset, sizeof(Params.EndOffset));
+
+			const uint8 ForwardAxis = SplineMeshComponent->ForwardAxis;
+			const bool bSmoothInterpRollScale = SplineMeshComponent->bSmoothInterpRollScale;
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &ForwardAxis, sizeof(ForwardAxis));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &bSmoothInterpRollScale, sizeof(bSmoothInterpRollScale));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &SplineMeshComponent->SplineUpDir, sizeof(SplineMeshComponent->SplineUpDir));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &SplineMeshComponent->SplineBoundaryMin, sizeof(SplineMeshComponent->SplineBoundaryMin));
+			Hash = FHoudiniHashUtils::HashBytes(Hash, &SplineMeshComponent->SplineBoundaryMax, sizeof(SplineMeshComponent->SplineBoundaryMax));
+		}
+	}
+
+	// 0 means unknown to the callers caching the merge
+	return Hash != 0 ? Hash : 1;
+}
+
 bool
 FHoudiniMeshUtils::RetrieveMesh(
 	const UStaticMeshComponent* InStaticMeshComponent,
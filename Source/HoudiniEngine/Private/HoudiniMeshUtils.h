@@ -61,6 +61,14 @@ public:
 		FVector& OutMergedLocation,
 		TArray<UObject*>* OutAssets=nullptr);
 
+	/**
+	 * @brief Hashes what MergeMeshes reads from InMeshComponents: their meshes, materials, transforms and, for spline
+	 * mesh components, their spline params. The merged mesh can be reused while the hash is unchanged.
+	 * @param InMeshComponents The primitive components that would be merged.
+	 * @return The hash of the components, never 0.
+	 */
+	static uint64 GetMergeMeshesHash(const TArray<UPrimitiveComponent*>& InMeshComponents);
+
 	static bool RetrieveMesh(
 		const UStaticMeshComponent* InStaticMeshComponent,
 		int32 InLODIndex,
@@ -33,6 +33,7 @@
 #include "HoudiniEngine.h"
 
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineAttributes.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniEnginePrivatePCH.h"
@@ -1586,6 +1587,9 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				if (CurrentPartInfo.Type == EHoudiniPartType::Invalid)
 					continue;
 
+				// Fetch the names of all the part's attributes once, so the classification and attribute
+				// lookups below don't need a HAPI call for every attribute the part doesn't have.
+				FHoudiniScopedPartAttributeManifest PartAttributeManifest(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentHapiPartInfo);
 
 				// Retrieve part name.
 				FString CurrentPartName = CurrentPartInfo.Name;
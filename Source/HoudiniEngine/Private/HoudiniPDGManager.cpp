@@ -593,6 +593,9 @@ FHoudiniPDGManager::CookTOPNode(UTOPNode* InTOPNode)
 		return false;
 	}
 
+	// String handles fetched before the cook might not be valid after it
+	FHoudiniEngineString::InvalidateStringCache();
+
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::CookPDG(
 		FHoudiniEngine::Get().GetSession(), InTOPNode->NodeId, 0, 0))
 	{
@@ -666,6 +669,9 @@ FHoudiniPDGManager::CookOutput(UTOPNetwork* InTOPNet)
 		return false;
 	}
 
+	// String handles fetched before the cook might not be valid after it
+	FHoudiniEngineString::InvalidateStringCache();
+
 	// TODO: ???
 	// Cancel all cooks. This is required as otherwise the graph gets into an infinite cook state (bug?)
 	if(HAPI_RESULT_SUCCESS != FHoudiniApi::CookPDGAllOutputs(
@@ -822,6 +828,9 @@ FHoudiniPDGManager::UpdatePDGContexts()
 
 			if (PDGEventCount < 1)
 				continue;
+
+			// PDG cooks work items in the background, string handles fetched before these events might not be valid anymore
+			FHoudiniEngineString::InvalidateStringCache();
 			
 			for (int32 EventIdx = 0; EventIdx < PDGEventCount; EventIdx++)
 			{
@@ -44,11 +44,181 @@
 	#include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionObject.h"
 #endif
 #include "HoudiniDataLayerUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
 
 #if HOUDINI_ENABLE_DATA_LAYERS
 #include "WorldPartition/DataLayer/DataLayerAsset.h"
 #endif
 
+namespace
+{
+	// Names of the packages existing in the folders CreatePackageForObject creates new assets in.
+	// Folders are read from the asset registry when first used, then kept up to date with the packages we create
+	// and the registry's events, so that finding a free package name does not require loading packages from disk.
+	class FHoudiniPackageNameIndex
+	{
+	public:
+		// Returns false if the index can't be used yet (the asset registry is still discovering assets)
+		static bool IsReady()
+		{
+			return bEnabled && !GetAssetRegistry().IsLoadingAssets();
+		}
+
+		static bool IsPackageNameTaken(const FString& InPackageName)
+		{
+			{
+				const FName PackageName(*InPackageName);
+				FScopeLock ScopeLock(&Lock);
+				if (FindOrAddFolder(FPackageName::GetLongPackagePath(InPackageName)).PackageNames.Contains(PackageName))
+					return true;
+			}
+
+			// Packages created by others but not registered yet are only in memory
+			if (FindPackage(nullptr, *InPackageName) != nullptr)
+				return true;
+
+			// Packages written to disk by others (source control syncs, external tools) might not be in the
+			// registry yet: checking the file is cheap compared to loading the package
+			if (FPackageName::DoesPackageExist(InPackageName))
+			{
+				Reserve(InPackageName);
+				return true;
+			}
+
+			return false;
+		}
+
+		static void Reserve(const FString& InPackageName)
+		{
+			FScopeLock ScopeLock(&Lock);
+			FindOrAddFolder(FPackageName::GetLongPackagePath(InPackageName)).PackageNames.Add(FName(*InPackageName));
+		}
+
+		// Returns the bake counter to start looking for a free name from, skipping the counters known to be taken
+		static int32 GetFirstCounterToProbe(const FString& InBasePackageName, int32 InCounterStart)
+		{
+			FScopeLock ScopeLock(&Lock);
+			const FFolder& Folder = FindOrAddFolder(FPackageName::GetLongPackagePath(InBasePackageName));
+			if (const FCounterRange* Taken = Folder.TakenCounters.Find(FName(*InBasePackageName)))
+			{
+				if (Taken->Start <= InCounterStart && InCounterStart < Taken->End)
+					return Taken->End;
+			}
+			return InCounterStart;
+		}
+
+		// Records that all the bake counters in [InCounterStart, InCounterEnd) are taken
+		static void SetCountersTaken(const FString& InBasePackageName, int32 InCounterStart, int32 InCounterEnd)
+		{
+			FScopeLock ScopeLock(&Lock);
+			FFolder& Folder = FindOrAddFolder(FPackageName::GetLongPackagePath(InBasePackageName));
+			FCounterRange& Taken = Folder.TakenCounters.FindOrAdd(FName(*InBasePackageName), FCounterRange{ InCounterStart, InCounterStart });
+			// Extend the known range if the new one continues it
+			if (InCounterStart < Taken.Start || InCounterStart > Taken.End)
+				Taken.Start = InCounterStart;
+			Taken.End = InCounterEnd;
+		}
+
+		static void Empty()
+		{
+			FScopeLock ScopeLock(&Lock);
+			Folders.Empty();
+		}
+
+		static bool bEnabled;
+
+	private:
+		struct FCounterRange
+		{
+			int32 Start;
+			int32 End;
+		};
+
+		struct FFolder
+		{
+			TSet<FName> PackageNames;
+			// Per base package name, a range of bake counters known to be taken
+			TMap<FName, FCounterRange> TakenCounters;
+		};
+
+		static IAssetRegistry& GetAssetRegistry()
+		{
+			return FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		}
+
+		static FFolder& FindOrAddFolder(const FString& InFolder)
+		{
+			const FName FolderName(*InFolder);
+			if (FFolder* Found = Folders.Find(FolderName))
+				return *Found;
+
+			TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPackageNameIndex::FindOrAddFolder);
+
+			BindAssetRegistryEvents();
+
+			FFolder& Folder = Folders.Add(FolderName);
+			TArray<FAssetData> Assets;
+			GetAssetRegistry().GetAssetsByPath(FolderName, Assets, false, false);
+			Folder.PackageNames.Reserve(Assets.Num());
+			for (const FAssetData& Asset : Assets)
+				Folder.PackageNames.Add(Asset.PackageName);
+
+			return Folder;
+		}
+
+		static void BindAssetRegistryEvents()
+		{
+			if (bEventsBound)
+				return;
+
+			IAssetRegistry& AssetRegistry = GetAssetRegistry();
+			AssetRegistry.OnAssetAdded().AddStatic(&FHoudiniPackageNameIndex::OnAssetAdded);
+			AssetRegistry.OnAssetRemoved().AddStatic(&FHoudiniPackageNameIndex::OnAssetRemoved);
+			AssetRegistry.OnAssetRenamed().AddStatic(&FHoudiniPackageNameIndex::OnAssetRenamed);
+			bEventsBound = true;
+		}
+
+		static void OnAssetAdded(const FAssetData& InAsset)
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (FFolder* Folder = Folders.Find(InAsset.PackagePath))
+				Folder->PackageNames.Add(InAsset.PackageName);
+		}
+
+		static void OnAssetRemoved(const FAssetData& InAsset)
+		{
+			RemovePackageName(InAsset.PackagePath, InAsset.PackageName);
+		}
+
+		static void OnAssetRenamed(const FAssetData& InAsset, const FString& InOldObjectPath)
+		{
+			const FString OldPackageName = FPackageName::ObjectPathToPackageName(InOldObjectPath);
+			RemovePackageName(FName(*FPackageName::GetLongPackagePath(OldPackageName)), FName(*OldPackageName));
+			OnAssetAdded(InAsset);
+		}
+
+		static void RemovePackageName(const FName& InFolder, const FName& InPackageName)
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (FFolder* Folder = Folders.Find(InFolder))
+			{
+				Folder->PackageNames.Remove(InPackageName);
+				// A freed counter must be found again
+				Folder->TakenCounters.Empty();
+			}
+		}
+
+		static FCriticalSection Lock;
+		static TMap<FName, FFolder> Folders;
+		static bool bEventsBound;
+	};
+
+	FCriticalSection FHoudiniPackageNameIndex::Lock;
+	TMap<FName, FHoudiniPackageNameIndex::FFolder> FHoudiniPackageNameIndex::Folders;
+	bool FHoudiniPackageNameIndex::bEventsBound = false;
+	bool FHoudiniPackageNameIndex::bEnabled = true;
+}
+
 //
 FHoudiniPackageParams::FHoudiniPackageParams()
 {
@@ -301,6 +471,14 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 	// Get the appropriate package path/name for this object
 	FString PackageName = GetPackageName();
 	FString PackagePath = GetPackagePath();
+
+	// When creating new assets, look for a free name in the index rather than loading packages
+	const bool bUseNameIndex = ReplaceMode == EPackageReplaceMode::CreateNewAssets && !OverideEnabled && FHoudiniPackageNameIndex::IsReady();
+	const bool bUseCounterIndex = bUseNameIndex && PackageMode == EPackageMode::Bake;
+	const FString BasePackageName = bUseCounterIndex ? UPackageTools::SanitizePackageName(PackagePath + TEXT("/") + PackageName) : FString();
+	if (bUseCounterIndex)
+		BakeCounter = FHoudiniPackageNameIndex::GetFirstCounterToProbe(BasePackageName, BakeCounter);
+	const int32 FirstProbedBakeCounter = BakeCounter;
 	   
 	// Iterate until we find a suitable name for the package
 	UPackage * NewPackage = nullptr;
@@ -329,7 +507,25 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		FinalPackageName = UPackageTools::SanitizePackageName(FinalPackageName);
 
 		// If we are set to create new assets, check if a package named similarly already exists
-		if (ReplaceMode == EPackageReplaceMode::CreateNewAssets)
+		if (bUseNameIndex)
+		{
+			if (FHoudiniPackageNameIndex::IsPackageNameTaken(FinalPackageName))
+			{
+				// we need to generate a new name for it
+				CurrentGuid = FGuid::NewGuid();
+				BakeCounter++;
+				continue;
+			}
+
+			FHoudiniPackageNameIndex::Reserve(FinalPackageName);
+			if (bUseCounterIndex)
+			{
+				// Counters before FirstProbedBakeCounter were skipped as taken, so the first one tried might be lower
+				const int32 TakenStart = FMath::Min(InBakeCounterStart, FirstProbedBakeCounter);
+				FHoudiniPackageNameIndex::SetCountersTaken(BasePackageName, TakenStart, BakeCounter + 1);
+			}
+		}
+		else if (ReplaceMode == EPackageReplaceMode::CreateNewAssets)
 		{
 			UPackage* FoundPackage = FindPackage(nullptr, *FinalPackageName);
 			if (FoundPackage == nullptr)
@@ -401,6 +597,25 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 	return NewPackage;
 }
 
+void
+FHoudiniPackageParams::SetPackageNameIndexEnabled(bool bInEnabled)
+{
+	FHoudiniPackageNameIndex::bEnabled = bInEnabled;
+	FHoudiniPackageNameIndex::Empty();
+}
+
+bool
+FHoudiniPackageParams::IsPackageNameIndexEnabled()
+{
+	return FHoudiniPackageNameIndex::bEnabled;
+}
+
+void
+FHoudiniPackageParams::InvalidatePackageNameIndex()
+{
+	FHoudiniPackageNameIndex::Empty();
+}
+
 UObject* FHoudiniPackageParams::CreateObjectAndPackageFromClass(UClass* Class, UObject* TemplateObject) const
 {
 	// Create the package for the object
@@ -99,6 +99,13 @@ public:
 	// Helper function to create a Package for a given object
 	UPackage* CreatePackageForObject(FString& OutPackageName, int32 InBakeCounterStart=0) const;
 
+	// Enables/disables the index of existing package names used by CreatePackageForObject in CreateNewAssets mode
+	// to find a free name without loading packages from disk. Disabling it also empties it.
+	static void SetPackageNameIndexEnabled(bool bInEnabled);
+	static bool IsPackageNameIndexEnabled();
+	// Forgets the indexed folders, they are read again from the asset registry on their next use
+	static void InvalidatePackageNameIndex();
+
 	// Helper function to create an object and its package
 
 	UObject* CreateObjectAndPackageFromClass(UClass* Class, UObject* TemplateObject = nullptr) const;
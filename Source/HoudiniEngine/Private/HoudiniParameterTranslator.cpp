@@ -249,7 +249,7 @@ FHoudiniParameterTranslator::BuildAllParameters(
 
 	int32 ParmCount = 0;
 
-	// Default value counts and arrays for if we need to fetch those from Houdini.
+	// Value counts and arrays, fetched in bulk either from the node, or from the asset definition's defaults.
 	int DefaultIntValueCount = 0;
 	int DefaultFloatValueCount = 0;
 	int DefaultStringValueCount = 0;
@@ -262,6 +262,7 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	HAPI_NodeId NodeId = -1;
 	HAPI_AssetLibraryId AssetLibraryId = -1;
 	FString HoudiniAssetName;
+	bool bHasPrefetchedValues = false;
 	
 	if (AssetId >= 0)
 	{
@@ -286,6 +287,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &NodeInfo), false);
 
 		ParmCount = NodeInfo.parmCount;
+
+		// Fetch all the values and choice lists of the node at once, instead of once per parameter
+		if (ParmCount > 0)
+			bHasPrefetchedValues = FetchAllParameterValues(NodeId, NodeInfo, DefaultIntValues, DefaultFloatValues, DefaultStringValues, DefaultChoiceValues);
 	}
 	else
 	{
@@ -368,6 +373,8 @@ FHoudiniParameterTranslator::BuildAllParameters(
 				HOUDINI_LOG_ERROR(TEXT("Hapi failed: %s"), *FHoudiniEngineUtils::GetErrorDescription());
 				return false;
 			}
+
+			bHasPrefetchedValues = true;
 		}
 	}
 
@@ -541,10 +548,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			// Do a fast update of this parameter
 			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					HoudiniAssetParameter, NodeId, ParmInfo, InForceFullUpdate, bUpdateValues, 
-					AssetId >= 0 ? nullptr : &DefaultIntValues,
-					AssetId >= 0 ? nullptr : &DefaultFloatValues,
-					AssetId >= 0 ? nullptr : &DefaultStringValues,
-					AssetId >= 0 ? nullptr : &DefaultChoiceValues))
+					bHasPrefetchedValues ? &DefaultIntValues : nullptr,
+					bHasPrefetchedValues ? &DefaultFloatValues : nullptr,
+					bHasPrefetchedValues ? &DefaultStringValues : nullptr,
+					bHasPrefetchedValues ? &DefaultChoiceValues : nullptr))
 				continue;
 
 			// Reset the states of ramp parameters.
@@ -590,10 +597,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			// Fully update this parameter
 			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					HoudiniAssetParameter, NodeId, ParmInfo, true, true,
-					AssetId >= 0 ? nullptr : &DefaultIntValues,
-					AssetId >= 0 ? nullptr : &DefaultFloatValues,
-					AssetId >= 0 ? nullptr : &DefaultStringValues,
-					AssetId >= 0 ? nullptr : &DefaultChoiceValues))
+					bHasPrefetchedValues ? &DefaultIntValues : nullptr,
+					bHasPrefetchedValues ? &DefaultFloatValues : nullptr,
+					bHasPrefetchedValues ? &DefaultStringValues : nullptr,
+					bHasPrefetchedValues ? &DefaultChoiceValues : nullptr))
 				continue;
 
 			// Record float and color ramps for further processing (creating their Points arrays)
@@ -1311,6 +1318,53 @@ FHoudiniParameterTranslator::CreateTypedParameter(UObject * Outer, const EHoudin
 	return HoudiniParameter;
 }
 
+bool
+FHoudiniParameterTranslator::FetchAllParameterValues(
+	const HAPI_NodeId& InNodeId,
+	const HAPI_NodeInfo& InNodeInfo,
+	TArray<int>& OutIntValues,
+	TArray<float>& OutFloatValues,
+	TArray<HAPI_StringHandle>& OutStringValues,
+	TArray<HAPI_ParmChoiceInfo>& OutChoiceValues)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniParameterTranslator::FetchAllParameterValues);
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	OutIntValues.SetNumZeroed(FMath::Max(InNodeInfo.parmIntValueCount, 0));
+	if (OutIntValues.Num() > 0 && FHoudiniApi::GetParmIntValues(
+		Session, InNodeId, OutIntValues.GetData(), 0, OutIntValues.Num()) != HAPI_RESULT_SUCCESS)
+	{
+		return false;
+	}
+
+	OutFloatValues.SetNumZeroed(FMath::Max(InNodeInfo.parmFloatValueCount, 0));
+	if (OutFloatValues.Num() > 0 && FHoudiniApi::GetParmFloatValues(
+		Session, InNodeId, OutFloatValues.GetData(), 0, OutFloatValues.Num()) != HAPI_RESULT_SUCCESS)
+	{
+		return false;
+	}
+
+	OutStringValues.SetNumZeroed(FMath::Max(InNodeInfo.parmStringValueCount, 0));
+	if (OutStringValues.Num() > 0 && FHoudiniApi::GetParmStringValues(
+		Session, InNodeId, false, OutStringValues.GetData(), 0, OutStringValues.Num()) != HAPI_RESULT_SUCCESS)
+	{
+		return false;
+	}
+
+	OutChoiceValues.SetNumUninitialized(FMath::Max(InNodeInfo.parmChoiceCount, 0));
+	for (HAPI_ParmChoiceInfo& ChoiceInfo : OutChoiceValues)
+		FHoudiniApi::ParmChoiceInfo_Init(&ChoiceInfo);
+
+	if (OutChoiceValues.Num() > 0 && FHoudiniApi::GetParmChoiceLists(
+		Session, InNodeId, OutChoiceValues.GetData(), 0, OutChoiceValues.Num()) != HAPI_RESULT_SUCCESS)
+	{
+		return false;
+	}
+
+	return true;
+}
+
 bool
 FHoudiniParameterTranslator::UpdateParameterFromInfo(
 	UHoudiniParameter * HoudiniParameter, const HAPI_NodeId& InNodeId, const HAPI_ParmInfo& ParmInfo,
@@ -1329,6 +1383,13 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 	const bool bHasValidNodeId = InNodeId >= 0;
 	if (bHasValidNodeId)
 		HoudiniParameter->SetNodeId(InNodeId);
+
+	// Only fetch values from HAPI if they haven't been prefetched for the whole node
+	const bool bFetchIntValues = bHasValidNodeId && !DefaultIntValues;
+	const bool bFetchFloatValues = bHasValidNodeId && !DefaultFloatValues;
+	const bool bFetchStringValues = bHasValidNodeId && !DefaultStringValues;
+	const bool bFetchChoiceLists = bHasValidNodeId && !DefaultChoiceValues;
+
 	HoudiniParameter->SetParmId(ParmInfo.id);
 	HoudiniParameter->SetParentParmId(ParmInfo.parentId);
 
@@ -1496,7 +1557,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				// Stop if we don't want to update the value
 				if (bUpdateValue)
 				{
-					if (bHasValidNodeId)
+					if (bFetchIntValues)
 					{
 						if (FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -1527,7 +1588,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
 					FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
 
-				if (bHasValidNodeId)
+				if (bFetchChoiceLists)
 				{
 					HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmChoiceLists(
 						FHoudiniEngine::Get().GetSession(),
@@ -1577,7 +1638,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual value for this property.
 					FLinearColor Color = FLinearColor::White;
-					if (bHasValidNodeId)
+					if (bFetchFloatValues)
 					{
 						if (FHoudiniApi::GetParmFloatValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -1677,7 +1738,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					TArray< HAPI_StringHandle > StringHandles;
 
-					if (bHasValidNodeId)
+					if (bFetchStringValues)
 					{
 						StringHandles.SetNumZeroed(ParmInfo.size);
 						if (FHoudiniApi::GetParmStringValues(
@@ -1736,7 +1797,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Update the parameter's value
 					HoudiniParameterFloat->SetNumberOfValues(ParmInfo.size);
 
-					if (bHasValidNodeId)
+					if (bFetchFloatValues)
 					{
 						if (FHoudiniApi::GetParmFloatValues(
 								FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -1942,7 +2003,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					HoudiniParameterInt->SetNumberOfValues(ParmInfo.size);
 
-					if (bHasValidNodeId)
+					if (bFetchIntValues)
 					{
 						if (FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -2063,7 +2124,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					int32 CurrentIntValue = 0;
 
-					if (bHasValidNodeId)
+					if (bFetchIntValues)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(),
@@ -2106,7 +2167,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
 						FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
 
-					if (bHasValidNodeId)
+					if (bFetchChoiceLists)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmChoiceLists(
 							FHoudiniEngine::Get().GetSession(), 
@@ -2192,7 +2253,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					HAPI_StringHandle StringHandle;
 
-					if (bHasValidNodeId)
+					if (bFetchStringValues)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmStringValues(
 							FHoudiniEngine::Get().GetSession(),
@@ -2228,7 +2289,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
 						FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
 
-					if (bHasValidNodeId)
+					if (bFetchChoiceLists)
 					{
 						HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmChoiceLists(
 							FHoudiniEngine::Get().GetSession(),
@@ -2305,7 +2366,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				// Get the actual value for this property.
 				TArray<HAPI_StringHandle> StringHandles;
 
-				if (bHasValidNodeId)
+				if (bFetchStringValues)
 				{
 					StringHandles.SetNumZeroed(ParmInfo.size);
 					FHoudiniApi::GetParmStringValues(
@@ -2356,7 +2417,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				// Set the multiparm value
 				int32 MultiParmValue = 0;
 
-				if (bHasValidNodeId)
+				if (bFetchIntValues)
 				{
 					HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
 						FHoudiniEngine::Get().GetSession(),
@@ -2420,7 +2481,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual value for this property.
 					TArray< HAPI_StringHandle > StringHandles;
 
-					if (bHasValidNodeId)
+					if (bFetchStringValues)
 					{
 						StringHandles.SetNumZeroed(ParmInfo.size);
 						if (FHoudiniApi::GetParmStringValues(
@@ -2489,7 +2550,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Get the actual values for this property.
 					HoudiniParameterToggle->SetNumberOfValues(ParmInfo.size);
 
-					if (bHasValidNodeId)
+					if (bFetchIntValues)
 					{
 						if (FHoudiniApi::GetParmIntValues(
 							FHoudiniEngine::Get().GetSession(), InNodeId,
@@ -2608,14 +2669,141 @@ FHoudiniParameterTranslator::HapiGetParameterHasTag(const HAPI_NodeId& NodeId, c
 }
 
 
+// Accumulates the values of changed parameters so that parameters with contiguous
+// value indices on the same node are uploaded with a single HAPI call.
+template<typename ValueType>
+struct FHoudiniParameterValueUploadBatch
+{
+	struct FEntry
+	{
+		UHoudiniParameter* Parameter;
+		HAPI_NodeId NodeId;
+		int32 ValueIndex;
+		int32 Count;
+		int32 Offset;
+	};
+
+	void Add(UHoudiniParameter* InParameter, const ValueType* InValues, const int32 InCount)
+	{
+		Entries.Add({ InParameter, InParameter->GetNodeId(), InParameter->GetValueIndex(), InCount, Values.Num() });
+		Values.Append(InValues, InCount);
+	}
+
+	bool IsEmpty() const { return Entries.Num() == 0; }
+
+	// Uploads the accumulated values with one call to SetValuesFunc per contiguous run of value indices
+	template<typename SetValuesFuncType>
+	void Flush(SetValuesFuncType SetValuesFunc, TArray<UHoudiniParameter*>& OutUploaded, TArray<UHoudiniParameter*>& OutFailed)
+	{
+		Entries.Sort([](const FEntry& A, const FEntry& B)
+		{
+			return A.NodeId != B.NodeId ? A.NodeId < B.NodeId : A.ValueIndex < B.ValueIndex;
+		});
+
+		TArray<ValueType> RunValues;
+		int32 RunStart = 0;
+		while (RunStart < Entries.Num())
+		{
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < Entries.Num()
+				&& Entries[RunEnd].NodeId == Entries[RunStart].NodeId
+				&& Entries[RunEnd].ValueIndex == Entries[RunEnd - 1].ValueIndex + Entries[RunEnd - 1].Count)
+			{
+				RunEnd++;
+			}
+
+			RunValues.Reset();
+			for (int32 Idx = RunStart; Idx < RunEnd; Idx++)
+				RunValues.Append(Values.GetData() + Entries[Idx].Offset, Entries[Idx].Count);
+
+			const bool bSuccess = SetValuesFunc(Entries[RunStart].NodeId, RunValues.GetData(), Entries[RunStart].ValueIndex, RunValues.Num());
+			for (int32 Idx = RunStart; Idx < RunEnd; Idx++)
+				(bSuccess ? OutUploaded : OutFailed).Add(Entries[Idx].Parameter);
+
+			RunStart = RunEnd;
+		}
+
+		Entries.Reset();
+		Values.Reset();
+	}
+
+	TArray<FEntry> Entries;
+	TArray<ValueType> Values;
+};
+
+// Adds the values of a float, color, int or toggle parameter to the upload batches.
+// Returns false if the parameter can't be batched and needs to be uploaded on its own.
+static bool
+AddParameterToUploadBatch(
+	UHoudiniParameter* InParam,
+	FHoudiniParameterValueUploadBatch<float>& FloatBatch,
+	FHoudiniParameterValueUploadBatch<int32>& IntBatch)
+{
+	if (!IsValid(InParam) || InParam->GetNodeId() < 0 || InParam->GetValueIndex() < 0)
+		return false;
+
+	switch (InParam->GetParameterType())
+	{
+		case EHoudiniParameterType::Float:
+		{
+			UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(InParam);
+			if (!IsValid(FloatParam) || !FloatParam->GetValuesPtr())
+				return false;
+
+			FloatBatch.Add(FloatParam, FloatParam->GetValuesPtr(), FloatParam->GetTupleSize());
+			return true;
+		}
+
+		case EHoudiniParameterType::Color:
+		{
+			UHoudiniParameterColor* ColorParam = Cast<UHoudiniParameterColor>(InParam);
+			if (!IsValid(ColorParam))
+				return false;
+
+			const FLinearColor Color = ColorParam->GetColorValue();
+			FloatBatch.Add(ColorParam, &Color.R, ColorParam->GetTupleSize() == 4 ? 4 : 3);
+			return true;
+		}
+
+		case EHoudiniParameterType::Int:
+		{
+			UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(InParam);
+			if (!IsValid(IntParam) || !IntParam->GetValuesPtr())
+				return false;
+
+			IntBatch.Add(IntParam, IntParam->GetValuesPtr(), IntParam->GetTupleSize());
+			return true;
+		}
+
+		case EHoudiniParameterType::Toggle:
+		{
+			UHoudiniParameterToggle* ToggleParam = Cast<UHoudiniParameterToggle>(InParam);
+			if (!IsValid(ToggleParam) || !ToggleParam->GetValuesPtr())
+				return false;
+
+			IntBatch.Add(ToggleParam, ToggleParam->GetValuesPtr(), ToggleParam->GetTupleSize());
+			return true;
+		}
+
+		default:
+			return false;
+	}
+}
+
 bool
 FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * HAC )
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniParameterTranslator::UploadChangedParameters);
-
 	if (!IsValid(HAC))
 		return false;
 
+	return UploadChangedParameters(HAC->Parameters, HAC->GetAssetId());
+}
+
+bool
+FHoudiniParameterTranslator::UploadChangedParameters(const TArray<UHoudiniParameter*>& InParameters, const HAPI_NodeId& InAssetId)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniParameterTranslator::UploadChangedParameters);
+
 	TMap<FString, UHoudiniParameter*> RampsToRevert;
 	// First upload all parameters, including the current child parameters/points of ramps, and then process
 	// the ramp parameters themselves (delete and insert operations of ramp points)
@@ -2624,12 +2812,45 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 	// parameter values after the insert.
 	TArray<UHoudiniParameter*> RampsToUpload;
 
-	for (int32 ParmIdx = 0; ParmIdx < HAC->GetNumParameters(); ParmIdx++)
+	// Changed float/int values are coalesced into per-type batches. Batches are flushed before any other
+	// parameter is uploaded, so that the upload order (and the value indices it relies on) is preserved.
+	FHoudiniParameterValueUploadBatch<float> FloatBatch;
+	FHoudiniParameterValueUploadBatch<int32> IntBatch;
+	auto FlushUploadBatches = [&FloatBatch, &IntBatch]()
+	{
+		if (FloatBatch.IsEmpty() && IntBatch.IsEmpty())
+			return;
+
+		const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+		TArray<UHoudiniParameter*> Uploaded;
+		TArray<UHoudiniParameter*> Failed;
+		FloatBatch.Flush([Session](HAPI_NodeId NodeId, const float* Values, int32 Start, int32 Count)
+		{
+			return FHoudiniApi::SetParmFloatValues(Session, NodeId, Values, Start, Count) == HAPI_RESULT_SUCCESS;
+		}, Uploaded, Failed);
+		IntBatch.Flush([Session](HAPI_NodeId NodeId, const int32* Values, int32 Start, int32 Count)
+		{
+			return FHoudiniApi::SetParmIntValues(Session, NodeId, Values, Start, Count) == HAPI_RESULT_SUCCESS;
+		}, Uploaded, Failed);
+
+		for (UHoudiniParameter* Param : Uploaded)
+			Param->MarkChanged(false);
+
+		// Keep these params marked as changed but prevent them from generating updates
+		for (UHoudiniParameter* Param : Failed)
+			Param->SetNeedsToTriggerUpdate(false);
+	};
+
+	for (UHoudiniParameter* CurrentParm : InParameters)
 	{
-		UHoudiniParameter*& CurrentParm = HAC->Parameters[ParmIdx];
 		if (!IsValid(CurrentParm) || !CurrentParm->HasChanged())
 			continue;
 
+		if (!CurrentParm->IsPendingRevertToDefault() && AddParameterToUploadBatch(CurrentParm, FloatBatch, IntBatch))
+			continue;
+
+		FlushUploadBatches();
+
 		bool bSuccess = false;
 
 		const EHoudiniParameterType CurrentParmType = CurrentParm->GetParameterType();
@@ -2669,7 +2890,9 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 		}
 	}
 
-	FHoudiniParameterTranslator::RevertRampParameters(RampsToRevert, HAC->GetAssetId());
+	FlushUploadBatches();
+
+	FHoudiniParameterTranslator::RevertRampParameters(RampsToRevert, InAssetId);
 
 	for (UHoudiniParameter* const RampParam : RampsToUpload)
 	{
@@ -52,6 +52,9 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 	// 
 	static bool UploadChangedParameters(UHoudiniAssetComponent* HAC);
 
+	// Uploads the changed parameters. Int and float values of contiguous parameters are sent in batches.
+	static bool UploadChangedParameters(const TArray<UHoudiniParameter*>& InParameters, const HAPI_NodeId& InAssetId);
+
 	//
 	static bool UploadParameterValue(UHoudiniParameter* InParam);
 
@@ -105,6 +108,8 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 	// and set to true when creating a new parameter
 	// bUpdateValue should be set to false when updating loaded parameters
 	// as the internal parameter's value from HAPI
+	// The optional value arrays hold values prefetched for the whole node (or the asset definition's defaults):
+	// when set, they are used instead of fetching that parameter's values from HAPI.
 	static bool UpdateParameterFromInfo(
 		UHoudiniParameter * HoudiniParameter,
 		const HAPI_NodeId& InNodeId,
@@ -116,6 +121,16 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 		const TArray<HAPI_StringHandle>* DefaultStringValues = nullptr,
 		const TArray<HAPI_ParmChoiceInfo>* DefaultChoiceValues = nullptr);
 
+	// Fetch all the int, float and string values and the choice lists of a node with one HAPI call per type.
+	// The arrays are indexed like the parameters' intValuesIndex, floatValuesIndex, stringValuesIndex and choiceIndex.
+	static bool FetchAllParameterValues(
+		const HAPI_NodeId& InNodeId,
+		const HAPI_NodeInfo& InNodeInfo,
+		TArray<int>& OutIntValues,
+		TArray<float>& OutFloatValues,
+		TArray<HAPI_StringHandle>& OutStringValues,
+		TArray<HAPI_ParmChoiceInfo>& OutChoiceValues);
+
 	static UClass* GetDesiredParameterClass(const HAPI_ParmInfo& ParmInfo);
 
 	static void GetParmTypeFromParmInfo(
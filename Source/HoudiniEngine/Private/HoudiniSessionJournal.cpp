@@ -0,0 +1,726 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniSessionJournal.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniHashUtils.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+#include "HoudiniInputTranslator.h"
+#include "HoudiniNodeSyncComponent.h"
+#include "HoudiniOutput.h"
+#include "HoudiniParameterTranslator.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_EDITOR
+	#include "Brushes/SlateDynamicImageBrush.h"
+	#include "Framework/Notifications/NotificationManager.h"
+	#include "Widgets/Notifications/SNotificationList.h"
+#endif
+
+#define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
+
+namespace
+{
+	// How long to wait for the nodes to be recreated before reinstantiating their HACs instead
+	constexpr double NodeCreationTimeoutSeconds = 30.0;
+
+	// Time spent rehydrating on each tick of the Houdini Engine manager
+	constexpr double RehydrateTickTimeLimitSeconds = 0.1;
+
+	struct FSessionJournalEntry
+	{
+		TWeakObjectPtr<UHoudiniAsset> HoudiniAsset;
+		FString HapiAssetName;
+		// Cook count of the HAC when it was recorded, any cook since invalidates the entry
+		int32 AssetCookCount = 0;
+		// Hash of the HAC's parameter values when it was recorded
+		uint64 ParametersHash = 0;
+		// Binary preset of the asset node's parameters
+		TArray<char> Preset;
+	};
+
+	// Steps of a rehydration, each one runs over as many ticks as needed
+	enum class ERehydrateStep : uint8
+	{
+		None,
+		// Loading the HACs' asset libraries
+		LoadingAssets,
+		// Waiting for the nodes, created without cooking, to be ready
+		CreatingNodes,
+		// Restoring the HACs' parameters on their new nodes, in dependency order
+		RestoringHACs,
+		// Uploading the inputs of all the restored HACs
+		UploadingInputs
+	};
+
+	struct FRehydrateState
+	{
+		ERehydrateStep Step = ERehydrateStep::None;
+		// The HACs being rehydrated, upstream HACs first
+		TArray<TWeakObjectPtr<UHoudiniAssetComponent>> SortedHACs;
+		// The new node of each HAC still being rehydrated (-1 until it is created)
+		TMap<TWeakObjectPtr<UHoudiniAssetComponent>, HAPI_NodeId> NewNodeIds;
+		TArray<TWeakObjectPtr<UHoudiniAsset>> HoudiniAssets;
+		TSet<TWeakObjectPtr<UHoudiniAsset>> FailedHoudiniAssets;
+		// The changed inputs of all the restored HACs, uploaded together once all the HACs are restored
+		TArray<TWeakObjectPtr<UHoudiniInput>> PendingInputs;
+		// Progress in the current step's array
+		int32 NextIndex = 0;
+		double StartTime = 0.0;
+		double NodeCreationStartTime = 0.0;
+		bool bCancelRequested = false;
+#if WITH_EDITOR
+		TWeakPtr<SNotificationItem> NotificationPtr;
+#endif
+	};
+
+	struct FSessionJournalState
+	{
+		TMap<TWeakObjectPtr<UHoudiniAssetComponent>, FSessionJournalEntry> Entries;
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> Rehydrated;
+		FRehydrateState Rehydrate;
+		double LastRehydrateTime = 0.0;
+	};
+
+	FSessionJournalState& GetSessionJournalState()
+	{
+		static FSessionJournalState State;
+		return State;
+	}
+
+	// Returns the HACs the given HAC takes as asset inputs
+	TArray<UHoudiniAssetComponent*> GetUpstreamHACs(UHoudiniAssetComponent* HAC)
+	{
+		TArray<UHoudiniAssetComponent*> UpstreamHACs;
+		for (UHoudiniInput* CurrentInput : HAC->GetInputs())
+		{
+			if (!IsValid(CurrentInput) || !CurrentInput->IsAssetInput())
+				continue;
+
+			const TArray<UHoudiniInputObject*>* ObjectArray = CurrentInput->GetHoudiniInputObjectArray(CurrentInput->GetInputType());
+			if (!ObjectArray)
+				continue;
+
+			for (UHoudiniInputObject* CurrentInputObject : *ObjectArray)
+			{
+				UHoudiniAssetComponent* InputHAC = CurrentInputObject ? Cast<UHoudiniAssetComponent>(CurrentInputObject->GetObject()) : nullptr;
+				if (IsValid(InputHAC))
+					UpstreamHACs.AddUnique(InputHAC);
+			}
+		}
+
+		return UpstreamHACs;
+	}
+
+	// Node sync components fetch existing nodes, PDG asset links and editable outputs own nodes besides
+	// the asset's: only plain HACs are journaled.
+	bool CanBeJournaled(UHoudiniAssetComponent* HAC)
+	{
+		if (HAC->IsA<UHoudiniNodeSyncComponent>() || IsValid(HAC->GetPDGAssetLink()) || HAC->HasBeenDuplicated())
+			return false;
+
+		if (!IsValid(HAC->GetHoudiniAsset()) || HAC->GetHapiAssetName().IsEmpty())
+			return false;
+
+		TArray<UHoudiniOutput*> Outputs;
+		HAC->GetOutputs(Outputs);
+		for (UHoudiniOutput* CurrentOutput : Outputs)
+		{
+			if (IsValid(CurrentOutput) && CurrentOutput->IsEditableNode())
+				return false;
+		}
+
+		return true;
+	}
+
+	// An entry can only be rehydrated if the HAC has not been modified, cooked or reinstantiated since it was recorded
+	bool IsEntryUpToDate(UHoudiniAssetComponent* HAC, const FSessionJournalEntry& Entry)
+	{
+		return HAC->GetAssetState() == EHoudiniAssetState::None
+			&& Entry.HoudiniAsset.Get() == HAC->GetHoudiniAsset()
+			&& Entry.HapiAssetName.Equals(HAC->GetHapiAssetName())
+			&& Entry.AssetCookCount == HAC->GetAssetCookCount()
+			&& !HAC->NeedUpdate()
+			&& CanBeJournaled(HAC);
+	}
+
+	// Adds the HAC to OutSorted after the HACs it takes as inputs.
+	// Returns false if one of them cannot be rehydrated, in which case neither can the HAC.
+	bool SortUpstreamFirst(
+		UHoudiniAssetComponent* HAC,
+		const TSet<UHoudiniAssetComponent*>& Candidates,
+		TMap<UHoudiniAssetComponent*, bool>& Visited,
+		TArray<UHoudiniAssetComponent*>& OutSorted)
+	{
+		if (const bool* bSorted = Visited.Find(HAC))
+			return *bSorted;
+
+		// Guards against cycles
+		Visited.Add(HAC, false);
+
+		for (UHoudiniAssetComponent* UpstreamHAC : GetUpstreamHACs(HAC))
+		{
+			if (!Candidates.Contains(UpstreamHAC) || !SortUpstreamFirst(UpstreamHAC, Candidates, Visited, OutSorted))
+				return false;
+		}
+
+		Visited[HAC] = true;
+		OutSorted.Add(HAC);
+		return true;
+	}
+
+	// Checks if the nodes created without cooking are ready, without waiting for them.
+	// Returns false if the session failed. Errors are per node, they are checked when restoring each of them.
+	bool IsNodeCreationDone(bool& bOutDone)
+	{
+		int Status = HAPI_STATE_STARTING_COOK;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStatus(
+			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status))
+		{
+			return false;
+		}
+
+		bOutDone = Status <= HAPI_STATE_MAX_READY_STATE;
+		return true;
+	}
+
+	FText GetRehydrateProgressText(const FRehydrateState& Rehydrate)
+	{
+		switch (Rehydrate.Step)
+		{
+			case ERehydrateStep::LoadingAssets:
+				return FText::Format(LOCTEXT("SessionRecoveryLoadingAssets", "Recovering Houdini Assets: loading asset libraries ({0}/{1})..."),
+					Rehydrate.NextIndex, Rehydrate.HoudiniAssets.Num());
+			case ERehydrateStep::CreatingNodes:
+				return FText::Format(LOCTEXT("SessionRecoveryCreatingNodes", "Recovering Houdini Assets: recreating {0} nodes..."),
+					Rehydrate.NewNodeIds.Num());
+			case ERehydrateStep::RestoringHACs:
+				return FText::Format(LOCTEXT("SessionRecoveryRestoringHACs", "Recovering Houdini Assets: restoring parameters ({0}/{1})..."),
+					Rehydrate.NextIndex, Rehydrate.SortedHACs.Num());
+			case ERehydrateStep::UploadingInputs:
+				return FText::Format(LOCTEXT("SessionRecoveryUploadingInputs", "Recovering Houdini Assets: uploading inputs ({0}/{1})..."),
+					Rehydrate.NextIndex, Rehydrate.PendingInputs.Num());
+			default:
+				return FText::GetEmpty();
+		}
+	}
+
+	void StartRehydrateNotification(FRehydrateState& Rehydrate)
+	{
+#if WITH_EDITOR
+		FNotificationInfo Info(GetRehydrateProgressText(Rehydrate));
+		Info.bFireAndForget = false;
+		Info.ButtonDetails.Add(FNotificationButtonInfo(
+			LOCTEXT("CancelSessionRecovery", "Cancel"),
+			LOCTEXT("CancelSessionRecoveryTooltip", "Stop recovering the Houdini Assets from the session journal. The remaining ones are reinstantiated and recooked instead."),
+			FSimpleDelegate::CreateStatic(&FHoudiniSessionJournal::CancelRehydrate),
+			SNotificationItem::CS_Pending));
+		TSharedPtr<FSlateDynamicImageBrush> HoudiniBrush = FHoudiniEngine::Get().GetHoudiniEngineLogoBrush();
+		if (HoudiniBrush.IsValid())
+			Info.Image = HoudiniBrush.Get();
+
+		Rehydrate.NotificationPtr = FSlateNotificationManager::Get().AddNotification(Info);
+
+		TSharedPtr<SNotificationItem> Notification = Rehydrate.NotificationPtr.Pin();
+		if (Notification.IsValid())
+			Notification->SetCompletionState(SNotificationItem::CS_Pending);
+#endif
+	}
+
+	void UpdateRehydrateNotification(const FRehydrateState& Rehydrate)
+	{
+#if WITH_EDITOR
+		TSharedPtr<SNotificationItem> Notification = Rehydrate.NotificationPtr.Pin();
+		if (Notification.IsValid())
+			Notification->SetText(GetRehydrateProgressText(Rehydrate));
+#endif
+	}
+
+	// Ends the rehydration in progress, without touching its HACs or nodes
+	void ResetRehydrate(FSessionJournalState& State, const FText& InMessage, bool bSuccess)
+	{
+#if WITH_EDITOR
+		TSharedPtr<SNotificationItem> Notification = State.Rehydrate.NotificationPtr.Pin();
+		if (Notification.IsValid())
+		{
+			Notification->SetText(InMessage);
+			Notification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+			Notification->ExpireAndFadeout();
+		}
+#endif
+		State.Rehydrate = FRehydrateState();
+	}
+
+	// Deletes the node created for the HAC and forgets its entry, so that it is reinstantiated instead
+	void AbortHAC(FSessionJournalState& State, const TWeakObjectPtr<UHoudiniAssetComponent>& HAC)
+	{
+		HAPI_NodeId NewNodeId = -1;
+		if (State.Rehydrate.NewNodeIds.RemoveAndCopyValue(HAC, NewNodeId) && NewNodeId >= 0)
+			FHoudiniEngineUtils::DeleteHoudiniNode(NewNodeId);
+
+		State.Entries.Remove(HAC);
+		if (HAC.IsValid())
+			HAC->MarkAsNeedInstantiation();
+	}
+
+	// Aborts the rehydration of all the remaining HACs, they are reinstantiated instead
+	void AbortRehydrate(FSessionJournalState& State, const FText& InMessage)
+	{
+		TArray<TWeakObjectPtr<UHoudiniAssetComponent>> RemainingHACs;
+		State.Rehydrate.NewNodeIds.GetKeys(RemainingHACs);
+		for (const TWeakObjectPtr<UHoudiniAssetComponent>& HAC : RemainingHACs)
+			AbortHAC(State, HAC);
+
+		ResetRehydrate(State, InMessage, false);
+	}
+
+	// Restores the HAC's state on the node created for it in the new session, whose id has been assigned to the HAC.
+	// Its changed inputs are added to OutPendingInputs, to be uploaded with the other HACs' inputs.
+	bool RestoreHAC(UHoudiniAssetComponent* HAC, const FSessionJournalEntry& Entry, TArray<TWeakObjectPtr<UHoudiniInput>>& OutPendingInputs)
+	{
+		const HAPI_NodeId NodeId = HAC->GetAssetId();
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(NodeId))
+			return false;
+
+		// All the parameter values, multiparm instances and ramps in one call
+		if (Entry.Preset.Num() > 0)
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPreset(
+				FHoudiniEngine::Get().GetSession(), NodeId,
+				HAPI_PRESETTYPE_BINARY, nullptr, Entry.Preset.GetData(), Entry.Preset.Num()), false);
+		}
+
+		HAC->ClearOutputNodes();
+
+		if (HAC->bUploadTransformsToHoudiniEngine)
+		{
+			if (!FHoudiniEngineUtils::HapiSetAssetTransform(NodeId, HAC->GetComponentTransform()))
+				HOUDINI_LOG_MESSAGE(TEXT("Failed to upload the initial Transform back to HAPI."));
+		}
+
+		// Point the loaded parameters to the new node, keeping their values.
+		// Parameters modified since the last cook are still marked as changed, and will be uploaded by the next one.
+		if (!FHoudiniParameterTranslator::UpdateLoadedParameters(HAC))
+			return false;
+
+		// Point the inputs to the new node, their nodes are recreated when they are uploaded
+		if (!FHoudiniInputTranslator::UpdateLoadedInputs(HAC))
+			return false;
+
+		for (UHoudiniInput* CurrentInput : HAC->GetInputs())
+		{
+			if (!IsValid(CurrentInput))
+				continue;
+
+			CurrentInput->MarkChanged(true);
+			CurrentInput->SetNeedsToTriggerUpdate(false);
+			CurrentInput->MarkDataUploadNeeded(true);
+			OutPendingInputs.Add(CurrentInput);
+		}
+
+		TArray<int32> OutputNodes;
+		FHoudiniEngineUtils::GatherAllAssetOutputs(NodeId, HAC->bUseOutputNodes, HAC->bOutputTemplateGeos, OutputNodes);
+		HAC->SetOutputNodeIds(OutputNodes);
+
+		return true;
+	}
+
+	// Loads each asset library once, then creates all the nodes without cooking them
+	void UpdateLoadingAssets(FSessionJournalState& State, double TimeLimit)
+	{
+		FRehydrateState& Rehydrate = State.Rehydrate;
+		while (Rehydrate.NextIndex < Rehydrate.HoudiniAssets.Num() && FPlatformTime::Seconds() < TimeLimit)
+		{
+			const TWeakObjectPtr<UHoudiniAsset>& HoudiniAsset = Rehydrate.HoudiniAssets[Rehydrate.NextIndex++];
+			HAPI_AssetLibraryId AssetLibraryId = -1;
+			if (!HoudiniAsset.IsValid() || !FHoudiniEngineUtils::LoadHoudiniAsset(HoudiniAsset.Get(), AssetLibraryId))
+				Rehydrate.FailedHoudiniAssets.Add(HoudiniAsset);
+		}
+
+		if (Rehydrate.NextIndex < Rehydrate.HoudiniAssets.Num())
+			return;
+
+		for (const TWeakObjectPtr<UHoudiniAssetComponent>& HAC : Rehydrate.SortedHACs)
+		{
+			const FSessionJournalEntry* Entry = HAC.IsValid() ? State.Entries.Find(HAC) : nullptr;
+			HAPI_NodeId NodeId = -1;
+			if (!Entry || Rehydrate.FailedHoudiniAssets.Contains(HAC->GetHoudiniAsset())
+				|| HAPI_RESULT_SUCCESS != FHoudiniApi::CreateNode(
+					FHoudiniEngine::Get().GetSession(), -1, TCHAR_TO_UTF8(*Entry->HapiAssetName), nullptr, false, &NodeId))
+			{
+				AbortHAC(State, HAC);
+				continue;
+			}
+
+			Rehydrate.NewNodeIds.Add(HAC, NodeId);
+		}
+
+		Rehydrate.Step = ERehydrateStep::CreatingNodes;
+		Rehydrate.NodeCreationStartTime = FPlatformTime::Seconds();
+	}
+
+	// Once all the HACs are restored, sorts their inputs to upload them together
+	void FinishRestoringHACs(FRehydrateState& Rehydrate)
+	{
+		// The data inputs first, so that objects shared by several HACs are uploaded once before any asset input
+		// connects the restored nodes.
+		Rehydrate.PendingInputs.StableSort([](const TWeakObjectPtr<UHoudiniInput>& A, const TWeakObjectPtr<UHoudiniInput>& B)
+		{
+			return (A.IsValid() && !A->IsAssetInput()) && (B.IsValid() && B->IsAssetInput());
+		});
+
+		Rehydrate.Step = ERehydrateStep::UploadingInputs;
+		Rehydrate.NextIndex = 0;
+	}
+
+	// Uploads the queued inputs, then hands the restored HACs back to the Houdini Engine manager
+	void UpdateUploadingInputs(FSessionJournalState& State, double TimeLimit)
+	{
+		FRehydrateState& Rehydrate = State.Rehydrate;
+		while (Rehydrate.NextIndex < Rehydrate.PendingInputs.Num() && FPlatformTime::Seconds() < TimeLimit)
+		{
+			UHoudiniInput* CurrentInput = Rehydrate.PendingInputs[Rehydrate.NextIndex++].Get();
+			UHoudiniAssetComponent* HAC = IsValid(CurrentInput) ? Cast<UHoudiniAssetComponent>(CurrentInput->GetOuter()) : nullptr;
+			if (!IsValid(HAC) || !Rehydrate.NewNodeIds.Contains(HAC))
+				continue;
+
+			AActor* OwnerActor = HAC->GetOwner();
+			FHoudiniInputTranslator::UploadChangedInput(CurrentInput, OwnerActor ? OwnerActor->GetTransform() : FTransform::Identity);
+		}
+
+		if (Rehydrate.NextIndex < Rehydrate.PendingInputs.Num())
+			return;
+
+		int32 NumRehydrated = 0;
+		for (const TPair<TWeakObjectPtr<UHoudiniAssetComponent>, HAPI_NodeId>& NewNodeId : Rehydrate.NewNodeIds)
+		{
+			if (!NewNodeId.Key.IsValid())
+			{
+				// The HAC was destroyed during the rehydration
+				FHoudiniEngineUtils::DeleteHoudiniNode(NewNodeId.Value);
+				continue;
+			}
+
+			State.Rehydrated.Add(NewNodeId.Key);
+			NumRehydrated++;
+		}
+
+		State.LastRehydrateTime = FPlatformTime::Seconds() - Rehydrate.StartTime;
+		HOUDINI_LOG_MESSAGE(TEXT("Session recovery: restored %d of %d journaled Houdini Assets in %.3fs."),
+			NumRehydrated, Rehydrate.SortedHACs.Num(), State.LastRehydrateTime);
+
+		ResetRehydrate(State,
+			FText::Format(LOCTEXT("SessionRecoveryDone", "Recovered {0} Houdini Assets in {1}s."),
+				NumRehydrated, FText::AsNumber(State.LastRehydrateTime)),
+			true);
+	}
+
+	void HandleSessionJournalCommand(const TArray<FString>& Args)
+	{
+		const FString Command = Args.Num() > 0 ? Args[0] : FString();
+		if (Command.Equals(TEXT("Clear"), ESearchCase::IgnoreCase))
+		{
+			FHoudiniSessionJournal::Clear();
+			HOUDINI_LOG_MESSAGE(TEXT("Cleared the session journal."));
+		}
+		else if (Command.Equals(TEXT("Stats"), ESearchCase::IgnoreCase))
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Session journal: %s, %d entries, last recovery took %.3fs."),
+				FHoudiniSessionJournal::IsEnabled() ? TEXT("enabled") : TEXT("disabled"),
+				FHoudiniSessionJournal::GetNumEntries(), FHoudiniSessionJournal::GetLastRehydrateTime());
+		}
+		else
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Usage: HoudiniEngine.SessionJournal Clear|Stats"));
+		}
+	}
+
+	FAutoConsoleCommand CCmdSessionJournal(
+		TEXT("HoudiniEngine.SessionJournal"),
+		TEXT("Manages the journal used to recover the Houdini Assets when the session is restarted.\n")
+		TEXT("Clear: forget all the journaled assets, so that they are reinstantiated and recooked\n")
+		TEXT("Stats: log the number of journaled assets and the duration of the last recovery"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleSessionJournalCommand));
+}
+
+bool
+FHoudiniSessionJournal::IsEnabled()
+{
+	return GetDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery;
+}
+
+void
+FHoudiniSessionJournal::Record(UHoudiniAssetComponent* HAC)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniSessionJournal::Record);
+
+	if (!IsValid(HAC))
+		return;
+
+	FSessionJournalState& State = GetSessionJournalState();
+	if (!IsEnabled() || HAC->GetAssetState() != EHoudiniAssetState::None || !HAC->WasLastCookSuccessful()
+		|| HAC->GetAssetId() < 0 || !CanBeJournaled(HAC))
+	{
+		State.Entries.Remove(HAC);
+		return;
+	}
+
+	// The node's preset only has to be fetched again if it was cooked or had its parameters modified since
+	const uint64 ParametersHash = FHoudiniHashUtils::HashParameterValues(0, HAC->GetParameters());
+	const FSessionJournalEntry* ExistingEntry = State.Entries.Find(HAC);
+	if (ExistingEntry
+		&& ExistingEntry->HoudiniAsset.Get() == HAC->GetHoudiniAsset()
+		&& ExistingEntry->HapiAssetName.Equals(HAC->GetHapiAssetName())
+		&& ExistingEntry->AssetCookCount == HAC->GetAssetCookCount()
+		&& ExistingEntry->ParametersHash == ParametersHash)
+	{
+		return;
+	}
+
+	FSessionJournalEntry Entry;
+	Entry.HoudiniAsset = HAC->GetHoudiniAsset();
+	Entry.HapiAssetName = HAC->GetHapiAssetName();
+	Entry.AssetCookCount = HAC->GetAssetCookCount();
+	Entry.ParametersHash = ParametersHash;
+	if (!FHoudiniEngineUtils::GetAssetPreset(HAC->GetAssetId(), Entry.Preset))
+	{
+		State.Entries.Remove(HAC);
+		return;
+	}
+
+	State.Entries.Add(HAC, MoveTemp(Entry));
+}
+
+bool
+FHoudiniSessionJournal::Contains(UHoudiniAssetComponent* HAC)
+{
+	return GetSessionJournalState().Entries.Contains(HAC);
+}
+
+
+int32
+FHoudiniSessionJournal::StartRehydrate(TSet<UHoudiniAssetComponent*>& OutPending)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniSessionJournal::StartRehydrate);
+
+	FSessionJournalState& State = GetSessionJournalState();
+	State.Rehydrated.Empty();
+
+	// A rehydration still in progress was for the previous session, whose nodes are gone:
+	// its HACs that are still up to date are rehydrated again in the new one.
+	if (State.Rehydrate.Step != ERehydrateStep::None)
+		ResetRehydrate(State, LOCTEXT("SessionRecoveryRestarted", "Session recovery restarted for the new session."), false);
+
+	if (!IsEnabled() || !FHoudiniEngine::Get().GetSession())
+	{
+		State.Entries.Empty();
+		return 0;
+	}
+
+	// Only keep the HACs that are still in the state they were recorded in
+	TSet<UHoudiniAssetComponent*> Candidates;
+	for (auto It = State.Entries.CreateIterator(); It; ++It)
+	{
+		UHoudiniAssetComponent* HAC = It->Key.Get();
+		if (!IsValid(HAC) || !IsEntryUpToDate(HAC, It->Value))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		Candidates.Add(HAC);
+	}
+
+	// Upstream HACs first, so that their new nodes can be connected to the downstream ones
+	TArray<UHoudiniAssetComponent*> SortedHACs;
+	TMap<UHoudiniAssetComponent*, bool> Visited;
+	for (UHoudiniAssetComponent* HAC : Candidates)
+		SortUpstreamFirst(HAC, Candidates, Visited, SortedHACs);
+
+	if (SortedHACs.Num() <= 0)
+		return 0;
+
+	FRehydrateState& Rehydrate = State.Rehydrate;
+	Rehydrate.Step = ERehydrateStep::LoadingAssets;
+	Rehydrate.StartTime = FPlatformTime::Seconds();
+	for (UHoudiniAssetComponent* HAC : SortedHACs)
+	{
+		// Its node died with the previous session, it gets a new one when it is restored
+		HAC->AssetId = -1;
+
+		Rehydrate.SortedHACs.Add(HAC);
+		Rehydrate.NewNodeIds.Add(HAC, -1);
+		Rehydrate.HoudiniAssets.AddUnique(HAC->GetHoudiniAsset());
+		OutPending.Add(HAC);
+	}
+
+	StartRehydrateNotification(Rehydrate);
+
+	return SortedHACs.Num();
+}
+
+void
+FHoudiniSessionJournal::UpdateRehydrate()
+{
+	FSessionJournalState& State = GetSessionJournalState();
+	FRehydrateState& Rehydrate = State.Rehydrate;
+	if (Rehydrate.Step == ERehydrateStep::None)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniSessionJournal::UpdateRehydrate);
+
+	if (Rehydrate.bCancelRequested)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Session recovery cancelled, the remaining Houdini Assets will be reinstantiated."));
+		AbortRehydrate(State, LOCTEXT("SessionRecoveryCancelled", "Session recovery cancelled, the Houdini Assets are reinstantiated."));
+		return;
+	}
+
+	const double TimeLimit = FPlatformTime::Seconds() + RehydrateTickTimeLimitSeconds;
+	if (Rehydrate.Step == ERehydrateStep::LoadingAssets)
+	{
+		UpdateLoadingAssets(State, TimeLimit);
+	}
+
+	if (Rehydrate.Step == ERehydrateStep::CreatingNodes)
+	{
+		bool bNodesCreated = false;
+		if (!IsNodeCreationDone(bNodesCreated)
+			|| (!bNodesCreated && FPlatformTime::Seconds() - Rehydrate.NodeCreationStartTime > NodeCreationTimeoutSeconds))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Session recovery failed: the nodes could not be recreated, the Houdini Assets will be reinstantiated."));
+			AbortRehydrate(State, LOCTEXT("SessionRecoveryFailed", "Session recovery failed, the Houdini Assets are reinstantiated."));
+			return;
+		}
+
+		if (bNodesCreated)
+		{
+			FHoudiniEngineString::InvalidateStringCache();
+			Rehydrate.Step = ERehydrateStep::RestoringHACs;
+			Rehydrate.NextIndex = 0;
+		}
+	}
+
+	if (Rehydrate.Step == ERehydrateStep::RestoringHACs)
+	{
+		while (Rehydrate.NextIndex < Rehydrate.SortedHACs.Num() && FPlatformTime::Seconds() < TimeLimit)
+		{
+			const TWeakObjectPtr<UHoudiniAssetComponent> HAC = Rehydrate.SortedHACs[Rehydrate.NextIndex++];
+			const HAPI_NodeId* NodeId = Rehydrate.NewNodeIds.Find(HAC);
+			if (!NodeId)
+				continue;
+
+			const FSessionJournalEntry* Entry = HAC.IsValid() ? State.Entries.Find(HAC) : nullptr;
+			if (!Entry)
+			{
+				AbortHAC(State, HAC);
+				continue;
+			}
+
+			// A HAC can only be rehydrated if all its upstream HACs are
+			bool bUpstreamRehydrated = true;
+			for (UHoudiniAssetComponent* UpstreamHAC : GetUpstreamHACs(HAC.Get()))
+				bUpstreamRehydrated &= Rehydrate.NewNodeIds.Contains(UpstreamHAC);
+
+			HAC->AssetId = *NodeId;
+			if (!bUpstreamRehydrated || !RestoreHAC(HAC.Get(), *Entry, Rehydrate.PendingInputs))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Session recovery: could not restore %s, it will be reinstantiated."), *HAC->GetDisplayName());
+				AbortHAC(State, HAC);
+			}
+		}
+
+		if (Rehydrate.NextIndex >= Rehydrate.SortedHACs.Num())
+			FinishRestoringHACs(Rehydrate);
+	}
+
+	if (Rehydrate.Step == ERehydrateStep::UploadingInputs)
+	{
+		UpdateUploadingInputs(State, TimeLimit);
+	}
+
+	UpdateRehydrateNotification(Rehydrate);
+}
+
+bool
+FHoudiniSessionJournal::IsRehydrating()
+{
+	return GetSessionJournalState().Rehydrate.Step != ERehydrateStep::None;
+}
+
+bool
+FHoudiniSessionJournal::IsRehydrating(UHoudiniAssetComponent* HAC)
+{
+	return GetSessionJournalState().Rehydrate.NewNodeIds.Contains(HAC);
+}
+
+void
+FHoudiniSessionJournal::CancelRehydrate()
+{
+	GetSessionJournalState().Rehydrate.bCancelRequested = true;
+}
+
+bool
+FHoudiniSessionJournal::ConsumeRehydrated(UHoudiniAssetComponent* HAC)
+{
+	return GetSessionJournalState().Rehydrated.Remove(HAC) > 0;
+}
+
+void
+FHoudiniSessionJournal::Clear()
+{
+	FSessionJournalState& State = GetSessionJournalState();
+	if (State.Rehydrate.Step != ERehydrateStep::None)
+		AbortRehydrate(State, LOCTEXT("SessionRecoveryCleared", "Session journal cleared, the Houdini Assets are reinstantiated."));
+
+	State.Entries.Empty();
+	State.Rehydrated.Empty();
+}
+
+int32
+FHoudiniSessionJournal::GetNumEntries()
+{
+	return GetSessionJournalState().Entries.Num();
+}
+
+double
+FHoudiniSessionJournal::GetLastRehydrateTime()
+{
+	return GetSessionJournalState().LastRehydrateTime;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,75 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UHoudiniAssetComponent;
+
+// In-memory journal of the state of the Houdini Asset Components in the current session: the HDA and asset they
+// instantiate, their parameter values (as a preset) and the HACs they take as inputs.
+// It is recorded after each cook, and outlives the session: when a session is restarted, StartRehydrate() starts
+// recreating the journaled HACs' nodes in the new session in bulk, and UpdateRehydrate() carries on over the next ticks
+// of the Houdini Engine manager: it restores their parameters in one call each in dependency order, then uploads the
+// inputs of all the HACs together, without cooking them or translating their outputs again.
+// Enabled by the "Fast session recovery" runtime setting, also available through the "HoudiniEngine.SessionJournal" console command.
+struct HOUDINIENGINE_API FHoudiniSessionJournal
+{
+	static bool IsEnabled();
+
+	// Records the state of the HAC once its cook has been processed. HACs that cannot be rehydrated are forgotten.
+	static void Record(UHoudiniAssetComponent* HAC);
+
+	static bool Contains(UHoudiniAssetComponent* HAC);
+
+	// Starts recreating the nodes of the journaled HACs that are still in the state they were recorded in, in the current session.
+	// Returns the number of HACs being rehydrated, which are added to OutPending. The others need to be reinstantiated.
+	// The HACs whose rehydration fails or is cancelled are marked as needing instantiation.
+	static int32 StartRehydrate(TSet<UHoudiniAssetComponent*>& OutPending);
+
+	// Carries on with the rehydration in progress, for a limited time. Called on each tick of the Houdini Engine manager.
+	static void UpdateRehydrate();
+
+	static bool IsRehydrating();
+
+	// HACs being rehydrated must not be processed until their rehydration is done
+	static bool IsRehydrating(UHoudiniAssetComponent* HAC);
+
+	// The remaining HACs are reinstantiated instead, on the next update
+	static void CancelRehydrate();
+
+	// Returns true once after a HAC was rehydrated: its new node has not been cooked yet,
+	// so its next cook must update all its outputs.
+	static bool ConsumeRehydrated(UHoudiniAssetComponent* HAC);
+
+	static void Clear();
+
+	static int32 GetNumEntries();
+
+	// Duration of the last rehydration, from StartRehydrate() until all the HACs were restored, in seconds
+	static double GetLastRehydrateTime();
+};
@@ -573,12 +573,13 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 	const FTransform& ParentTransform,
 	const bool & InIsLegacyCurve,
 	const int32& InOrder,
-	const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization
+	const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization,
+	const bool& bInUploadPointsAsAttributes
 	 )
 {
 	if (InIsLegacyCurve)
 	{
-		return HapiCreateCurveInputNodeForDataLegacy(CurveNodeId, ParentNodeId, InputNodeName, Positions, Rotations, Scales3d, InCurveType, InCurveMethod, InClosed, InReversed, InForceClose, ParentTransform);
+		return HapiCreateCurveInputNodeForDataLegacy(CurveNodeId, ParentNodeId, InputNodeName, Positions, Rotations, Scales3d, InCurveType, InCurveMethod, InClosed, InReversed, InForceClose, ParentTransform, bInUploadPointsAsAttributes);
 	}
 	
 #if WITH_EDITOR
@@ -640,49 +641,12 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
         &InputCurveInfo), false);
 
 	TArray<float> CurvePositions;
-	CurvePositions.SetNum(NumberOfCVs * 3);
-
-	for (int32 i = 0; i < Positions->Num(); i++)
-	{
-		CurvePositions[i*3 + 0] = (float)((*Positions)[i].X) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		// Swap Y/Z
-		CurvePositions[i*3 + 1] = (float)((*Positions)[i].Z) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		CurvePositions[i*3 + 2] = (float)((*Positions)[i].Y) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
-
 	TArray<float> CurveRotations;
 	TArray<float> CurveScales;
-	
-	bool bAddRotations = (Rotations != nullptr && Rotations->Num() == Positions->Num());
-	bool bAddScales3d = (Scales3d != nullptr && Scales3d->Num() == Positions->Num());
-	
-	if (bAddRotations)
-	{
-		CurveRotations.SetNum(NumberOfCVs * 4);
-		for (int32 Idx = 0; Idx < Rotations->Num(); Idx++)
-		{
-			// Get current quaternion
-			const FQuat& RotationQuaternion = (*Rotations)[Idx];
+	ConvertCurvePointsToHoudiniData(*Positions, Rotations, Scales3d, CurvePositions, CurveRotations, CurveScales);
 
-			CurveRotations[Idx * 4 + 0] = RotationQuaternion.X;
-			CurveRotations[Idx * 4 + 1] = RotationQuaternion.Z;
-			CurveRotations[Idx * 4 + 2] = RotationQuaternion.Y;
-			CurveRotations[Idx * 4 + 3] = -RotationQuaternion.W;
-		}
-	}
-
-	if (bAddScales3d)
-	{
-		CurveScales.SetNum(NumberOfCVs * 3);
-		for (int32 Idx = 0; Idx < Scales3d->Num(); Idx++)
-		{
-			// Get current scale
-			FVector ScaleVector = (*Scales3d)[Idx];
-			CurveScales[Idx * 3 + 0] = ScaleVector.X;
-			CurveScales[Idx * 3 + 1] = ScaleVector.Z;
-			CurveScales[Idx * 3 + 2] = ScaleVector.Y;
-		}
-	}
+	bool bAddRotations = CurveRotations.Num() > 0;
+	bool bAddScales3d = CurveScales.Num() > 0;
 
 	if (bAddRotations || bAddScales3d)
 	{
@@ -718,7 +682,8 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 	const bool& InClosed,
 	const bool& InReversed,
 	const bool& InForceClose,
-	const FTransform& ParentTransform )
+	const FTransform& ParentTransform,
+	const bool& bInUploadPointsAsAttributes)
 {
 #if WITH_EDITOR
 	// Positions are required
@@ -823,6 +788,21 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 		CurveClosed = 1;
 	}
 
+	// Open polygons don't need the curve SOP to generate their points: send them as typed point attributes
+	// instead of going through the coords string, and skip the first cook that reads back the curve SOP's output.
+	// This is only done if the curve SOP doesn't create other attributes, as they would be lost.
+	if (bInUploadPointsAsAttributes && CurveTypeValue == HAPI_CURVETYPE_LINEAR && !CurveClosed && !CurveReversed
+		&& FHoudiniSplineTranslator::HapiCurveNodeOnlyOutputsPositions(CurveNodeId))
+	{
+		if (!FHoudiniSplineTranslator::HapiSetCurvePointAttributes(CurveNodeId, *Positions, Rotations, Scales3d))
+			return false;
+
+		HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+		CookOptions.maxVerticesPerPrimitive = -1;
+		CookOptions.refineCurveToLinear = true;
+		return FHoudiniEngineUtils::HapiCookNode(CurveNodeId, &CookOptions, false);
+	}
+
 	// For closed NURBS (CVs and Breakpoints), we have to close the curve manually, by duplicating its last point
 	// in order to be able to set the rotations and scales attributes properly.
 	bool bCloseCurveManually = false;
@@ -1450,17 +1430,204 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 void
 FHoudiniSplineTranslator::CreatePositionsString(const TArray<FVector>& InPositions, FString& OutPositionString)
 {
-	OutPositionString = TEXT("");
+	// Append in place to a preallocated string instead of concatenating temporary strings.
+	// %f only kept 6 decimals, use enough to round trip the float positions HAPI uses.
+	OutPositionString.Empty(InPositions.Num() * 48);
 	for (int32 Idx = 0; Idx < InPositions.Num(); ++Idx)
 	{
 		FVector Position = InPositions[Idx];	
 		// Convert to meters
 		Position /= HAPI_UNREAL_SCALE_FACTOR_POSITION;
 		// Swap Y/Z
-		OutPositionString += FString::Printf(TEXT("%f, %f, %f "), Position.X, Position.Z, Position.Y);
+		OutPositionString.Appendf(TEXT("%.9f, %.9f, %.9f "), Position.X, Position.Z, Position.Y);
+	}
+}
+
+void
+FHoudiniSplineTranslator::ConvertCurvePointsToHoudiniData(
+	const TArray<FVector>& InPositions,
+	const TArray<FQuat>* InRotations,
+	const TArray<FVector>* InScales3d,
+	TArray<float>& OutPositions,
+	TArray<float>& OutRotations,
+	TArray<float>& OutScales3d)
+{
+	const int32 NumberOfCVs = InPositions.Num();
+
+	OutPositions.SetNumUninitialized(NumberOfCVs * 3);
+	for (int32 Idx = 0; Idx < NumberOfCVs; Idx++)
+	{
+		OutPositions[Idx * 3 + 0] = (float)(InPositions[Idx].X) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		// Swap Y/Z
+		OutPositions[Idx * 3 + 1] = (float)(InPositions[Idx].Z) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[Idx * 3 + 2] = (float)(InPositions[Idx].Y) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+	}
+
+	OutRotations.Reset();
+	if (InRotations && InRotations->Num() == NumberOfCVs)
+	{
+		OutRotations.SetNumUninitialized(NumberOfCVs * 4);
+		for (int32 Idx = 0; Idx < NumberOfCVs; Idx++)
+		{
+			// Get current quaternion
+			const FQuat& RotationQuaternion = (*InRotations)[Idx];
+
+			OutRotations[Idx * 4 + 0] = RotationQuaternion.X;
+			OutRotations[Idx * 4 + 1] = RotationQuaternion.Z;
+			OutRotations[Idx * 4 + 2] = RotationQuaternion.Y;
+			OutRotations[Idx * 4 + 3] = -RotationQuaternion.W;
+		}
+	}
+
+	OutScales3d.Reset();
+	if (InScales3d && InScales3d->Num() == NumberOfCVs)
+	{
+		OutScales3d.SetNumUninitialized(NumberOfCVs * 3);
+		for (int32 Idx = 0; Idx < NumberOfCVs; Idx++)
+		{
+			// Get current scale
+			const FVector& ScaleVector = (*InScales3d)[Idx];
+			OutScales3d[Idx * 3 + 0] = ScaleVector.X;
+			OutScales3d[Idx * 3 + 1] = ScaleVector.Z;
+			OutScales3d[Idx * 3 + 2] = ScaleVector.Y;
+		}
 	}
 }
 
+bool
+FHoudiniSplineTranslator::HapiCurveNodeOnlyOutputsPositions(const HAPI_NodeId& InCurveNodeId)
+{
+	// The result only depends on the curve SOP, so it is only checked once per session
+	static FCriticalSection CheckLock;
+	static const HAPI_Session* CheckedSession = nullptr;
+	static bool bCheckedOnlyPositions = false;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+		return false;
+
+	FScopeLock ScopeLock(&CheckLock);
+	if (CheckedSession == Session)
+		return bCheckedOnlyPositions;
+
+	HAPI_ParmId ParmId = -1;
+	if (FHoudiniApi::GetParmIdFromName(Session, InCurveNodeId, HAPI_UNREAL_PARAM_CURVE_COORDS, &ParmId) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	// Cook an open polygon with two points, and count the attributes of the output
+	if (FHoudiniApi::SetParmStringValue(Session, InCurveNodeId, "0, 0, 0 1, 0, 0 ", ParmId, 0) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+	CookOptions.maxVerticesPerPrimitive = -1;
+	CookOptions.refineCurveToLinear = false;
+	const bool bCooked = FHoudiniEngineUtils::HapiCookNode(InCurveNodeId, &CookOptions, true);
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	const bool bHasPartInfo = bCooked
+		&& FHoudiniApi::GetPartInfo(Session, InCurveNodeId, 0, &PartInfo) == HAPI_RESULT_SUCCESS;
+
+	// The points are sent as attributes, leave the coords empty
+	FHoudiniApi::SetParmStringValue(Session, InCurveNodeId, "", ParmId, 0);
+
+	if (!bHasPartInfo)
+		return false;
+
+	int32 NumAttributes = 0;
+	for (int32 Owner = 0; Owner < HAPI_ATTROWNER_MAX; ++Owner)
+		NumAttributes += PartInfo.attributeCounts[Owner];
+
+	CheckedSession = Session;
+	bCheckedOnlyPositions = NumAttributes == 1 && PartInfo.attributeCounts[HAPI_ATTROWNER_POINT] == 1;
+	if (!bCheckedOnlyPositions)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("The curve SOP outputs %d attributes, curve input points will be sent through its coords parameter."), NumAttributes);
+	}
+
+	return bCheckedOnlyPositions;
+}
+
+bool
+FHoudiniSplineTranslator::HapiSetCurvePointAttributes(
+	const HAPI_NodeId& InCurveNodeId,
+	const TArray<FVector>& InPositions,
+	const TArray<FQuat>* InRotations,
+	const TArray<FVector>* InScales3d)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniSplineTranslator::HapiSetCurvePointAttributes);
+
+	const int32 NumberOfCVs = InPositions.Num();
+	if (NumberOfCVs < 2)
+		return false;
+
+	TArray<float> CurvePositions;
+	TArray<float> CurveRotations;
+	TArray<float> CurveScales;
+	ConvertCurvePointsToHoudiniData(InPositions, InRotations, InScales3d, CurvePositions, CurveRotations, CurveScales);
+
+	// One open polygon curve using all the points
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	PartInfo.type = HAPI_PARTTYPE_CURVE;
+	PartInfo.faceCount = 1;
+	PartInfo.vertexCount = NumberOfCVs;
+	PartInfo.pointCount = NumberOfCVs;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InCurveNodeId, 0, &PartInfo), false);
+
+	HAPI_CurveInfo CurveInfo;
+	FHoudiniApi::CurveInfo_Init(&CurveInfo);
+	CurveInfo.curveType = HAPI_CURVETYPE_LINEAR;
+	CurveInfo.curveCount = 1;
+	CurveInfo.vertexCount = NumberOfCVs;
+	CurveInfo.knotCount = 0;
+	CurveInfo.isPeriodic = false;
+	CurveInfo.order = 2;
+	CurveInfo.hasKnots = false;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveInfo(
+		FHoudiniEngine::Get().GetSession(), InCurveNodeId, 0, &CurveInfo), false);
+
+	int32 CurveCount = NumberOfCVs;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveCounts(
+		FHoudiniEngine::Get().GetSession(), InCurveNodeId, 0, &CurveCount, 0, 1), false);
+
+	// Lambda adding a float point attribute and uploading its data
+	auto SetPointAttribute = [&](const char* InAttributeName, const int32& InTupleSize, const TArray<float>& InData)
+	{
+		HAPI_AttributeInfo AttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+		AttributeInfo.count = NumberOfCVs;
+		AttributeInfo.tupleSize = InTupleSize;
+		AttributeInfo.exists = true;
+		AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), InCurveNodeId, 0, InAttributeName, &AttributeInfo), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(), InCurveNodeId, 0, InAttributeName,
+			&AttributeInfo, InData.GetData(), 0, AttributeInfo.count), false);
+
+		return true;
+	};
+
+	if (!SetPointAttribute(HAPI_UNREAL_ATTRIB_POSITION, 3, CurvePositions))
+		return false;
+
+	if (CurveRotations.Num() > 0 && !SetPointAttribute(HAPI_UNREAL_ATTRIB_ROTATION, 4, CurveRotations))
+		return false;
+
+	if (CurveScales.Num() > 0 && !SetPointAttribute(HAPI_UNREAL_ATTRIB_SCALE, 3, CurveScales))
+		return false;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(InCurveNodeId), false);
+
+	return true;
+}
+
 bool
 FHoudiniSplineTranslator::HapiCreateCurveInputNode(
 	HAPI_NodeId& OutCurveNodeId, 
@@ -81,7 +81,9 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 		const bool & InIsLegacyCurve = false,
 		// Only used if Legacy curve:
 		const int32& InOrder = 2,
-		const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization = EHoudiniCurveBreakpointParameterization::Uniform
+		const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization = EHoudiniCurveBreakpointParameterization::Uniform,
+		// Only used if Legacy curve: see HapiCreateCurveInputNodeForDataLegacy
+		const bool& bInUploadPointsAsAttributes = false
 	);
 
 	// Update curve node data using curve::1.0
@@ -98,7 +100,33 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 		const bool& InClosed,
 		const bool& InReversed,
 		const bool& InForceClose = false,
-		const FTransform& ParentTransform = FTransform::Identity);
+		const FTransform& ParentTransform = FTransform::Identity,
+		// If true, open polygon curves are sent as P/rot/scale point attributes instead of through the coords parameter,
+		// unless the curve SOP creates other attributes (see HapiCurveNodeOnlyOutputsPositions).
+		// The coords parameter is then left empty, so this shouldn't be used for curves that are edited from the node.
+		const bool& bInUploadPointsAsAttributes = false);
+
+	// Returns true if the curve SOP doesn't output any attribute other than P for an open polygon, so that its points
+	// can be sent directly as attributes without losing anything. Checked by cooking InCurveNodeId once per session.
+	static bool HapiCurveNodeOnlyOutputsPositions(const HAPI_NodeId& InCurveNodeId);
+
+	// Replaces the geometry of a curve node by a single open polygon curve, with the given points sent as
+	// typed P/rot/scale point attributes. Rotations/scales are only sent if they match the number of points.
+	static bool HapiSetCurvePointAttributes(
+		const HAPI_NodeId& InCurveNodeId,
+		const TArray<FVector>& InPositions,
+		const TArray<FQuat>* InRotations,
+		const TArray<FVector>* InScales3d);
+
+	// Converts curve points to Houdini's coordinate system, as flat float arrays ready to be sent to HAPI.
+	// Rotations/scales are only converted if they match the number of points.
+	static void ConvertCurvePointsToHoudiniData(
+		const TArray<FVector>& InPositions,
+		const TArray<FQuat>* InRotations,
+		const TArray<FVector>* InScales3d,
+		TArray<float>& OutPositions,
+		TArray<float>& OutRotations,
+		TArray<float>& OutScales3d);
 
 	
 	// Create a default curve node.
@@ -30,6 +30,160 @@
 
 #include "HoudiniEnginePrivatePCH.h"
 #include "HAL/FileManager.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
+
+namespace
+{
+	// A format template split into literal text and token names, so that it can be resolved
+	// without being parsed again.
+	struct FHoudiniCompiledStringTemplate
+	{
+		struct FPart
+		{
+			FString Text;
+			bool bIsToken = false;
+		};
+
+		TArray<FPart> Parts;
+		int32 LiteralLength = 0;
+
+		// Only plain "{name}" tokens are compiled. Returns false when the template uses anything else
+		// FString::Format would have to interpret (` escapes, unmatched braces, spaces in a token...).
+		bool Compile(const FString& InTemplate)
+		{
+			const TCHAR* Chars = *InTemplate;
+			const int32 Len = InTemplate.Len();
+			int32 LiteralStart = 0;
+			for (int32 Idx = 0; Idx < Len; ++Idx)
+			{
+				if (Chars[Idx] == TEXT('`') || Chars[Idx] == TEXT('}'))
+					return false;
+
+				if (Chars[Idx] != TEXT('{'))
+					continue;
+
+				int32 TokenEnd = Idx + 1;
+				while (TokenEnd < Len && Chars[TokenEnd] != TEXT('}'))
+				{
+					const TCHAR C = Chars[TokenEnd];
+					if (C == TEXT('{') || C == TEXT('`') || FChar::IsWhitespace(C))
+						return false;
+					TokenEnd++;
+				}
+
+				if (TokenEnd >= Len || TokenEnd == Idx + 1)
+					return false;
+
+				AddPart(FString(Idx - LiteralStart, Chars + LiteralStart), false);
+				AddPart(FString(TokenEnd - Idx - 1, Chars + Idx + 1), true);
+				Idx = TokenEnd;
+				LiteralStart = TokenEnd + 1;
+			}
+
+			AddPart(FString(Len - LiteralStart, Chars + LiteralStart), false);
+			return true;
+		}
+
+		// Returns false if a token isn't a string, FString::Format must be used to convert it.
+		bool Resolve(const TMap<FString, FStringFormatArg>& InTokens, FString& OutString) const
+		{
+			OutString.Reset(LiteralLength);
+			for (const FPart& Part : Parts)
+			{
+				if (!Part.bIsToken)
+				{
+					OutString += Part.Text;
+					continue;
+				}
+
+				const FStringFormatArg* Arg = InTokens.Find(Part.Text);
+				if (!Arg)
+				{
+					// Unknown tokens are left as is
+					OutString += TEXT('{');
+					OutString += Part.Text;
+					OutString += TEXT('}');
+				}
+				else if (Arg->Type == FStringFormatArg::String)
+				{
+					OutString += Arg->StringValue;
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+	private:
+		void AddPart(FString&& InText, bool bInIsToken)
+		{
+			if (InText.IsEmpty())
+				return;
+
+			if (!bInIsToken)
+				LiteralLength += InText.Len();
+
+			Parts.Add({ MoveTemp(InText), bInIsToken });
+		}
+	};
+
+	// Templates parsed so far, shared by all resolvers.
+	// Null entries are templates that can't be compiled and go through FString::Format.
+	class FHoudiniStringTemplateCache
+	{
+	public:
+		static TSharedPtr<const FHoudiniCompiledStringTemplate> FindOrCompile(const FString& InTemplate)
+		{
+			{
+				FReadScopeLock ScopeLock(Lock);
+				if (const TSharedPtr<const FHoudiniCompiledStringTemplate>* Found = Templates.Find(InTemplate))
+					return *Found;
+			}
+
+			TSharedPtr<FHoudiniCompiledStringTemplate> Compiled = MakeShared<FHoudiniCompiledStringTemplate>();
+			if (!Compiled->Compile(InTemplate))
+				Compiled.Reset();
+
+			FWriteScopeLock ScopeLock(Lock);
+			// Attribute values can make every template unique, don't let them pile up
+			if (Templates.Num() >= MaxTemplates)
+				Templates.Reset();
+
+			Templates.Add(InTemplate, Compiled);
+			return Compiled;
+		}
+
+		static void Empty()
+		{
+			FWriteScopeLock ScopeLock(Lock);
+			Templates.Empty();
+		}
+
+		static std::atomic<bool> bEnabled;
+
+	private:
+		struct FKeyFuncs : BaseKeyFuncs<TPair<FString, TSharedPtr<const FHoudiniCompiledStringTemplate>>, FString, false>
+		{
+			static const FString& GetSetKey(const TPair<FString, TSharedPtr<const FHoudiniCompiledStringTemplate>>& InElement) { return InElement.Key; }
+			static bool Matches(const FString& A, const FString& B) { return FHoudiniStringTemplateKeyFuncs::Matches(A, B); }
+			static uint32 GetKeyHash(const FString& InKey) { return FHoudiniStringTemplateKeyFuncs::GetKeyHash(InKey); }
+		};
+
+		static constexpr int32 MaxTemplates = 4096;
+
+		static FRWLock Lock;
+		static TMap<FString, TSharedPtr<const FHoudiniCompiledStringTemplate>, FDefaultSetAllocator, FKeyFuncs> Templates;
+	};
+
+	FRWLock FHoudiniStringTemplateCache::Lock;
+	TMap<FString, TSharedPtr<const FHoudiniCompiledStringTemplate>, FDefaultSetAllocator, FHoudiniStringTemplateCache::FKeyFuncs> FHoudiniStringTemplateCache::Templates;
+	std::atomic<bool> FHoudiniStringTemplateCache::bEnabled(true);
+}
 
 void FHoudiniStringResolver::GetTokensAsStringMap(TMap<FString,FString>& OutTokens) const
 {
@@ -51,11 +205,13 @@ FString FHoudiniStringResolver::SanitizeTokenValue(const FString& InValue)
 
 void FHoudiniStringResolver::SetToken(const FString& InName, const FString& InValue)
 {
+	ResolvedStrings.Reset();
 	CachedTokens.Add(InName, SanitizeTokenValue(InValue));
 }
 
 void FHoudiniStringResolver::SetTokensFromStringMap(const TMap<FString, FString>& InTokens, bool bClearTokens)
 {
+	ResolvedStrings.Reset();
 	if (bClearTokens)
 	{
 		CachedTokens.Empty();
@@ -72,10 +228,37 @@ void FHoudiniStringResolver::SetTokensFromStringMap(const TMap<FString, FString>
 FString FHoudiniStringResolver::ResolveString(
 	const FString& InString) const
 {
-	FString Result = FString::Format(*InString, CachedTokens);
+	if (!FHoudiniStringTemplateCache::bEnabled)
+		return FString::Format(*InString, CachedTokens);
+
+	if (const FString* Resolved = ResolvedStrings.Find(InString))
+		return *Resolved;
+
+	FString Result;
+	const TSharedPtr<const FHoudiniCompiledStringTemplate> Template = FHoudiniStringTemplateCache::FindOrCompile(InString);
+	if (!Template.IsValid() || !Template->Resolve(CachedTokens, Result))
+		Result = FString::Format(*InString, CachedTokens);
+
+	ResolvedStrings.Add(InString, Result);
 	return Result;
 }
 
+void FHoudiniStringResolver::InvalidateStringTemplateCache()
+{
+	FHoudiniStringTemplateCache::Empty();
+}
+
+void FHoudiniStringResolver::SetStringTemplateCacheEnabled(bool bInEnabled)
+{
+	FHoudiniStringTemplateCache::bEnabled = bInEnabled;
+	FHoudiniStringTemplateCache::Empty();
+}
+
+bool FHoudiniStringResolver::IsStringTemplateCacheEnabled()
+{
+	return FHoudiniStringTemplateCache::bEnabled;
+}
+
 //void FHoudiniStringResolver::SetCurrentWorld(UWorld* InWorld)
 //{
 //	SetAttribute("world", InWorld->GetPathName());
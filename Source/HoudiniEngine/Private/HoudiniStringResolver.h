@@ -30,6 +30,14 @@
 
 #include "HoudiniStringResolver.generated.h"
 
+// Key funcs for maps of strings keyed on format templates, which must be matched case-sensitively
+struct FHoudiniStringTemplateKeyFuncs : BaseKeyFuncs<TPair<FString, FString>, FString, false>
+{
+	static const FString& GetSetKey(const TPair<FString, FString>& InElement) { return InElement.Key; }
+	static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static uint32 GetKeyHash(const FString& InKey) { return FCrc::StrCrc32(*InKey); }
+};
+
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniStringResolver
 {
@@ -41,13 +49,17 @@ protected:
 	// Named arguments that will be substituted into attribute values upon retrieval.
 	TMap<FString, FStringFormatArg> CachedTokens;
 
+	// Strings already resolved with the current tokens, keyed on their template.
+	mutable TMap<FString, FString, FDefaultSetAllocator, FHoudiniStringTemplateKeyFuncs> ResolvedStrings;
 
 public:
 	// ----------------------------------
 	// Named argument accessors
 	// ----------------------------------
 
-	TMap<FString, FStringFormatArg>& GetCachedTokens() { return CachedTokens; }
+	// The tokens can be modified through the returned reference, so this drops the resolved strings.
+	TMap<FString, FStringFormatArg>& GetCachedTokens() { ResolvedStrings.Reset(); return CachedTokens; }
+	const TMap<FString, FStringFormatArg>& GetCachedTokens() const { return CachedTokens; }
 
 
 	// Set a named argument that will be used for argument replacement during GetAttribute calls.
@@ -61,8 +73,17 @@ public:
 	void SetTokensFromStringMap(const TMap<FString, FString>& InValue, bool bClearTokens=true);
 
 	// Resolve a string by substituting `Tokens` as named arguments during string formatting.
+	// Templates are parsed once and shared by all resolvers, results are reused until the tokens change.
 	FString ResolveString(const FString& InStr) const;
 
+	// Drops the parsed templates shared by all resolvers.
+	static void InvalidateStringTemplateCache();
+
+	// Enables/disables the parsed templates and resolved strings. When disabled, every string is
+	// resolved with FString::Format.
+	static void SetStringTemplateCacheEnabled(bool bInEnabled);
+	static bool IsStringTemplateCacheEnabled();
+
 };
 
 
@@ -39,10 +39,119 @@
 
 #include "Animation/Skeleton.h"
 #include "Animation/AnimSequence.h"
+#include "Async/ParallelFor.h"
 #include "ReferenceSkeleton.h"
 #include "Serialization/JsonSerializer.h"
 
 
+void
+FHoudiniComponentSpacePoseEvaluator::Init(const FReferenceSkeleton& InRefSkeleton)
+{
+	const TArray<FMeshBoneInfo>& RefBoneInfo = InRefSkeleton.GetRefBoneInfo();
+
+	TArray<int32> BoneParents;
+	BoneParents.SetNumUninitialized(RefBoneInfo.Num());
+	for (int32 BoneIdx = 0; BoneIdx < RefBoneInfo.Num(); BoneIdx++)
+		BoneParents[BoneIdx] = RefBoneInfo[BoneIdx].ParentIndex;
+
+	Init(BoneParents);
+}
+
+void
+FHoudiniComponentSpacePoseEvaluator::Init(const TArray<int32>& InParentIndices)
+{
+	const int32 NumBones = InParentIndices.Num();
+	ParentIndices = InParentIndices;
+	EvaluationOrder.Reset(NumBones);
+
+	// Bones with an invalid parent are treated as roots
+	bool bParentsFirst = true;
+	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+	{
+		int32& ParentIdx = ParentIndices[BoneIdx];
+		if (!ParentIndices.IsValidIndex(ParentIdx) || ParentIdx == BoneIdx)
+			ParentIdx = INDEX_NONE;
+		else if (ParentIdx > BoneIdx)
+			bParentsFirst = false;
+	}
+
+	// Reference skeletons always store parents before their children
+	if (bParentsFirst)
+	{
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+			EvaluationOrder.Add(BoneIdx);
+		return;
+	}
+
+	// Otherwise, walk the hierarchy down from the roots
+	TArray<TArray<int32>> Children;
+	Children.SetNum(NumBones);
+	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+	{
+		if (ParentIndices[BoneIdx] == INDEX_NONE)
+			EvaluationOrder.Add(BoneIdx);
+		else
+			Children[ParentIndices[BoneIdx]].Add(BoneIdx);
+	}
+
+	for (int32 OrderIdx = 0; OrderIdx < EvaluationOrder.Num(); OrderIdx++)
+		EvaluationOrder.Append(Children[EvaluationOrder[OrderIdx]]);
+
+	// Bones left out are part of a cycle, treat them as roots
+	if (EvaluationOrder.Num() < NumBones)
+	{
+		TBitArray<> Visited(false, NumBones);
+		for (const int32& BoneIdx : EvaluationOrder)
+			Visited[BoneIdx] = true;
+
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+		{
+			if (Visited[BoneIdx])
+				continue;
+
+			HOUDINI_LOG_WARNING(TEXT("Bone %d is part of a cycle in the bone hierarchy, treating it as a root."), BoneIdx);
+			ParentIndices[BoneIdx] = INDEX_NONE;
+			EvaluationOrder.Add(BoneIdx);
+		}
+	}
+}
+
+void
+FHoudiniComponentSpacePoseEvaluator::Evaluate(TArrayView<const FTransform> InLocalTransforms, TArrayView<FTransform> OutComponentSpaceTransforms) const
+{
+	check(InLocalTransforms.Num() == ParentIndices.Num() && OutComponentSpaceTransforms.Num() == ParentIndices.Num());
+
+	for (const int32& BoneIdx : EvaluationOrder)
+	{
+		const int32 ParentIdx = ParentIndices[BoneIdx];
+		if (ParentIdx == INDEX_NONE)
+			OutComponentSpaceTransforms[BoneIdx] = InLocalTransforms[BoneIdx];
+		else
+			OutComponentSpaceTransforms[BoneIdx] = InLocalTransforms[BoneIdx] * OutComponentSpaceTransforms[ParentIdx];
+	}
+}
+
+void
+FHoudiniComponentSpacePoseEvaluator::EvaluateFrames(const TArray<FTransform>& InLocalTransforms, const int32& InNumFrames, TArray<FTransform>& OutComponentSpaceTransforms) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniComponentSpacePoseEvaluator::EvaluateFrames);
+
+	const int32 NumBones = ParentIndices.Num();
+	check(InLocalTransforms.Num() == NumBones * InNumFrames);
+
+	OutComponentSpaceTransforms.SetNumUninitialized(NumBones * InNumFrames);
+	if (NumBones <= 0)
+		return;
+
+	// Each frame only depends on its own local transforms
+	ParallelFor(InNumFrames, [&](int32 FrameIdx)
+	{
+		Evaluate(
+			TArrayView<const FTransform>(InLocalTransforms.GetData() + FrameIdx * NumBones, NumBones),
+			TArrayView<FTransform>(OutComponentSpaceTransforms.GetData() + FrameIdx * NumBones, NumBones));
+	});
+}
+
 bool
 FUnrealAnimationTranslator::SetAnimationDataOnNode(
 	UAnimSequence* Animation,
@@ -327,7 +436,7 @@ FUnrealAnimationTranslator::GetCompSpaceTransformForBone(const FReferenceSkeleto
 {
 	FTransform resultBoneTransform = InSkel.GetRefBonePose()[InBoneIdx];
 
-	auto refBoneInfo = InSkel.GetRefBoneInfo();
+	const auto& refBoneInfo = InSkel.GetRefBoneInfo();
 
 	int32 Bone = InBoneIdx;
 	while (Bone)
@@ -349,7 +458,7 @@ FUnrealAnimationTranslator::GetCompSpacePoseTransformForBoneMap(const TMap<int,F
 		resultBoneTransform = BoneMap.FindChecked(InBoneIdx);
 	}
 
-	auto refBoneInfo = InSkel.GetRefBoneInfo();
+	const auto& refBoneInfo = InSkel.GetRefBoneInfo();
 
 	int32 Bone = InBoneIdx;
 	while (Bone)
@@ -378,7 +487,7 @@ FUnrealAnimationTranslator::GetCompSpacePoseTransformForBone(const TArray<FTrans
 	//FTransform resultBoneTransform = InSkel.GetRefBonePose()[InBoneIdx];
 	FTransform resultBoneTransform = Bones[InBoneIdx];
 
-	auto refBoneInfo = InSkel.GetRefBoneInfo();
+	const auto& refBoneInfo = InSkel.GetRefBoneInfo();
 
 	int32 Bone = InBoneIdx;
 	while (Bone)
@@ -396,20 +505,17 @@ FUnrealAnimationTranslator::GetCompSpacePoseTransformForBone(const TArray<FTrans
 void
 FUnrealAnimationTranslator::GetComponentSpaceTransforms(TArray<FTransform>& OutResult, const FReferenceSkeleton& InRefSkeleton)
 {
-	const int32 PoseNum = InRefSkeleton.GetRefBonePose().Num();
-	OutResult.SetNum(PoseNum);
-
-	for (int32 i = 0; i < PoseNum; i++)
-	{
-		OutResult[i] = FUnrealAnimationTranslator::GetCompSpaceTransformForBone(InRefSkeleton, i);
+	FHoudiniComponentSpacePoseEvaluator PoseEvaluator;
+	PoseEvaluator.Init(InRefSkeleton);
 
-	}
+	OutResult.SetNumUninitialized(PoseEvaluator.GetNumBones());
+	PoseEvaluator.Evaluate(InRefSkeleton.GetRefBonePose(), OutResult);
 }
 
 FString FUnrealAnimationTranslator::GetBonePathForBone(const FReferenceSkeleton& InSkel, const int32& InBoneIdx)
 {
 	FString BonePath;
-	auto refBoneInfo = InSkel.GetRefBoneInfo();
+	const auto& refBoneInfo = InSkel.GetRefBoneInfo();
 
 	int32 Bone = InBoneIdx;
 	TArray<int32> Indices;
@@ -495,7 +601,9 @@ FUnrealAnimationTranslator::AddBoneTracksToNode(HAPI_NodeId& NewNodeId, UAnimSeq
 	TArray<FString> BonePaths;
 	TArray<FString> UnrealSkeletonPaths;
 	
-	TArray< TMap<int, FTransform>> Frames;
+	// Local transforms of all the skeleton's bones for each key, bones without a track use identity.
+	TArray<FTransform> LocalPoses;
+	LocalPoses.Init(FTransform::Identity, RefBoneCount * TotalTrackKeys);
 	TMap<int, int> BoneIndexCounterMap;
 	// AnimCurve data is stored in the fbx_custom_attributes dictionary which is stored on root joints for each frame
 	// For any joint that is not the "root" join, the dict can be empty.
@@ -520,26 +628,31 @@ FUnrealAnimationTranslator::AddBoneTracksToNode(HAPI_NodeId& NewNodeId, UAnimSeq
 		}
 	}
 
-	for (int KeyFrame = 0; KeyFrame < TotalTrackKeys; KeyFrame++)
 	{
 		int32 BoneIndex = 0;
-		TArray<FTransform> KeyBoneTransforms;
-		//for each bone
-		TMap<int, FTransform> SingleFrame;
 		for (const FMeshBoneInfo& MeshBoneInfo : RefSkeleton.GetRefBoneInfo())
 		{
 			//add that tracks keys
-			if (TrackMap.Contains(MeshBoneInfo.Name))
+			if (const TArray<FTransform>* TransformArray = TrackMap.Find(MeshBoneInfo.Name))
 			{
-				TArray<FTransform>& TransformArray = TrackMap[MeshBoneInfo.Name];
-				FTransform KeyBoneTransform = TransformArray[KeyFrame];
-				KeyBoneTransforms.Add(KeyBoneTransform);
-				SingleFrame.Add(BoneIndex, KeyBoneTransform);
+				for (int KeyFrame = 0; KeyFrame < TotalTrackKeys && KeyFrame < TransformArray->Num(); KeyFrame++)
+					LocalPoses[KeyFrame * RefBoneCount + BoneIndex] = (*TransformArray)[KeyFrame];
 			}
-			
+
 			BoneIndex++;
 		}
+	}
+
+	// Evaluate the component space transforms of all the bones, for all keys, in one pass.
+	TArray<FTransform> ComponentSpacePoses;
+	{
+		FHoudiniComponentSpacePoseEvaluator PoseEvaluator;
+		PoseEvaluator.Init(RefSkeleton);
+		PoseEvaluator.EvaluateFrames(LocalPoses, TotalTrackKeys, ComponentSpacePoses);
+	}
 
+	for (int KeyFrame = 0; KeyFrame < TotalTrackKeys; KeyFrame++)
+	{
 		if (RootBoneIndex != INDEX_NONE)
 		{
 			// Sample anim curves and store the data on the root bone for this keyframe.
@@ -565,8 +678,6 @@ FUnrealAnimationTranslator::AddBoneTracksToNode(HAPI_NodeId& NewNodeId, UAnimSeq
 			
 			FbxCustomAttributes[DataIndex] = FHoudiniEngineUtils::JSONToString(JSONObject);
 		}
-		
-		Frames.Add(SingleFrame);
 	}
 	TArray<int32> FrameIndexData;
 	TArray<float> TimeData;
@@ -579,6 +690,10 @@ FUnrealAnimationTranslator::AddBoneTracksToNode(HAPI_NodeId& NewNodeId, UAnimSeq
 	{
 		BoneInfos.Add(MeshBoneInfo.Name, MeshBoneInfo);
 	}
+
+	// Bone paths only depend on the bone, not on the frame
+	TArray<FString> BonePathsByRefIndex;
+	BonePathsByRefIndex.SetNum(RefBoneCount);
 	
 	//For Each Key Frame ( eg 1-60)
 	// We'll be using the FrameOffset to inject the first frame twice for the MotionClip topology frame.
@@ -600,15 +715,11 @@ FUnrealAnimationTranslator::AddBoneTracksToNode(HAPI_NodeId& NewNodeId, UAnimSeq
 			//add that tracks keys
 			if (TrackMap.Contains(MeshBoneInfo.Name))
 			{
-				FTransform PoseTransform = FUnrealAnimationTranslator::GetCompSpacePoseTransformForBoneMap(Frames[FrameIndex+FrameOffset], RefSkeleton, BoneRefIndex);
+				const int32 PoseOffset = (FrameIndex + FrameOffset) * RefBoneCount;
+				FTransform PoseTransform = ComponentSpacePoses[PoseOffset + BoneRefIndex];
 
 				//alt
 				FTransform LocalBoneTransform = FTransform::Identity;
-				TMap<int, FTransform>& BoneTransformMap = Frames[FrameIndex+FrameOffset];
-				if (!BoneTransformMap.Contains(BoneRefIndex))
-				{
-					LocalBoneTransform = BoneTransformMap.FindChecked(BoneRefIndex);
-				}
 
 				TArray<FTransform>& TransformArray = TrackMap[MeshBoneInfo.Name];
 
@@ -666,7 +777,7 @@ FUnrealAnimationTranslator::AddBoneTracksToNode(HAPI_NodeId& NewNodeId, UAnimSeq
 						ParentBoneIndex = RefSkeleton.GetParentIndex(BoneRefIndex);
 					}
 
-					FTransform ParentPoseTransform = GetCompSpacePoseTransformForBoneMap(Frames[FrameIndex+FrameOffset], RefSkeleton, ParentBoneIndex);
+					const FTransform& ParentPoseTransform = ComponentSpacePoses[PoseOffset + ParentBoneIndex];
 					
 					FQuat QBone = PoseTransform.GetRotation();
 					QBone = FQuat(QBone.X, QBone.Z, QBone.Y, -QBone.W) * FQuat::MakeFromEuler({ 90.f, 0.f, 0.f });
@@ -751,7 +862,10 @@ FUnrealAnimationTranslator::AddBoneTracksToNode(HAPI_NodeId& NewNodeId, UAnimSeq
 					PrimitiveCount++;
 				}
 				BoneNames.Add(MeshBoneInfo.Name.ToString());
-				BonePaths.Add(GetBonePathForBone(RefSkeleton, BoneRefIndex));
+				FString& BonePath = BonePathsByRefIndex[BoneRefIndex];
+				if (BonePath.IsEmpty())
+					BonePath = GetBonePathForBone(RefSkeleton, BoneRefIndex);
+				BonePaths.Add(BonePath);
 				UnrealSkeletonPaths.Add(SkeletonPathName);
 			}
 			else
@@ -33,6 +33,30 @@ class UAnimSequence;
 class FUnrealObjectInputHandle;
 struct FReferenceSkeleton;
 
+// Converts local bone transforms to component space. The bones are visited once in parent-first
+// order, each bone using its parent's already computed component space transform, over flat arrays.
+struct HOUDINIENGINE_API FHoudiniComponentSpacePoseEvaluator
+{
+	public:
+		// Builds the evaluation order from the reference skeleton's bone hierarchy.
+		void Init(const FReferenceSkeleton& InRefSkeleton);
+		// Builds the evaluation order from each bone's parent index (INDEX_NONE for roots).
+		void Init(const TArray<int32>& InParentIndices);
+
+		int32 GetNumBones() const { return ParentIndices.Num(); }
+
+		// Evaluates one pose. InLocalTransforms and OutComponentSpaceTransforms hold one transform per bone.
+		void Evaluate(TArrayView<const FTransform> InLocalTransforms, TArrayView<FTransform> OutComponentSpaceTransforms) const;
+
+		// Evaluates InNumFrames consecutive poses of GetNumBones() transforms each, in parallel.
+		void EvaluateFrames(const TArray<FTransform>& InLocalTransforms, const int32& InNumFrames, TArray<FTransform>& OutComponentSpaceTransforms) const;
+
+	private:
+		TArray<int32> ParentIndices;
+		// Bone indices, parents always before their children
+		TArray<int32> EvaluationOrder;
+};
+
 struct HOUDINIENGINE_API FUnrealAnimationTranslator
 {
 	public:
@@ -155,7 +155,11 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	TArray<ABrush*> BrushActors;
 	UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(InputBrushObject, BrushActors);
 	
-	UModel* BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors);
+	// Unchanged brush sets reuse the model built on a previous upload
+	UModel* BrushModel = UHCsgUtils::FindOrBuildModelFromBrushes(BrushActors);
+	if (!IsValid(BrushModel))
+		return false;
+
 	InputBrushObject->UpdateCachedData(BrushModel, BrushActors);
 	
 	// DEBUG: Upload the level model (baked by UE) to Houdini
@@ -12,6 +12,7 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniGeoImporter.h"
+#include "HoudiniHashUtils.h"
 #include "HoudiniInput.h"
 #include "HoudiniInputObject.h"
 #include "HoudiniInputTranslator.h"
@@ -543,6 +544,7 @@ UHoudiniEditorNodeSyncSubsystem::FetchFromHoudini()
 	
 	LastFetchStatus = EHoudiniNodeSyncStatus::Running;
 	FetchStatusMessage = "Fetching...";
+	LastFetchImportedPaths.Empty();
 
  	if (!CreateSessionIfNeeded())
 	{
@@ -600,6 +602,45 @@ UHoudiniEditorNodeSyncSubsystem::FetchFromHoudini()
 				}
 			}
 
+			// Settings used to create the meshes
+			const FHoudiniStaticMeshGenerationProperties StaticMeshGenerationProperties = FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
+			const FMeshBuildSettings MeshBuildSettings = FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
+
+			// Keep the content of the nodes and the import options, so we can skip this path on the next fetch if none changed
+			FHoudiniNodeSyncFetchedPath CurrentFetch;
+			{
+				const bool ImportFlags[] = { NodeSyncOptions.bUseOutputNodes, NodeSyncOptions.bOverwriteSkeleton };
+				uint64 OptionsHash = FHoudiniHashUtils::HashString(0, NodeSyncOptions.UnrealAssetFolder);
+				OptionsHash = FHoudiniHashUtils::HashString(OptionsHash, NodeSyncOptions.GetUnrealAssetName(PathIdx));
+				OptionsHash = FHoudiniHashUtils::HashString(OptionsHash, NodeSyncOptions.SkeletonAssetPath);
+				OptionsHash = FHoudiniHashUtils::HashBytes(OptionsHash, ImportFlags, sizeof(ImportFlags));
+				OptionsHash = FHoudiniHashUtils::HashStruct(OptionsHash, StaticMeshGenerationProperties);
+				OptionsHash = FHoudiniHashUtils::HashStruct(OptionsHash, MeshBuildSettings);
+				CurrentFetch.OptionsHash = OptionsHash;
+			}
+
+			bool bHasFetchedNodeStates = true;
+			for (auto CurrentNodeId : FetchNodeIds)
+			{
+				if (!GetFetchedNodeState(CurrentNodeId, CurrentFetch.Nodes.AddDefaulted_GetRef()))
+					bHasFetchedNodeStates = false;
+			}
+
+			// Creating new assets must create them on every fetch
+			if (bHasFetchedNodeStates && NodeSyncOptions.bOnlyFetchChangedNodes && NodeSyncOptions.bReplaceExisting)
+			{
+				const FHoudiniNodeSyncFetchedPath* PreviousFetch = FetchedPaths.Find(CurrentFetchNodePath);
+				if (PreviousFetch && PreviousFetch->IsUpToDate(CurrentFetch))
+				{
+					HOUDINI_LOG_MESSAGE(TEXT("Houdini Node Sync: %s hasn't changed since the last fetch, keeping its assets."), *CurrentFetchNodePath);
+					bSuccess = true;
+					continue;
+				}
+			}
+
+			FetchedPaths.Remove(CurrentFetchNodePath);
+			LastFetchImportedPaths.Add(CurrentFetchNodePath);
+
 			// Parent obj node that will contain all the merge nodes used for the import
 			// This will make cleaning up the fetch node easier
 			TArray<HAPI_NodeId> CreatedNodeIds;
@@ -686,8 +727,6 @@ UHoudiniEditorNodeSyncSubsystem::FetchFromHoudini()
 			}
 
 			// 5. Create all the objects using the outputs
-			const FHoudiniStaticMeshGenerationProperties& StaticMeshGenerationProperties = FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
-			const FMeshBuildSettings& MeshBuildSettings = FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
 			if (!HoudiniGeoImporter->CreateObjectsFromOutputs(NewOutputs, PackageParams, StaticMeshGenerationProperties, MeshBuildSettings))
 				return FailImportAndReturn();
 
@@ -705,6 +744,17 @@ UHoudiniEditorNodeSyncSubsystem::FetchFromHoudini()
 
 			CleanUp();
 
+			if (bHasFetchedNodeStates)
+			{
+				for (UObject* Object : Results)
+				{
+					if (IsValid(Object))
+						CurrentFetch.OutputObjects.Add(Object);
+				}
+
+				FetchedPaths.Add(CurrentFetchNodePath, MoveTemp(CurrentFetch));
+			}
+
 			// Sync the content browser to the newly created assets
 			if (GEditor)
 				GEditor->SyncBrowserToObjects(Results);
@@ -1025,6 +1075,46 @@ UHoudiniEditorNodeSyncSubsystem::GatherAllFetchedNodeIds(
 }
 
 
+bool
+UHoudiniEditorNodeSyncSubsystem::GetFetchedNodeState(
+	HAPI_NodeId InNodeId,
+	FHoudiniNodeSyncFetchedNode& OutNodeState)
+{
+	// Cook counts and node ids can repeat (e.g. after restarting the session), so compare the geometry itself
+	if (!FHoudiniEngineUtils::HapiGetAbsNodePath(InNodeId, OutNodeState.NodePath))
+		return false;
+
+	return FHoudiniEngineUtils::HapiGetGeoContentHash(InNodeId, OutNodeState.ContentHash);
+}
+
+
+void
+UHoudiniEditorNodeSyncSubsystem::InvalidateFetchedNodes()
+{
+	FetchedPaths.Empty();
+}
+
+
+bool
+FHoudiniNodeSyncFetchedPath::IsUpToDate(const FHoudiniNodeSyncFetchedPath& InFetch) const
+{
+	if (OptionsHash != InFetch.OptionsHash || Nodes != InFetch.Nodes)
+		return false;
+
+	// The assets must still be there to be kept
+	if (OutputObjects.Num() <= 0)
+		return false;
+
+	for (const TWeakObjectPtr<UObject>& OutputObject : OutputObjects)
+	{
+		if (!OutputObject.IsValid())
+			return false;
+	}
+
+	return true;
+}
+
+
 FLinearColor
 UHoudiniEditorNodeSyncSubsystem::GetStatusColor(const EHoudiniNodeSyncStatus& Status)
 {
@@ -72,11 +72,16 @@
 #include "Containers/UnrealString.h"
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
+#include "ISourceControlModule.h"
+#include "UObject/SavePackage.h"
 #include "EditorLevelUtils.h"
 #include "Engine/LevelBounds.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SkeletalMesh.h"
 #include "Engine/StaticMesh.h"
+#include "Engine/Texture.h"
+#include "MeshDescription.h"
+#include "StaticMeshResources.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/World.h"
 #include "Engine/WorldComposition.h"
@@ -118,9 +123,15 @@
 #include "Math/Box.h"
 #include "Misc/Paths.h"
 #include "Misc/ScopedSlowTask.h"
+#include "ScopedTransaction.h"
+#include "Containers/Ticker.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
 #include "PackageTools.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "Serialization/ArchiveUObject.h"
+#include "Serialization/MemoryWriter.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "RawMesh.h"
 #include "SkeletalMeshTypes.h"
@@ -282,6 +293,205 @@ FHoudiniEngineBakedActor::FHoudiniEngineBakedActor(
 {
 }
 
+// Spawns the remaining instanced actors of an actor instancer output over the next ticks, one batch per tick, so that
+// the editor stays responsive during large bakes. Each batch is its own undo transaction. The baked actors are added
+// to the HAC's bake output as they are spawned, and their packages are saved once they have all been spawned.
+// A notification shows the progress, and lets the user stop the bake: the actors baked so far are kept.
+class FHoudiniDeferredInstancedActorsBake : public TSharedFromThis<FHoudiniDeferredInstancedActorsBake>
+{
+public:
+	TWeakObjectPtr<UHoudiniAssetComponent> HAC;
+	int32 OutputIndex = INDEX_NONE;
+	FHoudiniOutputObjectIdentifier OutputObjectIdentifier;
+	TWeakObjectPtr<UHoudiniInstancedActorComponent> IAC;
+	// The instances that are left to bake
+	TArray<TWeakObjectPtr<AActor>> InstancedActors;
+	TWeakObjectPtr<ULevel> Level;
+	TWeakObjectPtr<AActor> ParentActor;
+	FHoudiniPackageParams PackageParams;
+	FHoudiniGeoPartObject InstancerHGPO;
+	FName WorldOutlinerFolderPath;
+	int32 BatchSize = 1;
+
+	static void Start(const TSharedRef<FHoudiniDeferredInstancedActorsBake>& InBake);
+
+	// Bakes the remaining instances of all the deferred bakes of InHAC now, so that a new bake of InHAC starts
+	// from a complete bake output.
+	static void FinishAll(const UHoudiniAssetComponent* InHAC);
+
+private:
+	bool Tick(float DeltaTime);
+
+	// Bakes up to InNumInstances of the remaining instances. Returns false if the bake cannot continue.
+	bool BakeBatch(int32 InNumInstances);
+
+	void Cancel();
+
+	// Saves the baked packages and removes the bake from the active ones
+	void Stop(const FText& InMessage, SNotificationItem::ECompletionState InCompletionState);
+
+	FText GetProgressText() const;
+
+	int32 NextInstance = 0;
+	FHoudiniBakedObjectData BakedObjectData;
+	FTSTicker::FDelegateHandle TickerHandle;
+	TWeakPtr<SNotificationItem> NotificationPtr;
+
+	static TArray<TSharedRef<FHoudiniDeferredInstancedActorsBake>> ActiveBakes;
+};
+
+TArray<TSharedRef<FHoudiniDeferredInstancedActorsBake>> FHoudiniDeferredInstancedActorsBake::ActiveBakes;
+
+void
+FHoudiniDeferredInstancedActorsBake::Start(const TSharedRef<FHoudiniDeferredInstancedActorsBake>& InBake)
+{
+	if (InBake->InstancedActors.Num() <= 0)
+		return;
+
+	ActiveBakes.Add(InBake);
+	InBake->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateSP(InBake, &FHoudiniDeferredInstancedActorsBake::Tick));
+
+	FNotificationInfo Info(InBake->GetProgressText());
+	Info.bFireAndForget = false;
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("StopDeferredInstancedActorsBake", "Stop"),
+		LOCTEXT("StopDeferredInstancedActorsBakeTooltip", "Stop baking the remaining instances. The instances baked so far are kept."),
+		FSimpleDelegate::CreateSP(InBake, &FHoudiniDeferredInstancedActorsBake::Cancel),
+		SNotificationItem::CS_Pending));
+	InBake->NotificationPtr = FSlateNotificationManager::Get().AddNotification(Info);
+
+	TSharedPtr<SNotificationItem> Notification = InBake->NotificationPtr.Pin();
+	if (Notification.IsValid())
+		Notification->SetCompletionState(SNotificationItem::CS_Pending);
+}
+
+void
+FHoudiniDeferredInstancedActorsBake::FinishAll(const UHoudiniAssetComponent* InHAC)
+{
+	// Stop() removes the bakes from the active ones
+	const TArray<TSharedRef<FHoudiniDeferredInstancedActorsBake>> Bakes = ActiveBakes;
+	for (const TSharedRef<FHoudiniDeferredInstancedActorsBake>& Bake : Bakes)
+	{
+		if (Bake->HAC.Get() != InHAC)
+			continue;
+
+		FScopedSlowTask Progress(0.0f, Bake->GetProgressText());
+		Progress.MakeDialog();
+
+		const bool bFinished = Bake->BakeBatch(Bake->InstancedActors.Num() - Bake->NextInstance);
+		Bake->Stop(
+			bFinished ? LOCTEXT("DeferredInstancedActorsBakeFinished", "Finished baking instanced actors.")
+			          : LOCTEXT("DeferredInstancedActorsBakeAborted", "Baking instanced actors stopped: the instancer changed."),
+			bFinished ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+	}
+}
+
+bool
+FHoudiniDeferredInstancedActorsBake::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniDeferredInstancedActorsBake::Tick);
+
+	if (!BakeBatch(BatchSize))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Baking instanced actors stopped after %d of %d instances: the instancer changed."),
+			NextInstance, InstancedActors.Num());
+		Stop(LOCTEXT("DeferredInstancedActorsBakeAborted", "Baking instanced actors stopped: the instancer changed."), SNotificationItem::CS_Fail);
+		return false;
+	}
+
+	if (NextInstance >= InstancedActors.Num())
+	{
+		Stop(LOCTEXT("DeferredInstancedActorsBakeFinished", "Finished baking instanced actors."), SNotificationItem::CS_Success);
+		return false;
+	}
+
+	TSharedPtr<SNotificationItem> Notification = NotificationPtr.Pin();
+	if (Notification.IsValid())
+		Notification->SetText(GetProgressText());
+
+	return true;
+}
+
+bool
+FHoudiniDeferredInstancedActorsBake::BakeBatch(int32 InNumInstances)
+{
+	UHoudiniAssetComponent* HoudiniAssetComponent = HAC.Get();
+	UHoudiniInstancedActorComponent* InIAC = IAC.Get();
+	ULevel* DesiredLevel = Level.Get();
+	if (!IsValid(HoudiniAssetComponent) || !IsValid(InIAC) || !IsValid(DesiredLevel))
+		return false;
+
+	TArray<FHoudiniBakedOutput>& BakedOutputs = HoudiniAssetComponent->GetBakedOutputs();
+	FHoudiniBakedOutputObject* BakedOutputObject = BakedOutputs.IsValidIndex(OutputIndex)
+		? BakedOutputs[OutputIndex].BakedOutputObjects.Find(OutputObjectIdentifier)
+		: nullptr;
+	if (!BakedOutputObject)
+		return false;
+
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+	const FScopedTransaction BatchTransaction(LOCTEXT("BakeInstancedActors", "Bake Instanced Actors"));
+
+	const int32 BatchEnd = FMath::Min(NextInstance + InNumInstances, InstancedActors.Num());
+	for (; NextInstance < BatchEnd; ++NextInstance)
+	{
+		// The instance is gone if the instancer was recooked or cleared since the bake started
+		AActor* CurrentInstancedActor = InstancedActors[NextInstance].Get();
+		if (!IsValid(CurrentInstancedActor))
+			return false;
+
+		AActor* NewActor = FHoudiniEngineBakeUtils::BakeInstancedActor(
+			CurrentInstancedActor, InIAC, DesiredLevel, PackageParams, InstancerHGPO,
+			WorldOutlinerFolderPath, ParentActor.Get(), BakedObjectData);
+		if (IsValid(NewActor))
+			BakedOutputObject->InstancedActors.Add(FSoftObjectPath(NewActor).ToString());
+	}
+
+	return true;
+}
+
+void
+FHoudiniDeferredInstancedActorsBake::Cancel()
+{
+	HOUDINI_LOG_WARNING(TEXT("Baking instanced actors stopped by the user after %d of %d instances."),
+		NextInstance, InstancedActors.Num());
+	Stop(LOCTEXT("DeferredInstancedActorsBakeCancelled", "Baking instanced actors stopped."), SNotificationItem::CS_None);
+}
+
+void
+FHoudiniDeferredInstancedActorsBake::Stop(const FText& InMessage, SNotificationItem::ECompletionState InCompletionState)
+{
+	// Keeps this alive until the end of the function
+	const TSharedRef<FHoudiniDeferredInstancedActorsBake> This = AsShared();
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
+
+	TSharedPtr<SNotificationItem> Notification = NotificationPtr.Pin();
+	if (Notification.IsValid())
+	{
+		Notification->SetText(InMessage);
+		Notification->SetCompletionState(InCompletionState);
+		Notification->ExpireAndFadeout();
+	}
+	NotificationPtr.Reset();
+
+	ActiveBakes.Remove(This);
+}
+
+FText
+FHoudiniDeferredInstancedActorsBake::GetProgressText() const
+{
+	return FText::Format(
+		LOCTEXT("DeferredInstancedActorsBakeProgress", "Baking instanced actors of {0}: {1} / {2}"),
+		FText::FromString(PackageParams.ObjectName), FText::AsNumber(NextInstance), FText::AsNumber(InstancedActors.Num()));
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	UHoudiniAssetComponent* InHACToBake,
@@ -300,6 +510,14 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 		return false;
 	}
 
+	// A previous bake of the HAC might still be spawning instanced actors
+	FHoudiniDeferredInstancedActorsBake::FinishAll(InHACToBake);
+
+	// The remaining instanced actors are copied from the HAC's instancers over the next ticks, so they can only be
+	// deferred if the HAC's outputs are kept. Blueprints are built from all the baked actors when the bake returns.
+	if (InBakeOption != EHoudiniEngineBakeOption::ToActor || bInRemoveHACOutputOnSuccess)
+		BakeSettings.bDeferInstancedActors = false;
+
 	bool bSuccess = false;
 	switch (InBakeOption)
 	{
@@ -345,7 +563,7 @@ FHoudiniEngineBakeUtils::BakeHDAToActors(
 	}
 
 	// Save the created packages
-	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
+	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
 
 	// Recenter and select the baked actors
 	if (GEditor && NewActors.Num() > 0)
@@ -395,6 +613,9 @@ FHoudiniEngineBakeUtils::BakeHDAToActors(
 	if (!IsValid(HoudiniAssetComponent))
 		return false;
 
+	// A previous bake of the HAC might still be spawning instanced actors
+	FHoudiniDeferredInstancedActorsBake::FinishAll(HoudiniAssetComponent);
+
 	// Get an array of the outputs
 	const int32 NumOutputs = HoudiniAssetComponent->GetNumOutputs();
 	TArray<UHoudiniOutput*> Outputs;
@@ -489,6 +710,8 @@ FHoudiniEngineBakeUtils::BakeHoudiniOutputsToActors(
 	AActor* InFallbackActor,
 	const FString& InFallbackWorldOutlinerFolder)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	const int32 NumOutputs = InOutputs.Num();
 	
 	const FString MsgTemplate = TEXT("Baking output: {0}/{1}.");
@@ -522,6 +745,9 @@ FHoudiniEngineBakeUtils::BakeHoudiniOutputsToActors(
 	TArray<FHoudiniEngineBakedActor> OutputBakedActors;
 	for (int32 OutputIdx = 0; OutputIdx < NumOutputs; ++OutputIdx)
 	{
+		if (BakedObjectData.bBakeCancelled)
+			break;
+
 		UHoudiniOutput* Output = InOutputs[OutputIdx];
 		if (!IsValid(Output))
 		{
@@ -701,6 +927,9 @@ FHoudiniEngineBakeUtils::BakeHoudiniOutputsToActors(
 
 	    for (int32 OutputIdx = 0; OutputIdx < NumOutputs; ++OutputIdx)
 		{
+			if (BakedObjectData.bBakeCancelled)
+				break;
+
 			UHoudiniOutput* Output = InOutputs[OutputIdx];
 			if (!IsValid(Output))
 			{
@@ -1071,6 +1300,9 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors(
 
 		for(auto Component : CurrentOutputObject.OutputComponents)
 		{
+		    if (BakedObjectData.bBakeCancelled)
+			    break;
+
 		    if (!IsValid(Component))
 			    continue;
 
@@ -1756,6 +1988,18 @@ bool FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_LevelInstances(
 #endif
 }
 
+// Adds the external package of InActor (World Partition / one file per actor levels) to the packages to save
+static void
+AddExternalActorPackageToSave(AActor* InActor, FHoudiniBakedObjectData& BakedObjectData)
+{
+	if (!IsValid(InActor))
+		return;
+
+	UPackage* ExternalPackage = InActor->GetExternalPackage();
+	if (IsValid(ExternalPackage))
+		BakedObjectData.PackagesToSave.Add(ExternalPackage);
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_SMC(
 	const UHoudiniAssetComponent* HoudiniAssetComponent,
@@ -2041,6 +2285,7 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_SMC(
 	    }
 	    
 	    BakedOutputObject.Actor = FSoftObjectPath(FoundActor).ToString();
+	    AddExternalActorPackageToSave(FoundActor, BakedObjectData);
 	    FHoudiniEngineBakedActor OutputEntry(
 		    FoundActor,
 		    BakeActorName,
@@ -2075,6 +2320,66 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_SMC(
 }
 
 
+AActor*
+FHoudiniEngineBakeUtils::BakeInstancedActor(
+	AActor* InInstancedActor,
+	UHoudiniInstancedActorComponent* InIAC,
+	ULevel* InLevel,
+	const FHoudiniPackageParams& InPackageParams,
+	const FHoudiniGeoPartObject& InInstancerHGPO,
+	const FName& InWorldOutlinerFolderPath,
+	AActor* InParentActor,
+	FHoudiniBakedObjectData& BakedObjectData)
+{
+	if (!IsValid(InInstancedActor))
+		return nullptr;
+
+	// Make sure we have a globally unique name and use it to name the new actor at spawn time.
+	const FString NewNameStr = MakeUniqueObjectNameIfNeeded(InLevel, InInstancedActor->GetClass(), InPackageParams.ObjectName);
+
+	FTransform CurrentTransform = InInstancedActor->GetTransform();
+
+	AActor* NewActor = FHoudiniInstanceTranslator::SpawnInstanceActor(CurrentTransform, InLevel, InIAC);
+	if (!IsValid(NewActor))
+		return nullptr;
+
+	// Explicitly set the actor label as there appears to be a bug in AActor::GetActorLabel() which sets the first
+	// duplicate actor name to "name-1" (minus one) instead of leaving off the 0.
+	NewActor->SetActorLabel(NewNameStr);
+
+	// Copy properties from the Instanced object, but only for actors.
+	constexpr auto CopyOptions = static_cast<EditorUtilities::ECopyOptions::Type>(
+		EditorUtilities::ECopyOptions::OnlyCopyEditOrInterpProperties |
+		EditorUtilities::ECopyOptions::PropagateChangesToArchetypeInstances |
+		EditorUtilities::ECopyOptions::CallPostEditChangeProperty |
+		EditorUtilities::ECopyOptions::CallPostEditMove);
+
+	// BUG: CopyActorProperties are not copying properties for components (at least on Blueprint type actors).
+	EditorUtilities::CopyActorProperties(InInstancedActor, NewActor, CopyOptions);
+
+	// TODO: Copy over component properties!
+
+	// Since we can't properly copy over component properties, the least we can do is apply actor and component tags
+	FHoudiniEngineUtils::ApplyTagsToActorAndComponents(
+		NewActor, FHoudiniEngineUtils::IsKeepTagsEnabled(&InInstancerHGPO), InInstancerHGPO.GenericPropertyAttributes);
+
+	BakedObjectData.BakeStats.NotifyObjectsCreated(NewActor->GetClass()->GetName(), 1);
+
+	SetOutlinerFolderPath(NewActor, InWorldOutlinerFolderPath);
+	NewActor->SetActorTransform(CurrentTransform);
+
+	if (InParentActor)
+	{
+		NewActor->AttachToActor(InParentActor, FAttachmentTransformRules::KeepWorldTransform);
+	}
+
+	// In World Partition levels, the actor was spawned in its own external package:
+	// only that package needs saving, not the whole map.
+	AddExternalActorPackageToSave(NewActor, BakedObjectData);
+
+	return NewActor;
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 	const UHoudiniAssetComponent* HoudiniAssetComponent,
@@ -2095,6 +2400,9 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 
 	for (auto Component : InOutputObject.OutputComponents)
 	{
+		if (BakedObjectData.bBakeCancelled)
+			break;
+
 		UHoudiniInstancedActorComponent* InIAC = Cast<UHoudiniInstancedActorComponent>(Component);
 		if (!IsValid(InIAC))
 		{
@@ -2234,6 +2542,7 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 				BakedObjectData.BakeStats.NotifyObjectsCreated(ParentActor->GetClass()->GetName(), 1);
 
 				ParentActor->SetActorLabel(ParentBakeActorName.ToString());
+				AddExternalActorPackageToSave(ParentActor, BakedObjectData);
 				OutActors.Emplace(FHoudiniEngineBakedActor(
 					ParentActor,
 					ParentActorName,
@@ -2286,74 +2595,94 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 			}
 		}
 
-		// Empty and reserve enough space for new instanced actors
-		BakedOutputObject.InstancedActors.Empty(InIAC->GetInstancedActors().Num());
+		const TArray<AActor*>& InstancedActors = InIAC->GetInstancedActors();
+		const int32 NumInstances = InstancedActors.Num();
 
-		// Iterates on all the instances of the IAC
-		for (AActor* CurrentInstancedActor : InIAC->GetInstancedActors())
-		{
-			if (!IsValid(CurrentInstancedActor))
+		// Empty and reserve enough space for new instanced actors
+		BakedOutputObject.InstancedActors.Empty(NumInstances);
+		OutActors.Reserve(OutActors.Num() + NumInstances);
+
+		// Instances are spawned in batches, each batch being its own undo transaction. Interactive bakes only spawn
+		// the first batch now, and the remaining ones over the next ticks. Otherwise, the progress dialog is updated,
+		// and lets the user cancel the whole bake, between two batches.
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		const int32 BatchSize = FMath::Max(1, HoudiniRuntimeSettings ? HoudiniRuntimeSettings->BakeInstancedActorsBatchSize : 500);
+
+		// Level instances are created from the actors returned by the bake, so they cannot be deferred
+		const bool bDeferRemainingBatches = BakeSettings.bDeferInstancedActors
+			&& NumInstances > BatchSize
+			&& IsValid(HoudiniAssetComponent)
+			&& InOutputObject.LevelInstanceParams.OutputName.IsEmpty();
+		const int32 NumInstancesToBakeNow = bDeferRemainingBatches ? BatchSize : NumInstances;
+
+		FScopedSlowTask InstanceProgress(
+			NumInstancesToBakeNow, FText::Format(LOCTEXT("BakeInstancedActorsProgress", "Baking {0} instanced actors ..."), FText::AsNumber(NumInstances)));
+		InstanceProgress.MakeDialogDelayed(1.0f, true);
+
+		int32 NumBakedInstances = 0;
+		for (int32 BatchStart = 0; BatchStart < NumInstancesToBakeNow; BatchStart += BatchSize)
+		{
+			if (InstanceProgress.ShouldCancel())
 			{
-				continue;
+				HOUDINI_LOG_WARNING(TEXT("Bake cancelled: %d of %d instances of %s were baked, the remaining outputs are skipped."),
+					NumBakedInstances, NumInstances, *InstancedObject->GetName());
+				BakedObjectData.bBakeCancelled = true;
+				break;
 			}
 
-			// Make sure we have a globally unique name and use it to name the new actor at spawn time.
-			const FString NewNameStr = MakeUniqueObjectNameIfNeeded(DesiredLevel, CurrentInstancedActor->GetClass(),
-			                                                        PackageParams.ObjectName);
+			const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, NumInstancesToBakeNow);
+			InstanceProgress.EnterProgressFrame(BatchEnd - BatchStart);
 
-			FTransform CurrentTransform = CurrentInstancedActor->GetTransform();
+			const FScopedTransaction BatchTransaction(LOCTEXT("BakeInstancedActors", "Bake Instanced Actors"));
 
-			AActor* NewActor = FHoudiniInstanceTranslator::SpawnInstanceActor(CurrentTransform, DesiredLevel, InIAC);
-			if (!IsValid(NewActor))
+			for (int32 InstanceIdx = BatchStart; InstanceIdx < BatchEnd; ++InstanceIdx)
 			{
-				continue;
-			}
-
-			// Explicitly set the actor label as there appears to be a bug in AActor::GetActorLabel() which sets the first
-			// duplicate actor name to "name-1" (minus one) instead of leaving off the 0.
-			NewActor->SetActorLabel(NewNameStr);
-
-			// Copy properties from the Instanced object, but only for actors.
-			constexpr auto CopyOptions = static_cast<EditorUtilities::ECopyOptions::Type>(
-				EditorUtilities::ECopyOptions::OnlyCopyEditOrInterpProperties |
-				EditorUtilities::ECopyOptions::PropagateChangesToArchetypeInstances |
-				EditorUtilities::ECopyOptions::CallPostEditChangeProperty |
-				EditorUtilities::ECopyOptions::CallPostEditMove);
-
-			// BUG: CopyActorProperties are not copying properties for components (at least on Blueprint type actors).
-			EditorUtilities::CopyActorProperties(CurrentInstancedActor, NewActor, CopyOptions);
-
-			// TODO: Copy over component properties!
-
-			// Since we can't properly copy over component properties, the least we can do is apply actor and component tags
-			FHoudiniEngineUtils::ApplyTagsToActorAndComponents(
-				NewActor, FHoudiniEngineUtils::IsKeepTagsEnabled(&InstancerHGPO), InstancerHGPO.GenericPropertyAttributes);
+				AActor* NewActor = BakeInstancedActor(
+					InstancedActors[InstanceIdx], InIAC, DesiredLevel, PackageParams, InstancerHGPO,
+					WorldOutlinerFolderPath, ParentActor, BakedObjectData);
+				if (!IsValid(NewActor))
+				{
+					continue;
+				}
 
-			BakedObjectData.BakeStats.NotifyObjectsCreated(NewActor->GetClass()->GetName(), 1);
+				BakedOutputObject.InstancedActors.Add(FSoftObjectPath(NewActor).ToString());
 
-			SetOutlinerFolderPath(NewActor, WorldOutlinerFolderPath);
-			NewActor->SetActorTransform(CurrentTransform);
+				FHoudiniEngineBakedActor& OutputEntry = OutActors.Add_GetRef(FHoudiniEngineBakedActor(
+					NewActor,
+					*PackageParams.ObjectName,
+					WorldOutlinerFolderPath,
+					InOutputIndex,
+					InOutputObjectIdentifier,
+					nullptr,
+					InstancedObject,
+					nullptr,
+					PackageParams.BakeFolder,
+					PackageParams));
+				OutputEntry.bInstancerOutput = true;
+				OutputEntry.InstancerPackageParams = PackageParams;
+				NumBakedInstances++;
+			}
+		}
 
-			if (ParentActor)
+		if (bDeferRemainingBatches && !BakedObjectData.bBakeCancelled)
+		{
+			TSharedRef<FHoudiniDeferredInstancedActorsBake> DeferredBake = MakeShared<FHoudiniDeferredInstancedActorsBake>();
+			DeferredBake->HAC = const_cast<UHoudiniAssetComponent*>(HoudiniAssetComponent);
+			DeferredBake->OutputIndex = InOutputIndex;
+			DeferredBake->OutputObjectIdentifier = InOutputObjectIdentifier;
+			DeferredBake->IAC = InIAC;
+			DeferredBake->Level = DesiredLevel;
+			DeferredBake->ParentActor = ParentActor;
+			DeferredBake->PackageParams = PackageParams;
+			DeferredBake->InstancerHGPO = InstancerHGPO;
+			DeferredBake->WorldOutlinerFolderPath = WorldOutlinerFolderPath;
+			DeferredBake->BatchSize = BatchSize;
+			for (int32 InstanceIdx = NumInstancesToBakeNow; InstanceIdx < NumInstances; ++InstanceIdx)
 			{
-				NewActor->AttachToActor(ParentActor, FAttachmentTransformRules::KeepWorldTransform);
+				if (IsValid(InstancedActors[InstanceIdx]))
+					DeferredBake->InstancedActors.Add(InstancedActors[InstanceIdx]);
 			}
-
-			BakedOutputObject.InstancedActors.Add(FSoftObjectPath(NewActor).ToString());
-
-			FHoudiniEngineBakedActor& OutputEntry = OutActors.Add_GetRef(FHoudiniEngineBakedActor(
-				NewActor,
-				*PackageParams.ObjectName,
-				WorldOutlinerFolderPath,
-				InOutputIndex,
-				InOutputObjectIdentifier,
-				nullptr,
-				InstancedObject,
-				nullptr,
-				PackageParams.BakeFolder,
-				PackageParams));
-			OutputEntry.bInstancerOutput = true;
-			OutputEntry.InstancerPackageParams = PackageParams;
+			FHoudiniDeferredInstancedActorsBake::Start(DeferredBake);
 		}
 
 		// TODO:
@@ -4404,7 +4733,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniCurveOutputToActors(
 
 	OutActors = MoveTemp(NewBakedActors);
 	
-	SaveBakedPackages(BakedObjectData.PackagesToSave);
+	SaveBakedPackages(BakedObjectData);
 
 	return true;
 }
@@ -4495,6 +4824,8 @@ FHoudiniEngineBakeUtils::CopyActorContentsToBlueprint(AActor * InActor, UBluepri
 bool 
 FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComponent, const FHoudiniBakeSettings& BakeSettings)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	FHoudiniBakedObjectData BakedObjectData;
 	const bool bSuccess = BakeBlueprints(HoudiniAssetComponent, BakeSettings, BakedObjectData);
 	if (!bSuccess)
@@ -4510,7 +4841,7 @@ FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComp
 		
 		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	}
-	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
+	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
 
 	// Sync the CB to the baked objects
 	if(GEditor && BakedObjectData.Blueprints.Num() > 0)
@@ -4544,6 +4875,8 @@ FHoudiniEngineBakeUtils::BakeBlueprints(
 	const FHoudiniBakeSettings& BakeSettings,
 	FHoudiniBakedObjectData& BakedObjectData)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	if (!IsValid(HoudiniAssetComponent))
 		return false;
 
@@ -4623,7 +4956,7 @@ FHoudiniEngineBakeUtils::BakeStaticMesh(
 
 	if (BakedStaticMesh) 
 	{
-		FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
+		FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
 
 		// Sync the CB to the baked objects
 		if(GEditor)
@@ -4873,6 +5206,8 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 	TMap<UStaticMesh*, UStaticMesh*>& InOutAlreadyBakedStaticMeshMap,
 	TMap<UMaterialInterface *, UMaterialInterface *>& InOutAlreadyBakedMaterialsMap) 
 {
+	FHoudiniScopedOutputStatsPhaseTimer DuplicateTimer(BakedObjectData.BakeStats, TEXT("Duplicate"));
+
 	if (!IsValid(InStaticMesh))
 		return nullptr;
 
@@ -4901,6 +5236,25 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 		}
 	}
 
+	// If enabled, look for a mesh with identical content that was already baked during this bake and reuse it.
+	// Deduplication is skipped in replace mode: a shared asset could later be overwritten by the rebake of
+	// only one of the outputs that use it.
+	FSHAHash StaticMeshHash;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bDeduplicate = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bBakeDeduplicateStaticMeshes
+		&& PackageParams.ReplaceMode != EPackageReplaceMode::ReplaceExistingAssets
+		&& GetStaticMeshBakeHash(InStaticMesh, InTemporaryCookFolder, StaticMeshHash);
+	if (bDeduplicate)
+	{
+		UStaticMesh** IdenticalBakedSM = BakedObjectData.BakedStaticMeshesByHash.Find(StaticMeshHash);
+		if (IdenticalBakedSM && IsValid(*IdenticalBakedSM))
+		{
+			InOutAlreadyBakedStaticMeshMap.Add(InStaticMesh, *IdenticalBakedSM);
+			HOUDINI_LOG_MESSAGE(TEXT("Reusing baked static mesh %s for identical mesh %s"), *(*IdenticalBakedSM)->GetPathName(), *InStaticMesh->GetPathName());
+			return *IdenticalBakedSM;
+		}
+	}
+
 	// InStaticMesh is temporary and we didn't find a baked version of it in our current bake output, we need to bake it
 	
 	// If we have a previously baked static mesh, get the bake counter from it so that both replace and increment
@@ -4963,6 +5317,8 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 		return nullptr;
 
 	InOutAlreadyBakedStaticMeshMap.Add(InStaticMesh, DuplicatedStaticMesh);
+	if (bDeduplicate)
+		BakedObjectData.BakedStaticMeshesByHash.Add(StaticMeshHash, DuplicatedStaticMesh);
 
 	// Add meta information.
 	// Houdini Generated
@@ -5060,9 +5416,204 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 	// Dirty the static mesh package.
 	DuplicatedStaticMesh->MarkPackageDirty();
 
+	// If the duplicate has no render data, build it with the other meshes of the bake when saving
+	if (!DuplicatedStaticMesh->HasValidRenderData())
+		BakedObjectData.StaticMeshesToBuild.Add(DuplicatedStaticMesh);
+
 	return DuplicatedStaticMesh;
 }
 
+namespace
+{
+	// Archive that feeds everything serialized through it to a SHA1 hash. Object references to non-temporary
+	// objects are hashed by path, while temporary objects (ie, materials created for each cook or work item)
+	// are hashed by content, so that identical temporary objects in different packages produce the same hash.
+	class FHoudiniBakeContentHashArchive : public FArchiveUObject
+	{
+	public:
+		FHoudiniBakeContentHashArchive(FSHA1& InHashState, const FString& InTemporaryCookFolder)
+			: HashState(InHashState)
+			, TemporaryCookFolder(InTemporaryCookFolder)
+		{
+			SetIsSaving(true);
+			SetIsPersistent(true);
+		}
+
+		using FArchiveUObject::operator<<;
+
+		virtual void Serialize(void* Data, int64 Num) override
+		{
+			HashState.Update(static_cast<const uint8*>(Data), Num);
+		}
+
+		virtual FArchive& operator<<(FName& Value) override
+		{
+			FString NameString = Value.ToString();
+			*this << NameString;
+			return *this;
+		}
+
+		virtual FArchive& operator<<(UObject*& Value) override
+		{
+			HashObject(Value);
+			return *this;
+		}
+
+		virtual bool ShouldSkipProperty(const FProperty* InProperty) const override
+		{
+			// Skip transient data and guids, which differ between otherwise identical objects
+			if (InProperty->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient))
+				return true;
+
+			const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+			return StructProperty && StructProperty->Struct == TBaseStructure<FGuid>::Get();
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("FHoudiniBakeContentHashArchive"); }
+
+		void HashObject(UObject* InObject)
+		{
+			if (!IsValid(InObject))
+			{
+				FString Empty;
+				*this << Empty;
+				return;
+			}
+
+			if (!FHoudiniEngineBakeUtils::IsObjectInTempFolder(InObject, TemporaryCookFolder))
+			{
+				FString PathName = InObject->GetPathName();
+				*this << PathName;
+				return;
+			}
+
+			// Temporary objects that were already visited are referred to by their visit index, to handle cycles
+			if (const int32* VisitIndex = VisitedObjects.Find(InObject))
+			{
+				int32 Index = *VisitIndex;
+				*this << Index;
+				return;
+			}
+			VisitedObjects.Add(InObject, VisitedObjects.Num());
+
+			FString ClassPathName = InObject->GetClass()->GetPathName();
+			*this << ClassPathName;
+
+			UClass* Class = InObject->GetClass();
+			Class->SerializeTaggedProperties(
+				*this, reinterpret_cast<uint8*>(InObject), Class, reinterpret_cast<uint8*>(Class->GetDefaultObject()));
+
+			// Texture source data is not a property
+			UTexture* Texture = Cast<UTexture>(InObject);
+			if (IsValid(Texture))
+			{
+				TArray64<uint8> MipData;
+				if (Texture->Source.GetMipData(MipData, 0, 0, 0, nullptr))
+					Serialize(MipData.GetData(), MipData.Num());
+			}
+		}
+
+	private:
+		FSHA1& HashState;
+		const FString& TemporaryCookFolder;
+		TMap<UObject*, int32> VisitedObjects;
+	};
+}
+
+bool
+FHoudiniEngineBakeUtils::GetStaticMeshBakeHash(UStaticMesh* InStaticMesh, const FString& InTemporaryCookFolder, FSHAHash& OutHash)
+{
+	if (!IsValid(InStaticMesh))
+		return false;
+
+	FSHA1 HashState;
+	TArray<uint8> Bytes;
+	auto UpdateHash = [&HashState, &Bytes](TFunctionRef<void(FArchive&)> InSerialize)
+	{
+		Bytes.Reset();
+		FMemoryWriter Writer(Bytes);
+		InSerialize(Writer);
+		HashState.Update(Bytes.GetData(), Bytes.Num());
+	};
+	auto UpdateHashWithString = [&HashState](const FString& InString)
+	{
+		HashState.UpdateWithString(*InString, InString.Len());
+		// Separate consecutive strings
+		HashState.Update(reinterpret_cast<const uint8*>(TEXT("|")), sizeof(TCHAR));
+	};
+
+	// Geometry and build settings, per LOD
+	const int32 NumSourceModels = InStaticMesh->GetNumSourceModels();
+	HashState.Update(reinterpret_cast<const uint8*>(&NumSourceModels), sizeof(NumSourceModels));
+	for (int32 LODIndex = 0; LODIndex < NumSourceModels; ++LODIndex)
+	{
+		FMeshDescription* MeshDescription = InStaticMesh->GetMeshDescription(LODIndex);
+		if (!MeshDescription)
+			return false;
+
+		UpdateHash([MeshDescription](FArchive& Ar) { MeshDescription->Serialize(Ar); });
+
+		FStaticMeshSourceModel& SourceModel = InStaticMesh->GetSourceModel(LODIndex);
+		UpdateHash([&SourceModel](FArchive& Ar)
+		{
+			FMeshBuildSettings::StaticStruct()->SerializeBin(Ar, &SourceModel.BuildSettings);
+			FMeshReductionSettings::StaticStruct()->SerializeBin(Ar, &SourceModel.ReductionSettings);
+			float ScreenSize = SourceModel.ScreenSize.Default;
+			Ar << ScreenSize;
+		});
+	}
+
+	// Materials: temporary materials are hashed by content, as each cook / work item creates its own copies
+	FHoudiniBakeContentHashArchive ContentHashArchive(HashState, InTemporaryCookFolder);
+	for (const FStaticMaterial& StaticMaterial : InStaticMesh->GetStaticMaterials())
+	{
+		ContentHashArchive.HashObject(StaticMaterial.MaterialInterface);
+		UpdateHashWithString(StaticMaterial.MaterialSlotName.ToString());
+	}
+
+	UpdateHash([InStaticMesh](FArchive& Ar)
+	{
+		FMeshSectionInfoMap SectionInfoMap = InStaticMesh->GetSectionInfoMap();
+		SectionInfoMap.Serialize(Ar);
+
+		int32 LightMapResolution = InStaticMesh->GetLightMapResolution();
+		int32 LightMapCoordinateIndex = InStaticMesh->GetLightMapCoordinateIndex();
+		Ar << LightMapResolution;
+		Ar << LightMapCoordinateIndex;
+	});
+
+	// Collision
+	UBodySetup* BodySetup = InStaticMesh->GetBodySetup();
+	if (IsValid(BodySetup))
+	{
+		UpdateHash([BodySetup](FArchive& Ar)
+		{
+			FKAggregateGeom::StaticStruct()->SerializeBin(Ar, &BodySetup->AggGeom);
+			uint8 CollisionTraceFlag = static_cast<uint8>(BodySetup->CollisionTraceFlag.GetValue());
+			Ar << CollisionTraceFlag;
+		});
+	}
+
+	// Temporary complex collision meshes are hashed by content as well
+	UStaticMesh* ComplexCollisionMesh = InStaticMesh->ComplexCollisionMesh;
+	if (IsValid(ComplexCollisionMesh) && ComplexCollisionMesh != InStaticMesh && IsObjectInTempFolder(ComplexCollisionMesh, InTemporaryCookFolder))
+	{
+		FSHAHash ComplexCollisionHash;
+		if (!GetStaticMeshBakeHash(ComplexCollisionMesh, InTemporaryCookFolder, ComplexCollisionHash))
+			return false;
+		HashState.Update(ComplexCollisionHash.Hash, sizeof(ComplexCollisionHash.Hash));
+	}
+	else
+	{
+		UpdateHashWithString(IsValid(ComplexCollisionMesh) ? ComplexCollisionMesh->GetPathName() : FString());
+	}
+
+	HashState.Final();
+	HashState.GetHash(OutHash.Hash);
+
+	return true;
+}
+
 USkeletalMesh*
 FHoudiniEngineBakeUtils::DuplicateSkeletalMeshAndCreatePackageIfNeeded(
 	USkeletalMesh* InSkeletalMesh,
@@ -5698,7 +6249,7 @@ FHoudiniEngineBakeUtils::BakeHeightfield(
 
 			// 7. Save Package
 			BakedObjectData.PackagesToSave.Add(CreatedPackage);
-			FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
+			FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
 
 			// Sync the CB to the baked objects
 			if(GEditor)
@@ -6061,7 +6612,7 @@ FHoudiniEngineBakeUtils::BakeInputHoudiniCurveToBlueprint(
 	if (!IsValid(Blueprint))
 		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	// Save the created BP package.
-	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
+	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
 
 	return Blueprint;
 }
@@ -6112,6 +6663,8 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 	FHoudiniBakedObjectData& BakedObjectData,
 	TMap<UMaterialInterface *, UMaterialInterface *>& InOutAlreadyBakedMaterialsMap)
 {
+	FHoudiniScopedOutputStatsPhaseTimer DuplicateTimer(BakedObjectData.BakeStats, TEXT("Duplicate"));
+
 	if (InOutAlreadyBakedMaterialsMap.Contains(Material))
 	{
 		return InOutAlreadyBakedMaterialsMap[Material];
@@ -6265,6 +6818,8 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
 	const FHoudiniPackageParams& PackageParams,
 	FHoudiniBakedObjectData& BakedObjectData)
 {
+	FHoudiniScopedOutputStatsPhaseTimer DuplicateTimer(BakedObjectData.BakeStats, TEXT("Duplicate"));
+
 	UTexture2D* DuplicatedTexture = nullptr;
 #if WITH_EDITOR
 	// Retrieve original package of this texture.
@@ -6368,24 +6923,136 @@ FHoudiniEngineBakeUtils::DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent* Ho
 void 
 FHoudiniEngineBakeUtils::SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld) 
 {
-	UWorld * CurrentWorld = nullptr;
-	if (bSaveCurrentWorld && GEditor)
-		CurrentWorld = GEditor->GetEditorWorldContext().World();
+	if (bSaveCurrentWorld)
+		AddCurrentWorldPackage(PackagesToSave);
+
+	FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false);
+}
+
+void
+FHoudiniEngineBakeUtils::SaveBakedPackages(FHoudiniBakedObjectData& BakedObjectData, bool bSaveCurrentWorld)
+{
+	FHoudiniEngineOutputStats& BakeStats = BakedObjectData.BakeStats;
+	{
+		FHoudiniScopedOutputStatsPhaseTimer BuildTimer(BakeStats, TEXT("Build"));
+		BuildBakedStaticMeshes(BakedObjectData.StaticMeshesToBuild);
+	}
+
+	{
+		FHoudiniScopedOutputStatsPhaseTimer SaveTimer(BakeStats, TEXT("Save"));
+		if (bSaveCurrentWorld)
+			AddCurrentWorldPackage(BakedObjectData.PackagesToSave);
+
+		SavePackagesWithAsyncWrites(BakedObjectData.PackagesToSave);
+	}
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Bake timings: duplicate %.3fs, build %.3fs, save %.3fs (%d packages)."),
+		BakeStats.GetPhaseTime(TEXT("Duplicate")),
+		BakeStats.GetPhaseTime(TEXT("Build")),
+		BakeStats.GetPhaseTime(TEXT("Save")),
+		BakedObjectData.PackagesToSave.Num());
+}
+
+void
+FHoudiniEngineBakeUtils::AddCurrentWorldPackage(TArray<UPackage*>& PackagesToSave)
+{
+	UWorld * CurrentWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!CurrentWorld)
+		return;
+
+	// Save the current map
+	FString CurrentWorldPath = FPaths::GetBaseFilename(CurrentWorld->GetPathName(), false);
+	UPackage* CurrentWorldPackage = CreatePackage(*CurrentWorldPath);
 
-	if (CurrentWorld)
+	if (CurrentWorldPackage)
 	{
-		// Save the current map
-		FString CurrentWorldPath = FPaths::GetBaseFilename(CurrentWorld->GetPathName(), false);
-		UPackage* CurrentWorldPackage = CreatePackage(*CurrentWorldPath);
+		CurrentWorldPackage->MarkPackageDirty();
+		PackagesToSave.Add(CurrentWorldPackage);
+	}
+}
+
+void
+FHoudiniEngineBakeUtils::BuildBakedStaticMeshes(TArray<UStaticMesh*>& StaticMeshesToBuild)
+{
+	TArray<UStaticMesh*> Meshes;
+	Meshes.Reserve(StaticMeshesToBuild.Num());
+	for (UStaticMesh* StaticMesh : StaticMeshesToBuild)
+	{
+		// Meshes could have been replaced or built by a later step of the bake
+		if (IsValid(StaticMesh) && !StaticMesh->HasValidRenderData())
+			Meshes.AddUnique(StaticMesh);
+	}
+	StaticMeshesToBuild.Empty();
+
+	if (Meshes.Num() <= 0)
+		return;
+
+	// BatchBuild builds the meshes concurrently on the engine's worker threads
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+	UStaticMesh::FBuildParameters BuildParameters;
+	BuildParameters.bInSilent = true;
+	UStaticMesh::BatchBuild(Meshes, BuildParameters);
+#else
+	UStaticMesh::BatchBuild(Meshes, true);
+#endif
+
+	for (UStaticMesh* StaticMesh : Meshes)
+		StaticMesh->MarkPackageDirty();
+}
+
+void
+FHoudiniEngineBakeUtils::SavePackagesWithAsyncWrites(const TArray<UPackage*>& PackagesToSave)
+{
+	TArray<UPackage*> PackagesToPromptAndSave;
+	TArray<UPackage*> PackagesToWrite;
+	
+	const bool bSourceControlEnabled = ISourceControlModule::Get().IsEnabled();
+	TSet<UPackage*> VisitedPackages;
+	VisitedPackages.Reserve(PackagesToSave.Num());
+	for (UPackage* Package : PackagesToSave)
+	{
+		bool bAlreadyVisited = false;
+		VisitedPackages.Add(Package, &bAlreadyVisited);
+		if (!IsValid(Package) || bAlreadyVisited)
+			continue;
+
+		// Maps, external actor packages (World Partition), and packages that might need a checkout or have
+		// a read-only file, go through the editor's regular save path so that the user is prompted like before.
+		const bool bIsMapData = Package->ContainsMap() || Package->HasAnyPackageFlags(PKG_ContainsMapData);
+		const FString Filename = FPackageName::LongPackageNameToFilename(
+			Package->GetName(), Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+		if (bSourceControlEnabled || bIsMapData || IFileManager::Get().IsReadOnly(*Filename))
+			PackagesToPromptAndSave.Add(Package);
+		else
+			PackagesToWrite.Add(Package);
+	}
 
-		if (CurrentWorldPackage)
+	// Serialize the packages on the game thread but let the engine write the files concurrently.
+	for (UPackage* Package : PackagesToWrite)
+	{
+		if (!Package->IsDirty())
+			continue;
+
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+		SaveArgs.Error = GWarn;
+		const FSavePackageResultStruct Result = UPackage::Save(Package, nullptr, *Filename, SaveArgs);
+		if (Result.Result != ESavePackageResult::Success)
 		{
-			CurrentWorldPackage->MarkPackageDirty();
-			PackagesToSave.Add(CurrentWorldPackage);
+			// Try again through the regular save path, which reports errors to the user
+			PackagesToPromptAndSave.Add(Package);
 		}
 	}
 
-	FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false);
+	if (PackagesToWrite.Num() > 0)
+		UPackage::WaitForAsyncFileWrites();
+
+	if (PackagesToPromptAndSave.Num() > 0)
+		FEditorFileUtils::PromptForCheckoutAndSave(PackagesToPromptAndSave, true, false);
 }
 
 bool
@@ -6977,6 +7644,10 @@ FHoudiniEngineBakeUtils::RemovePreviouslyBakedComponent(UActorComponent* InCompo
 	InComponent->UnregisterComponent();
 	InComponent->DestroyComponent();
 
+	FHoudiniBakeNameAllocator* NameAllocator = FHoudiniBakeNameAllocator::GetActive();
+	if (NameAllocator)
+		NameAllocator->ReleaseName(InComponent->GetOuter(), InComponent->GetFName());
+
 	return true;
 }
 
@@ -7016,8 +7687,14 @@ FHoudiniEngineBakeUtils::RenameAsset(UObject* InAsset, const FString& InNewName,
 	else
 		NewName = InNewName;
 
+	UObject* const OldOuter = InAsset->GetOuter();
+	const FName OldName = InAsset->GetFName();
 	FHoudiniEngineUtils::RenameObject(InAsset, *NewName);
 
+	FHoudiniBakeNameAllocator* NameAllocator = FHoudiniBakeNameAllocator::GetActive();
+	if (NameAllocator && InAsset->GetFName() != OldName)
+		NameAllocator->ReleaseName(OldOuter, OldName);
+
 	const FSoftObjectPath NewPath = FSoftObjectPath(InAsset);
 	if (OldPath != NewPath)
 	{
@@ -7043,7 +7720,13 @@ FHoudiniEngineBakeUtils::RenameAndRelabelActor(AActor* InActor, const FString& I
 	else
 		NewName = InNewName;
 
+	UObject* const OldOuter = InActor->GetOuter();
+	const FName OldName = InActor->GetFName();
 	FHoudiniEngineUtils::RenameObject(InActor, *NewName);
+
+	FHoudiniBakeNameAllocator* NameAllocator = FHoudiniBakeNameAllocator::GetActive();
+	if (NameAllocator && InActor->GetFName() != OldName)
+		NameAllocator->ReleaseName(OldOuter, OldName);
 	FHoudiniEngineRuntimeUtils::SetActorLabel(InActor, NewName);
 
 	const FSoftObjectPath NewPath = FSoftObjectPath(InActor);
@@ -7100,6 +7783,8 @@ FHoudiniEngineBakeUtils::BakePDGWorkResultObject(
 	TArray<EHoudiniInstancerComponentType> * InInstancerComponentTypesToBake,
 	const FString& InFallbackWorldOutlinerFolder)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	if (!IsValid(InPDGAssetLink))
 		return false;
 
@@ -7353,6 +8038,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(
 	TArray<FHoudiniEngineBakedActor>& OutBakedActors,
 	FHoudiniBakedObjectData& BakedObjectData) 
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	if (!IsValid(InPDGAssetLink))
 		return false;
 
@@ -7396,6 +8083,9 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(
 	TArray<FHoudiniEngineBakedActor> WorkResultObjectBakedActors;
 	for (int32 WorkResultArrayIdx = 0; WorkResultArrayIdx < NumWorkResults; ++WorkResultArrayIdx)
 	{
+		if (BakedObjectData.bBakeCancelled)
+			break;
+
 		// Bug: #126086
 		// Fixed ensure failure due to invalid amount of work passed to the FSlowTask
 		Progress.EnterProgressFrame(1.0f);
@@ -7440,6 +8130,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(
 	bool bInRecenterBakedActors,
 	TArray<FHoudiniEngineBakedActor>& OutBakedActors)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	FHoudiniBakedObjectData BakedObjectData;
 
 	const bool bBakeBlueprints = false;
@@ -7447,7 +8139,7 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(
 	bool bSuccess = BakePDGTOPNodeOutputsKeepActors(
 		InPDGAssetLink, InTOPNode, bBakeBlueprints, bInIsAutoBake, InPDGBakePackageReplaceMode, OutBakedActors, BakedObjectData);
 
-	SaveBakedPackages(BakedObjectData.PackagesToSave);
+	SaveBakedPackages(BakedObjectData);
 
 	// Recenter and select the baked actors
 	if (GEditor && OutBakedActors.Num() > 0)
@@ -7487,6 +8179,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNetworkOutputsKeepActors(
 	TArray<FHoudiniEngineBakedActor>& BakedActors,
 	FHoudiniBakedObjectData& BakedObjectData)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	if (!IsValid(InPDGAssetLink))
 		return false;
 
@@ -7547,7 +8241,7 @@ bool FHoudiniEngineBakeUtils::BakePDGAssetLinkOutputsKeepActors(
 		break;
 	}
 
-	SaveBakedPackages(BakedObjectData.PackagesToSave);
+	SaveBakedPackages(BakedObjectData);
 
 	// Recenter and select the baked actors
 	if (GEditor && BakedActors.Num() > 0)
@@ -7587,6 +8281,8 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkOutputsKeepActors(
 	EPDGBakePackageReplaceModeOption InPDGBakePackageReplaceMode, 
 	bool bInRecenterBakedActors)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	FHoudiniBakedObjectData BakedObjectData;
 	TArray<FHoudiniEngineBakedActor> BakedActors;
 
@@ -7611,6 +8307,8 @@ FHoudiniEngineBakeUtils::BakeBlueprintsFromBakedActors(
 	TMap<FString, FHoudiniPDGWorkResultObjectBakedOutput>* const InPDGBakedOutputs,
 	FHoudiniBakedObjectData& BakedObjectData)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	// // Clear selection
 	// if (GEditor)
 	// {
@@ -7883,6 +8581,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(
 	bool bInRecenterBakedActors,
 	FHoudiniBakedObjectData& BakedObjectData)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	TArray<AActor*> BPActors;
 
 	if (!IsValid(InPDGAssetLink))
@@ -7934,6 +8634,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(
 bool
 FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAssetLink, UTOPNode* InTOPNode, bool bInIsAutoBake, const EPDGBakePackageReplaceModeOption InPDGBakePackageReplaceMode, bool bInRecenterBakedActors)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	FHoudiniBakedObjectData BakedObjectData;
 	
 	if (!IsValid(InPDGAssetLink))
@@ -7955,7 +8657,7 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAss
 		
 		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	}
-	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
+	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
 
 	// Sync the CB to the baked objects
 	if(GEditor && BakedObjectData.Blueprints.Num() > 0)
@@ -7988,6 +8690,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNetworkBlueprints(
 	bool bInRecenterBakedActors,
 	FHoudiniBakedObjectData& BakedObjectData)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	if (!IsValid(InPDGAssetLink))
 		return false;
 
@@ -8010,6 +8714,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNetworkBlueprints(
 bool
 FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGAssetLink, const EPDGBakeSelectionOption InBakeSelectionOption, const EPDGBakePackageReplaceModeOption InPDGBakePackageReplaceMode, bool bInRecenterBakedActors)
 {
+	FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+
 	FHoudiniBakedObjectData BakedObjectData;
 
 	if (!IsValid(InPDGAssetLink))
@@ -8069,7 +8775,7 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGA
 		
 		FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	}
-	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
+	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData);
 
 	// Sync the CB to the baked objects
 	if(GEditor && BakedObjectData.Blueprints.Num() > 0)
@@ -8502,6 +9208,12 @@ FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(UObject* InOuter, const UC
 			return CurrentName.ToString();
 	}
 
+	// During a bake, use the bake's name allocator: it only scans the outer once
+	// instead of probing every suffix for each object.
+	FHoudiniBakeNameAllocator* NameAllocator = FHoudiniBakeNameAllocator::GetActive();
+	if (NameAllocator && IsValid(InOuter))
+		return NameAllocator->MakeUniqueObjectName(InOuter, InName, InObjectThatWouldBeRenamed);
+
 	UObject* ExistingObject = nullptr;
 	FName CandidateName(InName);
 	bool bAppendedNumber = false;
@@ -8556,6 +9268,163 @@ FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(UObject* InOuter, const UC
 	return CandidateName.ToString();
 }
 
+FHoudiniBakeNameAllocator* FHoudiniBakeNameAllocator::ActiveAllocator = nullptr;
+
+FHoudiniBakeNameAllocator::FOuterNames&
+FHoudiniBakeNameAllocator::GetOrScanOuter(UObject* InOuter)
+{
+	FOuterNames* OuterNames = Outers.Find(InOuter);
+	if (OuterNames)
+		return *OuterNames;
+
+	OuterNames = &Outers.Add(InOuter);
+	ForEachObjectWithOuter(InOuter, [OuterNames](UObject* InObject)
+	{
+		OuterNames->UsedNames.Add(InObject->GetFName());
+	}, false);
+
+	return *OuterNames;
+}
+
+static FName
+MakeBakeCandidateName(const FString& InName, int32 InSuffix)
+{
+	if (InSuffix == 0)
+		return FName(InName);
+
+	const bool bSplitName = false;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+	return FName(*InName, NAME_EXTERNAL_TO_INTERNAL(InSuffix), bSplitName);
+#else
+	return FName(*InName, NAME_EXTERNAL_TO_INTERNAL(InSuffix), FNAME_Add, bSplitName);
+#endif
+}
+
+FString
+FHoudiniBakeNameAllocator::MakeUniqueObjectName(UObject* InOuter, const FString& InName, UObject* InObjectThatWouldBeRenamed)
+{
+	FOuterNames& OuterNames = GetOrScanOuter(InOuter);
+	int32& NextSuffix = OuterNames.NextSuffix.FindOrAdd(InName, 0);
+
+	AActor* RenamedActor = Cast<AActor>(InObjectThatWouldBeRenamed);
+	const bool bRenamedActorIsExternal = RenamedActor && RenamedActor->IsPackageExternal();
+
+	// Checks if a candidate is in use. Names are only known to be used once their object exists: handed out names
+	// are not reserved, since their object might fail to be created. Names we think are free are confirmed with a
+	// lookup, and the names found in use are recorded.
+	UObject* ExistingObject = nullptr;
+	auto IsNameInUse = [&OuterNames, &ExistingObject, InOuter, bRenamedActorIsExternal](const FName& InCandidateName)
+	{
+		ExistingObject = nullptr;
+		bool bInUse = OuterNames.UsedNames.Contains(InCandidateName);
+		if (!bInUse || bRenamedActorIsExternal)
+		{
+			ExistingObject = StaticFindObjectFast(nullptr, InOuter, InCandidateName);
+			if (ExistingObject)
+			{
+				OuterNames.UsedNames.Add(InCandidateName);
+				bInUse = true;
+			}
+		}
+		return bInUse;
+	};
+
+	// Names released during the bake come first, like they would with a sequential search.
+	// A released suffix is only dropped once it is in use again.
+	TArray<int32>* ReleasedSuffixes = OuterNames.ReleasedSuffixes.Find(InName);
+	while (ReleasedSuffixes && ReleasedSuffixes->Num() > 0)
+	{
+		int32 MinIndex = 0;
+		for (int32 Index = 1; Index < ReleasedSuffixes->Num(); ++Index)
+		{
+			if ((*ReleasedSuffixes)[Index] < (*ReleasedSuffixes)[MinIndex])
+				MinIndex = Index;
+		}
+		const int32 Suffix = (*ReleasedSuffixes)[MinIndex];
+		if (Suffix < NextSuffix)
+		{
+			const FName CandidateName = MakeBakeCandidateName(InName, Suffix);
+			if (!IsNameInUse(CandidateName))
+				return CandidateName.ToString();
+		}
+
+		ReleasedSuffixes->RemoveAtSwap(MinIndex);
+	}
+
+	while (true)
+	{
+		const FName CandidateName = MakeBakeCandidateName(InName, NextSuffix);
+		const bool bInUse = IsNameInUse(CandidateName);
+		if (bInUse && bRenamedActorIsExternal)
+		{
+			// We don't want to create unique names when actors are saved in their own package 
+			// because we don't care about the name, we only care about the label.
+			AActor* ExistingActor = Cast<AActor>(ExistingObject);
+			if (ExistingActor && ExistingActor->IsPackageExternal())
+				return InName;
+		}
+
+		// A free name is handed out without moving on: if its object is not created, the next request gets it again.
+		if (!bInUse)
+			return CandidateName.ToString();
+
+		NextSuffix++;
+	}
+}
+
+void
+FHoudiniBakeNameAllocator::ReleaseName(UObject* InOuter, const FName& InName)
+{
+	FOuterNames* OuterNames = Outers.Find(InOuter);
+	if (!OuterNames)
+		return;
+
+	if (OuterNames->UsedNames.Remove(InName) == 0)
+		return;
+
+	// The name could have been handed out either as a base name, or as a suffixed base name
+	const FString NameString = InName.ToString();
+	if (OuterNames->NextSuffix.Contains(NameString))
+		OuterNames->ReleasedSuffixes.FindOrAdd(NameString).AddUnique(0);
+
+	const FString PlainName = InName.GetPlainNameString();
+	if (InName.GetNumber() != NAME_NO_NUMBER_INTERNAL && OuterNames->NextSuffix.Contains(PlainName))
+		OuterNames->ReleasedSuffixes.FindOrAdd(PlainName).AddUnique(NAME_INTERNAL_TO_EXTERNAL(InName.GetNumber()));
+}
+
+FHoudiniScopedBakeNameAllocator::FHoudiniScopedBakeNameAllocator()
+{
+	check(IsInGameThread());
+	if (!FHoudiniBakeNameAllocator::ActiveAllocator)
+	{
+		Allocator = MakeUnique<FHoudiniBakeNameAllocator>();
+		FHoudiniBakeNameAllocator::ActiveAllocator = Allocator.Get();
+
+		// Actors destroyed during the bake (by replace mode for example) free their names
+		if (GEngine)
+		{
+			FHoudiniBakeNameAllocator* NameAllocator = Allocator.Get();
+			OnLevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddLambda([NameAllocator](AActor* InActor)
+			{
+				if (InActor)
+					NameAllocator->ReleaseName(InActor->GetOuter(), InActor->GetFName());
+			});
+		}
+	}
+}
+
+FHoudiniScopedBakeNameAllocator::~FHoudiniScopedBakeNameAllocator()
+{
+	if (Allocator.IsValid())
+	{
+		if (GEngine && OnLevelActorDeletedHandle.IsValid())
+			GEngine->OnLevelActorDeleted().Remove(OnLevelActorDeletedHandle);
+
+		FHoudiniBakeNameAllocator::ActiveAllocator = nullptr;
+		Allocator.Reset();
+	}
+}
+
 FName
 FHoudiniEngineBakeUtils::GetOutlinerFolderPath(const FHoudiniAttributeResolver& Resolver, FName DefaultFolder)
 {
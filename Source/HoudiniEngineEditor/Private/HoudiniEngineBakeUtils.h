@@ -33,6 +33,8 @@
 #include "Materials/MaterialExpression.h"
 #include "HoudiniOutputDetails.h"
 #include "HoudiniEngineOutputStats.h"
+#include "UObject/ObjectKey.h"
+#include "Misc/SecureHash.h"
 
 struct FHoudiniEngineBakedActor;
 class UDataTable;
@@ -47,6 +49,7 @@ class UPackage;
 class UWorld;
 class AActor;
 class UHoudiniSplineComponent;
+class UHoudiniInstancedActorComponent;
 class UStaticMeshComponent;
 class UHoudiniPDGAssetLink;
 class UTOPNetwork;
@@ -77,18 +80,80 @@ struct FHoudiniBakeSettings
 	bool bRecenterBakedActors = false;
 	EHoudiniEngineActorBakeOption ActorBakeOption = EHoudiniEngineActorBakeOption::OneActorPerComponent;
 	FString DefaultBakeName = TEXT("{hda_actor_name}_{guid8}");
+	// Only bake the first batch of actor instancers' instances, and the remaining batches over the next ticks.
+	// Used by interactive bakes, whose caller does not need all the baked actors when the bake returns.
+	bool bDeferInstancedActors = false;
 };
 
 // Use this structure to return bake output data. Previously the code would
 // pass each of there individually which was hard to maintain.
+// It also acts as the bake's transaction: packages and meshes are collected while baking,
+// and only built and saved together in SaveBakedPackages().
 struct FHoudiniBakedObjectData
 {
 	TArray<UBlueprint*> Blueprints;
 	TArray<UPackage*> PackagesToSave;
+	// Baked static meshes whose render data still has to be built
+	TArray<UStaticMesh*> StaticMeshesToBuild;
+	// Static meshes baked so far, by content hash (only used when static mesh deduplication is enabled)
+	TMap<FSHAHash, UStaticMesh*> BakedStaticMeshesByHash;
+	// Set when the user cancelled the bake: the remaining outputs are skipped, what was baked so far is kept
+	bool bBakeCancelled = false;
 	FHoudiniEngineOutputStats BakeStats;
 };
 
 
+// Allocates unique object names for the duration of a bake.
+// Each outer is scanned once, and a next-suffix counter is kept per base name, so that baking thousands
+// of objects that share a base name does not probe every candidate suffix again for each object.
+// Names are handed out in the same sequence as FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded would:
+// InName, InName_1, InName_2, ... A name is only considered used once its object exists, so a failed spawn does
+// not shift the numbering, and names freed by renamed or destroyed objects are handed out again.
+class HOUDINIENGINEEDITOR_API FHoudiniBakeNameAllocator
+{
+public:
+	// Returns a name, based on InName, that is not used by any object in InOuter.
+	FString MakeUniqueObjectName(UObject* InOuter, const FString& InName, UObject* InObjectThatWouldBeRenamed=nullptr);
+
+	// Notify the allocator that InName is no longer used in InOuter (the object was renamed or destroyed).
+	void ReleaseName(UObject* InOuter, const FName& InName);
+
+	// Returns the allocator of the active FHoudiniScopedBakeNameAllocator, if any.
+	static FHoudiniBakeNameAllocator* GetActive() { return ActiveAllocator; }
+
+private:
+	friend class FHoudiniScopedBakeNameAllocator;
+
+	struct FOuterNames
+	{
+		// Every name known to be used by an object of the outer
+		TSet<FName> UsedNames;
+		// Next suffix to try, per requested base name (0 means the base name itself)
+		TMap<FString, int32> NextSuffix;
+		// Suffixes below NextSuffix whose object was renamed or destroyed during the bake, per base name
+		TMap<FString, TArray<int32>> ReleasedSuffixes;
+	};
+
+	FOuterNames& GetOrScanOuter(UObject* InOuter);
+
+	TMap<TObjectKey<UObject>, FOuterNames> Outers;
+
+	static FHoudiniBakeNameAllocator* ActiveAllocator;
+};
+
+// Makes a FHoudiniBakeNameAllocator active for its lifetime. Nested scopes share the outermost allocator.
+class HOUDINIENGINEEDITOR_API FHoudiniScopedBakeNameAllocator
+{
+public:
+	FHoudiniScopedBakeNameAllocator();
+	~FHoudiniScopedBakeNameAllocator();
+
+private:
+	TUniquePtr<FHoudiniBakeNameAllocator> Allocator;
+	FDelegateHandle OnLevelActorDeletedHandle;
+};
+
+
 // An enum of the different types for instancer component/bake types
 UENUM()
 enum class EHoudiniInstancerComponentType : uint8
@@ -361,6 +426,18 @@ public:
 		TArray<FHoudiniEngineBakedActor>& OutActors,
 		FHoudiniBakedObjectData& BakedObjectData);
 
+	// Spawns the baked actor of one of an actor instancer's instances in InLevel, copying InInstancedActor.
+	// Returns null if it could not be spawned.
+	static AActor* BakeInstancedActor(
+		AActor* InInstancedActor,
+		UHoudiniInstancedActorComponent* InIAC,
+		ULevel* InLevel,
+		const FHoudiniPackageParams& InPackageParams,
+		const FHoudiniGeoPartObject& InInstancerHGPO,
+		const FName& InWorldOutlinerFolderPath,
+		AActor* InParentActor,
+		FHoudiniBakedObjectData& BakedObjectData);
+
 	static bool BakeInstancerOutputToActors_MSIC(
 		const UHoudiniAssetComponent* HoudiniAssetComponent,
 		int32 InOutputIndex,
@@ -430,6 +507,11 @@ public:
 		TMap<UStaticMesh*, UStaticMesh*>& InOutAlreadyBakedStaticMeshMap,
 		TMap<UMaterialInterface *, UMaterialInterface *>& InOutAlreadyBakedMaterialsMap);
 
+	// Computes a hash of the content of a static mesh that is relevant when baking: the mesh descriptions,
+	// build settings, materials, section info and collision. Meshes with the same hash can share a baked asset.
+	// Materials in the temporary cook folder are hashed by content rather than by path.
+	static bool GetStaticMeshBakeHash(UStaticMesh* InStaticMesh, const FString& InTemporaryCookFolder, FSHAHash& OutHash);
+
 	static USkeletalMesh* DuplicateSkeletalMeshAndCreatePackageIfNeeded(
 		USkeletalMesh* InSkeletalMesh,
 		USkeletalMesh* InPreviousBakeSkeletalMesh,
@@ -692,6 +774,20 @@ public:
 
 	static void SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld = false);
 
+	// Builds the static meshes collected during the bake in one batch, then saves all of the bake's packages.
+	// The duplicate, build and save timings are recorded in the bake stats.
+	static void SaveBakedPackages(FHoudiniBakedObjectData& BakedObjectData, bool bSaveCurrentWorld = false);
+
+	// Adds the package of the editor's current world to the packages to save.
+	static void AddCurrentWorldPackage(TArray<UPackage*>& PackagesToSave);
+
+	// Builds the given static meshes in parallel, where the engine allows it.
+	static void BuildBakedStaticMeshes(TArray<UStaticMesh*>& StaticMeshesToBuild);
+
+	// Saves packages that do not need a source control checkout with asynchronous file writes,
+	// the others are saved via FEditorFileUtils::PromptForCheckoutAndSave.
+	static void SavePackagesWithAsyncWrites(const TArray<UPackage*>& PackagesToSave);
+
 	// Look for InObjectToFind among InOutputs. Return true if found and set OutOutputIndex and OutIdentifier.
 	static bool FindOutputObject(
 		const UObject* InObjectToFind,
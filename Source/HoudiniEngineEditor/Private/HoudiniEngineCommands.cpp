@@ -594,7 +594,7 @@ FHoudiniEngineCommands::BakeAllAssets()
 			BakeOptions.bRecenterBakedActors = HoudiniAssetComponent->bRecenterBakedActors;
 
 			bSuccess = FHoudiniEngineBakeUtils::BakeBlueprints(HoudiniAssetComponent, BakeOptions, BakeOutputs);
-			FHoudiniEngineBakeUtils::SaveBakedPackages(BakeOutputs.PackagesToSave);
+			FHoudiniEngineBakeUtils::SaveBakedPackages(BakeOutputs);
 			
 			if (bSuccess)
 			{
@@ -887,7 +887,7 @@ FHoudiniEngineCommands::BakeSelection()
 			BakeOptions.bRecenterBakedActors = HoudiniAssetComponent->bRecenterBakedActors;
 
 			const bool bSuccess = FHoudiniEngineBakeUtils::BakeBlueprints(HoudiniAssetComponent, BakeOptions, BakeOutputs);
-			FHoudiniEngineBakeUtils::SaveBakedPackages(BakeOutputs.PackagesToSave);
+			FHoudiniEngineBakeUtils::SaveBakedPackages(BakeOutputs);
 			
 			if (bSuccess)
 			{
@@ -692,6 +692,8 @@ FHoudiniEngineDetails::CreateBakeWidgets(
 
 			FHoudiniBakeSettings BakeSettings;
 			BakeSettings.SetFromHAC(MainHAC.Get());
+			// Large actor instancers are baked over several ticks, so that the editor stays responsive
+			BakeSettings.bDeferInstancedActors = true;
 
 			FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 				NextHAC.Get(),
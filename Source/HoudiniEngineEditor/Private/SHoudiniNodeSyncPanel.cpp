@@ -372,6 +372,36 @@ SHoudiniNodeSyncPanel::Construct( const FArguments& InArgs )
 				]
 			]
 
+			// ONLY FETCH CHANGED NODES
+			+ SVerticalBox::Slot()
+			.HAlign(HAlign_Left)
+			.AutoHeight()
+			.Padding(10.0f, 0.0f, 0.0f, 5.0f)
+			[
+				SNew(SBox)
+				.WidthOverride(160.f)
+				[
+					SNew(SCheckBox)
+					.Content()
+					[
+						SNew(STextBlock).Text(LOCTEXT("OnlyFetchChangedNodes", "Only Fetch Changed Nodes"))
+						.ToolTipText(LOCTEXT("OnlyFetchChangedNodesToolTip", "If enabled, when replacing existing assets, the fetch paths whose nodes and options have not changed since the last fetch keep their assets instead of being imported again."))
+						.Font(_GetEditorStyle().GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+					]
+					.IsChecked_Lambda([]()
+					{
+						UHoudiniEditorNodeSyncSubsystem* HoudiniEditorNodeSyncSubsystem = GEditor->GetEditorSubsystem<UHoudiniEditorNodeSyncSubsystem>();
+						return HoudiniEditorNodeSyncSubsystem->NodeSyncOptions.bOnlyFetchChangedNodes ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+					.OnCheckStateChanged_Lambda([](ECheckBoxState NewState)
+					{
+						const bool bNewState = (NewState == ECheckBoxState::Checked);
+						UHoudiniEditorNodeSyncSubsystem* HoudiniEditorNodeSyncSubsystem = GEditor->GetEditorSubsystem<UHoudiniEditorNodeSyncSubsystem>();
+						HoudiniEditorNodeSyncSubsystem->NodeSyncOptions.bOnlyFetchChangedNodes = bNewState;
+					})
+				]
+			]
+
 			// UNREAL ASSET NAME
 			+ SVerticalBox::Slot()
 			.HAlign(HAlign_Left)
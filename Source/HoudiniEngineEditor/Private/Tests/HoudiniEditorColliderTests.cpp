@@ -28,12 +28,249 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniMeshTranslator.h"
 
 #include "Misc/AutomationTest.h"
 
 FString FHoudiniEditorColliderTests::EquivalenceTestMapName = TEXT("Colliders");
 FString FHoudiniEditorColliderTests::TestHDAPath = TEXT("/Game/TestHDAs/Colliders/");
 
+namespace
+{
+	// Simple collision split names, and the collider types they should be fitted with
+	const TCHAR* CollisionSplitNames[] = {
+		TEXT("collision_geo_simple_box"),
+		TEXT("collision_geo_simple_sphere"),
+		TEXT("collision_geo_simple_capsule"),
+		TEXT("collision_geo_simple_kdop18"),
+		TEXT("collision_geo_simple") };
+
+	const EHoudiniCollisionType CollisionSplitTypes[] = {
+		EHoudiniCollisionType::SimpleBox,
+		EHoudiniCollisionType::SimpleSphere,
+		EHoudiniCollisionType::SimpleCapsule,
+		EHoudiniCollisionType::Kdop18,
+		EHoudiniCollisionType::Kdop26 };
+
+	void CreateCollisionGroups(
+		TArray<EHoudiniCollisionType>& OutCollisionTypes,
+		TArray<TArray<FVector>>& OutPositionArrays,
+		int32 InNumGroups,
+		int32 InNumPoints,
+		bool bInKDops,
+		FRandomStream& InRandom)
+	{
+		const int32 NumTypes = bInKDops ? (int32)UE_ARRAY_COUNT(CollisionSplitNames) : 3;
+		OutCollisionTypes.SetNum(InNumGroups);
+		OutPositionArrays.SetNum(InNumGroups);
+		for (int32 GroupIdx = 0; GroupIdx < InNumGroups; GroupIdx++)
+		{
+			const FString SplitName = FString::Printf(TEXT("%s_%d"), CollisionSplitNames[GroupIdx % NumTypes], GroupIdx);
+			OutCollisionTypes[GroupIdx] = FHoudiniMeshTranslator::GetSimpleCollisionTypeFromSplitName(SplitName);
+			FHoudiniEditorColliderTests::CreateRandomCollisionGroup(OutPositionArrays[GroupIdx], InNumPoints, InRandom);
+		}
+	}
+
+	// The serial fits, one group after the other on the game thread
+	void FitCollisionGroupsSerially(
+		const TArray<EHoudiniCollisionType>& InCollisionTypes,
+		const TArray<TArray<FVector>>& InPositionArrays,
+		TArray<FKAggregateGeom>& OutAggregateCollisions)
+	{
+		OutAggregateCollisions.Empty(InCollisionTypes.Num());
+		OutAggregateCollisions.SetNum(InCollisionTypes.Num());
+		for (int32 GroupIdx = 0; GroupIdx < InCollisionTypes.Num(); GroupIdx++)
+			FHoudiniMeshTranslator::FitSimpleCollision(InCollisionTypes[GroupIdx], InPositionArrays[GroupIdx], OutAggregateCollisions[GroupIdx]);
+	}
+
+	int32 CountMismatches(const TArray<FKAggregateGeom>& InA, const TArray<FKAggregateGeom>& InB)
+	{
+		if (InA.Num() != InB.Num())
+			return FMath::Max(InA.Num(), InB.Num());
+
+		int32 NumMismatches = 0;
+		for (int32 Idx = 0; Idx < InA.Num(); Idx++)
+		{
+			if (!FHoudiniEditorColliderTests::AreAggregateCollisionsEqual(InA[Idx], InB[Idx], 1e-6))
+				NumMismatches++;
+		}
+		return NumMismatches;
+	}
+}
+
+void
+FHoudiniEditorColliderTests::CreateRandomCollisionGroup(TArray<FVector>& OutPositions, int32 InNumPoints, FRandomStream& InRandom)
+{
+	const FVector Center = InRandom.GetUnitVector() * InRandom.FRandRange(0.0, 5000.0);
+	const FVector Scale(InRandom.FRandRange(10.0, 200.0), InRandom.FRandRange(10.0, 200.0), InRandom.FRandRange(10.0, 200.0));
+	const FQuat Rotation(InRandom.GetUnitVector(), InRandom.FRandRange(-PI, PI));
+
+	OutPositions.SetNumUninitialized(InNumPoints);
+	for (int32 PointIdx = 0; PointIdx < InNumPoints; PointIdx++)
+		OutPositions[PointIdx] = Center + Rotation.RotateVector(InRandom.GetUnitVector() * Scale * InRandom.FRandRange(0.5, 1.0));
+}
+
+bool
+FHoudiniEditorColliderTests::AreAggregateCollisionsEqual(const FKAggregateGeom& InA, const FKAggregateGeom& InB, double InTolerance)
+{
+	if (InA.BoxElems.Num() != InB.BoxElems.Num()
+		|| InA.SphereElems.Num() != InB.SphereElems.Num()
+		|| InA.SphylElems.Num() != InB.SphylElems.Num()
+		|| InA.ConvexElems.Num() != InB.ConvexElems.Num())
+		return false;
+
+	for (int32 Idx = 0; Idx < InA.BoxElems.Num(); Idx++)
+	{
+		const FKBoxElem& A = InA.BoxElems[Idx];
+		const FKBoxElem& B = InB.BoxElems[Idx];
+		if (!A.Center.Equals(B.Center, InTolerance) || !A.Rotation.Equals(B.Rotation, InTolerance)
+			|| !FMath::IsNearlyEqual(A.X, B.X, InTolerance) || !FMath::IsNearlyEqual(A.Y, B.Y, InTolerance) || !FMath::IsNearlyEqual(A.Z, B.Z, InTolerance))
+			return false;
+	}
+
+	for (int32 Idx = 0; Idx < InA.SphereElems.Num(); Idx++)
+	{
+		const FKSphereElem& A = InA.SphereElems[Idx];
+		const FKSphereElem& B = InB.SphereElems[Idx];
+		if (!A.Center.Equals(B.Center, InTolerance) || !FMath::IsNearlyEqual(A.Radius, B.Radius, InTolerance))
+			return false;
+	}
+
+	for (int32 Idx = 0; Idx < InA.SphylElems.Num(); Idx++)
+	{
+		const FKSphylElem& A = InA.SphylElems[Idx];
+		const FKSphylElem& B = InB.SphylElems[Idx];
+		if (!A.Center.Equals(B.Center, InTolerance) || !A.Rotation.Equals(B.Rotation, InTolerance)
+			|| !FMath::IsNearlyEqual(A.Radius, B.Radius, InTolerance) || !FMath::IsNearlyEqual(A.Length, B.Length, InTolerance))
+			return false;
+	}
+
+	for (int32 Idx = 0; Idx < InA.ConvexElems.Num(); Idx++)
+	{
+		const FKConvexElem& A = InA.ConvexElems[Idx];
+		const FKConvexElem& B = InB.ConvexElems[Idx];
+		if (A.VertexData.Num() != B.VertexData.Num() || !A.ElemBox.Min.Equals(B.ElemBox.Min, InTolerance) || !A.ElemBox.Max.Equals(B.ElemBox.Max, InTolerance))
+			return false;
+	}
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorColliderTest_ParallelFit, "Houdini.UnitTests.Collisions.ParallelFit", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorColliderTest_ParallelFit::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that fitting collision groups together, in parallel and through the cache, matches fitting them one by one.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumGroups = 250;
+	constexpr int32 NumPoints = 64;
+
+	FRandomStream Random(1213);
+	TArray<EHoudiniCollisionType> CollisionTypes;
+	TArray<TArray<FVector>> PositionArrays;
+	CreateCollisionGroups(CollisionTypes, PositionArrays, NumGroups, NumPoints, true, Random);
+
+	// Split names map to the expected collider types
+	for (int32 TypeIdx = 0; TypeIdx < (int32)UE_ARRAY_COUNT(CollisionSplitNames); TypeIdx++)
+		HOUDINI_TEST_EQUAL((int32)CollisionTypes[TypeIdx], (int32)CollisionSplitTypes[TypeIdx]);
+
+	TArray<FKAggregateGeom> SerialCollisions;
+	FitCollisionGroupsSerially(CollisionTypes, PositionArrays, SerialCollisions);
+
+	// Every group gets one collider
+	int32 NumFailedFits = 0;
+	for (const FKAggregateGeom& Collisions : SerialCollisions)
+	{
+		if (Collisions.GetElementCount() != 1)
+			NumFailedFits++;
+	}
+	HOUDINI_TEST_EQUAL(NumFailedFits, 0);
+
+	// Fit everything from an empty cache
+	FHoudiniMeshTranslator::EmptyCollisionFitCache();
+	TArray<FKAggregateGeom> ParallelCollisions;
+	FHoudiniMeshTranslator::FitSimpleCollisions(CollisionTypes, PositionArrays, ParallelCollisions);
+	HOUDINI_TEST_EQUAL(CountMismatches(ParallelCollisions, SerialCollisions), 0);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshTranslator::GetCollisionFitCacheNum(), NumGroups);
+
+	// Same geometry: all the fits come from the cache
+	TArray<FKAggregateGeom> CachedCollisions;
+	FHoudiniMeshTranslator::FitSimpleCollisions(CollisionTypes, PositionArrays, CachedCollisions);
+	HOUDINI_TEST_EQUAL(CountMismatches(CachedCollisions, SerialCollisions), 0);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshTranslator::GetCollisionFitCacheNum(), NumGroups);
+
+	// Moving a single point of a group refits that group only
+	PositionArrays[0][0] += FVector(1000.0, 0.0, 0.0);
+	TArray<FKAggregateGeom> EditedSerialCollisions;
+	FitCollisionGroupsSerially(CollisionTypes, PositionArrays, EditedSerialCollisions);
+
+	TArray<FKAggregateGeom> EditedCollisions;
+	FHoudiniMeshTranslator::FitSimpleCollisions(CollisionTypes, PositionArrays, EditedCollisions);
+	HOUDINI_TEST_EQUAL(CountMismatches(EditedCollisions, EditedSerialCollisions), 0);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshTranslator::GetCollisionFitCacheNum(), NumGroups + 1);
+	HOUDINI_TEST_EQUAL(FHoudiniEditorColliderTests::AreAggregateCollisionsEqual(EditedCollisions[0], SerialCollisions[0], 1e-6), false);
+
+	// The same points fitted with another collider type are not taken from the cache
+	TArray<FKAggregateGeom> SphereCollisions;
+	FHoudiniMeshTranslator::FitSimpleCollisions({ EHoudiniCollisionType::SimpleSphere }, { PositionArrays[0] }, SphereCollisions);
+	HOUDINI_TEST_EQUAL_ON_FAIL(SphereCollisions.Num(), 1, return false);
+	HOUDINI_TEST_EQUAL(SphereCollisions[0].SphereElems.Num(), 1);
+	HOUDINI_TEST_EQUAL(SphereCollisions[0].BoxElems.Num(), 0);
+
+	FHoudiniMeshTranslator::EmptyCollisionFitCache();
+	HOUDINI_TEST_EQUAL(FHoudiniMeshTranslator::GetCollisionFitCacheNum(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorColliderTest_FitBenchmark, "Houdini.UnitTests.Collisions.FitBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorColliderTest_FitBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Time the fitting of hundreds of box, sphere and capsule collision groups serially, in parallel, and on a recook.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumGroups = 400;
+	constexpr int32 NumPoints = 500;
+
+	FRandomStream Random(1415);
+	TArray<EHoudiniCollisionType> CollisionTypes;
+	TArray<TArray<FVector>> PositionArrays;
+	CreateCollisionGroups(CollisionTypes, PositionArrays, NumGroups, NumPoints, false, Random);
+
+	double StartTime = FPlatformTime::Seconds();
+	TArray<FKAggregateGeom> SerialCollisions;
+	FitCollisionGroupsSerially(CollisionTypes, PositionArrays, SerialCollisions);
+	const double SerialTime = FPlatformTime::Seconds() - StartTime;
+
+	FHoudiniMeshTranslator::EmptyCollisionFitCache();
+	StartTime = FPlatformTime::Seconds();
+	TArray<FKAggregateGeom> ParallelCollisions;
+	FHoudiniMeshTranslator::FitSimpleCollisions(CollisionTypes, PositionArrays, ParallelCollisions);
+	const double ParallelTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	TArray<FKAggregateGeom> CachedCollisions;
+	FHoudiniMeshTranslator::FitSimpleCollisions(CollisionTypes, PositionArrays, CachedCollisions);
+	const double CachedTime = FPlatformTime::Seconds() - StartTime;
+
+	HOUDINI_TEST_EQUAL(CountMismatches(ParallelCollisions, SerialCollisions), 0);
+	HOUDINI_TEST_EQUAL(CountMismatches(CachedCollisions, SerialCollisions), 0);
+
+	FHoudiniMeshTranslator::EmptyCollisionFitCache();
+
+	AddInfo(FString::Printf(TEXT("%d groups x %d points: %.3fs serial, %.3fs in parallel, %.3fs on recook from the cache."),
+		NumGroups, NumPoints, SerialTime, ParallelTime, CachedTime));
+
+	return true;
+}
+
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorColliderTest_Colliders_Common, "Houdini.Editor.Colliders.Colliders_Common", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
 bool HoudiniEditorColliderTest_Colliders_Common::RunTest(const FString & Parameters)
@@ -28,6 +28,7 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 #include "CoreMinimal.h"
+#include "PhysicsEngine/AggregateGeom.h"
 
 // Class just for containing static member variables
 class FHoudiniEditorColliderTests
@@ -35,6 +36,12 @@ class FHoudiniEditorColliderTests
 public:
 	static FString EquivalenceTestMapName;
 	static FString TestHDAPath;
+
+	// Random point cloud for a collision group: a rotated and stretched blob around a random center.
+	static void CreateRandomCollisionGroup(TArray<FVector>& OutPositions, int32 InNumPoints, FRandomStream& InRandom);
+
+	// Returns true if both aggregates hold the same colliders, in the same order.
+	static bool AreAggregateCollisionsEqual(const FKAggregateGeom& InA, const FKAggregateGeom& InB, double InTolerance);
 };
 
 #endif
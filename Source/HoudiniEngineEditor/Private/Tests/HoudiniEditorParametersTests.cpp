@@ -28,6 +28,12 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniParameterFloat.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniParameterTranslator.h"
 
 #include "HoudiniPublicAPIAssetWrapper.h"
 #include "HoudiniAssetComponent.h"
@@ -540,4 +546,288 @@ bool HoudiniEditorParametersTest_Menu_Single_Select::RunTest(const FString & Par
 	return true;
 }
 
+
+FHoudiniTestFakeParameterNode::FHoudiniTestFakeParameterNode(int32 InNumFloatParms, int32 InNumIntParms)
+	: FHoudiniTestFakeHoudiniApi(this)
+{
+	// String handle 0 is invalid
+	Strings.Add(std::string());
+
+	const int32 NumParms = InNumFloatParms + InNumIntParms;
+	ParmInfos.SetNumZeroed(NumParms);
+	for (int32 Idx = 0; Idx < NumParms; ++Idx)
+	{
+		const bool bIsFloat = Idx < InNumFloatParms;
+
+		HAPI_ParmInfo& ParmInfo = ParmInfos[Idx];
+		ParmInfo.id = Idx;
+		ParmInfo.parentId = -1;
+		ParmInfo.childIndex = Idx;
+		ParmInfo.intValuesIndex = -1;
+		ParmInfo.floatValuesIndex = -1;
+		ParmInfo.stringValuesIndex = -1;
+		ParmInfo.choiceIndex = -1;
+
+		if (bIsFloat)
+		{
+			ParmInfo.type = HAPI_PARMTYPE_FLOAT;
+			ParmInfo.scriptType = HAPI_PRM_SCRIPT_TYPE_FLOAT;
+			ParmInfo.size = 3;
+			ParmInfo.floatValuesIndex = FloatValues.Num();
+			for (int32 Component = 0; Component < ParmInfo.size; ++Component)
+				FloatValues.Add(Idx + Component * 0.25f);
+		}
+		else
+		{
+			ParmInfo.type = HAPI_PARMTYPE_INT;
+			ParmInfo.scriptType = HAPI_PRM_SCRIPT_TYPE_INT;
+			ParmInfo.size = 1;
+			ParmInfo.intValuesIndex = IntValues.Num();
+			IntValues.Add(Idx);
+		}
+
+		ParmInfo.nameSH = Strings.Num();
+		ParmInfo.labelSH = ParmInfo.nameSH;
+		Strings.Add(TCHAR_TO_UTF8(*FString::Printf(TEXT("parm%d"), Idx)));
+	}
+
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAssetInfo);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetNodeInfo);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetParameters);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetParmIntValues);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetParmFloatValues);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetParmStringValues);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetParmChoiceLists);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(SetParmIntValues);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(SetParmFloatValues);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetStringBufLength);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetString);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(ParmHasExpression);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(ParmHasTag);
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetAssetInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_AssetInfo* AssetInfo)
+{
+	Active()->NumCalls++;
+	FMemory::Memzero(*AssetInfo);
+	AssetInfo->nodeId = NodeId;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetNodeInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_NodeInfo* NodeInfo)
+{
+	Active()->NumCalls++;
+	FMemory::Memzero(*NodeInfo);
+	NodeInfo->id = NodeId;
+	NodeInfo->parmCount = Active()->ParmInfos.Num();
+	NodeInfo->parmIntValueCount = Active()->IntValues.Num();
+	NodeInfo->parmFloatValueCount = Active()->FloatValues.Num();
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetParameters(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_ParmInfo* ParmInfosArray, int Start, int Length)
+{
+	Active()->NumCalls++;
+	if (InNodeId != NodeId || Start < 0 || Start + Length > Active()->ParmInfos.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memcpy(ParmInfosArray, Active()->ParmInfos.GetData() + Start, sizeof(HAPI_ParmInfo) * Length);
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetParmIntValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, int* ValuesArray, int Start, int Length)
+{
+	Active()->NumCalls++;
+	Active()->NumValueFetchCalls++;
+	if (InNodeId != NodeId || Start < 0 || Start + Length > Active()->IntValues.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memcpy(ValuesArray, Active()->IntValues.GetData() + Start, sizeof(int) * Length);
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetParmFloatValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, float* ValuesArray, int Start, int Length)
+{
+	Active()->NumCalls++;
+	Active()->NumValueFetchCalls++;
+	if (InNodeId != NodeId || Start < 0 || Start + Length > Active()->FloatValues.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memcpy(ValuesArray, Active()->FloatValues.GetData() + Start, sizeof(float) * Length);
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetParmStringValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_Bool Evaluate, HAPI_StringHandle* ValuesArray, int Start, int Length)
+{
+	Active()->NumCalls++;
+	Active()->NumValueFetchCalls++;
+	// The fake node doesn't have any string parameter
+	return Length == 0 ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetParmChoiceLists(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_ParmChoiceInfo* ParmChoicesArray, int Start, int Length)
+{
+	Active()->NumCalls++;
+	Active()->NumValueFetchCalls++;
+	// The fake node doesn't have any choice list
+	return Length == 0 ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::SetParmIntValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, const int* ValuesArray, int Start, int Length)
+{
+	Active()->NumCalls++;
+	Active()->NumValueUploadCalls++;
+	if (InNodeId != NodeId || Start < 0 || Start + Length > Active()->IntValues.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memcpy(Active()->IntValues.GetData() + Start, ValuesArray, sizeof(int) * Length);
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::SetParmFloatValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, const float* ValuesArray, int Start, int Length)
+{
+	Active()->NumCalls++;
+	Active()->NumValueUploadCalls++;
+	if (InNodeId != NodeId || Start < 0 || Start + Length > Active()->FloatValues.Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memcpy(Active()->FloatValues.GetData() + Start, ValuesArray, sizeof(float) * Length);
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetStringBufLength(const HAPI_Session* Session, HAPI_StringHandle StringHandle, int* BufferLength)
+{
+	Active()->NumCalls++;
+	if (!Active()->Strings.IsValidIndex(StringHandle))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*BufferLength = static_cast<int>(Active()->Strings[StringHandle].size()) + 1;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::GetString(const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length)
+{
+	Active()->NumCalls++;
+	if (!Active()->Strings.IsValidIndex(StringHandle) || Length <= 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const std::string& Value = Active()->Strings[StringHandle];
+	const int32 NumChars = FMath::Min(static_cast<int32>(Value.size()), Length - 1);
+	FMemory::Memcpy(StringValue, Value.c_str(), NumChars);
+	StringValue[NumChars] = '\0';
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::ParmHasExpression(const HAPI_Session* Session, HAPI_NodeId InNodeId, const char* ParmName, int Index, HAPI_Bool* bHasExpression)
+{
+	Active()->NumCalls++;
+	*bHasExpression = false;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeParameterNode::ParmHasTag(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_ParmId ParmId, const char* TagName, HAPI_Bool* bHasTag)
+{
+	Active()->NumCalls++;
+	*bHasTag = false;
+	return HAPI_RESULT_SUCCESS;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestParametersBatchedValues, "Houdini.UnitTests.Parameters.BatchedValues", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestParametersBatchedValues::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the number of HAPI calls used to fetch and upload parameter values doesn't grow with the parameter count.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	TArray<int32> FetchCalls;
+	TArray<int32> UploadCalls;
+	for (const int32 NumParms : { 8, 128, 2048 })
+	{
+		FHoudiniTestFakeParameterNode FakeNode(NumParms, NumParms);
+		UPackage* Outer = NewObject<UPackage>(nullptr, MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("HoudiniParametersTest")), RF_Transient);
+
+		TArray<UHoudiniParameter*> CurrentParameters;
+		TArray<UHoudiniParameter*> NewParameters;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniParameterTranslator::BuildAllParameters(
+			FakeNode.NodeId, Outer, CurrentParameters, NewParameters, true, true, nullptr, FString()), true, return false);
+		HOUDINI_TEST_EQUAL_ON_FAIL(NewParameters.Num(), NumParms * 2, return false);
+
+		// The values must match the node's
+		bool bValuesMatch = true;
+		for (int32 Idx = 0; Idx < NewParameters.Num(); ++Idx)
+		{
+			const HAPI_ParmInfo& ParmInfo = FakeNode.ParmInfos[Idx];
+			if (UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(NewParameters[Idx]))
+			{
+				for (int32 Component = 0; Component < ParmInfo.size; ++Component)
+					bValuesMatch &= FloatParam->GetValue(Component).Get(0.0f) == FakeNode.FloatValues[ParmInfo.floatValuesIndex + Component];
+			}
+			else if (UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(NewParameters[Idx]))
+			{
+				bValuesMatch &= IntParam->GetValue(0).Get(-1) == FakeNode.IntValues[ParmInfo.intValuesIndex];
+			}
+			else
+			{
+				bValuesMatch = false;
+			}
+		}
+		HOUDINI_TEST_EQUAL(bValuesMatch, true);
+		FetchCalls.Add(FakeNode.NumValueFetchCalls);
+
+		// Change every parameter and upload them
+		for (UHoudiniParameter* Param : NewParameters)
+		{
+			if (UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(Param))
+				FloatParam->SetValueAt(-1.0f, 1);
+			else if (UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(Param))
+				IntParam->SetValueAt(-1, 0);
+			Param->MarkChanged(true);
+		}
+
+		HOUDINI_TEST_EQUAL(FHoudiniParameterTranslator::UploadChangedParameters(NewParameters, FakeNode.NodeId), true);
+		UploadCalls.Add(FakeNode.NumValueUploadCalls);
+
+		int32 NumStillChanged = 0;
+		for (UHoudiniParameter* Param : NewParameters)
+			NumStillChanged += Param->HasChanged() ? 1 : 0;
+		HOUDINI_TEST_EQUAL(NumStillChanged, 0);
+
+		bool bUploadedValuesMatch = true;
+		for (const HAPI_ParmInfo& ParmInfo : FakeNode.ParmInfos)
+		{
+			if (ParmInfo.type == HAPI_PARMTYPE_FLOAT)
+				bUploadedValuesMatch &= FakeNode.FloatValues[ParmInfo.floatValuesIndex + 1] == -1.0f;
+			else
+				bUploadedValuesMatch &= FakeNode.IntValues[ParmInfo.intValuesIndex] == -1;
+		}
+		HOUDINI_TEST_EQUAL(bUploadedValuesMatch, true);
+	}
+
+	for (int32 Idx = 1; Idx < FetchCalls.Num(); ++Idx)
+	{
+		HOUDINI_TEST_EQUAL(FetchCalls[Idx], FetchCalls[0]);
+		HOUDINI_TEST_EQUAL(UploadCalls[Idx], UploadCalls[0]);
+	}
+
+	// Contiguous float and int values are sent with one call per type
+	HOUDINI_TEST_EQUAL(UploadCalls[0], 2);
+
+	return true;
+}
+
 #endif
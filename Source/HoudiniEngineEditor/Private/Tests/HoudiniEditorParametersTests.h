@@ -29,6 +29,10 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 #include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include <string>
 
 // Class for containing static member variables for the tests
 class FHoudiniEditorParametersTests
@@ -38,4 +42,42 @@ public:
 	static FString TestHDAPath;
 };
 
+// Replaces the HAPI functions used to build and upload parameters with fakes simulating a node
+// with float and int parameters, so that the parameter translator can be tested without a session.
+// Counts the HAPI calls made. The original functions are restored on destruction.
+class FHoudiniTestFakeParameterNode : public FHoudiniTestFakeHoudiniApi
+{
+public:
+	FHoudiniTestFakeParameterNode(int32 InNumFloatParms, int32 InNumIntParms);
+
+	static constexpr HAPI_NodeId NodeId = 42;
+
+	// Number of calls to GetParmIntValues / GetParmFloatValues / GetParmStringValues / GetParmChoiceLists
+	int32 NumValueFetchCalls = 0;
+	// Number of calls to SetParmIntValues / SetParmFloatValues
+	int32 NumValueUploadCalls = 0;
+
+	TArray<HAPI_ParmInfo> ParmInfos;
+	TArray<float> FloatValues;
+	TArray<int> IntValues;
+	TArray<std::string> Strings;
+
+private:
+	static FHoudiniTestFakeParameterNode* Active() { return GetActive<FHoudiniTestFakeParameterNode>(); }
+
+	static HAPI_Result GetAssetInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_AssetInfo* AssetInfo);
+	static HAPI_Result GetNodeInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_NodeInfo* NodeInfo);
+	static HAPI_Result GetParameters(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_ParmInfo* ParmInfosArray, int Start, int Length);
+	static HAPI_Result GetParmIntValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, int* ValuesArray, int Start, int Length);
+	static HAPI_Result GetParmFloatValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, float* ValuesArray, int Start, int Length);
+	static HAPI_Result GetParmStringValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_Bool Evaluate, HAPI_StringHandle* ValuesArray, int Start, int Length);
+	static HAPI_Result GetParmChoiceLists(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_ParmChoiceInfo* ParmChoicesArray, int Start, int Length);
+	static HAPI_Result SetParmIntValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, const int* ValuesArray, int Start, int Length);
+	static HAPI_Result SetParmFloatValues(const HAPI_Session* Session, HAPI_NodeId InNodeId, const float* ValuesArray, int Start, int Length);
+	static HAPI_Result GetStringBufLength(const HAPI_Session* Session, HAPI_StringHandle StringHandle, int* BufferLength);
+	static HAPI_Result GetString(const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length);
+	static HAPI_Result ParmHasExpression(const HAPI_Session* Session, HAPI_NodeId InNodeId, const char* ParmName, int Index, HAPI_Bool* bHasExpression);
+	static HAPI_Result ParmHasTag(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_ParmId ParmId, const char* TagName, HAPI_Bool* bHasTag);
+};
+
 #endif
@@ -0,0 +1,229 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestAnimation.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "UnrealAnimationTranslator.h"
+
+#include "Misc/AutomationTest.h"
+
+void
+FHoudiniEditorTestAnimation::CreateDeepSkeleton(FReferenceSkeleton& OutRefSkeleton, int32 InNumBones, FRandomStream& InRandom)
+{
+	OutRefSkeleton.Empty(InNumBones);
+
+	FReferenceSkeletonModifier Modifier(OutRefSkeleton, nullptr);
+	int32 ChainEnd = INDEX_NONE;
+	for (int32 BoneIdx = 0; BoneIdx < InNumBones; BoneIdx++)
+	{
+		// Every 4th bone branches off the chain, the others extend it
+		const int32 ParentIdx = (BoneIdx > 0 && BoneIdx % 4 == 0) ? FMath::Max(ChainEnd - 1, 0) : ChainEnd;
+		if (BoneIdx % 4 != 0 || BoneIdx == 0)
+			ChainEnd = BoneIdx;
+
+		const FName BoneName(*FString::Printf(TEXT("bone_%d"), BoneIdx));
+		Modifier.Add(FMeshBoneInfo(BoneName, BoneName.ToString(), ParentIdx), CreateRandomLocalTransform(InRandom));
+	}
+}
+
+FTransform
+FHoudiniEditorTestAnimation::CreateRandomLocalTransform(FRandomStream& InRandom)
+{
+	// Scales stay uniform: FTransform composition is only associative for those.
+	return FTransform(
+		FQuat(InRandom.GetUnitVector(), InRandom.FRandRange(-PI, PI)),
+		InRandom.GetUnitVector() * InRandom.FRandRange(0.0, 10.0),
+		FVector(InRandom.FRandRange(0.98, 1.02)));
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestAnimationComponentSpacePoses, "Houdini.UnitTests.Animation.ComponentSpacePoses", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestAnimationComponentSpacePoses::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the component space pose evaluator matches the per bone parent chain walks on a deep skeleton.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumBones = 300;
+	constexpr int32 NumFrames = 8;
+	constexpr double Tolerance = 1e-4;
+
+	FRandomStream Random(5678);
+	FReferenceSkeleton RefSkeleton;
+	FHoudiniEditorTestAnimation::CreateDeepSkeleton(RefSkeleton, NumBones, Random);
+	HOUDINI_TEST_EQUAL_ON_FAIL(RefSkeleton.GetRawBoneNum(), NumBones, return false);
+
+	// Reference pose
+	TArray<FTransform> RefPose;
+	FUnrealAnimationTranslator::GetComponentSpaceTransforms(RefPose, RefSkeleton);
+	HOUDINI_TEST_EQUAL_ON_FAIL(RefPose.Num(), NumBones, return false);
+
+	int32 NumRefPoseMismatches = 0;
+	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+	{
+		if (!RefPose[BoneIdx].Equals(FUnrealAnimationTranslator::GetCompSpaceTransformForBone(RefSkeleton, BoneIdx), Tolerance))
+			NumRefPoseMismatches++;
+	}
+	HOUDINI_TEST_EQUAL(NumRefPoseMismatches, 0);
+
+	// Animated frames, some bones without tracks
+	TArray<FTransform> LocalPoses;
+	LocalPoses.Init(FTransform::Identity, NumBones * NumFrames);
+	TArray<TMap<int, FTransform>> Frames;
+	Frames.SetNum(NumFrames);
+	for (int32 FrameIdx = 0; FrameIdx < NumFrames; FrameIdx++)
+	{
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+		{
+			if (BoneIdx % 7 == 3)
+				continue;
+
+			const FTransform LocalTransform = FHoudiniEditorTestAnimation::CreateRandomLocalTransform(Random);
+			LocalPoses[FrameIdx * NumBones + BoneIdx] = LocalTransform;
+			Frames[FrameIdx].Add(BoneIdx, LocalTransform);
+		}
+	}
+
+	FHoudiniComponentSpacePoseEvaluator PoseEvaluator;
+	PoseEvaluator.Init(RefSkeleton);
+	HOUDINI_TEST_EQUAL(PoseEvaluator.GetNumBones(), NumBones);
+
+	TArray<FTransform> ComponentSpacePoses;
+	PoseEvaluator.EvaluateFrames(LocalPoses, NumFrames, ComponentSpacePoses);
+	HOUDINI_TEST_EQUAL_ON_FAIL(ComponentSpacePoses.Num(), NumBones * NumFrames, return false);
+
+	int32 NumPoseMismatches = 0;
+	for (int32 FrameIdx = 0; FrameIdx < NumFrames; FrameIdx++)
+	{
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+		{
+			const FTransform Expected = FUnrealAnimationTranslator::GetCompSpacePoseTransformForBoneMap(Frames[FrameIdx], RefSkeleton, BoneIdx);
+			if (!ComponentSpacePoses[FrameIdx * NumBones + BoneIdx].Equals(Expected, Tolerance))
+				NumPoseMismatches++;
+		}
+	}
+	HOUDINI_TEST_EQUAL(NumPoseMismatches, 0);
+
+	// Same hierarchy with the bones stored in reverse order, children before their parents
+	TArray<int32> ReversedParents;
+	TArray<FTransform> ReversedLocalPose;
+	ReversedParents.SetNum(NumBones);
+	ReversedLocalPose.SetNum(NumBones);
+	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+	{
+		const int32 ParentIdx = RefSkeleton.GetParentIndex(BoneIdx);
+		ReversedParents[NumBones - 1 - BoneIdx] = ParentIdx == INDEX_NONE ? INDEX_NONE : NumBones - 1 - ParentIdx;
+		ReversedLocalPose[NumBones - 1 - BoneIdx] = LocalPoses[BoneIdx];
+	}
+
+	FHoudiniComponentSpacePoseEvaluator ReversedEvaluator;
+	ReversedEvaluator.Init(ReversedParents);
+
+	TArray<FTransform> ReversedComponentSpacePose;
+	ReversedComponentSpacePose.SetNum(NumBones);
+	ReversedEvaluator.Evaluate(ReversedLocalPose, ReversedComponentSpacePose);
+
+	int32 NumReversedMismatches = 0;
+	for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+	{
+		if (!ReversedComponentSpacePose[NumBones - 1 - BoneIdx].Equals(ComponentSpacePoses[BoneIdx], Tolerance))
+			NumReversedMismatches++;
+	}
+	HOUDINI_TEST_EQUAL(NumReversedMismatches, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestAnimationComponentSpaceBenchmark, "Houdini.UnitTests.Animation.ComponentSpaceBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestAnimationComponentSpaceBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Time the evaluation of a long animation with per bone parent chain walks and with the pose evaluator.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumBones = 150;
+	constexpr int32 NumFrames = 1000;
+
+	FRandomStream Random(91011);
+	FReferenceSkeleton RefSkeleton;
+	FHoudiniEditorTestAnimation::CreateDeepSkeleton(RefSkeleton, NumBones, Random);
+
+	TArray<FTransform> LocalPoses;
+	TArray<TMap<int, FTransform>> Frames;
+	LocalPoses.SetNum(NumBones * NumFrames);
+	Frames.SetNum(NumFrames);
+	for (int32 FrameIdx = 0; FrameIdx < NumFrames; FrameIdx++)
+	{
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+		{
+			const FTransform LocalTransform = FHoudiniEditorTestAnimation::CreateRandomLocalTransform(Random);
+			LocalPoses[FrameIdx * NumBones + BoneIdx] = LocalTransform;
+			Frames[FrameIdx].Add(BoneIdx, LocalTransform);
+		}
+	}
+
+	// Parent chain walks for each bone of each frame
+	double StartTime = FPlatformTime::Seconds();
+	TArray<FTransform> ChainWalkPoses;
+	ChainWalkPoses.SetNumUninitialized(NumBones * NumFrames);
+	for (int32 FrameIdx = 0; FrameIdx < NumFrames; FrameIdx++)
+	{
+		for (int32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+			ChainWalkPoses[FrameIdx * NumBones + BoneIdx] = FUnrealAnimationTranslator::GetCompSpacePoseTransformForBoneMap(Frames[FrameIdx], RefSkeleton, BoneIdx);
+	}
+	const double ChainWalkTime = FPlatformTime::Seconds() - StartTime;
+
+	// One parent-first pass per frame, frames in parallel
+	StartTime = FPlatformTime::Seconds();
+	FHoudiniComponentSpacePoseEvaluator PoseEvaluator;
+	PoseEvaluator.Init(RefSkeleton);
+	TArray<FTransform> EvaluatedPoses;
+	PoseEvaluator.EvaluateFrames(LocalPoses, NumFrames, EvaluatedPoses);
+	const double EvaluatorTime = FPlatformTime::Seconds() - StartTime;
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(EvaluatedPoses.Num(), ChainWalkPoses.Num(), return false);
+
+	int32 NumMismatches = 0;
+	for (int32 Idx = 0; Idx < EvaluatedPoses.Num(); Idx++)
+	{
+		if (!EvaluatedPoses[Idx].Equals(ChainWalkPoses[Idx], 1e-4))
+			NumMismatches++;
+	}
+	HOUDINI_TEST_EQUAL(NumMismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d bones x %d frames: %.3fs with parent chain walks, %.3fs with the pose evaluator."),
+		NumBones, NumFrames, ChainWalkTime, EvaluatorTime));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,387 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestApiRecorder.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorParametersTests.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniApiRecorder.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniParameterFloat.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniParameterTranslator.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+
+TArray<FString>
+FHoudiniEditorTestApiRecorder::DescribeParameters(const TArray<UHoudiniParameter*>& InParameters)
+{
+	TArray<FString> Descriptions;
+	for (UHoudiniParameter* Param : InParameters)
+	{
+		if (!Param)
+		{
+			Descriptions.Add(TEXT("null"));
+			continue;
+		}
+
+		FString Description = Param->GetParameterName() + TEXT("=");
+		if (UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(Param))
+		{
+			for (int32 Component = 0; Component < FloatParam->GetNumberOfValues(); ++Component)
+				Description += FString::Printf(TEXT("%f "), FloatParam->GetValue(Component).Get(0.0f));
+		}
+		else if (UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(Param))
+		{
+			for (int32 Component = 0; Component < IntParam->GetNumberOfValues(); ++Component)
+				Description += FString::Printf(TEXT("%d "), IntParam->GetValue(Component).Get(-1));
+		}
+		Descriptions.Add(Description);
+	}
+
+	return Descriptions;
+}
+
+FHoudiniTestFakeSizedOutputs::FHoudiniTestFakeSizedOutputs()
+	: FHoudiniTestFakeHoudiniApi(this)
+{
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(ConvertTransformEulerToMatrix);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(ConvertTransformQuatToMatrix);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetPDGGraphContexts);
+}
+
+HAPI_Result
+FHoudiniTestFakeSizedOutputs::ConvertTransformEulerToMatrix(const HAPI_Session* Session, const HAPI_TransformEuler* Transform, float* Matrix)
+{
+	Active()->NumCalls++;
+	for (int32 Idx = 0; Idx < 16; ++Idx)
+		Matrix[Idx] = Transform->position[0] + Idx;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeSizedOutputs::ConvertTransformQuatToMatrix(const HAPI_Session* Session, const HAPI_Transform* Transform, float* Matrix)
+{
+	Active()->NumCalls++;
+	for (int32 Idx = 0; Idx < 16; ++Idx)
+		Matrix[Idx] = Transform->position[0] - Idx;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeSizedOutputs::GetPDGGraphContexts(const HAPI_Session* Session, HAPI_StringHandle* ContextNames, HAPI_PDG_GraphContextId* ContextIds, int Start, int Length)
+{
+	Active()->NumCalls++;
+	if (Start < 0 || Length < 0 || Start + Length > NumGraphContexts)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	for (int32 Idx = 0; Idx < Length; ++Idx)
+	{
+		ContextNames[Idx] = 100 + Start + Idx;
+		ContextIds[Idx] = 200 + Start + Idx;
+	}
+	return HAPI_RESULT_SUCCESS;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestApiRecorderRecordAndReplay, "Houdini.UnitTests.ApiRecorder.RecordAndReplay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestApiRecorderRecordAndReplay::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Record the HAPI calls made to build the parameters of a fake node, then build them again from the recording once
+	/// the fake node is gone, and check that the same parameters are built, without missing calls.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiRecorder::IsRecording() || FHoudiniApiRecorder::IsReplaying(), false, return false);
+
+	constexpr int32 NumParms = 256;
+	TArray<uint8> Recording;
+	TArray<FString> RecordedParameters;
+	double RecordedSeconds = 0.0;
+	{
+		FHoudiniTestFakeParameterNode FakeNode(NumParms, NumParms);
+		UPackage* Outer = NewObject<UPackage>(nullptr, MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("HoudiniApiRecorderTest")), RF_Transient);
+
+		// Strings must be fetched from HAPI to be recorded
+		FHoudiniEngineString::InvalidateStringCache();
+
+		FHoudiniApiRecorder::StartRecording();
+		HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::IsRecording(), true);
+
+		TArray<UHoudiniParameter*> CurrentParameters;
+		TArray<UHoudiniParameter*> NewParameters;
+		const double StartTime = FPlatformTime::Seconds();
+		const bool bBuilt = FHoudiniParameterTranslator::BuildAllParameters(
+			FakeNode.NodeId, Outer, CurrentParameters, NewParameters, true, true, nullptr, FString());
+		RecordedSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// Stop before the fake node restores the HAPI functions
+		FHoudiniApiRecorder::StopRecording(Recording);
+		HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::IsRecording(), false);
+		HOUDINI_TEST_EQUAL_ON_FAIL(bBuilt, true, return false);
+		HOUDINI_TEST_EQUAL_ON_FAIL(NewParameters.Num(), NumParms * 2, return false);
+
+		RecordedParameters = FHoudiniEditorTestApiRecorder::DescribeParameters(NewParameters);
+	}
+
+	// Replay from the data, then from a file
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("HoudiniApiRecorderTest.hapirec"));
+	ON_SCOPE_EXIT
+	{
+		FHoudiniApiRecorder::StopReplay();
+		IFileManager::Get().Delete(*FilePath);
+	};
+	HOUDINI_TEST_EQUAL_ON_FAIL(FFileHelper::SaveArrayToFile(Recording, *FilePath), true, return false);
+
+	for (const bool bFromFile : { false, true })
+	{
+		const FHoudiniApi::GetParametersFuncPtr OriginalGetParameters = FHoudiniApi::GetParameters;
+
+		FHoudiniEngineString::InvalidateStringCache();
+		const bool bStarted = bFromFile ? FHoudiniApiRecorder::StartReplay(FilePath) : FHoudiniApiRecorder::StartReplay(Recording);
+		HOUDINI_TEST_EQUAL_ON_FAIL(bStarted, true, return false);
+		HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::IsReplaying(), true);
+		HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::GetNumCalls() > 0, true);
+
+		UPackage* Outer = NewObject<UPackage>(nullptr, MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("HoudiniApiRecorderTest")), RF_Transient);
+		TArray<UHoudiniParameter*> CurrentParameters;
+		TArray<UHoudiniParameter*> NewParameters;
+		const double StartTime = FPlatformTime::Seconds();
+		const bool bBuilt = FHoudiniParameterTranslator::BuildAllParameters(
+			FHoudiniTestFakeParameterNode::NodeId, Outer, CurrentParameters, NewParameters, true, true, nullptr, FString());
+		const double ReplayedSeconds = FPlatformTime::Seconds() - StartTime;
+		const int32 NumMisses = FHoudiniApiRecorder::GetNumReplayMisses();
+
+		FHoudiniApiRecorder::StopReplay();
+		HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::IsReplaying(), false);
+		HOUDINI_TEST_EQUAL(FHoudiniApi::GetParameters == OriginalGetParameters, true);
+
+		HOUDINI_TEST_EQUAL_ON_FAIL(bBuilt, true, return false);
+		HOUDINI_TEST_EQUAL(NumMisses, 0);
+		HOUDINI_TEST_EQUAL(FHoudiniEditorTestApiRecorder::DescribeParameters(NewParameters) == RecordedParameters, true);
+
+		AddInfo(FString::Printf(TEXT("%d parameters: recorded in %.3f ms, replayed%s in %.3f ms"),
+			NumParms * 2, RecordedSeconds * 1000.0, bFromFile ? TEXT(" from a file") : TEXT(""), ReplayedSeconds * 1000.0));
+	}
+
+	// Calls that were not recorded fail
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiRecorder::StartReplay(Recording), true, return false);
+	HAPI_NodeInfo NodeInfo;
+	FMemory::Memzero(NodeInfo);
+	const HAPI_Result Result = FHoudiniApi::GetNodeInfo(nullptr, FHoudiniTestFakeParameterNode::NodeId + 1, &NodeInfo);
+	HOUDINI_TEST_EQUAL((int32)Result, (int32)HAPI_RESULT_FAILURE);
+	HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::GetNumReplayMisses(), 1);
+	FHoudiniApiRecorder::StopReplay();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestApiRecorderAttributeData, "Houdini.UnitTests.ApiRecorder.AttributeData", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestApiRecorderAttributeData::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that attribute data is recorded with its tuple size, and that strings and repeated calls are replayed.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiRecorder::IsRecording() || FHoudiniApiRecorder::IsReplaying(), false, return false);
+
+	static int32 NumAttributeCalls = 0;
+	NumAttributeCalls = 0;
+
+	const FHoudiniApi::GetAttributeFloatDataFuncPtr OriginalGetAttributeFloatData = FHoudiniApi::GetAttributeFloatData;
+	const FHoudiniApi::GetStringFuncPtr OriginalGetString = FHoudiniApi::GetString;
+	ON_SCOPE_EXIT
+	{
+		FHoudiniApiRecorder::StopReplay();
+		FHoudiniApi::GetAttributeFloatData = OriginalGetAttributeFloatData;
+		FHoudiniApi::GetString = OriginalGetString;
+	};
+
+	// Fill the values with the index of the call, so that repeated calls can be told apart
+	FHoudiniApi::GetAttributeFloatData = [](const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, const char* Name,
+		HAPI_AttributeInfo* AttributeInfo, int Stride, float* Data, int Start, int Length)
+	{
+		NumAttributeCalls++;
+		for (int32 Idx = 0; Idx < AttributeInfo->tupleSize * Length; ++Idx)
+			Data[Idx] = NumAttributeCalls * 1000.0f + Start * AttributeInfo->tupleSize + Idx;
+		return HAPI_RESULT_SUCCESS;
+	};
+	FHoudiniApi::GetString = [](const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length)
+	{
+		FCStringAnsi::Strncpy(StringValue, StringHandle == 1 ? "first" : "second", Length);
+		return HAPI_RESULT_SUCCESS;
+	};
+
+	constexpr int32 TupleSize = 3;
+	constexpr int32 NumPoints = 4;
+	HAPI_AttributeInfo AttributeInfo;
+	FMemory::Memzero(AttributeInfo);
+	AttributeInfo.exists = true;
+	AttributeInfo.tupleSize = TupleSize;
+	AttributeInfo.count = NumPoints;
+
+	TArray<float> RecordedValues[2];
+	char RecordedStrings[2][16] = {};
+
+	FHoudiniApiRecorder::StartRecording();
+	for (TArray<float>& Values : RecordedValues)
+	{
+		Values.SetNumZeroed(TupleSize * NumPoints);
+		FHoudiniApi::GetAttributeFloatData(nullptr, 1, 0, "P", &AttributeInfo, -1, Values.GetData(), 0, NumPoints);
+	}
+	FHoudiniApi::GetString(nullptr, 1, RecordedStrings[0], 16);
+	FHoudiniApi::GetString(nullptr, 2, RecordedStrings[1], 16);
+
+	TArray<uint8> Recording;
+	FHoudiniApiRecorder::StopRecording(Recording);
+	HOUDINI_TEST_EQUAL(NumAttributeCalls, 2);
+	HOUDINI_TEST_EQUAL(RecordedValues[0] != RecordedValues[1], true);
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiRecorder::StartReplay(Recording), true, return false);
+	HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::GetNumCalls(), 4);
+
+	// Replayed in the order they were recorded, the last call is served again afterwards
+	for (int32 CallIdx = 0; CallIdx < 3; ++CallIdx)
+	{
+		TArray<float> Values;
+		Values.SetNumZeroed(TupleSize * NumPoints);
+		HAPI_AttributeInfo ReplayedInfo;
+		FMemory::Memzero(ReplayedInfo);
+		ReplayedInfo.tupleSize = TupleSize;
+		const HAPI_Result Result = FHoudiniApi::GetAttributeFloatData(nullptr, 1, 0, "P", &ReplayedInfo, -1, Values.GetData(), 0, NumPoints);
+		HOUDINI_TEST_EQUAL((int32)Result, (int32)HAPI_RESULT_SUCCESS);
+		HOUDINI_TEST_EQUAL(Values == RecordedValues[FMath::Min(CallIdx, 1)], true);
+		HOUDINI_TEST_EQUAL((bool)ReplayedInfo.exists, true);
+		HOUDINI_TEST_EQUAL(ReplayedInfo.count, NumPoints);
+	}
+
+	// Strings are matched on their handle
+	char ReplayedStrings[2][16] = {};
+	FHoudiniApi::GetString(nullptr, 2, ReplayedStrings[1], 16);
+	FHoudiniApi::GetString(nullptr, 1, ReplayedStrings[0], 16);
+	HOUDINI_TEST_EQUAL(FString(ReplayedStrings[0]), FString(RecordedStrings[0]));
+	HOUDINI_TEST_EQUAL(FString(ReplayedStrings[1]), FString(RecordedStrings[1]));
+
+	// The attribute name is part of the call's inputs
+	TArray<float> Values;
+	Values.SetNumZeroed(TupleSize * NumPoints);
+	const HAPI_Result Result = FHoudiniApi::GetAttributeFloatData(nullptr, 1, 0, "N", &AttributeInfo, -1, Values.GetData(), 0, NumPoints);
+	HOUDINI_TEST_EQUAL((int32)Result, (int32)HAPI_RESULT_FAILURE);
+	HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::GetNumReplayMisses(), 1);
+	HOUDINI_TEST_EQUAL(NumAttributeCalls, 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestApiRecorderSizedOutputs, "Houdini.UnitTests.ApiRecorder.SizedOutputs", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestApiRecorderSizedOutputs::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the outputs whose size isn't given by the following arguments are fully recorded and replayed: the
+	/// 16 floats of the transform to matrix conversions, and the names of the PDG graph contexts, followed by their ids.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiRecorder::IsRecording() || FHoudiniApiRecorder::IsReplaying(), false, return false);
+	ON_SCOPE_EXIT { FHoudiniApiRecorder::StopReplay(); };
+
+	constexpr int32 NumContexts = FHoudiniTestFakeSizedOutputs::NumGraphContexts;
+
+	HAPI_TransformEuler TransformEuler;
+	FMemory::Memzero(TransformEuler);
+	TransformEuler.position[0] = 10.0f;
+
+	HAPI_Transform TransformQuat;
+	FMemory::Memzero(TransformQuat);
+	TransformQuat.position[0] = 20.0f;
+
+	TArray<float> RecordedEulerMatrix;
+	TArray<float> RecordedQuatMatrix;
+	TArray<HAPI_StringHandle> RecordedContextNames;
+	TArray<HAPI_PDG_GraphContextId> RecordedContextIds;
+	TArray<uint8> Recording;
+	{
+		FHoudiniTestFakeSizedOutputs FakeApi;
+
+		RecordedEulerMatrix.SetNumZeroed(16);
+		RecordedQuatMatrix.SetNumZeroed(16);
+		RecordedContextNames.SetNumZeroed(NumContexts);
+		RecordedContextIds.SetNumZeroed(NumContexts);
+
+		FHoudiniApiRecorder::StartRecording();
+		HOUDINI_TEST_EQUAL((int32)FHoudiniApi::ConvertTransformEulerToMatrix(nullptr, &TransformEuler, RecordedEulerMatrix.GetData()), (int32)HAPI_RESULT_SUCCESS);
+		HOUDINI_TEST_EQUAL((int32)FHoudiniApi::ConvertTransformQuatToMatrix(nullptr, &TransformQuat, RecordedQuatMatrix.GetData()), (int32)HAPI_RESULT_SUCCESS);
+		HOUDINI_TEST_EQUAL((int32)FHoudiniApi::GetPDGGraphContexts(nullptr, RecordedContextNames.GetData(), RecordedContextIds.GetData(), 0, NumContexts), (int32)HAPI_RESULT_SUCCESS);
+
+		// Stop before the fake functions are restored
+		FHoudiniApiRecorder::StopRecording(Recording);
+		HOUDINI_TEST_EQUAL(FakeApi.NumCalls.load(), 3);
+	}
+
+	HOUDINI_TEST_EQUAL(RecordedEulerMatrix[15], 25.0f);
+	HOUDINI_TEST_EQUAL(RecordedQuatMatrix[15], 5.0f);
+	HOUDINI_TEST_EQUAL(RecordedContextNames[NumContexts - 1], 100 + NumContexts - 1);
+	HOUDINI_TEST_EQUAL(RecordedContextIds[NumContexts - 1], 200 + NumContexts - 1);
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiRecorder::StartReplay(Recording), true, return false);
+	HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::GetNumCalls(), 3);
+
+	// The whole matrices are replayed
+	TArray<float> EulerMatrix;
+	EulerMatrix.SetNumZeroed(16);
+	HOUDINI_TEST_EQUAL((int32)FHoudiniApi::ConvertTransformEulerToMatrix(nullptr, &TransformEuler, EulerMatrix.GetData()), (int32)HAPI_RESULT_SUCCESS);
+	HOUDINI_TEST_EQUAL(EulerMatrix == RecordedEulerMatrix, true);
+
+	TArray<float> QuatMatrix;
+	QuatMatrix.SetNumZeroed(16);
+	HOUDINI_TEST_EQUAL((int32)FHoudiniApi::ConvertTransformQuatToMatrix(nullptr, &TransformQuat, QuatMatrix.GetData()), (int32)HAPI_RESULT_SUCCESS);
+	HOUDINI_TEST_EQUAL(QuatMatrix == RecordedQuatMatrix, true);
+
+	// All the names are replayed, and the ids are not shifted by the names
+	TArray<HAPI_StringHandle> ContextNames;
+	TArray<HAPI_PDG_GraphContextId> ContextIds;
+	ContextNames.SetNumZeroed(NumContexts);
+	ContextIds.SetNumZeroed(NumContexts);
+	HOUDINI_TEST_EQUAL((int32)FHoudiniApi::GetPDGGraphContexts(nullptr, ContextNames.GetData(), ContextIds.GetData(), 0, NumContexts), (int32)HAPI_RESULT_SUCCESS);
+	HOUDINI_TEST_EQUAL(ContextNames == RecordedContextNames, true);
+	HOUDINI_TEST_EQUAL(ContextIds == RecordedContextIds, true);
+
+	HOUDINI_TEST_EQUAL(FHoudiniApiRecorder::GetNumReplayMisses(), 0);
+	FHoudiniApiRecorder::StopReplay();
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,61 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+class UHoudiniParameter;
+
+class FHoudiniEditorTestApiRecorder
+{
+public:
+	// Returns a "name=values" description of each parameter, to compare parameters built from different calls.
+	static TArray<FString> DescribeParameters(const TArray<UHoudiniParameter*>& InParameters);
+};
+
+// Replaces the HAPI functions whose outputs are sized per function by the recorder (the transform to matrix
+// conversions, and the PDG graph contexts) with fakes filling their outputs with distinct values.
+// Counts the HAPI calls made. The original functions are restored on destruction.
+class FHoudiniTestFakeSizedOutputs : public FHoudiniTestFakeHoudiniApi
+{
+public:
+	FHoudiniTestFakeSizedOutputs();
+
+	static constexpr int32 NumGraphContexts = 3;
+
+private:
+	static FHoudiniTestFakeSizedOutputs* Active() { return GetActive<FHoudiniTestFakeSizedOutputs>(); }
+
+	static HAPI_Result ConvertTransformEulerToMatrix(const HAPI_Session* Session, const HAPI_TransformEuler* Transform, float* Matrix);
+	static HAPI_Result ConvertTransformQuatToMatrix(const HAPI_Session* Session, const HAPI_Transform* Transform, float* Matrix);
+	static HAPI_Result GetPDGGraphContexts(const HAPI_Session* Session, HAPI_StringHandle* ContextNames, HAPI_PDG_GraphContextId* ContextIds, int Start, int Length);
+};
+
+#endif
@@ -0,0 +1,165 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestApiTrace.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniApiTrace.h"
+
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+const FHoudiniApiCallStats*
+FHoudiniEditorTestApiTrace::FindStats(
+	const TArray<FHoudiniApiCallStats>& InStats, const FString& InFunctionName, int64 InSessionId, const FString& InContext)
+{
+	return InStats.FindByPredicate([&](const FHoudiniApiCallStats& Stat)
+	{
+		return Stat.FunctionName == InFunctionName && Stat.SessionId == InSessionId && Stat.Context == InContext;
+	});
+}
+
+int64
+FHoudiniEditorTestApiTrace::GetHistogramTotal(const FHoudiniApiCallStats& InStats)
+{
+	int64 Total = 0;
+	for (int32 Bucket = 0; Bucket < FHoudiniApiCallStats::NumLatencyBuckets; ++Bucket)
+		Total += InStats.LatencyHistogram[Bucket];
+	return Total;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestApiTraceStubTable, "Houdini.UnitTests.ApiTrace.StubTable", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestApiTraceStubTable::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Trace calls to the empty stubs of the FHoudiniApi table, and check the calls, failures, payloads, sessions and
+	/// contexts recorded, and that stopping restores the table.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniApiTrace::IsTracing(), false, return false);
+
+	// Use the stubs, so that no session is needed
+	const FHoudiniApi::GetParmIntValuesFuncPtr OriginalGetParmIntValues = FHoudiniApi::GetParmIntValues;
+	const FHoudiniApi::SetAttributeFloatDataFuncPtr OriginalSetAttributeFloatData = FHoudiniApi::SetAttributeFloatData;
+	FHoudiniApi::GetParmIntValues = &FHoudiniApi::GetParmIntValuesEmptyStub;
+	FHoudiniApi::SetAttributeFloatData = &FHoudiniApi::SetAttributeFloatDataEmptyStub;
+
+	FHoudiniApiTrace::Reset();
+	FHoudiniApiTrace::Start();
+	HOUDINI_TEST_EQUAL(FHoudiniApiTrace::IsTracing(), true);
+	HOUDINI_TEST_EQUAL(FHoudiniApi::GetParmIntValues != &FHoudiniApi::GetParmIntValuesEmptyStub, true);
+
+	HAPI_Session SessionA;
+	SessionA.type = HAPI_SESSION_THRIFT;
+	SessionA.id = 1;
+	HAPI_Session SessionB = SessionA;
+	SessionB.id = 2;
+
+	constexpr int32 NumValues = 8;
+	constexpr int32 NumParmCalls = 10;
+	int Values[NumValues] = {};
+	for (int32 Idx = 0; Idx < NumParmCalls; ++Idx)
+		FHoudiniApi::GetParmIntValues(&SessionA, 0, Values, 0, NumValues);
+
+	constexpr int32 NumPoints = 5;
+	constexpr int32 NumAttributeCalls = 64;
+	float Positions[NumPoints * 3] = {};
+	HAPI_AttributeInfo AttributeInfo;
+	FMemory::Memzero(AttributeInfo);
+	AttributeInfo.tupleSize = 3;
+	{
+		// The calls made by the worker threads are attributed to the game thread's context
+		FHoudiniApiTraceScope TraceScope(TEXT("TestContext"));
+		ParallelFor(NumAttributeCalls, [&](int32 Idx)
+		{
+			FHoudiniApi::SetAttributeFloatData(&SessionB, 0, 0, "P", &AttributeInfo, Positions, 0, NumPoints);
+		});
+	}
+
+	FHoudiniApiTrace::Stop();
+	HOUDINI_TEST_EQUAL(FHoudiniApiTrace::IsTracing(), false);
+	HOUDINI_TEST_EQUAL(FHoudiniApi::GetParmIntValues == &FHoudiniApi::GetParmIntValuesEmptyStub, true);
+	HOUDINI_TEST_EQUAL(FHoudiniApi::SetAttributeFloatData == &FHoudiniApi::SetAttributeFloatDataEmptyStub, true);
+
+	// Calls made once stopped are not recorded
+	FHoudiniApi::GetParmIntValues(&SessionA, 0, Values, 0, NumValues);
+
+	FHoudiniApi::GetParmIntValues = OriginalGetParmIntValues;
+	FHoudiniApi::SetAttributeFloatData = OriginalSetAttributeFloatData;
+
+	// Other HAPI calls might have been made during the test if a session is running, so only look for ours
+	const TArray<FHoudiniApiCallStats> Stats = FHoudiniApiTrace::GetStats();
+
+	const FHoudiniApiCallStats* ParmStats = FHoudiniEditorTestApiTrace::FindStats(Stats, TEXT("GetParmIntValues"), SessionA.id, FString());
+	HOUDINI_TEST_NOT_NULL(ParmStats);
+	if (ParmStats)
+	{
+		HOUDINI_TEST_EQUAL(ParmStats->NumCalls, (int64)NumParmCalls);
+		// The stubs always fail
+		HOUDINI_TEST_EQUAL(ParmStats->NumFailures, (int64)NumParmCalls);
+		HOUDINI_TEST_EQUAL(ParmStats->PayloadBytes, (int64)(NumParmCalls * NumValues * sizeof(int)));
+		HOUDINI_TEST_EQUAL(FHoudiniEditorTestApiTrace::GetHistogramTotal(*ParmStats), (int64)NumParmCalls);
+	}
+
+	const FHoudiniApiCallStats* AttributeStats = FHoudiniEditorTestApiTrace::FindStats(Stats, TEXT("SetAttributeFloatData"), SessionB.id, TEXT("TestContext"));
+	HOUDINI_TEST_NOT_NULL(AttributeStats);
+	if (AttributeStats)
+	{
+		HOUDINI_TEST_EQUAL(AttributeStats->NumCalls, (int64)NumAttributeCalls);
+		HOUDINI_TEST_EQUAL(AttributeStats->PayloadBytes, (int64)(NumAttributeCalls * NumPoints * 3 * sizeof(float)));
+		HOUDINI_TEST_EQUAL(FHoudiniEditorTestApiTrace::GetHistogramTotal(*AttributeStats), (int64)NumAttributeCalls);
+	}
+
+	// CSV: a header and one line per entry
+	TArray<FString> CSVLines;
+	FHoudiniApiTrace::ToCSV(Stats).ParseIntoArrayLines(CSVLines);
+	HOUDINI_TEST_EQUAL(CSVLines.Num(), Stats.Num() + 1);
+	if (CSVLines.Num() > 0)
+		HOUDINI_TEST_EQUAL(CSVLines[0].StartsWith(TEXT("Function,Session,Context,Calls")), true);
+
+	// JSON: one call object per entry
+	TSharedPtr<FJsonObject> Json;
+	HOUDINI_TEST_EQUAL(FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FHoudiniApiTrace::ToJson(Stats)), Json), true);
+	if (Json.IsValid())
+	{
+		HOUDINI_TEST_EQUAL(Json->GetArrayField(TEXT("calls")).Num(), Stats.Num());
+		HOUDINI_TEST_EQUAL(Json->GetArrayField(TEXT("latency_buckets")).Num(), FHoudiniApiCallStats::NumLatencyBuckets);
+	}
+
+	FHoudiniApiTrace::Reset();
+	HOUDINI_TEST_EQUAL(FHoudiniApiTrace::GetStats().Num(), 0);
+
+	return true;
+}
+
+#endif
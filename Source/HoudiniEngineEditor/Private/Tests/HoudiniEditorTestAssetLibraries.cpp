@@ -0,0 +1,214 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestAssetLibraries.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniAsset.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineUtils.h"
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+#include <string>
+
+UHoudiniAsset*
+FHoudiniEditorTestAssetLibraries::CreateTestHoudiniAsset(const FString& InHdaName)
+{
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("HoudiniEngine"));
+	if (!Plugin.IsValid())
+		return nullptr;
+
+	const FString HdaPath = FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(Plugin->GetContentDir(), TEXT("Test"), TEXT("hda"), InHdaName));
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *HdaPath) || Bytes.Num() <= 0)
+		return nullptr;
+
+	UHoudiniAsset* HoudiniAsset = NewObject<UHoudiniAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	HoudiniAsset->CreateAsset(Bytes.GetData(), Bytes.GetData() + Bytes.Num(), HdaPath);
+	return HoudiniAsset;
+}
+
+bool
+FHoudiniEditorTestAssetLibraries::InstantiateAndDelete(const UHoudiniAsset* InHoudiniAsset, HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	if (!FHoudiniEngineUtils::LoadHoudiniAsset(InHoudiniAsset, OutAssetLibraryId))
+		return false;
+
+	TArray<HAPI_StringHandle> AssetNames;
+	if (!FHoudiniEngineUtils::GetSubAssetNames(OutAssetLibraryId, AssetNames) || AssetNames.Num() <= 0)
+		return false;
+
+	std::string AssetName;
+	if (!FHoudiniEngineString(AssetNames[0]).ToStdString(AssetName))
+		return false;
+
+	HAPI_NodeId NodeId = -1;
+	if (FHoudiniApi::CreateNode(FHoudiniEngine::Get().GetSession(), -1, AssetName.c_str(), nullptr, false, &NodeId) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	return FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NodeId) == HAPI_RESULT_SUCCESS;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestAssetLibrariesRegistry, "Houdini.UnitTests.AssetLibraries.Registry", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestAssetLibrariesRegistry::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that loading the same HDA twice reuses its library, and that invalidating the registry or changing the HDA
+	/// loads it again.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestUtils::CreateSessionIfInvalid(), true, return false);
+
+	UHoudiniAsset* HoudiniAsset = FHoudiniEditorTestAssetLibraries::CreateTestHoudiniAsset(TEXT("TestBox.hda"));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(HoudiniAsset, return false);
+
+	const bool bWasEnabled = FHoudiniEngineUtils::IsAssetLibraryCacheEnabled();
+	FHoudiniEngineUtils::SetAssetLibraryCacheEnabled(true);
+
+	// Count the library loads made through HAPI
+	static int32 NumLoads = 0;
+	static decltype(FHoudiniApi::LoadAssetLibraryFromFile) OriginalLoadFromFile = nullptr;
+	static decltype(FHoudiniApi::LoadAssetLibraryFromMemory) OriginalLoadFromMemory = nullptr;
+	NumLoads = 0;
+	OriginalLoadFromFile = FHoudiniApi::LoadAssetLibraryFromFile;
+	OriginalLoadFromMemory = FHoudiniApi::LoadAssetLibraryFromMemory;
+	FHoudiniApi::LoadAssetLibraryFromFile = [](const HAPI_Session* Session, const char* FilePath, HAPI_Bool AllowOverwrite, HAPI_AssetLibraryId* LibraryId)
+	{
+		NumLoads++;
+		return OriginalLoadFromFile(Session, FilePath, AllowOverwrite, LibraryId);
+	};
+	FHoudiniApi::LoadAssetLibraryFromMemory = [](const HAPI_Session* Session, const char* LibraryBuffer, int LibraryBufferLength, HAPI_Bool AllowOverwrite, HAPI_AssetLibraryId* LibraryId)
+	{
+		NumLoads++;
+		return OriginalLoadFromMemory(Session, LibraryBuffer, LibraryBufferLength, AllowOverwrite, LibraryId);
+	};
+
+	HAPI_AssetLibraryId FirstLibraryId = -1;
+	HAPI_AssetLibraryId SecondLibraryId = -1;
+	HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::LoadHoudiniAsset(HoudiniAsset, FirstLibraryId), true);
+	HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::LoadHoudiniAsset(HoudiniAsset, SecondLibraryId), true);
+	HOUDINI_TEST_EQUAL(NumLoads, 1);
+	HOUDINI_TEST_EQUAL(SecondLibraryId, FirstLibraryId);
+
+	// A copy of the same HDA shares the library
+	UHoudiniAsset* CopiedAsset = FHoudiniEditorTestAssetLibraries::CreateTestHoudiniAsset(TEXT("TestBox.hda"));
+	HOUDINI_TEST_NOT_NULL(CopiedAsset);
+	if (CopiedAsset)
+	{
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::LoadHoudiniAsset(CopiedAsset, SecondLibraryId), true);
+		HOUDINI_TEST_EQUAL(NumLoads, 1);
+		HOUDINI_TEST_EQUAL(SecondLibraryId, FirstLibraryId);
+	}
+
+	// Once invalidated, the HDA is loaded again
+	FHoudiniEngineUtils::InvalidateAssetLibraryCache();
+	HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::LoadHoudiniAsset(HoudiniAsset, SecondLibraryId), true);
+	HOUDINI_TEST_EQUAL(NumLoads, 2);
+
+	// A different HDA gets its own library
+	UHoudiniAsset* OtherAsset = FHoudiniEditorTestAssetLibraries::CreateTestHoudiniAsset(TEXT("TestParams.hda"));
+	HOUDINI_TEST_NOT_NULL(OtherAsset);
+	if (OtherAsset)
+	{
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::LoadHoudiniAsset(OtherAsset, SecondLibraryId), true);
+		HOUDINI_TEST_EQUAL(NumLoads, 3);
+		HOUDINI_TEST_EQUAL(SecondLibraryId != FirstLibraryId, true);
+	}
+
+	FHoudiniApi::LoadAssetLibraryFromFile = OriginalLoadFromFile;
+	FHoudiniApi::LoadAssetLibraryFromMemory = OriginalLoadFromMemory;
+	FHoudiniEngineUtils::SetAssetLibraryCacheEnabled(bWasEnabled);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestAssetLibrariesInstantiationBenchmark, "Houdini.UnitTests.AssetLibraries.InstantiationBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestAssetLibrariesInstantiationBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Instantiate the same HDA 100 times, loading its library every time and then through the registry.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestUtils::CreateSessionIfInvalid(), true, return false);
+
+	UHoudiniAsset* HoudiniAsset = FHoudiniEditorTestAssetLibraries::CreateTestHoudiniAsset(TEXT("TestBox.hda"));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(HoudiniAsset, return false);
+
+	constexpr int32 NumInstantiations = 100;
+	const bool bWasEnabled = FHoudiniEngineUtils::IsAssetLibraryCacheEnabled();
+
+	const auto InstantiateAll = [this, HoudiniAsset](TSet<HAPI_AssetLibraryId>& OutLibraryIds)
+	{
+		int32 NumFailures = 0;
+		for (int32 Idx = 0; Idx < NumInstantiations; ++Idx)
+		{
+			HAPI_AssetLibraryId AssetLibraryId = -1;
+			if (FHoudiniEditorTestAssetLibraries::InstantiateAndDelete(HoudiniAsset, AssetLibraryId))
+				OutLibraryIds.Add(AssetLibraryId);
+			else
+				NumFailures++;
+		}
+		return NumFailures;
+	};
+
+	FHoudiniEngineUtils::SetAssetLibraryCacheEnabled(false);
+	TSet<HAPI_AssetLibraryId> UncachedLibraryIds;
+	double StartTime = FPlatformTime::Seconds();
+	HOUDINI_TEST_EQUAL(InstantiateAll(UncachedLibraryIds), 0);
+	const double UncachedTime = FPlatformTime::Seconds() - StartTime;
+
+	FHoudiniEngineUtils::SetAssetLibraryCacheEnabled(true);
+	TSet<HAPI_AssetLibraryId> CachedLibraryIds;
+	StartTime = FPlatformTime::Seconds();
+	HOUDINI_TEST_EQUAL(InstantiateAll(CachedLibraryIds), 0);
+	const double CachedTime = FPlatformTime::Seconds() - StartTime;
+
+	// Every cached instantiation used the same library
+	HOUDINI_TEST_EQUAL(CachedLibraryIds.Num(), 1);
+
+	AddInfo(FString::Printf(TEXT("%d instantiations: %.3fs loading the library each time (%d library ids), %.3fs with the library registry."),
+		NumInstantiations, UncachedTime, UncachedLibraryIds.Num(), CachedTime));
+
+	FHoudiniEngineUtils::SetAssetLibraryCacheEnabled(bWasEnabled);
+
+	return true;
+}
+
+#endif
@@ -36,6 +36,14 @@
 #include "GenericPlatform/GenericPlatformProcess.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "HoudiniEditorUnitTestUtils.h"
+#include "HoudiniEngineBakeUtils.h"
+#include "HoudiniRuntimeSettings.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Misc/ScopeExit.h"
+#include "StaticMeshAttributes.h"
 
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestInstancesMeshes, "Houdini.UnitTests.Baking.Meshes", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 
@@ -320,6 +328,195 @@ bool FHoudiniEditorTestBakingGroupedToBlueprint::RunTest(const FString& Paramete
 }
 
 
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestBakeNameAllocator, "Houdini.UnitTests.Baking.NameAllocator", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 
-#endif
+bool FHoudiniEditorTestBakeNameAllocator::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the bake name allocator hands out the same names as the sequential search, without a Houdini session.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// Creates an outer that already contains a few objects with names based on "Rock"
+	auto CreateOuter = []()
+	{
+		UPackage* Outer = NewObject<UPackage>(nullptr, MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("HoudiniBakeNameAllocatorTest")), RF_Transient);
+		NewObject<UObject>(Outer, TEXT("Rock"), RF_Transient);
+		NewObject<UObject>(Outer, TEXT("Rock_1"), RF_Transient);
+		NewObject<UObject>(Outer, TEXT("Rock_3"), RF_Transient);
+		NewObject<UObject>(Outer, TEXT("Tree_1"), RF_Transient);
+		return Outer;
+	};
+
+	const TArray<FString> RequestedNames = { TEXT("Rock"), TEXT("Rock"), TEXT("Tree"), TEXT("Rock"), TEXT("Tree"), TEXT("Tree"), TEXT("Rock_3"), TEXT("Rock") };
+
+	// Reference: sequential search
+	TArray<FString> ExpectedNames;
+	{
+		UPackage* Outer = CreateOuter();
+		for (const FString& Name : RequestedNames)
+		{
+			const FString UniqueName = FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(Outer, UObject::StaticClass(), Name);
+			NewObject<UObject>(Outer, *UniqueName, RF_Transient);
+			ExpectedNames.Add(UniqueName);
+		}
+	}
+
+	// Allocator
+	{
+		FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(FHoudiniBakeNameAllocator::GetActive(), return false);
+
+		UPackage* Outer = CreateOuter();
+		for (int32 Index = 0; Index < RequestedNames.Num(); ++Index)
+		{
+			const FString UniqueName = FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(Outer, UObject::StaticClass(), RequestedNames[Index]);
+			HOUDINI_TEST_EQUAL(UniqueName, ExpectedNames[Index]);
+			NewObject<UObject>(Outer, *UniqueName, RF_Transient);
+		}
+
+		// A name that is released during the bake is handed out again, like the sequential search would.
+		UObject* Rock2 = StaticFindObjectFast(nullptr, Outer, FName(TEXT("Rock_2")));
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(Rock2, return false);
+		Rock2->Rename(TEXT("Pebble"), nullptr, REN_DontCreateRedirectors | REN_NonTransactional);
+		FHoudiniBakeNameAllocator::GetActive()->ReleaseName(Outer, FName(TEXT("Rock_2")));
 
+		const FString ReusedName = FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(Outer, UObject::StaticClass(), TEXT("Rock"));
+		HOUDINI_TEST_EQUAL(ReusedName, FString(TEXT("Rock_2")));
+	}
+
+	HOUDINI_TEST_NULL(FHoudiniBakeNameAllocator::GetActive());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestBakeNameAllocatorReplace, "Houdini.UnitTests.Baking.NameAllocatorReplace", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestBakeNameAllocatorReplace::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the bake name allocator follows the sequential search when spawns fail and when replace mode
+	/// destroys previously baked actors, without a Houdini session.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// Spawns actors, fails spawns and destroys actors in a new world, returning the names that were handed out
+	auto RunBake = [](TArray<FString>& OutNames)
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+		if (!World)
+			return false;
+		ON_SCOPE_EXIT { World->DestroyWorld(false); };
+
+		ULevel* Level = World->PersistentLevel;
+		auto SpawnRock = [World, Level, &OutNames]()
+		{
+			FActorSpawnParameters SpawnInfo;
+			SpawnInfo.OverrideLevel = Level;
+			SpawnInfo.Name = FName(FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(Level, AActor::StaticClass(), TEXT("Rock")));
+			OutNames.Add(SpawnInfo.Name.ToString());
+			return World->SpawnActor<AActor>(SpawnInfo);
+		};
+
+		// A previous bake
+		TArray<AActor*> PreviousActors;
+		for (int32 Index = 0; Index < 4; ++Index)
+			PreviousActors.Add(SpawnRock());
+
+		// Failed spawns: the names are handed out, but no actor is created
+		OutNames.Add(FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(Level, AActor::StaticClass(), TEXT("Rock")));
+		OutNames.Add(FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(Level, AActor::StaticClass(), TEXT("Rock")));
+		SpawnRock();
+
+		// Replace mode: the previous bake's actors are destroyed, then new ones are baked
+		World->DestroyActor(PreviousActors[1]);
+		World->DestroyActor(PreviousActors[2]);
+		for (int32 Index = 0; Index < 4; ++Index)
+			SpawnRock();
+
+		return true;
+	};
+
+	// Reference: sequential search
+	TArray<FString> ExpectedNames;
+	HOUDINI_TEST_EQUAL_ON_FAIL(RunBake(ExpectedNames), true, return false);
+
+	// The same failed spawn gets the same name twice
+	HOUDINI_TEST_EQUAL_ON_FAIL(ExpectedNames.Num(), 11, return false);
+	HOUDINI_TEST_EQUAL(ExpectedNames[4], ExpectedNames[5]);
+	HOUDINI_TEST_EQUAL(ExpectedNames[5], ExpectedNames[6]);
+
+	// Allocator
+	TArray<FString> AllocatedNames;
+	{
+		FHoudiniScopedBakeNameAllocator ScopedNameAllocator;
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(FHoudiniBakeNameAllocator::GetActive(), return false);
+		HOUDINI_TEST_EQUAL_ON_FAIL(RunBake(AllocatedNames), true, return false);
+	}
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(AllocatedNames.Num(), ExpectedNames.Num(), return false);
+	for (int32 Index = 0; Index < ExpectedNames.Num(); ++Index)
+		HOUDINI_TEST_EQUAL(AllocatedNames[Index], ExpectedNames[Index]);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestBakeDeduplicateHash, "Houdini.UnitTests.Baking.DeduplicateHash", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestBakeDeduplicateHash::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that identical temporary meshes with their own copies of identical temporary materials have the same bake
+	/// hash, and that a change in the material content changes the hash. Does not need a Houdini session.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const FString TemporaryCookFolder = GetDefault<UHoudiniRuntimeSettings>()->DefaultTemporaryCookFolder;
+
+	// Creates a one triangle mesh and its own material instance, in their own temporary packages
+	auto CreateTemporaryMesh = [&TemporaryCookFolder](const FString& InName, float InRoughness)
+	{
+		UPackage* MaterialPackage = CreatePackage(*(TemporaryCookFolder / TEXT("HoudiniBakeHashTest_MI_") + InName));
+		UMaterialInstanceConstant* MaterialInstance = NewObject<UMaterialInstanceConstant>(MaterialPackage, *(TEXT("MI_") + InName), RF_Transient);
+		MaterialInstance->SetParentEditorOnly(UMaterial::GetDefaultMaterial(MD_Surface));
+		MaterialInstance->SetScalarParameterValueEditorOnly(FName(TEXT("Roughness")), InRoughness);
+
+		UPackage* MeshPackage = CreatePackage(*(TemporaryCookFolder / TEXT("HoudiniBakeHashTest_SM_") + InName));
+		UStaticMesh* StaticMesh = NewObject<UStaticMesh>(MeshPackage, *(TEXT("SM_") + InName), RF_Transient);
+		StaticMesh->AddSourceModel();
+		FMeshDescription* MeshDescription = StaticMesh->CreateMeshDescription(0);
+		FStaticMeshAttributes(*MeshDescription).Register();
+
+		TVertexAttributesRef<FVector3f> VertexPositions = MeshDescription->GetVertexPositions();
+		const FPolygonGroupID PolygonGroupID = MeshDescription->CreatePolygonGroup();
+		TArray<FVertexInstanceID> VertexInstanceIDs;
+		for (const FVector3f& Position : { FVector3f(0.0f, 0.0f, 0.0f), FVector3f(100.0f, 0.0f, 0.0f), FVector3f(0.0f, 100.0f, 0.0f) })
+		{
+			const FVertexID VertexID = MeshDescription->CreateVertex();
+			VertexPositions[VertexID] = Position;
+			VertexInstanceIDs.Add(MeshDescription->CreateVertexInstance(VertexID));
+		}
+		MeshDescription->CreateTriangle(PolygonGroupID, VertexInstanceIDs);
+		StaticMesh->CommitMeshDescription(0);
+
+		StaticMesh->SetStaticMaterials({ FStaticMaterial(MaterialInstance, FName(TEXT("Material"))) });
+		return StaticMesh;
+	};
+
+	UStaticMesh* MeshA = CreateTemporaryMesh(TEXT("A"), 0.5f);
+	UStaticMesh* MeshB = CreateTemporaryMesh(TEXT("B"), 0.5f);
+	UStaticMesh* MeshC = CreateTemporaryMesh(TEXT("C"), 0.75f);
+
+	FSHAHash HashA, HashB, HashC;
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineBakeUtils::GetStaticMeshBakeHash(MeshA, TemporaryCookFolder, HashA), true, return false);
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineBakeUtils::GetStaticMeshBakeHash(MeshB, TemporaryCookFolder, HashB), true, return false);
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineBakeUtils::GetStaticMeshBakeHash(MeshC, TemporaryCookFolder, HashC), true, return false);
+
+	// Materials in different packages, but with the same content
+	HOUDINI_TEST_EQUAL(HashA.ToString(), HashB.ToString());
+
+	// Different material content
+	HOUDINI_TEST_NOT_EQUAL(HashA.ToString(), HashC.ToString());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,236 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestBrushes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HCsgUtils.h"
+
+#include "Builders/CubeBuilder.h"
+#include "Components/BrushComponent.h"
+#include "Engine/Polys.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Model.h"
+#include "UObject/StrongObjectPtr.h"
+
+ABrush*
+FHoudiniEditorTestBrushes::CreateCubeBrush(UWorld* InWorld, const FVector& InLocation, double InSize, EBrushType InBrushType)
+{
+	ABrush* Brush = InWorld->SpawnActor<ABrush>(InLocation, FRotator::ZeroRotator);
+	if (!IsValid(Brush))
+		return nullptr;
+
+	Brush->BrushType = InBrushType;
+	Brush->Brush = NewObject<UModel>(Brush, NAME_None, RF_Transactional);
+	Brush->Brush->Initialize(nullptr, true);
+	Brush->Brush->Polys = NewObject<UPolys>(Brush->Brush, NAME_None, RF_Transactional);
+	Brush->GetBrushComponent()->Brush = Brush->Brush;
+
+	UCubeBuilder* Builder = NewObject<UCubeBuilder>();
+	Builder->X = InSize;
+	Builder->Y = InSize;
+	Builder->Z = InSize;
+	Builder->Build(InWorld, Brush);
+
+	return Brush;
+}
+
+bool
+FHoudiniEditorTestBrushes::AreModelsEqual(const UModel* InA, const UModel* InB)
+{
+	if (!IsValid(InA) || !IsValid(InB))
+		return false;
+
+	if (InA->Points.Num() != InB->Points.Num() || InA->Nodes.Num() != InB->Nodes.Num() || InA->Surfs.Num() != InB->Surfs.Num())
+		return false;
+
+	for (int32 Idx = 0; Idx < InA->Points.Num(); Idx++)
+	{
+		if (!InA->Points[Idx].Equals(InB->Points[Idx]))
+			return false;
+	}
+
+	for (int32 Idx = 0; Idx < InA->Nodes.Num(); Idx++)
+	{
+		if (InA->Nodes[Idx].NumVertices != InB->Nodes[Idx].NumVertices)
+			return false;
+	}
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestBrushesModelCache, "Houdini.UnitTests.Brushes.ModelCache", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestBrushesModelCache::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that unchanged brush sets reuse their model, and that moving a brush builds the same model as a full rebuild.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(World, return false);
+	ON_SCOPE_EXIT { World->DestroyWorld(false); };
+
+	// An additive cube carved by a grid of small subtractive cubes
+	TArray<ABrush*> Brushes;
+	Brushes.Add(FHoudiniEditorTestBrushes::CreateCubeBrush(World, FVector::ZeroVector, 1000.0, Brush_Add));
+	for (int32 X = 0; X < 4; X++)
+	{
+		for (int32 Y = 0; Y < 4; Y++)
+			Brushes.Add(FHoudiniEditorTestBrushes::CreateCubeBrush(World, FVector(X * 200.0 - 300.0, Y * 200.0 - 300.0, 500.0), 100.0, Brush_Subtract));
+	}
+
+	for (ABrush* Brush : Brushes)
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(Brush, return false);
+
+	UHCsgUtils::EmptyModelCache();
+
+	TStrongObjectPtr<UModel> Model(UHCsgUtils::FindOrBuildModelFromBrushes(Brushes));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(Model.Get(), return false);
+	HOUDINI_TEST_EQUAL(Model->Points.Num() > 0, true);
+
+	// Same brushes: the same model is returned
+	HOUDINI_TEST_EQUAL(UHCsgUtils::FindOrBuildModelFromBrushes(Brushes) == Model.Get(), true);
+
+	// The cached model matches a full rebuild
+	TStrongObjectPtr<UModel> RebuiltModel(UHCsgUtils::BuildModelFromBrushes(Brushes));
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestBrushes::AreModelsEqual(Model.Get(), RebuiltModel.Get()), true);
+
+	// Moving a brush builds a new model, matching a full rebuild
+	const uint64 OriginalHash = UHCsgUtils::GetBrushesHash(Brushes);
+	const FVector OriginalLocation = Brushes[5]->GetActorLocation();
+	Brushes[5]->SetActorLocation(OriginalLocation + FVector(50.0, 0.0, 0.0));
+	HOUDINI_TEST_EQUAL(UHCsgUtils::GetBrushesHash(Brushes) != OriginalHash, true);
+
+	TStrongObjectPtr<UModel> MovedModel(UHCsgUtils::FindOrBuildModelFromBrushes(Brushes));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(MovedModel.Get(), return false);
+	HOUDINI_TEST_EQUAL(MovedModel.Get() != Model.Get(), true);
+
+	TStrongObjectPtr<UModel> RebuiltMovedModel(UHCsgUtils::BuildModelFromBrushes(Brushes));
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestBrushes::AreModelsEqual(MovedModel.Get(), RebuiltMovedModel.Get()), true);
+
+	// Moving it back finds the first model again
+	Brushes[5]->SetActorLocation(OriginalLocation);
+	HOUDINI_TEST_EQUAL(UHCsgUtils::GetBrushesHash(Brushes) == OriginalHash, true);
+	HOUDINI_TEST_EQUAL(UHCsgUtils::FindOrBuildModelFromBrushes(Brushes) == Model.Get(), true);
+
+	// Brush order matters for CSG, so it is part of the key
+	TArray<ABrush*> ReorderedBrushes = Brushes;
+	ReorderedBrushes.Swap(1, 2);
+	HOUDINI_TEST_EQUAL(UHCsgUtils::GetBrushesHash(ReorderedBrushes) != UHCsgUtils::GetBrushesHash(Brushes), true);
+
+	// A cached model that is no longer valid is rebuilt
+	Model->MarkAsGarbage();
+	TStrongObjectPtr<UModel> ReplacedModel(UHCsgUtils::FindOrBuildModelFromBrushes(Brushes));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(ReplacedModel.Get(), return false);
+	HOUDINI_TEST_EQUAL(ReplacedModel.Get() != Model.Get(), true);
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestBrushes::AreModelsEqual(ReplacedModel.Get(), RebuiltModel.Get()), true);
+	HOUDINI_TEST_EQUAL(UHCsgUtils::FindOrBuildModelFromBrushes(Brushes) == ReplacedModel.Get(), true);
+
+	UHCsgUtils::EmptyModelCache();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestBrushesModelCacheBenchmark, "Houdini.UnitTests.Brushes.ModelCacheBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestBrushesModelCacheBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Time the update of hundreds of brush inputs after moving one brush, with full rebuilds and with the model cache.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumBrushSets = 100;
+	constexpr int32 NumSubtractiveBrushes = 3;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(World, return false);
+	ON_SCOPE_EXIT { World->DestroyWorld(false); };
+
+	// Each brush input combines an additive cube with the subtractive cubes that intersect it
+	TArray<TArray<ABrush*>> BrushSets;
+	BrushSets.SetNum(NumBrushSets);
+	for (int32 SetIdx = 0; SetIdx < NumBrushSets; SetIdx++)
+	{
+		const FVector Center(SetIdx * 1000.0, 0.0, 0.0);
+		BrushSets[SetIdx].Add(FHoudiniEditorTestBrushes::CreateCubeBrush(World, Center, 400.0, Brush_Add));
+		for (int32 SubIdx = 0; SubIdx < NumSubtractiveBrushes; SubIdx++)
+			BrushSets[SetIdx].Add(FHoudiniEditorTestBrushes::CreateCubeBrush(World, Center + FVector(0.0, SubIdx * 150.0 - 150.0, 200.0), 80.0, Brush_Subtract));
+	}
+
+	UHCsgUtils::EmptyModelCache();
+
+	TArray<TStrongObjectPtr<UModel>> Models;
+	Models.SetNum(NumBrushSets);
+	for (int32 SetIdx = 0; SetIdx < NumBrushSets; SetIdx++)
+		Models[SetIdx].Reset(UHCsgUtils::FindOrBuildModelFromBrushes(BrushSets[SetIdx]));
+
+	// Move a single brush
+	ABrush* MovedBrush = BrushSets[NumBrushSets / 2][1];
+	MovedBrush->SetActorLocation(MovedBrush->GetActorLocation() + FVector(0.0, 40.0, 0.0));
+
+	double StartTime = FPlatformTime::Seconds();
+	TArray<TStrongObjectPtr<UModel>> RebuiltModels;
+	RebuiltModels.SetNum(NumBrushSets);
+	for (int32 SetIdx = 0; SetIdx < NumBrushSets; SetIdx++)
+		RebuiltModels[SetIdx].Reset(UHCsgUtils::BuildModelFromBrushes(BrushSets[SetIdx]));
+	const double RebuildTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	TArray<TStrongObjectPtr<UModel>> CachedModels;
+	CachedModels.SetNum(NumBrushSets);
+	for (int32 SetIdx = 0; SetIdx < NumBrushSets; SetIdx++)
+		CachedModels[SetIdx].Reset(UHCsgUtils::FindOrBuildModelFromBrushes(BrushSets[SetIdx]));
+	const double CachedTime = FPlatformTime::Seconds() - StartTime;
+
+	// Only the set with the moved brush was rebuilt, and all models match the full rebuild
+	int32 NumRebuiltSets = 0;
+	int32 NumMismatches = 0;
+	for (int32 SetIdx = 0; SetIdx < NumBrushSets; SetIdx++)
+	{
+		if (CachedModels[SetIdx].Get() != Models[SetIdx].Get())
+			NumRebuiltSets++;
+
+		if (!FHoudiniEditorTestBrushes::AreModelsEqual(CachedModels[SetIdx].Get(), RebuiltModels[SetIdx].Get()))
+			NumMismatches++;
+	}
+	HOUDINI_TEST_EQUAL(NumRebuiltSets, 1);
+	HOUDINI_TEST_EQUAL(NumMismatches, 0);
+
+	UHCsgUtils::EmptyModelCache();
+
+	AddInfo(FString::Printf(TEXT("%d brushes in %d sets, one moved: %.3fs with full rebuilds, %.3fs with the model cache."),
+		NumBrushSets * (NumSubtractiveBrushes + 1), NumBrushSets, RebuildTime, CachedTime));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,223 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestCookCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniAssetComponent.h"
+#include "HoudiniCookCache.h"
+#include "HoudiniOutput.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "Engine/StaticMesh.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+
+namespace
+{
+	constexpr int32 NumBoxesA = 1;
+	constexpr int32 NumBoxesB = 2;
+
+	// Returns the bounds and vertex count of the HAC's single static mesh output, as a string to store in the test context
+	FString GetOutputMeshBounds(UHoudiniAssetComponent* HAC)
+	{
+		TArray<UHoudiniOutput*> Outputs;
+		HAC->GetOutputs(Outputs);
+		if (Outputs.Num() != 1 || Outputs[0]->GetOutputObjects().Num() != 1)
+			return FString();
+
+		for (const auto& OutputObjectPair : Outputs[0]->GetOutputObjects())
+		{
+			const UStaticMesh* StaticMesh = Cast<UStaticMesh>(OutputObjectPair.Value.OutputObject);
+			if (IsValid(StaticMesh))
+				return FString::Printf(TEXT("%s %d"), *StaticMesh->GetBoundingBox().ToString(), StaticMesh->GetNumVertices(0));
+		}
+
+		return FString();
+	}
+
+	// Sets the box count parameter and waits for the HAC to update, without requesting a recook (which bypasses the cache)
+	bool SetNumBoxes(FAutomationTestBase* InTest, const TSharedPtr<FHoudiniTestContext>& Context, int32 InNumBoxes)
+	{
+		UHoudiniParameterInt* Parameter = FHoudiniEditorUnitTestUtils::GetTypedParameter<UHoudiniParameterInt>(Context->HAC, "int_numboxes");
+		if (!InTest->TestNotNull(TEXT("int_numboxes"), Parameter))
+			return false;
+
+		Parameter->SetValueAt(InNumBoxes, 0);
+		Parameter->MarkChanged(true);
+		Context->bCookInProgress = true;
+		Context->bPostOutputDelegateCalled = false;
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestCookCacheRestore, "Houdini.UnitTests.CookCache.Restore", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestCookCacheRestore::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Flip a parameter A -> B -> A and check that the second A is restored from the cook cache, without cooking,
+	/// with the same output as the first A.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	const bool bWasCookCacheEnabled = GetDefault<UHoudiniRuntimeSettings>()->bEnableCookCache;
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/HoudiniEngine/Test/hda/TestParams"), FTransform::Identity, false));
+	HOUDINI_TEST_EQUAL_ON_FAIL(Context->IsValid(), true, return false);
+
+	// Proxy meshes are not cached
+	Context->HAC->bOverrideGlobalProxyStaticMeshSettings = true;
+	Context->HAC->bEnableProxyStaticMeshOverride = false;
+
+	// A: cooked, and stored. The cache is only enabled once the initial cook is done, so that it is not stored.
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableCookCache = true;
+		FHoudiniCookCache::Clear();
+		FHoudiniCookCache::ResetStats();
+
+		SetNumBoxes(this, Context, NumBoxesA);
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		Context->Data.Add(TEXT("BoundsA"), GetOutputMeshBounds(Context->HAC));
+		HOUDINI_TEST_EQUAL(Context->Data[TEXT("BoundsA")].IsEmpty(), false);
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetNumHits(), 0);
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetNumEntries(), 1);
+		return true;
+	}));
+
+	// B: cooked, and stored
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		SetNumBoxes(this, Context, NumBoxesB);
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		HOUDINI_TEST_NOT_EQUAL(GetOutputMeshBounds(Context->HAC), Context->Data[TEXT("BoundsA")]);
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetNumHits(), 0);
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetNumEntries(), 2);
+		Context->Data.Add(TEXT("CookCountB"), FString::FromInt(Context->HAC->GetAssetCookCount()));
+		return true;
+	}));
+
+	// A again: restored from the cache, the asset is not cooked
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		SetNumBoxes(this, Context, NumBoxesA);
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetNumHits(), 1);
+		HOUDINI_TEST_EQUAL(FString::FromInt(Context->HAC->GetAssetCookCount()), Context->Data[TEXT("CookCountB")]);
+		HOUDINI_TEST_EQUAL(GetOutputMeshBounds(Context->HAC), Context->Data[TEXT("BoundsA")]);
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [bWasCookCacheEnabled]()
+	{
+		FHoudiniCookCache::Clear();
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableCookCache = bWasCookCacheEnabled;
+		return true;
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestCookCacheKey, "Houdini.UnitTests.CookCache.Key", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestCookCacheKey::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the cook key follows the parameter values: flipping a parameter back gives back the same key.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	const bool bWasCookCacheEnabled = GetDefault<UHoudiniRuntimeSettings>()->bEnableCookCache;
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/HoudiniEngine/Test/hda/TestParams"), FTransform::Identity, false));
+	HOUDINI_TEST_EQUAL_ON_FAIL(Context->IsValid(), true, return false);
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, bWasCookCacheEnabled]()
+	{
+		UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetMutableDefault<UHoudiniRuntimeSettings>();
+		ON_SCOPE_EXIT { HoudiniRuntimeSettings->bEnableCookCache = bWasCookCacheEnabled; };
+
+		HoudiniRuntimeSettings->bEnableCookCache = false;
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetCookKey(Context->HAC), (uint64)0);
+
+		HoudiniRuntimeSettings->bEnableCookCache = true;
+		UHoudiniParameterInt* Parameter = FHoudiniEditorUnitTestUtils::GetTypedParameter<UHoudiniParameterInt>(Context->HAC, "int_numboxes");
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(Parameter, return true);
+
+		Parameter->SetValueAt(1, 0);
+		const uint64 KeyA = FHoudiniCookCache::GetCookKey(Context->HAC);
+		Parameter->SetValueAt(2, 0);
+		const uint64 KeyB = FHoudiniCookCache::GetCookKey(Context->HAC);
+		Parameter->SetValueAt(1, 0);
+
+		HOUDINI_TEST_NOT_EQUAL(KeyA, (uint64)0);
+		HOUDINI_TEST_NOT_EQUAL(KeyA, KeyB);
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetCookKey(Context->HAC), KeyA);
+
+		// The mesh generation settings, on the HAC and in the global settings, change the key as well
+		const bool bWasGeneratingLightmapUVs = Context->HAC->StaticMeshBuildSettings.bGenerateLightmapUVs;
+		Context->HAC->StaticMeshBuildSettings.bGenerateLightmapUVs = !bWasGeneratingLightmapUVs;
+		HOUDINI_TEST_NOT_EQUAL(FHoudiniCookCache::GetCookKey(Context->HAC), KeyA);
+		Context->HAC->StaticMeshBuildSettings.bGenerateLightmapUVs = bWasGeneratingLightmapUVs;
+
+		const bool bWasGeneratingDoubleSided = Context->HAC->StaticMeshGenerationProperties.bGeneratedDoubleSidedGeometry;
+		Context->HAC->StaticMeshGenerationProperties.bGeneratedDoubleSidedGeometry = !bWasGeneratingDoubleSided;
+		HOUDINI_TEST_NOT_EQUAL(FHoudiniCookCache::GetCookKey(Context->HAC), KeyA);
+		Context->HAC->StaticMeshGenerationProperties.bGeneratedDoubleSidedGeometry = bWasGeneratingDoubleSided;
+
+		const bool bWasDoubleSided = HoudiniRuntimeSettings->bDoubleSidedGeometry;
+		HoudiniRuntimeSettings->bDoubleSidedGeometry = !bWasDoubleSided;
+		HOUDINI_TEST_NOT_EQUAL(FHoudiniCookCache::GetCookKey(Context->HAC), KeyA);
+		HoudiniRuntimeSettings->bDoubleSidedGeometry = bWasDoubleSided;
+
+		HOUDINI_TEST_EQUAL(FHoudiniCookCache::GetCookKey(Context->HAC), KeyA);
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,237 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestCurves.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniSplineTranslator.h"
+
+#include "Misc/AutomationTest.h"
+
+FHoudiniTestFakeCurveNode::FHoudiniTestFakeCurveNode()
+	: FHoudiniTestFakeHoudiniApi(this)
+{
+	FMemory::Memzero(PartInfo);
+	FMemory::Memzero(CurveInfo);
+
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(SetPartInfo);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(SetCurveInfo);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(SetCurveCounts);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(AddAttribute);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(SetAttributeFloatData);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(CommitGeo);
+}
+
+HAPI_Result
+FHoudiniTestFakeCurveNode::SetPartInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const HAPI_PartInfo* InPartInfo)
+{
+	Active()->NumCalls++;
+	if (InNodeId != NodeId || PartId != 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	Active()->PartInfo = *InPartInfo;
+	Active()->FloatAttributes.Empty();
+	Active()->bCommitted = false;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeCurveNode::SetCurveInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const HAPI_CurveInfo* InCurveInfo)
+{
+	Active()->NumCalls++;
+	if (InNodeId != NodeId || PartId != 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	Active()->CurveInfo = *InCurveInfo;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeCurveNode::SetCurveCounts(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const int* Counts, int Start, int Length)
+{
+	Active()->NumCalls++;
+	if (InNodeId != NodeId || PartId != 0 || Start != 0 || Length != Active()->CurveInfo.curveCount)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	Active()->CurveCounts = TArray<int32>(Counts, Length);
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeCurveNode::AddAttribute(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const char* Name, const HAPI_AttributeInfo* AttributeInfo)
+{
+	Active()->NumCalls++;
+	if (InNodeId != NodeId || PartId != 0 || AttributeInfo->owner != HAPI_ATTROWNER_POINT || AttributeInfo->count != Active()->PartInfo.pointCount)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	Active()->FloatAttributes.Add(UTF8_TO_TCHAR(Name));
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeCurveNode::SetAttributeFloatData(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const char* Name, const HAPI_AttributeInfo* AttributeInfo, const float* Data, int Start, int Length)
+{
+	Active()->NumCalls++;
+	TArray<float>* Values = Active()->FloatAttributes.Find(UTF8_TO_TCHAR(Name));
+	if (InNodeId != NodeId || PartId != 0 || !Values || Start != 0 || Length != AttributeInfo->count)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*Values = TArray<float>(Data, Length * AttributeInfo->tupleSize);
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeCurveNode::CommitGeo(const HAPI_Session* Session, HAPI_NodeId InNodeId)
+{
+	Active()->NumCalls++;
+	if (InNodeId != NodeId)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	Active()->bCommitted = true;
+	return HAPI_RESULT_SUCCESS;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestCurvesPointUpload, "Houdini.UnitTests.Curves.PointUpload", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestCurvesPointUpload::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Round trip a long curve through the coords string and through the point attributes uploaded by
+	/// HapiSetCurvePointAttributes, check the precision of both and compare the time they take.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumPoints = 50000;
+
+	FRandomStream Random(1234);
+	TArray<FVector> Positions;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Scales;
+	Positions.SetNum(NumPoints);
+	Rotations.SetNum(NumPoints);
+	Scales.SetNum(NumPoints);
+	for (int32 Idx = 0; Idx < NumPoints; ++Idx)
+	{
+		// Mix of large coordinates and small details
+		Positions[Idx] = FVector(
+			Random.FRandRange(-500000.0, 500000.0),
+			Random.FRandRange(-1.0, 1.0),
+			Idx * 0.0123);
+		Rotations[Idx] = FQuat(Random.GetUnitVector(), Random.FRandRange(-PI, PI));
+		Scales[Idx] = FVector(Random.FRandRange(0.1, 10.0), 1.0, Random.FRandRange(0.1, 10.0));
+	}
+
+	// Error allowed for a position sent as a float, in cm
+	const auto GetFloatTolerance = [](const FVector& InPosition)
+	{
+		return FMath::Max(InPosition.GetAbsMax(), 1.0) * 4.0 * FLT_EPSILON;
+	};
+
+	// String path
+	double StartTime = FPlatformTime::Seconds();
+	FString PositionString;
+	FHoudiniSplineTranslator::CreatePositionsString(Positions, PositionString);
+	const double StringCreationTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray<FVector> StringPositions;
+	FHoudiniSplineTranslator::ExtractStringPositions(PositionString, StringPositions);
+	HOUDINI_TEST_EQUAL_ON_FAIL(StringPositions.Num(), NumPoints, return false);
+
+	double MaxStringError = 0.0;
+	for (int32 Idx = 0; Idx < NumPoints; ++Idx)
+		MaxStringError = FMath::Max(MaxStringError, (StringPositions[Idx] - Positions[Idx]).GetAbsMax());
+
+	// Binary path
+	FHoudiniTestFakeCurveNode FakeNode;
+	StartTime = FPlatformTime::Seconds();
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniSplineTranslator::HapiSetCurvePointAttributes(FakeNode.NodeId, Positions, &Rotations, &Scales), true, return false);
+	const double BinaryUploadTime = FPlatformTime::Seconds() - StartTime;
+
+	HOUDINI_TEST_EQUAL(FakeNode.bCommitted, true);
+	HOUDINI_TEST_EQUAL(FakeNode.PartInfo.type, HAPI_PARTTYPE_CURVE);
+	HOUDINI_TEST_EQUAL(FakeNode.PartInfo.pointCount, NumPoints);
+	HOUDINI_TEST_EQUAL(FakeNode.CurveInfo.curveType, HAPI_CURVETYPE_LINEAR);
+	HOUDINI_TEST_EQUAL(FakeNode.CurveCounts.Num(), 1);
+	HOUDINI_TEST_EQUAL(FakeNode.CurveCounts[0], NumPoints);
+
+	// The upload is done in a fixed number of calls, whatever the number of points
+	HOUDINI_TEST_EQUAL(FakeNode.NumCalls.load(), 10);
+
+	const TArray<float>* UploadedPositions = FakeNode.FloatAttributes.Find(TEXT(HAPI_UNREAL_ATTRIB_POSITION));
+	const TArray<float>* UploadedRotations = FakeNode.FloatAttributes.Find(TEXT(HAPI_UNREAL_ATTRIB_ROTATION));
+	const TArray<float>* UploadedScales = FakeNode.FloatAttributes.Find(TEXT(HAPI_UNREAL_ATTRIB_SCALE));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(UploadedPositions, return false);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(UploadedRotations, return false);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(UploadedScales, return false);
+
+	TArray<FVector> BinaryPositions;
+	FHoudiniEngineUtils::ConvertHoudiniPositionToUnrealVector(*UploadedPositions, BinaryPositions);
+	HOUDINI_TEST_EQUAL_ON_FAIL(BinaryPositions.Num(), NumPoints, return false);
+
+	bool bPositionsWithinFloatPrecision = true;
+	bool bRotationsMatch = true;
+	bool bScalesMatch = true;
+	double MaxBinaryError = 0.0;
+	for (int32 Idx = 0; Idx < NumPoints; ++Idx)
+	{
+		const double Error = (BinaryPositions[Idx] - Positions[Idx]).GetAbsMax();
+		MaxBinaryError = FMath::Max(MaxBinaryError, Error);
+		bPositionsWithinFloatPrecision &= Error <= GetFloatTolerance(Positions[Idx]);
+
+		// Rotations are sent as (X, Z, Y, -W), scales as (X, Z, Y)
+		const float* Rot = UploadedRotations->GetData() + Idx * 4;
+		const FQuat RoundTripRotation(Rot[0], Rot[2], Rot[1], -Rot[3]);
+		bRotationsMatch &= RoundTripRotation.Equals(Rotations[Idx], 1e-6f);
+
+		const float* Scale = UploadedScales->GetData() + Idx * 3;
+		bScalesMatch &= FVector(Scale[0], Scale[2], Scale[1]).Equals(Scales[Idx], 1e-5f);
+	}
+
+	HOUDINI_TEST_EQUAL(bPositionsWithinFloatPrecision, true);
+	HOUDINI_TEST_EQUAL(bRotationsMatch, true);
+	HOUDINI_TEST_EQUAL(bScalesMatch, true);
+
+	// The string keeps more precision than the floats HAPI stores P as
+	HOUDINI_TEST_EQUAL(MaxStringError <= 1e-5, true);
+
+	AddInfo(FString::Printf(TEXT("%d curve points: coords string built in %.3fs (%d chars, max error %g cm), point attributes uploaded in %.3fs (max error %g cm)."),
+		NumPoints, StringCreationTime, PositionString.Len(), MaxStringError, BinaryUploadTime, MaxBinaryError));
+
+	// Rotations and scales that don't match the points are ignored
+	TArray<FQuat> TooFewRotations = { FQuat::Identity };
+	HOUDINI_TEST_EQUAL(FHoudiniSplineTranslator::HapiSetCurvePointAttributes(FakeNode.NodeId, Positions, &TooFewRotations, nullptr), true);
+	HOUDINI_TEST_NULL(FakeNode.FloatAttributes.Find(TEXT(HAPI_UNREAL_ATTRIB_ROTATION)));
+	HOUDINI_TEST_NULL(FakeNode.FloatAttributes.Find(TEXT(HAPI_UNREAL_ATTRIB_SCALE)));
+
+	return true;
+}
+
+#endif
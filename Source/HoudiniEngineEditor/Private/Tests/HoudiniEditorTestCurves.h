@@ -0,0 +1,61 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+// Replaces the HAPI functions used to author curve geometry with fakes that record the uploaded
+// part, curve and float attribute data, so that curve uploads can be tested without a session.
+// Counts the HAPI calls made. The original functions are restored on destruction.
+class FHoudiniTestFakeCurveNode : public FHoudiniTestFakeHoudiniApi
+{
+public:
+	FHoudiniTestFakeCurveNode();
+
+	static constexpr HAPI_NodeId NodeId = 42;
+
+	HAPI_PartInfo PartInfo;
+	HAPI_CurveInfo CurveInfo;
+	TArray<int32> CurveCounts;
+	TMap<FString, TArray<float>> FloatAttributes;
+	bool bCommitted = false;
+
+private:
+	static FHoudiniTestFakeCurveNode* Active() { return GetActive<FHoudiniTestFakeCurveNode>(); }
+
+	static HAPI_Result SetPartInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const HAPI_PartInfo* InPartInfo);
+	static HAPI_Result SetCurveInfo(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const HAPI_CurveInfo* InCurveInfo);
+	static HAPI_Result SetCurveCounts(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const int* Counts, int Start, int Length);
+	static HAPI_Result AddAttribute(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const char* Name, const HAPI_AttributeInfo* AttributeInfo);
+	static HAPI_Result SetAttributeFloatData(const HAPI_Session* Session, HAPI_NodeId InNodeId, HAPI_PartId PartId, const char* Name, const HAPI_AttributeInfo* AttributeInfo, const float* Data, int Start, int Length);
+	static HAPI_Result CommitGeo(const HAPI_Session* Session, HAPI_NodeId InNodeId);
+};
+
+#endif
@@ -0,0 +1,315 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestDataTables.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestStrings.h"
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniDataTableTranslator.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineString.h"
+
+#include "Engine/UserDefinedStruct.h"
+#include "Kismet2/StructureEditorUtils.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+const TArray<FString> FHoudiniTestFakeDataTablePart::Columns = { TEXT("count"), TEXT("weight"), TEXT("position"), TEXT("id"), TEXT("label") };
+
+// Indices in FHoudiniTestFakeDataTablePart::Columns
+namespace EFakeDataTableColumn
+{
+	enum Type
+	{
+		Count,
+		Weight,
+		Position,
+		Id,
+		Label
+	};
+}
+
+FHoudiniTestFakeDataTablePart::FHoudiniTestFakeDataTablePart(int32 InNumRows)
+	: FHoudiniTestFakeHoudiniApi(this)
+	, NumRows(InNumRows)
+{
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAttributeInfo);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAttributeIntData);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAttributeFloatData);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAttributeInt64Data);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAttributeStringData);
+}
+
+UUserDefinedStruct*
+FHoudiniTestFakeDataTablePart::CreateRowStruct(int32& OutStructSize, TMap<FString, FProperty*>& OutFoundProps, TMap<FString, HAPI_AttributeInfo>& OutFoundInfos)
+{
+	UUserDefinedStruct* RowStruct = FStructureEditorUtils::CreateUserDefinedStruct(
+		GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UUserDefinedStruct::StaticClass(), TEXT("TestRowStruct")), RF_Transient);
+	if (!RowStruct)
+		return nullptr;
+
+	FGuid DefaultPropId = FStructureEditorUtils::GetGuidForProperty(*TFieldIterator<FProperty>(RowStruct));
+
+	int32 AssignedIdx = 1;
+	TMap<FString, FGuid> CreatedIds;
+	for (const FString& Column : Columns)
+	{
+		HAPI_AttributeInfo AttribInfo;
+		const FString AttribName = TEXT(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX) + Column;
+		if (!FHoudiniDataTableTranslator::CreateRowStructProp(GeoId, PartId,
+			AttribName, Column, HAPI_ATTROWNER_POINT, AttribInfo, RowStruct, AssignedIdx, CreatedIds, OutFoundInfos))
+			return nullptr;
+	}
+
+	if (!FHoudiniDataTableTranslator::RemoveDefaultProp(RowStruct, DefaultPropId, OutStructSize,
+		CreatedIds, TSet<FString>(), TMap<FString, FHoudiniDataTableTranslator::TransformComponents>(), OutFoundProps))
+		return nullptr;
+
+	return RowStruct;
+}
+
+int32
+FHoudiniTestFakeDataTablePart::FindColumn(HAPI_NodeId InGeoId, HAPI_PartId InPartId, const char* Name)
+{
+	if (InGeoId != GeoId || InPartId != PartId || !Name)
+		return INDEX_NONE;
+
+	const FString AttribName = UTF8_TO_TCHAR(Name);
+	const FString Prefix = TEXT(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX);
+	if (!AttribName.StartsWith(Prefix))
+		return INDEX_NONE;
+
+	return Columns.IndexOfByKey(AttribName.Mid(Prefix.Len()));
+}
+
+bool
+FHoudiniTestFakeDataTablePart::IsValidRange(const HAPI_AttributeInfo* AttributeInfo, int Start, int Length)
+{
+	return AttributeInfo && Start >= 0 && Length >= 0 && Start + Length <= Active()->NumRows;
+}
+
+HAPI_Result
+FHoudiniTestFakeDataTablePart::GetAttributeInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeOwner Owner, HAPI_AttributeInfo* AttributeInfo)
+{
+	Active()->NumCalls++;
+	FHoudiniApi::AttributeInfo_Init(AttributeInfo);
+
+	const int32 Column = FindColumn(NodeId, InPartId, Name);
+	if (Column == INDEX_NONE || Owner != HAPI_ATTROWNER_POINT)
+		return HAPI_RESULT_SUCCESS;
+
+	AttributeInfo->exists = true;
+	AttributeInfo->owner = HAPI_ATTROWNER_POINT;
+	AttributeInfo->originalOwner = HAPI_ATTROWNER_INVALID;
+	AttributeInfo->count = Active()->NumRows;
+	AttributeInfo->tupleSize = Column == EFakeDataTableColumn::Position ? 3 : 1;
+	switch (Column)
+	{
+		case EFakeDataTableColumn::Count:
+			AttributeInfo->storage = HAPI_STORAGETYPE_INT;
+			break;
+		case EFakeDataTableColumn::Weight:
+		case EFakeDataTableColumn::Position:
+			AttributeInfo->storage = HAPI_STORAGETYPE_FLOAT;
+			break;
+		case EFakeDataTableColumn::Id:
+			AttributeInfo->storage = HAPI_STORAGETYPE_INT64;
+			break;
+		default:
+			AttributeInfo->storage = HAPI_STORAGETYPE_STRING;
+			break;
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeDataTablePart::GetAttributeIntData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, int* Data, int Start, int Length)
+{
+	Active()->NumCalls++;
+	if (FindColumn(NodeId, InPartId, Name) != EFakeDataTableColumn::Count || !IsValidRange(AttributeInfo, Start, Length))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	for (int32 Idx = 0; Idx < Length; ++Idx)
+		Data[Idx] = GetCount(Start + Idx);
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeDataTablePart::GetAttributeFloatData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, float* Data, int Start, int Length)
+{
+	Active()->NumCalls++;
+	const int32 Column = FindColumn(NodeId, InPartId, Name);
+	if (!IsValidRange(AttributeInfo, Start, Length))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	if (Column == EFakeDataTableColumn::Weight)
+	{
+		for (int32 Idx = 0; Idx < Length; ++Idx)
+			Data[Idx] = GetWeight(Start + Idx);
+	}
+	else if (Column == EFakeDataTableColumn::Position)
+	{
+		for (int32 Idx = 0; Idx < Length; ++Idx)
+		{
+			const FVector3f Position = GetPosition(Start + Idx);
+			Data[Idx * 3 + 0] = Position.X;
+			Data[Idx * 3 + 1] = Position.Y;
+			Data[Idx * 3 + 2] = Position.Z;
+		}
+	}
+	else
+	{
+		return HAPI_RESULT_INVALID_ARGUMENT;
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeDataTablePart::GetAttributeInt64Data(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, HAPI_Int64* Data, int Start, int Length)
+{
+	Active()->NumCalls++;
+	if (FindColumn(NodeId, InPartId, Name) != EFakeDataTableColumn::Id || !IsValidRange(AttributeInfo, Start, Length))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	for (int32 Idx = 0; Idx < Length; ++Idx)
+		Data[Idx] = GetId(Start + Idx);
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeDataTablePart::GetAttributeStringData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, HAPI_StringHandle* Data, int Start, int Length)
+{
+	Active()->NumCalls++;
+	if (FindColumn(NodeId, InPartId, Name) != EFakeDataTableColumn::Label || !IsValidRange(AttributeInfo, Start, Length))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	// String handle 0 is invalid
+	for (int32 Idx = 0; Idx < Length; ++Idx)
+		Data[Idx] = Start + Idx + 1;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestDataTablesPopulateRows, "Houdini.UnitTests.DataTables.PopulateRows", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestDataTablesPopulateRows::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Build the row struct and rows of a large data table from a fake point cloud, as BuildDataTable does, and check every
+	/// field of every row.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// The columns are fetched through the accessor, which splits the work between the sessions.
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestUtils::CreateSessionIfInvalid(), true, return false);
+
+	constexpr int32 NumRows = 100000;
+
+	FHoudiniEngineString::InvalidateStringCache();
+	FHoudiniTestFakeStringTable FakeStrings(NumRows, TEXT("row_"));
+	FHoudiniTestFakeDataTablePart FakePart(NumRows);
+
+	// Row struct with one property per column
+	int32 StructSize = 0;
+	TMap<FString, FProperty*> FoundProps;
+	TMap<FString, HAPI_AttributeInfo> FoundInfos;
+	UUserDefinedStruct* RowStruct = FHoudiniTestFakeDataTablePart::CreateRowStruct(StructSize, FoundProps, FoundInfos);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(RowStruct, return false);
+	HOUDINI_TEST_EQUAL_ON_FAIL(FoundProps.Num(), FHoudiniTestFakeDataTablePart::Columns.Num(), return false);
+
+	// Rows
+	uint8* RowData = (uint8*)FMemory::MallocZeroed(NumRows * StructSize);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bPopulated = FHoudiniDataTableTranslator::PopulateRowData(FakePart.GeoId, FakePart.PartId,
+		FoundProps, FoundInfos, StructSize, NumRows, RowData);
+	const double PopulateTime = FPlatformTime::Seconds() - StartTime;
+	HOUDINI_TEST_EQUAL(bPopulated, true);
+
+	const auto GetProp = [&FoundProps](const int32 InColumn)
+	{
+		return FoundProps.FindChecked(TEXT(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX) + FHoudiniTestFakeDataTablePart::Columns[InColumn]);
+	};
+
+	const FNumericProperty* CountProp = CastField<FNumericProperty>(GetProp(EFakeDataTableColumn::Count));
+	const FNumericProperty* WeightProp = CastField<FNumericProperty>(GetProp(EFakeDataTableColumn::Weight));
+	const FStructProperty* PositionProp = CastField<FStructProperty>(GetProp(EFakeDataTableColumn::Position));
+	const FNumericProperty* IdProp = CastField<FNumericProperty>(GetProp(EFakeDataTableColumn::Id));
+	const FStrProperty* LabelProp = CastField<FStrProperty>(GetProp(EFakeDataTableColumn::Label));
+	HOUDINI_TEST_NOT_NULL(CountProp);
+	HOUDINI_TEST_NOT_NULL(WeightProp);
+	HOUDINI_TEST_NOT_NULL(PositionProp);
+	HOUDINI_TEST_NOT_NULL(IdProp);
+	HOUDINI_TEST_NOT_NULL(LabelProp);
+
+	if (bPopulated && CountProp && WeightProp && PositionProp && IdProp && LabelProp)
+	{
+		HOUDINI_TEST_EQUAL(PositionProp->Struct == TBaseStructure<FVector>::Get(), true);
+
+		TArray<int32> NumMismatches;
+		NumMismatches.SetNumZeroed(FHoudiniTestFakeDataTablePart::Columns.Num());
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			const uint8* RowPtr = &RowData[Row * StructSize];
+
+			if (CountProp->GetSignedIntPropertyValue(CountProp->ContainerPtrToValuePtr<void>(RowPtr)) != FHoudiniTestFakeDataTablePart::GetCount(Row))
+				NumMismatches[EFakeDataTableColumn::Count]++;
+
+			if (WeightProp->GetFloatingPointPropertyValue(WeightProp->ContainerPtrToValuePtr<void>(RowPtr)) != FHoudiniTestFakeDataTablePart::GetWeight(Row))
+				NumMismatches[EFakeDataTableColumn::Weight]++;
+
+			if (*PositionProp->ContainerPtrToValuePtr<FVector>(RowPtr) != FVector(FHoudiniTestFakeDataTablePart::GetPosition(Row)))
+				NumMismatches[EFakeDataTableColumn::Position]++;
+
+			if (IdProp->GetSignedIntPropertyValue(IdProp->ContainerPtrToValuePtr<void>(RowPtr)) != FHoudiniTestFakeDataTablePart::GetId(Row))
+				NumMismatches[EFakeDataTableColumn::Id]++;
+
+			if (LabelProp->GetPropertyValue_InContainer(RowPtr) != FakeStrings.GetExpectedString(Row + 1))
+				NumMismatches[EFakeDataTableColumn::Label]++;
+		}
+
+		for (int32 Column = 0; Column < NumMismatches.Num(); ++Column)
+			HOUDINI_TEST_EQUAL_ON_FAIL(NumMismatches[Column], 0, AddError(FString::Printf(TEXT("Column %s has wrong values."), *FHoudiniTestFakeDataTablePart::Columns[Column])));
+	}
+
+	AddInfo(FString::Printf(TEXT("Populated %d rows of %d columns in %.3fs, %d attribute calls."),
+		NumRows, FoundProps.Num(), PopulateTime, FakePart.NumCalls.load()));
+
+	RowStruct->DestroyStruct(RowData, NumRows);
+	FMemory::Free(RowData);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+class UUserDefinedStruct;
+
+// Replaces the HAPI functions used to read data table attributes with fakes simulating a point
+// cloud with int, float, vector, int64 and string columns, so that data tables can be built without
+// a cook. String values are handles that FHoudiniTestFakeStringTable resolves to "<Prefix><Row + 1>".
+// Counts the HAPI calls made. The original functions are restored on destruction.
+class FHoudiniTestFakeDataTablePart : public FHoudiniTestFakeHoudiniApi
+{
+public:
+	FHoudiniTestFakeDataTablePart(int32 InNumRows);
+
+	static constexpr HAPI_NodeId GeoId = 42;
+	static constexpr HAPI_PartId PartId = 0;
+
+	// Column names, without the data table attribute prefix
+	static const TArray<FString> Columns;
+
+	// Expected values for each row
+	static int32 GetCount(int32 InRow) { return InRow * 3 - 7; }
+	static float GetWeight(int32 InRow) { return InRow * 0.5f + 0.25f; }
+	static FVector3f GetPosition(int32 InRow) { return FVector3f(InRow, -2.0f * InRow, 0.125f * InRow); }
+	static int64 GetId(int32 InRow) { return InRow * 10000000000ll + 1; }
+
+	int32 NumRows = 0;
+
+	// Creates a transient row struct with one property per column, as BuildDataTable does, and the properties and
+	// attribute infos to populate rows with. Returns null on failure.
+	static UUserDefinedStruct* CreateRowStruct(int32& OutStructSize, TMap<FString, FProperty*>& OutFoundProps, TMap<FString, HAPI_AttributeInfo>& OutFoundInfos);
+
+private:
+	static FHoudiniTestFakeDataTablePart* Active() { return GetActive<FHoudiniTestFakeDataTablePart>(); }
+
+	// Returns the column of a data table attribute, INDEX_NONE if it isn't one of the fake's attributes.
+	static int32 FindColumn(HAPI_NodeId InGeoId, HAPI_PartId InPartId, const char* Name);
+	static bool IsValidRange(const HAPI_AttributeInfo* AttributeInfo, int Start, int Length);
+
+	static HAPI_Result GetAttributeInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeOwner Owner, HAPI_AttributeInfo* AttributeInfo);
+	static HAPI_Result GetAttributeIntData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, int* Data, int Start, int Length);
+	static HAPI_Result GetAttributeFloatData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, float* Data, int Start, int Length);
+	static HAPI_Result GetAttributeInt64Data(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, HAPI_Int64* Data, int Start, int Length);
+	static HAPI_Result GetAttributeStringData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, HAPI_StringHandle* Data, int Start, int Length);
+};
+
+#endif
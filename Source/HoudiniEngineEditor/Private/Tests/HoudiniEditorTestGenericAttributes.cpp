@@ -0,0 +1,163 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestGenericAttributes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniGenericAttribute.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+FHoudiniTestFoundProperty
+FHoudiniEditorTestGenericAttributes::FindProperty(UObject* InObject, const FString& InPropertyName)
+{
+	FHoudiniTestFoundProperty Result;
+	FEditPropertyChain PropertyChain;
+	Result.bFound = FHoudiniGenericAttribute::TryToFindProperty(
+		InObject, InObject->GetClass(), InPropertyName, PropertyChain, Result.Property, Result.bExact, Result.Container, false);
+
+	for (FProperty* ChainProperty : PropertyChain)
+		Result.Chain.Add(ChainProperty);
+
+	return Result;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestGenericAttributesPropertyCache, "Houdini.UnitTests.GenericAttributes.PropertyCache", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestGenericAttributesPropertyCache::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the property cache resolves exact matches, matches in nested structs, partial matches and missing
+	/// properties like walking the class does, for the object the result was cached for and for other objects.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const bool bWasEnabled = FHoudiniGenericAttribute::IsPropertyCacheEnabled();
+
+	UStaticMeshComponent* FirstComponent = NewObject<UStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+	UStaticMeshComponent* SecondComponent = NewObject<UStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	const TArray<FString> PropertyNames =
+	{
+		TEXT("CastShadow"),				// Exact match
+		TEXT("castshadow"),				// Exact match, different case
+		TEXT("CollisionProfileName"),	// Exact match in the BodyInstance struct
+		TEXT("Shadow"),					// Partial matches only
+		TEXT("NoSuchPropertyOnThisClass")
+	};
+
+	for (const FString& PropertyName : PropertyNames)
+	{
+		FHoudiniGenericAttribute::SetPropertyCacheEnabled(false);
+		const FHoudiniTestFoundProperty FirstWalked = FHoudiniEditorTestGenericAttributes::FindProperty(FirstComponent, PropertyName);
+		const FHoudiniTestFoundProperty SecondWalked = FHoudiniEditorTestGenericAttributes::FindProperty(SecondComponent, PropertyName);
+
+		FHoudiniGenericAttribute::SetPropertyCacheEnabled(true);
+		const FHoudiniTestFoundProperty FirstCached = FHoudiniEditorTestGenericAttributes::FindProperty(FirstComponent, PropertyName);
+		const FHoudiniTestFoundProperty FirstFromCache = FHoudiniEditorTestGenericAttributes::FindProperty(FirstComponent, PropertyName);
+		const FHoudiniTestFoundProperty SecondFromCache = FHoudiniEditorTestGenericAttributes::FindProperty(SecondComponent, PropertyName);
+
+		HOUDINI_TEST_EQUAL_ON_FAIL(FirstCached == FirstWalked, true, AddError(FString::Printf(TEXT("Cache miss for %s differs."), *PropertyName)));
+		HOUDINI_TEST_EQUAL_ON_FAIL(FirstFromCache == FirstWalked, true, AddError(FString::Printf(TEXT("Cache hit for %s differs."), *PropertyName)));
+		HOUDINI_TEST_EQUAL_ON_FAIL(SecondFromCache == SecondWalked, true, AddError(FString::Printf(TEXT("Cache hit on another object for %s differs."), *PropertyName)));
+	}
+
+	// Sanity checks on what was walked
+	FHoudiniGenericAttribute::SetPropertyCacheEnabled(false);
+	const FHoudiniTestFoundProperty Nested = FHoudiniEditorTestGenericAttributes::FindProperty(FirstComponent, TEXT("CollisionProfileName"));
+	HOUDINI_TEST_EQUAL(Nested.bExact, true);
+	HOUDINI_TEST_EQUAL(Nested.Chain.Num(), 2);
+	HOUDINI_TEST_EQUAL(Nested.Container == &FirstComponent->BodyInstance, true);
+
+	const FHoudiniTestFoundProperty Partial = FHoudiniEditorTestGenericAttributes::FindProperty(FirstComponent, TEXT("Shadow"));
+	HOUDINI_TEST_EQUAL(Partial.bFound, true);
+	HOUDINI_TEST_EQUAL(Partial.bExact, false);
+	HOUDINI_TEST_EQUAL(Partial.Chain.Num(), 0);
+
+	const FHoudiniTestFoundProperty Missing = FHoudiniEditorTestGenericAttributes::FindProperty(FirstComponent, TEXT("NoSuchPropertyOnThisClass"));
+	HOUDINI_TEST_EQUAL(Missing.bFound, false);
+
+	FHoudiniGenericAttribute::SetPropertyCacheEnabled(bWasEnabled);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestGenericAttributesPropertyCacheBenchmark, "Houdini.UnitTests.GenericAttributes.PropertyCacheBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestGenericAttributesPropertyCacheBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Resolve a few uproperty attributes on a thousand components, as applying them to instances does, walking the class
+	/// every time and through the cache.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumComponents = 1000;
+	const TArray<FString> PropertyNames = { TEXT("CastShadow"), TEXT("CollisionProfileName"), TEXT("bVisibleInRayTracing"), TEXT("LDMaxDrawDistance") };
+
+	const bool bWasEnabled = FHoudiniGenericAttribute::IsPropertyCacheEnabled();
+
+	TArray<UStaticMeshComponent*> Components;
+	for (int32 Idx = 0; Idx < NumComponents; ++Idx)
+		Components.Add(NewObject<UStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient));
+
+	const auto FindAll = [&Components, &PropertyNames]()
+	{
+		int32 NumFound = 0;
+		for (UStaticMeshComponent* Component : Components)
+		{
+			for (const FString& PropertyName : PropertyNames)
+			{
+				if (FHoudiniEditorTestGenericAttributes::FindProperty(Component, PropertyName).bFound)
+					NumFound++;
+			}
+		}
+		return NumFound;
+	};
+
+	FHoudiniGenericAttribute::SetPropertyCacheEnabled(false);
+	double StartTime = FPlatformTime::Seconds();
+	const int32 NumWalkedFound = FindAll();
+	const double WalkTime = FPlatformTime::Seconds() - StartTime;
+
+	FHoudiniGenericAttribute::SetPropertyCacheEnabled(true);
+	StartTime = FPlatformTime::Seconds();
+	const int32 NumCachedFound = FindAll();
+	const double CachedTime = FPlatformTime::Seconds() - StartTime;
+
+	HOUDINI_TEST_EQUAL(NumCachedFound, NumWalkedFound);
+
+	AddInfo(FString::Printf(TEXT("%d components x %d properties: %.3fs walking the class, %.3fs with the property cache."),
+		NumComponents, PropertyNames.Num(), WalkTime, CachedTime));
+
+	FHoudiniGenericAttribute::SetPropertyCacheEnabled(bWasEnabled);
+
+	return true;
+}
+
+#endif
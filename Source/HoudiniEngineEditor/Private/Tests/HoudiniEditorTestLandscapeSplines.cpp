@@ -0,0 +1,236 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestLandscapeSplines.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniApiTrace.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineAttributes.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniLandscapeSplineTranslator.h"
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+
+#include <string>
+
+HAPI_NodeId
+FHoudiniEditorTestLandscapeSplines::CreateSplineNetworkNode(const int32 InNumCurves, const int32 InNumPointsPerCurve)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	HAPI_NodeId NodeId = -1;
+	if (FHoudiniApi::CreateInputNode(Session, -1, &NodeId, "LandscapeSplineNetwork") != HAPI_RESULT_SUCCESS)
+		return -1;
+
+	const int32 NumPoints = InNumCurves * InNumPointsPerCurve;
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	PartInfo.type = HAPI_PARTTYPE_CURVE;
+	PartInfo.pointCount = NumPoints;
+	PartInfo.vertexCount = NumPoints;
+	PartInfo.faceCount = InNumCurves;
+
+	HAPI_CurveInfo CurveInfo;
+	FHoudiniApi::CurveInfo_Init(&CurveInfo);
+	CurveInfo.curveType = HAPI_CURVETYPE_LINEAR;
+	CurveInfo.curveCount = InNumCurves;
+	CurveInfo.vertexCount = NumPoints;
+	CurveInfo.order = 2;
+
+	TArray<int32> CurveCounts;
+	CurveCounts.Init(InNumPointsPerCurve, InNumCurves);
+
+	// The curves are laid out on a grid, each point has a unique control point id and half width
+	TArray<float> Positions;
+	TArray<int32> PointIds;
+	TArray<float> HalfWidths;
+	Positions.SetNumUninitialized(NumPoints * 3);
+	PointIds.SetNumUninitialized(NumPoints);
+	HalfWidths.SetNumUninitialized(NumPoints);
+	for (int32 PointIdx = 0; PointIdx < NumPoints; ++PointIdx)
+	{
+		Positions[PointIdx * 3 + 0] = (PointIdx / InNumPointsPerCurve) * 10.0f;
+		Positions[PointIdx * 3 + 1] = 0.0f;
+		Positions[PointIdx * 3 + 2] = (PointIdx % InNumPointsPerCurve) * 100.0f;
+		PointIds[PointIdx] = PointIdx;
+		HalfWidths[PointIdx] = 100.0f + PointIdx % 7;
+	}
+
+	std::string LayerNames[2] = { "Dirt", "Grass" };
+	TArray<const char*> PaintLayerNames;
+	PaintLayerNames.SetNumUninitialized(InNumCurves);
+	for (int32 CurveIdx = 0; CurveIdx < InNumCurves; ++CurveIdx)
+		PaintLayerNames[CurveIdx] = LayerNames[CurveIdx % 2].c_str();
+
+	HAPI_AttributeInfo PointInfo;
+	FHoudiniApi::AttributeInfo_Init(&PointInfo);
+	PointInfo.exists = true;
+	PointInfo.owner = HAPI_ATTROWNER_POINT;
+	PointInfo.count = NumPoints;
+	PointInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HAPI_AttributeInfo PositionInfo = PointInfo;
+	PositionInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	PositionInfo.tupleSize = 3;
+
+	HAPI_AttributeInfo PointIdInfo = PointInfo;
+	PointIdInfo.storage = HAPI_STORAGETYPE_INT;
+	PointIdInfo.tupleSize = 1;
+
+	HAPI_AttributeInfo HalfWidthInfo = PointInfo;
+	HalfWidthInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	HalfWidthInfo.tupleSize = 1;
+
+	HAPI_AttributeInfo PaintLayerInfo;
+	FHoudiniApi::AttributeInfo_Init(&PaintLayerInfo);
+	PaintLayerInfo.exists = true;
+	PaintLayerInfo.owner = HAPI_ATTROWNER_PRIM;
+	PaintLayerInfo.storage = HAPI_STORAGETYPE_STRING;
+	PaintLayerInfo.count = InNumCurves;
+	PaintLayerInfo.tupleSize = 1;
+	PaintLayerInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	const bool bSuccess =
+		FHoudiniApi::SetPartInfo(Session, NodeId, 0, &PartInfo) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::SetCurveInfo(Session, NodeId, 0, &CurveInfo) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::SetCurveCounts(Session, NodeId, 0, CurveCounts.GetData(), 0, InNumCurves) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::AddAttribute(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &PositionInfo) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::SetAttributeFloatData(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &PositionInfo, Positions.GetData(), 0, NumPoints) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::AddAttribute(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_ID, &PointIdInfo) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::SetAttributeIntData(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_ID, &PointIdInfo, PointIds.GetData(), 0, NumPoints) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::AddAttribute(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_HALF_WIDTH, &HalfWidthInfo) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::SetAttributeFloatData(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_HALF_WIDTH, &HalfWidthInfo, HalfWidths.GetData(), 0, NumPoints) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::AddAttribute(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME, &PaintLayerInfo) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::SetAttributeStringData(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME, &PaintLayerInfo, PaintLayerNames.GetData(), 0, InNumCurves) == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::CommitGeo(Session, NodeId) == HAPI_RESULT_SUCCESS;
+
+	if (!bSuccess)
+	{
+		FHoudiniApi::DeleteNode(Session, NodeId);
+		return -1;
+	}
+
+	return NodeId;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestLandscapeSplinesAttributePrefetch, "Houdini.UnitTests.LandscapeSplines.AttributePrefetch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestLandscapeSplinesAttributePrefetch::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Copy the landscape spline attributes of a 10k segment network. Check that the number of HAPI calls does not
+	/// depend on the number of curves, that the attributes of each curve match what fetching the curve's range returns,
+	/// and report the time taken.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestUtils::CreateSessionIfInvalid(), true, return false);
+
+	constexpr int32 NumCurves = 10000;
+	constexpr int32 NumPointsPerCurve = 2;
+
+	const HAPI_NodeId NodeId = FHoudiniEditorTestLandscapeSplines::CreateSplineNetworkNode(NumCurves, NumPointsPerCurve);
+	HOUDINI_TEST_NOT_EQUAL_ON_FAIL(NodeId, -1, return false);
+	ON_SCOPE_EXIT
+	{
+		FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NodeId);
+	};
+
+	TArray<int32> CurvePointCounts;
+	CurvePointCounts.Init(NumPointsPerCurve, NumCurves);
+
+	const bool bWasTracing = FHoudiniApiTrace::IsTracing();
+	FHoudiniApiTrace::Reset();
+	if (!bWasTracing)
+		FHoudiniApiTrace::Start();
+
+	TArray<FLandscapeSplineCurveAttributes> CurveAttributes;
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bCopied = FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(NodeId, 0, CurvePointCounts, CurveAttributes);
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+	if (!bWasTracing)
+		FHoudiniApiTrace::Stop();
+
+	int64 NumHapiCalls = 0;
+	for (const FHoudiniApiCallStats& Stats : FHoudiniApiTrace::GetStats())
+		NumHapiCalls += Stats.NumCalls;
+	FHoudiniApiTrace::Reset();
+
+	AddInfo(FString::Printf(TEXT("Copied the landscape spline attributes of %d curves in %.3fs with %lld HAPI calls"), NumCurves, Seconds, NumHapiCalls));
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(bCopied, true, return false);
+	HOUDINI_TEST_EQUAL_ON_FAIL(CurveAttributes.Num(), NumCurves, return false);
+
+	// Each attribute is fetched once for the whole part: fetching per curve would need at least one call per curve.
+	HOUDINI_TEST_EQUAL(NumHapiCalls < NumCurves / 10, true);
+
+	// Compare a sample of the curves with their attribute ranges fetched from HAPI
+	for (int32 CurveIdx = 0; CurveIdx < NumCurves; CurveIdx += NumCurves / 10 - 1)
+	{
+		const int32 FirstPointIndex = CurveIdx * NumPointsPerCurve;
+		const FLandscapeSplineCurveAttributes& Attributes = CurveAttributes[CurveIdx];
+
+		TArray<float> Positions;
+		FHoudiniHapiAccessor Accessor(NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION);
+		HOUDINI_TEST_EQUAL(Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 3, Positions, FirstPointIndex, NumPointsPerCurve), true);
+		HOUDINI_TEST_EQUAL(Attributes.PointPositions == Positions, true);
+
+		TArray<int32> PointIds;
+		Accessor.Init(NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_ID);
+		HOUDINI_TEST_EQUAL(Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, PointIds, FirstPointIndex, NumPointsPerCurve), true);
+		HOUDINI_TEST_EQUAL(Attributes.PointIds == PointIds, true);
+
+		TArray<float> HalfWidths;
+		Accessor.Init(NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_HALF_WIDTH);
+		HOUDINI_TEST_EQUAL(Accessor.GetAttributeData(HAPI_ATTROWNER_POINT, 1, HalfWidths, FirstPointIndex, NumPointsPerCurve), true);
+		HOUDINI_TEST_EQUAL(Attributes.bHasPointHalfWidthAttribute, true);
+		HOUDINI_TEST_EQUAL(Attributes.PointHalfWidths == HalfWidths, true);
+
+		TArray<FString> PaintLayerNames;
+		Accessor.Init(NodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME);
+		HOUDINI_TEST_EQUAL(Accessor.GetAttributeData(HAPI_ATTROWNER_PRIM, 1, PaintLayerNames, CurveIdx, 1), true);
+		// The segment paint layer name is looked up by point range first, as a vertex attribute, then by prim
+		HOUDINI_TEST_EQUAL(Attributes.bHasVertexPaintLayerNameAttribute || Attributes.bHasPrimPaintLayerNameAttribute, true);
+		if (Attributes.bHasPrimPaintLayerNameAttribute && PaintLayerNames.Num() > 0)
+			HOUDINI_TEST_EQUAL(Attributes.PrimPaintLayerName, PaintLayerNames[0]);
+
+		// Attributes the part does not have
+		HOUDINI_TEST_EQUAL(Attributes.bHasPointRotationAttribute, false);
+		HOUDINI_TEST_EQUAL(Attributes.bHasPointSideFalloffAttribute, false);
+		HOUDINI_TEST_EQUAL(Attributes.VertexPerMeshSegmentData.Num(), 0);
+		HOUDINI_TEST_EQUAL(Attributes.PrimPerMeshSegmentData.Num(), 0);
+	}
+
+	return true;
+}
+
+#endif
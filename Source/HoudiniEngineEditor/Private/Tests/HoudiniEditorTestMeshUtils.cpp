@@ -0,0 +1,97 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestMeshUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniMeshUtils.h"
+
+#include "Components/SplineMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestMeshUtilsMergeMeshesHash, "Houdini.UnitTests.MeshUtils.MergeMeshesHash", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestMeshUtilsMergeMeshesHash::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the hash used to reuse merged spline meshes is stable while the spline mesh components are unchanged,
+	/// and changes with their spline params, meshes and transforms.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	UStaticMesh* const Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	UStaticMesh* const Sphere = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(Cube, return false);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(Sphere, return false);
+
+	TArray<UPrimitiveComponent*> Components;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		USplineMeshComponent* const Component = NewObject<USplineMeshComponent>(GetTransientPackage());
+		Component->SetStaticMesh(Cube);
+		Component->SetStartAndEnd(FVector(Index * 100.0, 0.0, 0.0), FVector(100.0, 0.0, 0.0), FVector((Index + 1) * 100.0, 0.0, 0.0), FVector(100.0, 0.0, 0.0), false);
+		Components.Add(Component);
+	}
+	USplineMeshComponent* const First = CastChecked<USplineMeshComponent>(Components[0]);
+
+	const uint64 Hash = FHoudiniMeshUtils::GetMergeMeshesHash(Components);
+	HOUDINI_TEST_NOT_EQUAL(Hash, (uint64)0);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+
+	// Spline params
+	First->SetEndPosition(FVector(150.0, 0.0, 0.0), false);
+	HOUDINI_TEST_NOT_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+	First->SetEndPosition(FVector(100.0, 0.0, 0.0), false);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+
+	First->SetStartRoll(0.5f, false);
+	HOUDINI_TEST_NOT_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+	First->SetStartRoll(0.0f, false);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+
+	// Mesh
+	First->SetStaticMesh(Sphere);
+	HOUDINI_TEST_NOT_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+	First->SetStaticMesh(Cube);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+
+	// Transform
+	First->SetRelativeLocation(FVector(0.0, 0.0, 10.0));
+	HOUDINI_TEST_NOT_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+	First->SetRelativeLocation(FVector::ZeroVector);
+	HOUDINI_TEST_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(Components), Hash);
+
+	// Component set
+	TArray<UPrimitiveComponent*> FewerComponents = Components;
+	FewerComponents.Pop();
+	HOUDINI_TEST_NOT_EQUAL(FHoudiniMeshUtils::GetMergeMeshesHash(FewerComponents), Hash);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestNodeSync.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEditorNodeSyncSubsystem.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+
+#include "Editor.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+
+#include <string>
+
+bool
+FHoudiniEditorTestNodeSync::CreateBoxObject(const FString& InName, HAPI_NodeId& OutObjectNodeId, HAPI_NodeId& OutBoxNodeId)
+{
+	const std::string Name = TCHAR_TO_UTF8(*InName);
+	if (FHoudiniApi::CreateNode(FHoudiniEngine::Get().GetSession(), -1, "Object/geo", Name.c_str(), true, &OutObjectNodeId) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	return FHoudiniApi::CreateNode(FHoudiniEngine::Get().GetSession(), OutObjectNodeId, "box", "box", true, &OutBoxNodeId) == HAPI_RESULT_SUCCESS;
+}
+
+FHoudiniTestRecordMergedNodes::FHoudiniTestRecordMergedNodes()
+	: FHoudiniTestFakeHoudiniApi(this)
+{
+	OriginalSetParmStringValue = FHoudiniApi::SetParmStringValue;
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(SetParmStringValue);
+}
+
+TArray<FString>
+FHoudiniTestRecordMergedNodes::ConsumeMergedNodePaths()
+{
+	TArray<FString> Paths = MoveTemp(MergedNodePaths);
+	MergedNodePaths.Reset();
+	Paths.Sort();
+	return Paths;
+}
+
+HAPI_Result
+FHoudiniTestRecordMergedNodes::SetParmStringValue(const HAPI_Session* Session, HAPI_NodeId NodeId, const char* Value, HAPI_ParmId ParmId, int Index)
+{
+	Active()->NumCalls++;
+	Active()->MergedNodePaths.Add(UTF8_TO_TCHAR(Value));
+	return Active()->OriginalSetParmStringValue(Session, NodeId, Value, ParmId, Index);
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestNodeSyncIncrementalFetch, "Houdini.UnitTests.NodeSync.IncrementalFetch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestNodeSyncIncrementalFetch::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Fetch three paths to the content browser, change one of them and fetch again. Only the changed node must be
+	/// imported again.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestUtils::CreateSessionIfInvalid(), true, return false);
+
+	UHoudiniEditorNodeSyncSubsystem* NodeSync = GEditor ? GEditor->GetEditorSubsystem<UHoudiniEditorNodeSyncSubsystem>() : nullptr;
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(NodeSync, return false);
+
+	TArray<FString> FetchPaths;
+	TArray<FString> BoxPaths;
+	TArray<HAPI_NodeId> ObjectNodeIds;
+	TArray<HAPI_NodeId> BoxNodeIds;
+	for (const TCHAR* Name : { TEXT("NodeSyncTestA"), TEXT("NodeSyncTestB"), TEXT("NodeSyncTestC") })
+	{
+		HAPI_NodeId ObjectNodeId = -1;
+		HAPI_NodeId BoxNodeId = -1;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestNodeSync::CreateBoxObject(Name, ObjectNodeId, BoxNodeId), true, return false);
+
+		FString ObjectPath;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::HapiGetAbsNodePath(ObjectNodeId, ObjectPath), true, return false);
+		FString BoxPath;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::HapiGetAbsNodePath(BoxNodeId, BoxPath), true, return false);
+
+		FetchPaths.Add(ObjectPath);
+		BoxPaths.Add(BoxPath);
+		ObjectNodeIds.Add(ObjectNodeId);
+		BoxNodeIds.Add(BoxNodeId);
+	}
+	BoxPaths.Sort();
+
+	// Record the nodes merged by the importer, these are the nodes whose outputs are rebuilt
+	FHoudiniTestRecordMergedNodes MergedNodes;
+
+	const FHoudiniNodeSyncOptions PreviousOptions = NodeSync->NodeSyncOptions;
+	ON_SCOPE_EXIT
+	{
+		NodeSync->NodeSyncOptions = PreviousOptions;
+		NodeSync->InvalidateFetchedNodes();
+
+		for (HAPI_NodeId ObjectNodeId : ObjectNodeIds)
+			FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), ObjectNodeId);
+	};
+
+	NodeSync->NodeSyncOptions.FetchNodePath = FString::Join(FetchPaths, TEXT(";"));
+	NodeSync->NodeSyncOptions.UnrealAssetName = TEXT("");
+	NodeSync->NodeSyncOptions.UnrealAssetFolder = TEXT("/Game/HoudiniEngineTests/NodeSync");
+	NodeSync->NodeSyncOptions.bFetchToWorld = false;
+	NodeSync->NodeSyncOptions.bReplaceExisting = true;
+	NodeSync->NodeSyncOptions.bOnlyFetchChangedNodes = true;
+	NodeSync->InvalidateFetchedNodes();
+
+	// The first fetch imports every box
+	NodeSync->FetchFromHoudini();
+	HOUDINI_TEST_EQUAL((int32)NodeSync->LastFetchStatus, (int32)EHoudiniNodeSyncStatus::Success);
+	HOUDINI_TEST_EQUAL(NodeSync->GetLastFetchImportedPaths().Num(), 3);
+	HOUDINI_TEST_EQUAL(MergedNodes.ConsumeMergedNodePaths() == BoxPaths, true);
+
+	// Nothing changed
+	NodeSync->FetchFromHoudini();
+	HOUDINI_TEST_EQUAL((int32)NodeSync->LastFetchStatus, (int32)EHoudiniNodeSyncStatus::Success);
+	HOUDINI_TEST_EQUAL(NodeSync->GetLastFetchImportedPaths().Num(), 0);
+	HOUDINI_TEST_EQUAL(MergedNodes.ConsumeMergedNodePaths().Num(), 0);
+
+	// Change the second box, only it is imported again
+	HOUDINI_TEST_EQUAL((int32)FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), BoxNodeIds[1], "size", 0, 3.0f), (int32)HAPI_RESULT_SUCCESS);
+	FString ChangedBoxPath;
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::HapiGetAbsNodePath(BoxNodeIds[1], ChangedBoxPath), true, return false);
+	NodeSync->FetchFromHoudini();
+	HOUDINI_TEST_EQUAL((int32)NodeSync->LastFetchStatus, (int32)EHoudiniNodeSyncStatus::Success);
+	HOUDINI_TEST_EQUAL_ON_FAIL(NodeSync->GetLastFetchImportedPaths().Num(), 1, return false);
+	HOUDINI_TEST_EQUAL(NodeSync->GetLastFetchImportedPaths()[0], FetchPaths[1]);
+	HOUDINI_TEST_EQUAL(MergedNodes.ConsumeMergedNodePaths() == TArray<FString>({ ChangedBoxPath }), true);
+
+	// Cooking the box again without changing it keeps its assets: only the content is compared
+	HOUDINI_TEST_EQUAL((int32)FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), BoxNodeIds[1], "size", 0, 2.0f), (int32)HAPI_RESULT_SUCCESS);
+	HOUDINI_TEST_EQUAL((int32)FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), BoxNodeIds[1], "size", 0, 3.0f), (int32)HAPI_RESULT_SUCCESS);
+	NodeSync->FetchFromHoudini();
+	HOUDINI_TEST_EQUAL(NodeSync->GetLastFetchImportedPaths().Num(), 0);
+	HOUDINI_TEST_EQUAL(MergedNodes.ConsumeMergedNodePaths().Num(), 0);
+
+	// Changing an import option imports every box again
+	NodeSync->NodeSyncOptions.bOverwriteSkeleton = !NodeSync->NodeSyncOptions.bOverwriteSkeleton;
+	NodeSync->FetchFromHoudini();
+	HOUDINI_TEST_EQUAL(NodeSync->GetLastFetchImportedPaths().Num(), 3);
+	HOUDINI_TEST_EQUAL(MergedNodes.ConsumeMergedNodePaths() == BoxPaths, true);
+
+	// Without incremental fetches, every box is imported again
+	NodeSync->NodeSyncOptions.bOnlyFetchChangedNodes = false;
+	NodeSync->FetchFromHoudini();
+	HOUDINI_TEST_EQUAL(NodeSync->GetLastFetchImportedPaths().Num(), 3);
+	HOUDINI_TEST_EQUAL(MergedNodes.ConsumeMergedNodePaths() == BoxPaths, true);
+
+	return true;
+}
+
+#endif
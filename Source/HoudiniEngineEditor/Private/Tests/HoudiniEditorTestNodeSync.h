@@ -0,0 +1,61 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniApi.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+class FHoudiniEditorTestNodeSync
+{
+public:
+	// Creates a geo object in the session containing a box SOP.
+	static bool CreateBoxObject(const FString& InName, HAPI_NodeId& OutObjectNodeId, HAPI_NodeId& OutBoxNodeId);
+};
+
+// Records the string parameter values set in the session, which include the node paths the geo importer's
+// object merge nodes fetch. The calls are forwarded to the session. The original function is restored on destruction.
+class FHoudiniTestRecordMergedNodes : public FHoudiniTestFakeHoudiniApi
+{
+public:
+	FHoudiniTestRecordMergedNodes();
+
+	// Paths of the nodes merged since the last call, sorted
+	TArray<FString> ConsumeMergedNodePaths();
+
+private:
+	static FHoudiniTestRecordMergedNodes* Active() { return GetActive<FHoudiniTestRecordMergedNodes>(); }
+
+	TArray<FString> MergedNodePaths;
+	decltype(FHoudiniApi::SetParmStringValue) OriginalSetParmStringValue = nullptr;
+
+	static HAPI_Result SetParmStringValue(const HAPI_Session* Session, HAPI_NodeId NodeId, const char* Value, HAPI_ParmId ParmId, int Index);
+};
+
+#endif
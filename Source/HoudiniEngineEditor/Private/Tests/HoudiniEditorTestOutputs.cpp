@@ -47,6 +47,9 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "HoudiniEditorUnitTestUtils.h"
 #include "FoliageType_InstancedStaticMesh.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngineAttributes.h"
+#include "HoudiniEngineUtils.h"
 
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestOutput, "Houdini.UnitTests.OutputTests", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 
@@ -294,6 +297,238 @@ bool FHoudiniEditorTestOutput::RunTest(const FString & Parameters)
 	return true;
 }
 
+FHoudiniTestFakeAttributePart::FHoudiniTestFakeAttributePart()
+	: FHoudiniTestFakeHoudiniApi(this)
+{
+	AttributeNames[HAPI_ATTROWNER_VERTEX] = { "N", "uv", "uv2" };
+	AttributeNames[HAPI_ATTROWNER_POINT] = { "P", "Cd", "Alpha", "pscale" };
+	AttributeNames[HAPI_ATTROWNER_PRIM] = { "shop_materialpath", "unreal_material", "name" };
+	AttributeNames[HAPI_ATTROWNER_DETAIL] = { "varmap" };
+
+	// String handle 0 is invalid, the attribute names follow in owner order
+	Strings.Add(std::string());
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+		Strings.Append(AttributeNames[OwnerIdx]);
+
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetPartInfo);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAttributeNames);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetAttributeInfo);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetStringBufLength);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetString);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetStringBatchSize);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetStringBatch);
+}
 
-#endif
+HAPI_PartInfo
+FHoudiniTestFakeAttributePart::GetPartInfo() const
+{
+	HAPI_PartInfo PartInfo;
+	FMemory::Memzero(PartInfo);
+	PartInfo.id = PartId;
+	PartInfo.type = HAPI_PARTTYPE_MESH;
+	PartInfo.faceCount = 12;
+	PartInfo.vertexCount = 36;
+	PartInfo.pointCount = 8;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+		PartInfo.attributeCounts[OwnerIdx] = AttributeNames[OwnerIdx].Num();
+
+	return PartInfo;
+}
+
+HAPI_Result
+FHoudiniTestFakeAttributePart::GetPartInfo(const HAPI_Session* Session, HAPI_NodeId InGeoId, HAPI_PartId InPartId, HAPI_PartInfo* PartInfo)
+{
+	Active()->NumCalls++;
+	if (InGeoId != GeoId || InPartId != PartId)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*PartInfo = Active()->GetPartInfo();
+	return HAPI_RESULT_SUCCESS;
+}
 
+HAPI_Result
+FHoudiniTestFakeAttributePart::GetAttributeNames(const HAPI_Session* Session, HAPI_NodeId InGeoId, HAPI_PartId InPartId, HAPI_AttributeOwner Owner, HAPI_StringHandle* NamesArray, int Count)
+{
+	Active()->NumCalls++;
+	if (InGeoId != GeoId || InPartId != PartId || Owner < 0 || Owner >= HAPI_ATTROWNER_MAX || Count != Active()->AttributeNames[Owner].Num())
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	int32 FirstHandle = 1;
+	for (int32 OwnerIdx = 0; OwnerIdx < Owner; ++OwnerIdx)
+		FirstHandle += Active()->AttributeNames[OwnerIdx].Num();
+
+	for (int32 Idx = 0; Idx < Count; ++Idx)
+		NamesArray[Idx] = FirstHandle + Idx;
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeAttributePart::GetAttributeInfo(const HAPI_Session* Session, HAPI_NodeId InGeoId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeOwner Owner, HAPI_AttributeInfo* AttributeInfo)
+{
+	Active()->NumCalls++;
+	if (InGeoId != GeoId || InPartId != PartId || Owner < 0 || Owner >= HAPI_ATTROWNER_MAX)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	FMemory::Memzero(*AttributeInfo);
+	AttributeInfo->owner = Owner;
+	AttributeInfo->exists = Active()->AttributeNames[Owner].Contains(std::string(Name));
+	if (AttributeInfo->exists)
+	{
+		const HAPI_PartInfo PartInfo = Active()->GetPartInfo();
+		AttributeInfo->storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfo->tupleSize = 3;
+		AttributeInfo->count = Owner == HAPI_ATTROWNER_VERTEX ? PartInfo.vertexCount
+			: Owner == HAPI_ATTROWNER_POINT ? PartInfo.pointCount
+			: Owner == HAPI_ATTROWNER_PRIM ? PartInfo.faceCount : 1;
+	}
+
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeAttributePart::GetStringBufLength(const HAPI_Session* Session, HAPI_StringHandle StringHandle, int* BufferLength)
+{
+	Active()->NumCalls++;
+	if (!Active()->Strings.IsValidIndex(StringHandle))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*BufferLength = static_cast<int>(Active()->Strings[StringHandle].size()) + 1;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeAttributePart::GetString(const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length)
+{
+	Active()->NumCalls++;
+	if (!Active()->Strings.IsValidIndex(StringHandle) || Length <= 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const std::string& Value = Active()->Strings[StringHandle];
+	const int32 NumChars = FMath::Min(static_cast<int32>(Value.size()), Length - 1);
+	FMemory::Memcpy(StringValue, Value.c_str(), NumChars);
+	StringValue[NumChars] = '\0';
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeAttributePart::GetStringBatchSize(const HAPI_Session* Session, const int* StringHandles, int Count, int* BufferSize)
+{
+	Active()->NumCalls++;
+	Active()->PendingStringBatch.Reset();
+
+	int32 Size = 0;
+	for (int32 Idx = 0; Idx < Count; ++Idx)
+	{
+		if (!Active()->Strings.IsValidIndex(StringHandles[Idx]))
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		Active()->PendingStringBatch.Add(StringHandles[Idx]);
+		Size += static_cast<int32>(Active()->Strings[StringHandles[Idx]].size()) + 1;
+	}
+
+	*BufferSize = Size;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeAttributePart::GetStringBatch(const HAPI_Session* Session, char* Buffer, int Length)
+{
+	Active()->NumCalls++;
+
+	int32 Offset = 0;
+	for (const HAPI_StringHandle Handle : Active()->PendingStringBatch)
+	{
+		const std::string& Value = Active()->Strings[Handle];
+		if (Offset + static_cast<int32>(Value.size()) + 1 > Length)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FMemory::Memcpy(Buffer + Offset, Value.c_str(), Value.size() + 1);
+		Offset += static_cast<int32>(Value.size()) + 1;
+	}
+
+	Active()->PendingStringBatch.Reset();
+	return HAPI_RESULT_SUCCESS;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestOutputsPartAttributeManifest, "Houdini.UnitTests.Outputs.PartAttributeManifest", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestOutputsPartAttributeManifest::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Run the attribute probes made when classifying and processing output parts on a 10k parts output, with and without
+	/// the part attribute manifest. The results must be the same, with fewer HAPI calls when using the manifest.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumParts = 10000;
+
+	FHoudiniTestFakeAttributePart FakePart;
+	const HAPI_NodeId GeoId = FakePart.GeoId;
+	const HAPI_PartId PartId = FakePart.PartId;
+	const HAPI_PartInfo PartInfo = FakePart.GetPartInfo();
+
+	const auto ProbePart = [&]()
+	{
+		EHoudiniInstancerType InstancerType = EHoudiniInstancerType::Invalid;
+		TArray<FHoudiniGenericAttribute> PropertyAttributes;
+		TArray<FString> LevelPaths;
+		TArray<FString> BakeNames;
+		TArray<int32> Tiles;
+
+		TArray<bool> Results;
+		Results.Add(FHoudiniEngineUtils::IsAttributeInstancer(GeoId, PartId, InstancerType));
+		Results.Add(FHoudiniEngineUtils::IsLandscapeSpline(GeoId, PartId));
+		Results.Add(FHoudiniEngineUtils::IsValidDataTable(GeoId, PartId));
+		Results.Add(FHoudiniEngineUtils::GetGenericPropertiesAttributes(GeoId, PartId, true, 0, 0, 0, PropertyAttributes));
+		Results.Add(FHoudiniEngineUtils::GetLevelPathAttribute(GeoId, PartId, LevelPaths));
+		Results.Add(FHoudiniEngineUtils::GetBakeNameAttribute(GeoId, PartId, BakeNames));
+		Results.Add(FHoudiniEngineUtils::GetTileAttribute(GeoId, PartId, Tiles));
+		Results.Add(FHoudiniEngineUtils::HapiCheckAttributeExists(GeoId, PartId, "P", HAPI_ATTROWNER_POINT));
+		Results.Add(FHoudiniEngineUtils::HapiCheckAttributeExists(GeoId, PartId, "unreal_material", HAPI_ATTROWNER_INVALID));
+		return Results;
+	};
+
+	const TArray<bool> ExpectedResults = { false, false, false, false, false, false, false, true, true };
+
+	// Without manifest
+	bool bResultsMatch = true;
+	FakePart.NumCalls = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < NumParts; ++Idx)
+		bResultsMatch &= ProbePart() == ExpectedResults;
+	const double TimeWithoutManifest = FPlatformTime::Seconds() - StartTime;
+	const int32 CallsWithoutManifest = FakePart.NumCalls;
+	HOUDINI_TEST_EQUAL(bResultsMatch, true);
+
+	// With manifest, built once per part
+	FakePart.NumCalls = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < NumParts; ++Idx)
+	{
+		FHoudiniScopedPartAttributeManifest Manifest(GeoId, PartId, PartInfo);
+		bResultsMatch &= Manifest.Manifest.IsValid();
+		bResultsMatch &= ProbePart() == ExpectedResults;
+	}
+	const double TimeWithManifest = FPlatformTime::Seconds() - StartTime;
+	const int32 CallsWithManifest = FakePart.NumCalls;
+	HOUDINI_TEST_EQUAL(bResultsMatch, true);
+
+	AddInfo(FString::Printf(TEXT("%d parts: %d HAPI calls (%.3fs) without the attribute manifest, %d HAPI calls (%.3fs) with it."),
+		NumParts, CallsWithoutManifest, TimeWithoutManifest, CallsWithManifest, TimeWithManifest));
+
+	// Only the manifest itself and the positive probes should reach HAPI
+	HOUDINI_TEST_EQUAL(CallsWithManifest < CallsWithoutManifest / 2, true);
+
+	// The manifest must not be used for other parts
+	{
+		FHoudiniScopedPartAttributeManifest Manifest(GeoId, PartId, PartInfo);
+		HOUDINI_TEST_NULL(FHoudiniPartAttributeManifest::Find(GeoId, PartId + 1));
+		HOUDINI_TEST_NOT_NULL(FHoudiniPartAttributeManifest::Find(GeoId, PartId));
+	}
+	HOUDINI_TEST_NULL(FHoudiniPartAttributeManifest::Find(GeoId, PartId));
+
+	return true;
+}
+
+#endif
@@ -28,6 +28,40 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 #include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include <string>
+
+// Replaces the HAPI functions used to query a part's attributes with fakes simulating a mesh part
+// with a few common attributes, so that attribute probes can be tested without a session.
+// Counts the HAPI calls made. The original functions are restored on destruction.
+class FHoudiniTestFakeAttributePart : public FHoudiniTestFakeHoudiniApi
+{
+public:
+	FHoudiniTestFakeAttributePart();
+
+	static constexpr HAPI_NodeId GeoId = 42;
+	static constexpr HAPI_PartId PartId = 0;
+
+	// Attribute names, per owner
+	TArray<std::string> AttributeNames[HAPI_ATTROWNER_MAX];
+	TArray<std::string> Strings;
+
+	HAPI_PartInfo GetPartInfo() const;
+
+private:
+	static FHoudiniTestFakeAttributePart* Active() { return GetActive<FHoudiniTestFakeAttributePart>(); }
+	TArray<HAPI_StringHandle> PendingStringBatch;
+
+	static HAPI_Result GetPartInfo(const HAPI_Session* Session, HAPI_NodeId InGeoId, HAPI_PartId InPartId, HAPI_PartInfo* PartInfo);
+	static HAPI_Result GetAttributeNames(const HAPI_Session* Session, HAPI_NodeId InGeoId, HAPI_PartId InPartId, HAPI_AttributeOwner Owner, HAPI_StringHandle* NamesArray, int Count);
+	static HAPI_Result GetAttributeInfo(const HAPI_Session* Session, HAPI_NodeId InGeoId, HAPI_PartId InPartId, const char* Name, HAPI_AttributeOwner Owner, HAPI_AttributeInfo* AttributeInfo);
+	static HAPI_Result GetStringBufLength(const HAPI_Session* Session, HAPI_StringHandle StringHandle, int* BufferLength);
+	static HAPI_Result GetString(const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length);
+	static HAPI_Result GetStringBatchSize(const HAPI_Session* Session, const int* StringHandles, int Count, int* BufferSize);
+	static HAPI_Result GetStringBatch(const HAPI_Session* Session, char* Buffer, int Length);
+};
 
 #endif
 
@@ -0,0 +1,203 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestPackages.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniPackageParams.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Curves/CurveFloat.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+FString
+FHoudiniEditorTestPackages::MakeTestFolder()
+{
+	return FString::Printf(TEXT("/Game/HoudiniEngineTests/Packages_%s"), *FGuid::NewGuid().ToString());
+}
+
+TArray<UObject*>
+FHoudiniEditorTestPackages::CreateRegisteredAssets(const FString& InFolder, const FString& InBaseName, int32 InNum)
+{
+	TArray<UObject*> Assets;
+	Assets.Reserve(InNum);
+	for (int32 Idx = 0; Idx < InNum; ++Idx)
+	{
+		const FString AssetName = Idx > 0 ? FString::Printf(TEXT("%s_%d"), *InBaseName, Idx) : InBaseName;
+		UPackage* Package = CreatePackage(*(InFolder + TEXT("/") + AssetName));
+		UCurveFloat* Asset = NewObject<UCurveFloat>(Package, FName(*AssetName), RF_Public | RF_Standalone | RF_Transient);
+		FAssetRegistryModule::AssetCreated(Asset);
+		Assets.Add(Asset);
+	}
+	return Assets;
+}
+
+void
+FHoudiniEditorTestPackages::DeleteRegisteredAssets(const TArray<UObject*>& InAssets)
+{
+	for (UObject* Asset : InAssets)
+	{
+		if (!IsValid(Asset))
+			continue;
+
+		FAssetRegistryModule::AssetDeleted(Asset);
+		Asset->ClearFlags(RF_Public | RF_Standalone);
+		Asset->MarkAsGarbage();
+	}
+}
+
+FHoudiniPackageParams
+FHoudiniEditorTestPackages::MakeBakeParams(const FString& InFolder, const FString& InName)
+{
+	FHoudiniPackageParams PackageParams;
+	PackageParams.PackageMode = EPackageMode::Bake;
+	PackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+	PackageParams.BakeFolder = InFolder;
+	PackageParams.ObjectName = InName;
+	return PackageParams;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestPackagesNameIndex, "Houdini.UnitTests.Packages.NameIndex", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestPackagesNameIndex::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that the package name index finds the same free bake counters as probing the packages, and never returns a
+	/// name that is already taken.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const bool bWasEnabled = FHoudiniPackageParams::IsPackageNameIndexEnabled();
+
+	const FString Folder = FHoudiniEditorTestPackages::MakeTestFolder();
+	const TArray<UObject*> Existing = FHoudiniEditorTestPackages::CreateRegisteredAssets(Folder, TEXT("SM_Test"), 10);
+	const FHoudiniPackageParams PackageParams = FHoudiniEditorTestPackages::MakeBakeParams(Folder, TEXT("SM_Test"));
+
+	// Probing the packages
+	FHoudiniPackageParams::SetPackageNameIndexEnabled(false);
+	FString PackageName;
+	HOUDINI_TEST_NOT_NULL(PackageParams.CreatePackageForObject(PackageName));
+	HOUDINI_TEST_EQUAL(PackageName, FString(TEXT("SM_Test_10")));
+
+	// With the index, the counters taken by the assets and by the package above are skipped
+	FHoudiniPackageParams::SetPackageNameIndexEnabled(true);
+	HOUDINI_TEST_NOT_NULL(PackageParams.CreatePackageForObject(PackageName));
+	HOUDINI_TEST_EQUAL(PackageName, FString(TEXT("SM_Test_11")));
+	HOUDINI_TEST_NOT_NULL(PackageParams.CreatePackageForObject(PackageName));
+	HOUDINI_TEST_EQUAL(PackageName, FString(TEXT("SM_Test_12")));
+
+	// Starting from a higher counter
+	HOUDINI_TEST_NOT_NULL(PackageParams.CreatePackageForObject(PackageName, 20));
+	HOUDINI_TEST_EQUAL(PackageName, FString(TEXT("SM_Test_20")));
+	HOUDINI_TEST_NOT_NULL(PackageParams.CreatePackageForObject(PackageName));
+	HOUDINI_TEST_EQUAL(PackageName, FString(TEXT("SM_Test_13")));
+
+	// Assets registered after the folder was indexed are taken too
+	const TArray<UObject*> Added = FHoudiniEditorTestPackages::CreateRegisteredAssets(Folder, TEXT("SM_Other"), 2);
+	const FHoudiniPackageParams OtherParams = FHoudiniEditorTestPackages::MakeBakeParams(Folder, TEXT("SM_Other"));
+	HOUDINI_TEST_NOT_NULL(OtherParams.CreatePackageForObject(PackageName));
+	HOUDINI_TEST_EQUAL(PackageName, FString(TEXT("SM_Other_2")));
+
+	// Temp packages get a GUID suffix when the name is taken
+	FHoudiniPackageParams TempParams = PackageParams;
+	TempParams.PackageMode = EPackageMode::CookToTemp;
+	TempParams.TempCookFolder = Folder;
+	HOUDINI_TEST_NOT_NULL(TempParams.CreatePackageForObject(PackageName));
+	HOUDINI_TEST_EQUAL(PackageName.StartsWith(TEXT("SM_Test_")), true);
+	HOUDINI_TEST_EQUAL(PackageName.Len(), FString(TEXT("SM_Test_")).Len() + PACKAGE_GUID_LENGTH);
+
+	FHoudiniEditorTestPackages::DeleteRegisteredAssets(Existing);
+	FHoudiniEditorTestPackages::DeleteRegisteredAssets(Added);
+	FHoudiniPackageParams::SetPackageNameIndexEnabled(bWasEnabled);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestPackagesNameIndexBenchmark, "Houdini.UnitTests.Packages.NameIndexBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestPackagesNameIndexBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Bake 5000 new packages in a folder already holding 20000 assets of the same name, with and without the package
+	/// name index. Without the index, every package probes all the taken counters so only a sample is timed.
+	/// The existing assets are only in memory: with assets on disk, each probe would also load a package.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumExistingAssets = 20000;
+	constexpr int32 NumNewPackages = 5000;
+	constexpr int32 NumProbedPackages = 50;
+
+	const bool bWasEnabled = FHoudiniPackageParams::IsPackageNameIndexEnabled();
+
+	const FString Folder = FHoudiniEditorTestPackages::MakeTestFolder();
+	const TArray<UObject*> Existing = FHoudiniEditorTestPackages::CreateRegisteredAssets(Folder, TEXT("SM_Bench"), NumExistingAssets);
+	const FHoudiniPackageParams PackageParams = FHoudiniEditorTestPackages::MakeBakeParams(Folder, TEXT("SM_Bench"));
+
+	TSet<FString> CreatedNames;
+	int32 NumDuplicates = 0;
+	const auto CreatePackages = [&](int32 InNum)
+	{
+		for (int32 Idx = 0; Idx < InNum; ++Idx)
+		{
+			FString PackageName;
+			if (!PackageParams.CreatePackageForObject(PackageName))
+				continue;
+
+			bool bAlreadyCreated = false;
+			CreatedNames.Add(PackageName, &bAlreadyCreated);
+			if (bAlreadyCreated)
+				NumDuplicates++;
+		}
+	};
+
+	FHoudiniPackageParams::SetPackageNameIndexEnabled(false);
+	double StartTime = FPlatformTime::Seconds();
+	CreatePackages(NumProbedPackages);
+	const double ProbingTime = FPlatformTime::Seconds() - StartTime;
+
+	FHoudiniPackageParams::SetPackageNameIndexEnabled(true);
+	StartTime = FPlatformTime::Seconds();
+	CreatePackages(NumNewPackages);
+	const double IndexedTime = FPlatformTime::Seconds() - StartTime;
+
+	HOUDINI_TEST_EQUAL(CreatedNames.Num(), NumProbedPackages + NumNewPackages);
+	HOUDINI_TEST_EQUAL(NumDuplicates, 0);
+	// The new packages take the counters following the existing assets
+	HOUDINI_TEST_EQUAL(CreatedNames.Contains(FString::Printf(TEXT("SM_Bench_%d"), NumExistingAssets + NumProbedPackages + NumNewPackages - 1)), true);
+
+	AddInfo(FString::Printf(TEXT("%d existing assets: %.3fms per package probing the packages (%d packages), %.3fms per package with the name index (%d packages)."),
+		NumExistingAssets, ProbingTime * 1000.0 / NumProbedPackages, NumProbedPackages, IndexedTime * 1000.0 / NumNewPackages, NumNewPackages));
+
+	FHoudiniEditorTestPackages::DeleteRegisteredAssets(Existing);
+	FHoudiniPackageParams::SetPackageNameIndexEnabled(bWasEnabled);
+
+	return true;
+}
+
+#endif
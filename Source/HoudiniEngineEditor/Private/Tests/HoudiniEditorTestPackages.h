@@ -0,0 +1,51 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+
+struct FHoudiniPackageParams;
+
+class FHoudiniEditorTestPackages
+{
+public:
+	// Returns a new, empty content folder for the test to create packages in.
+	static FString MakeTestFolder();
+
+	// Creates in-memory assets named InBaseName, InBaseName_1, ... InBaseName_<InNum - 1> in the folder, and
+	// registers them with the asset registry.
+	static TArray<UObject*> CreateRegisteredAssets(const FString& InFolder, const FString& InBaseName, int32 InNum);
+
+	// Unregisters the assets and lets them be garbage collected.
+	static void DeleteRegisteredAssets(const TArray<UObject*>& InAssets);
+
+	// Package params baking new assets named InName in the folder.
+	static FHoudiniPackageParams MakeBakeParams(const FString& InFolder, const FString& InName);
+};
+
+#endif
@@ -0,0 +1,523 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestPerformance.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestDataTables.h"
+#include "HoudiniEditorTestStrings.h"
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApiTrace.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniDataTableTranslator.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniParameterString.h"
+
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Engine/UserDefinedStruct.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// Measures a cook, from its start until the HAC has processed its outputs
+	class FHoudiniPerformanceMeasure
+	{
+	public:
+		~FHoudiniPerformanceMeasure()
+		{
+			StopSampling();
+		}
+
+		void Begin(UHoudiniAssetComponent* InHAC)
+		{
+			bEnded = false;
+			StartMemory = (int64)FPlatformMemory::GetStats().UsedPhysical;
+			PeakMemory = StartMemory;
+
+			// Sample the memory every tick, the cook spans many
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+			{
+				SampleMemory();
+				return true;
+			}));
+
+			PostOutputHandle = InHAC->GetOnPostOutputProcessingDelegate().AddLambda([this](UHoudiniAssetComponent*, bool)
+			{
+				if (!bEnded)
+				{
+					EndTime = FPlatformTime::Seconds();
+					SampleMemory();
+					bEnded = true;
+				}
+			});
+			HAC = InHAC;
+
+			FHoudiniApiTrace::Reset();
+			FHoudiniApiTrace::Start();
+			StartTime = FPlatformTime::Seconds();
+		}
+
+		FHoudiniPerformanceSample End(const FString& InTranslator, int32 InScale)
+		{
+			if (!bEnded)
+			{
+				EndTime = FPlatformTime::Seconds();
+				SampleMemory();
+			}
+
+			FHoudiniApiTrace::Stop();
+			StopSampling();
+
+			FHoudiniPerformanceSample Sample;
+			Sample.Translator = InTranslator;
+			Sample.Scale = InScale;
+			Sample.WallSeconds = EndTime - StartTime;
+			Sample.PeakMemoryBytes = FMath::Max<int64>(PeakMemory - StartMemory, 0);
+			for (const FHoudiniApiCallStats& Stats : FHoudiniApiTrace::GetStats())
+				Sample.NumHAPICalls += Stats.NumCalls;
+
+			return Sample;
+		}
+
+	private:
+		void SampleMemory()
+		{
+			PeakMemory = FMath::Max(PeakMemory, (int64)FPlatformMemory::GetStats().UsedPhysical);
+		}
+
+		void StopSampling()
+		{
+			if (TickerHandle.IsValid())
+			{
+				FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+				TickerHandle.Reset();
+			}
+
+			if (HAC.IsValid() && PostOutputHandle.IsValid())
+				HAC->GetOnPostOutputProcessingDelegate().Remove(PostOutputHandle);
+			PostOutputHandle.Reset();
+			HAC.Reset();
+		}
+
+		TWeakObjectPtr<UHoudiniAssetComponent> HAC;
+		FTSTicker::FDelegateHandle TickerHandle;
+		FDelegateHandle PostOutputHandle;
+
+		double StartTime = 0.0;
+		double EndTime = 0.0;
+		int64 StartMemory = 0;
+		int64 PeakMemory = 0;
+		bool bEnded = false;
+	};
+
+	bool LoadSamples(const FString& InFilePath, TArray<FHoudiniPerformanceSample>& OutSamples)
+	{
+		FString Json;
+		return FFileHelper::LoadFileToString(Json, *InFilePath) && FHoudiniEditorTestPerformance::FromJson(Json, OutSamples);
+	}
+
+	bool SaveSamples(const FString& InDirectory, const FString& InTranslator, const TArray<FHoudiniPerformanceSample>& InSamples, bool bInCSV)
+	{
+		const FString BasePath = FPaths::Combine(InDirectory, InTranslator);
+		bool bSuccess = FFileHelper::SaveStringToFile(FHoudiniEditorTestPerformance::ToJson(InSamples), *(BasePath + TEXT(".json")));
+		if (bInCSV)
+			bSuccess &= FFileHelper::SaveStringToFile(FHoudiniEditorTestPerformance::ToCSV(InSamples), *(BasePath + TEXT(".csv")));
+		return bSuccess;
+	}
+}
+
+FString
+FHoudiniEditorTestPerformance::ToJson(const TArray<FHoudiniPerformanceSample>& InSamples)
+{
+	TArray<TSharedPtr<FJsonValue>> Samples;
+	for (const FHoudiniPerformanceSample& Sample : InSamples)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("translator"), Sample.Translator);
+		Object->SetNumberField(TEXT("scale"), Sample.Scale);
+		Object->SetNumberField(TEXT("wall_ms"), Sample.WallSeconds * 1000.0);
+		Object->SetNumberField(TEXT("hapi_calls"), (double)Sample.NumHAPICalls);
+		Object->SetNumberField(TEXT("peak_memory_bytes"), (double)Sample.PeakMemoryBytes);
+		Samples.Add(MakeShared<FJsonValueObject>(Object));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Root->SetArrayField(TEXT("samples"), Samples);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Json;
+}
+
+bool
+FHoudiniEditorTestPerformance::FromJson(const FString& InJson, TArray<FHoudiniPerformanceSample>& OutSamples)
+{
+	OutSamples.Empty();
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InJson);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+		return false;
+
+	const TArray<TSharedPtr<FJsonValue>>* Samples = nullptr;
+	if (!Root->TryGetArrayField(TEXT("samples"), Samples))
+		return false;
+
+	for (const TSharedPtr<FJsonValue>& Value : *Samples)
+	{
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(Object))
+			return false;
+
+		FHoudiniPerformanceSample& Sample = OutSamples.AddDefaulted_GetRef();
+		Sample.Translator = (*Object)->GetStringField(TEXT("translator"));
+		Sample.Scale = (int32)(*Object)->GetNumberField(TEXT("scale"));
+		Sample.WallSeconds = (*Object)->GetNumberField(TEXT("wall_ms")) / 1000.0;
+		Sample.NumHAPICalls = (int64)(*Object)->GetNumberField(TEXT("hapi_calls"));
+		Sample.PeakMemoryBytes = (int64)(*Object)->GetNumberField(TEXT("peak_memory_bytes"));
+	}
+
+	return true;
+}
+
+FString
+FHoudiniEditorTestPerformance::ToCSV(const TArray<FHoudiniPerformanceSample>& InSamples)
+{
+	FString CSV = TEXT("Translator,Scale,WallMs,HAPICalls,PeakMemoryBytes\n");
+	for (const FHoudiniPerformanceSample& Sample : InSamples)
+	{
+		CSV += FString::Printf(TEXT("%s,%d,%.3f,%lld,%lld\n"),
+			*Sample.Translator, Sample.Scale, Sample.WallSeconds * 1000.0, Sample.NumHAPICalls, Sample.PeakMemoryBytes);
+	}
+	return CSV;
+}
+
+TArray<FString>
+FHoudiniEditorTestPerformance::FindRegressions(
+	const TArray<FHoudiniPerformanceSample>& InSamples,
+	const TArray<FHoudiniPerformanceSample>& InBaseline,
+	const FHoudiniPerformanceTolerances& InTolerances)
+{
+	TArray<FString> Regressions;
+	for (const FHoudiniPerformanceSample& Sample : InSamples)
+	{
+		const FHoudiniPerformanceSample* Baseline = InBaseline.FindByPredicate([&Sample](const FHoudiniPerformanceSample& Other)
+		{
+			return Other.Translator == Sample.Translator && Other.Scale == Sample.Scale;
+		});
+		if (!Baseline)
+			continue;
+
+		auto CheckMetric = [&](const TCHAR* InMetric, double InValue, double InBaselineValue, double InTolerance, double InMinGrowth)
+		{
+			if (InValue > InBaselineValue * (1.0 + InTolerance) && InValue - InBaselineValue > InMinGrowth)
+			{
+				Regressions.Add(FString::Printf(TEXT("%s at scale %d: %s went from %.3f to %.3f (+%.1f%%, tolerance %.1f%%)"),
+					*Sample.Translator, Sample.Scale, InMetric, InBaselineValue, InValue,
+					InBaselineValue > 0.0 ? (InValue / InBaselineValue - 1.0) * 100.0 : 100.0, InTolerance * 100.0));
+			}
+		};
+
+		CheckMetric(TEXT("wall time (ms)"), Sample.WallSeconds * 1000.0, Baseline->WallSeconds * 1000.0, InTolerances.WallTime, InTolerances.MinWallSeconds * 1000.0);
+		CheckMetric(TEXT("HAPI calls"), (double)Sample.NumHAPICalls, (double)Baseline->NumHAPICalls, InTolerances.HAPICalls, (double)InTolerances.MinHAPICalls);
+		CheckMetric(TEXT("peak memory (bytes)"), (double)Sample.PeakMemoryBytes, (double)Baseline->PeakMemoryBytes, InTolerances.PeakMemory, (double)InTolerances.MinMemoryBytes);
+	}
+
+	return Regressions;
+}
+
+FString
+FHoudiniEditorTestPerformance::GetResultsDir()
+{
+	FString Dir;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("HoudiniPerfResults="), Dir))
+		Dir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("Performance"));
+	return Dir;
+}
+
+FString
+FHoudiniEditorTestPerformance::GetBaselineDir()
+{
+	FString Dir;
+	if (FParse::Value(FCommandLine::Get(), TEXT("HoudiniPerfBaseline="), Dir))
+		return Dir;
+
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("HoudiniEngine"));
+	if (Plugin.IsValid())
+		return FPaths::Combine(Plugin->GetBaseDir(), TEXT("Resources"), TEXT("Performance"), TEXT("Baseline"));
+
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("Performance"), TEXT("Baseline"));
+}
+
+bool
+FHoudiniEditorTestPerformance::AddPerformanceCommands(FAutomationTestBase* InTest, const FHoudiniPerformanceCase& InCase)
+{
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(InTest, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(InTest, InCase.HDAPath, FTransform::Identity, false));
+	if (!InTest->TestEqual(TEXT("Context->IsValid()"), Context->IsValid(), true))
+		return false;
+
+	// Measure the translators, not the proxy meshes
+	Context->HAC->bOverrideGlobalProxyStaticMeshSettings = true;
+	Context->HAC->bEnableProxyStaticMeshOverride = false;
+	Context->MaxTime = 600.0;
+
+	TSharedPtr<FHoudiniPerformanceMeasure> Measure = MakeShared<FHoudiniPerformanceMeasure>();
+	TSharedPtr<TArray<FHoudiniPerformanceSample>> Samples = MakeShared<TArray<FHoudiniPerformanceSample>>();
+
+	for (const int32 Scale : InCase.Scales)
+	{
+		InTest->AddCommand(new FHoudiniLatentTestCommand(Context, [InTest, Context, Measure, InCase, Scale]()
+		{
+			for (const TPair<FString, FString>& StringParameter : InCase.StringParameters)
+			{
+				UHoudiniParameterString* Parameter = FHoudiniEditorUnitTestUtils::GetTypedParameter<UHoudiniParameterString>(Context->HAC, TCHAR_TO_ANSI(*StringParameter.Key));
+				if (!InTest->TestNotNull(*StringParameter.Key, Parameter))
+					return true;
+
+				Parameter->SetValueAt(StringParameter.Value, 0);
+			}
+
+			if (!InCase.ScaleParameter.IsEmpty())
+			{
+				UHoudiniParameterInt* Parameter = FHoudiniEditorUnitTestUtils::GetTypedParameter<UHoudiniParameterInt>(Context->HAC, TCHAR_TO_ANSI(*InCase.ScaleParameter));
+				if (!InTest->TestNotNull(*InCase.ScaleParameter, Parameter))
+					return true;
+
+				for (int32 Component = 0; Component < InCase.NumScaleComponents; ++Component)
+					Parameter->SetValueAt(Scale, Component);
+			}
+
+			Measure->Begin(Context->HAC);
+			Context->StartCookingHDA();
+			return true;
+		}));
+
+		InTest->AddCommand(new FHoudiniLatentTestCommand(Context, [InTest, Measure, Samples, InCase, Scale]()
+		{
+			const FHoudiniPerformanceSample Sample = Measure->End(InCase.Translator, Scale);
+			Samples->Add(Sample);
+			InTest->AddInfo(FString::Printf(TEXT("%s at scale %d: %.3f ms, %lld HAPI calls, %.1f MB peak memory"),
+				*InCase.Translator, Scale, Sample.WallSeconds * 1000.0, Sample.NumHAPICalls, Sample.PeakMemoryBytes / (1024.0 * 1024.0)));
+			return true;
+		}));
+	}
+
+	InTest->AddCommand(new FHoudiniLatentTestCommand(Context, [InTest, Samples, InCase]()
+	{
+		FHoudiniEditorTestPerformance::SaveAndCompareSamples(InTest, InCase.Translator, *Samples);
+		return true;
+	}));
+
+	return true;
+}
+
+void
+FHoudiniEditorTestPerformance::SaveAndCompareSamples(FAutomationTestBase* InTest, const FString& InTranslator, const TArray<FHoudiniPerformanceSample>& InSamples)
+{
+	const FString ResultsDir = GetResultsDir();
+	if (!SaveSamples(ResultsDir, InTranslator, InSamples, true))
+		InTest->AddWarning(FString::Printf(TEXT("Could not write the results to %s."), *ResultsDir));
+
+	const FString BaselineDir = GetBaselineDir();
+	if (FParse::Param(FCommandLine::Get(), TEXT("HoudiniPerfUpdateBaseline")))
+	{
+		if (!SaveSamples(BaselineDir, InTranslator, InSamples, false))
+			InTest->AddError(FString::Printf(TEXT("Could not write the baseline to %s."), *BaselineDir));
+		return;
+	}
+
+	TArray<FHoudiniPerformanceSample> Baseline;
+	const FString BaselinePath = FPaths::Combine(BaselineDir, InTranslator + TEXT(".json"));
+	if (!LoadSamples(BaselinePath, Baseline))
+	{
+		InTest->AddWarning(FString::Printf(TEXT("No baseline found at %s, the results were not compared. Record it with -HoudiniPerfUpdateBaseline."), *BaselinePath));
+		return;
+	}
+
+	for (const FString& Regression : FindRegressions(InSamples, Baseline, FHoudiniPerformanceTolerances()))
+		InTest->AddError(Regression);
+}
+
+// Each case uses one of the existing test HDAs
+#define HOUDINI_PERFORMANCE_TEST(TestName, ...) \
+	IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestPerformance##TestName, "Houdini.Performance." #TestName, EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter) \
+	bool FHoudiniEditorTestPerformance##TestName::RunTest(const FString& Parameters) \
+	{ \
+		return FHoudiniEditorTestPerformance::AddPerformanceCommands(this, { TEXT(#TestName), __VA_ARGS__ }); \
+	}
+
+HOUDINI_PERFORMANCE_TEST(Mesh, TEXT("/HoudiniEngine/Test/hda/TestParams"), TEXT("int_numboxes"), 1, { 1, 10, 100 })
+HOUDINI_PERFORMANCE_TEST(Instancer, TEXT("/Game/TestHDAs/Instances/Test_Instances"), TEXT("max_instances"), 1, { 1, 100, 10000 },
+	{ { TEXT("instance_object"), TEXT("/Script/Engine.StaticMesh'/Game/TestObjects/SM_Cube.SM_Cube'") } })
+HOUDINI_PERFORMANCE_TEST(Landscape, TEXT("/Game/TestHDAs/Landscape/Test_Landscapes"), TEXT("size"), 2, { 64, 256, 1024 })
+HOUDINI_PERFORMANCE_TEST(Curve, TEXT("/Game/TestHDAs/Random/simple_curve"), TEXT(""), 1, { 1 })
+HOUDINI_PERFORMANCE_TEST(Material, TEXT("/Game/TestHDAs/Materials/Material_Maps"), TEXT(""), 1, { 1 })
+HOUDINI_PERFORMANCE_TEST(GeometryCollection, TEXT("/Game/TestHDAs/GeometryCollections/Test_GC"), TEXT(""), 1, { 1 })
+
+#undef HOUDINI_PERFORMANCE_TEST
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestPerformanceDataTable, "Houdini.Performance.DataTable", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestPerformanceDataTable::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// There is no data table test HDA: build the rows from a fake point cloud of increasing size instead, and count the
+	/// calls made to the fake attribute functions.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// The columns are fetched through the accessor, which splits the work between the sessions.
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestUtils::CreateSessionIfInvalid(), true, return false);
+
+	TArray<FHoudiniPerformanceSample> Samples;
+	for (const int32 NumRows : { 1000, 10000, 100000 })
+	{
+		FHoudiniEngineString::InvalidateStringCache();
+		FHoudiniTestFakeStringTable FakeStrings(NumRows, TEXT("row_"));
+		FHoudiniTestFakeDataTablePart FakePart(NumRows);
+
+		int32 StructSize = 0;
+		TMap<FString, FProperty*> FoundProps;
+		TMap<FString, HAPI_AttributeInfo> FoundInfos;
+		UUserDefinedStruct* RowStruct = FHoudiniTestFakeDataTablePart::CreateRowStruct(StructSize, FoundProps, FoundInfos);
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(RowStruct, return false);
+
+		FakePart.NumCalls = 0;
+		const int64 StartMemory = (int64)FPlatformMemory::GetStats().UsedPhysical;
+		const double StartTime = FPlatformTime::Seconds();
+
+		uint8* RowData = (uint8*)FMemory::MallocZeroed(NumRows * StructSize);
+		const bool bPopulated = FHoudiniDataTableTranslator::PopulateRowData(FakePart.GeoId, FakePart.PartId,
+			FoundProps, FoundInfos, StructSize, NumRows, RowData);
+
+		FHoudiniPerformanceSample& Sample = Samples.AddDefaulted_GetRef();
+		Sample.Translator = TEXT("DataTable");
+		Sample.Scale = NumRows;
+		Sample.WallSeconds = FPlatformTime::Seconds() - StartTime;
+		Sample.NumHAPICalls = FakePart.NumCalls.load();
+		Sample.PeakMemoryBytes = FMath::Max<int64>((int64)FPlatformMemory::GetStats().UsedPhysical - StartMemory, 0);
+		HOUDINI_TEST_EQUAL(bPopulated, true);
+
+		AddInfo(FString::Printf(TEXT("DataTable at scale %d: %.3f ms, %lld HAPI calls, %.1f MB peak memory"),
+			NumRows, Sample.WallSeconds * 1000.0, Sample.NumHAPICalls, Sample.PeakMemoryBytes / (1024.0 * 1024.0)));
+
+		RowStruct->DestroyStruct(RowData, NumRows);
+		FMemory::Free(RowData);
+	}
+
+	FHoudiniEditorTestPerformance::SaveAndCompareSamples(this, TEXT("DataTable"), Samples);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestPerformanceBaseline, "Houdini.UnitTests.Performance.Baseline", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestPerformanceBaseline::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that results survive a round trip through JSON, and that only the metrics growing past their tolerance are
+	/// reported as regressions.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	TArray<FHoudiniPerformanceSample> Baseline;
+	for (const int32 Scale : { 1, 10 })
+	{
+		FHoudiniPerformanceSample& Sample = Baseline.AddDefaulted_GetRef();
+		Sample.Translator = TEXT("Mesh");
+		Sample.Scale = Scale;
+		Sample.WallSeconds = 0.5 * Scale;
+		Sample.NumHAPICalls = 1000 * Scale;
+		Sample.PeakMemoryBytes = 64ll * 1024 * 1024 * Scale;
+	}
+
+	TArray<FHoudiniPerformanceSample> Loaded;
+	HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorTestPerformance::FromJson(FHoudiniEditorTestPerformance::ToJson(Baseline), Loaded), true, return false);
+	HOUDINI_TEST_EQUAL_ON_FAIL(Loaded.Num(), Baseline.Num(), return false);
+	for (int32 Idx = 0; Idx < Loaded.Num(); ++Idx)
+	{
+		HOUDINI_TEST_EQUAL(Loaded[Idx].Translator, Baseline[Idx].Translator);
+		HOUDINI_TEST_EQUAL(Loaded[Idx].Scale, Baseline[Idx].Scale);
+		HOUDINI_TEST_EQUAL(FMath::IsNearlyEqual(Loaded[Idx].WallSeconds, Baseline[Idx].WallSeconds, 1e-6), true);
+		HOUDINI_TEST_EQUAL(Loaded[Idx].NumHAPICalls, Baseline[Idx].NumHAPICalls);
+		HOUDINI_TEST_EQUAL(Loaded[Idx].PeakMemoryBytes, Baseline[Idx].PeakMemoryBytes);
+	}
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestPerformance::FromJson(TEXT("{ \"samples\": 3 }"), Loaded), false);
+
+	const FHoudiniPerformanceTolerances Tolerances;
+
+	// Identical results, or results within the tolerances, are not regressions
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestPerformance::FindRegressions(Baseline, Baseline, Tolerances).Num(), 0);
+	TArray<FHoudiniPerformanceSample> Results = Baseline;
+	Results[1].WallSeconds *= 1.0 + Tolerances.WallTime * 0.5;
+	Results[1].NumHAPICalls += Tolerances.MinHAPICalls;
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestPerformance::FindRegressions(Results, Baseline, Tolerances).Num(), 0);
+
+	// Each metric growing past its tolerance is reported
+	Results = Baseline;
+	Results[0].WallSeconds *= 2.0;
+	Results[1].NumHAPICalls *= 2;
+	Results[1].PeakMemoryBytes *= 2;
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestPerformance::FindRegressions(Results, Baseline, Tolerances).Num(), 3);
+
+	// Growth under the noise floor is ignored, even when large in relative terms
+	Results = Baseline;
+	Results[0].WallSeconds = 0.001;
+	TArray<FHoudiniPerformanceSample> SmallBaseline = Results;
+	SmallBaseline[0].WallSeconds = 0.0001;
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestPerformance::FindRegressions(Results, SmallBaseline, Tolerances).Num(), 0);
+
+	// Samples without a baseline are not compared
+	Results = Baseline;
+	Results[0].Scale = 100;
+	Results[0].WallSeconds = 1000.0;
+	HOUDINI_TEST_EQUAL(FHoudiniEditorTestPerformance::FindRegressions(Results, Baseline, Tolerances).Num(), 0);
+
+	// The CSV has a header and a line per sample
+	TArray<FString> Lines;
+	FHoudiniEditorTestPerformance::ToCSV(Baseline).ParseIntoArrayLines(Lines);
+	HOUDINI_TEST_EQUAL(Lines.Num(), Baseline.Num() + 1);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+
+class FAutomationTestBase;
+
+// Metrics of one cook of a translator's test HDA, at one input scale
+struct FHoudiniPerformanceSample
+{
+	FString Translator;
+	int32 Scale = 0;
+
+	// Time from the start of the cook until its outputs are processed
+	double WallSeconds = 0.0;
+	int64 NumHAPICalls = 0;
+	// Growth of the process' used physical memory during the cook, at its highest
+	int64 PeakMemoryBytes = 0;
+};
+
+// How much each metric may grow above its baseline before it is reported as a regression
+struct FHoudiniPerformanceTolerances
+{
+	double WallTime = 0.25;
+	double HAPICalls = 0.05;
+	double PeakMemory = 0.25;
+
+	// Growth under these is noise, and is never reported
+	double MinWallSeconds = 0.05;
+	int64 MinHAPICalls = 10;
+	int64 MinMemoryBytes = 16 * 1024 * 1024;
+};
+
+// A translator's test HDA, and the values of its scale parameter to measure it at
+struct FHoudiniPerformanceCase
+{
+	FString Translator;
+	FString HDAPath;
+	// Int parameter scaling the HDA's outputs. When empty, the HDA is cooked once with its defaults, as scale 1.
+	FString ScaleParameter;
+	// Number of components of the scale parameter to set (e.g. 2 for an X/Y size)
+	int32 NumScaleComponents = 1;
+	TArray<int32> Scales;
+	// String parameters to set before cooking, by name
+	TMap<FString, FString> StringParameters;
+};
+
+// Translator performance suite (Houdini.Performance.*).
+//
+// Each test cooks a translator's HDA at increasing scales, and writes the metrics of each cook to
+// <ResultsDir>/<Translator>.json and .csv. When <BaselineDir>/<Translator>.json exists, the test fails if a metric
+// grew past the tolerances. The suite can run headless, on Linux too:
+//   UnrealEditor-Cmd <Project> -ExecCmds="Automation RunTests Houdini.Performance; Quit" -unattended -nullrhi
+// Command line options:
+//   -HoudiniPerfResults=<Dir>    Results directory, Saved/HoudiniEngine/Performance by default
+//   -HoudiniPerfBaseline=<Dir>   Baseline directory, the plugin's Resources/Performance/Baseline by default
+//   -HoudiniPerfUpdateBaseline   Writes the results to the baseline directory instead of comparing them
+// The baselines are machine specific: they are recorded with -HoudiniPerfUpdateBaseline on the reference machine.
+class FHoudiniEditorTestPerformance
+{
+public:
+	static FString ToJson(const TArray<FHoudiniPerformanceSample>& InSamples);
+	static bool FromJson(const FString& InJson, TArray<FHoudiniPerformanceSample>& OutSamples);
+	static FString ToCSV(const TArray<FHoudiniPerformanceSample>& InSamples);
+
+	// Returns a description of each metric of the samples that regressed compared to the baseline.
+	// Samples without a baseline are ignored.
+	static TArray<FString> FindRegressions(
+		const TArray<FHoudiniPerformanceSample>& InSamples,
+		const TArray<FHoudiniPerformanceSample>& InBaseline,
+		const FHoudiniPerformanceTolerances& InTolerances);
+
+	static FString GetResultsDir();
+	static FString GetBaselineDir();
+
+	// Adds the latent commands cooking the case's HDA at each scale, then saving and comparing the results
+	static bool AddPerformanceCommands(FAutomationTestBase* InTest, const FHoudiniPerformanceCase& InCase);
+
+	// Saves the samples to the results directory, then updates the baseline or compares them to it
+	static void SaveAndCompareSamples(FAutomationTestBase* InTest, const FString& InTranslator, const TArray<FHoudiniPerformanceSample>& InSamples);
+};
+
+#endif
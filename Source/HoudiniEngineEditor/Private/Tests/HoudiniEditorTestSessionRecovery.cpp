@@ -0,0 +1,316 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestSessionRecovery.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniInput.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniRuntimeSettings.h"
+#include "HoudiniSessionJournal.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+	constexpr int32 RecordedNumBoxes = 2;
+
+	// Kills the current session, and starts a new one the way the tests do
+	bool KillAndRestartSession()
+	{
+		FHoudiniEngine::Get().StopSession();
+		return FHoudiniEditorTestUtils::CreateSessionIfInvalid(FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName);
+	}
+
+	// Returns true once all the HACs are instantiated, cooked and processed
+	bool AreAllCooked(const TArray<UHoudiniAssetComponent*>& HACs)
+	{
+		for (UHoudiniAssetComponent* HAC : HACs)
+		{
+			if (HAC->GetAssetState() != EHoudiniAssetState::None || HAC->GetAssetCookCount() <= 0 || HAC->NeedUpdate())
+				return false;
+		}
+
+		return true;
+	}
+
+	// Returns the node connected to the HDA node's first input
+	HAPI_NodeId GetConnectedInputNode(UHoudiniAssetComponent* HAC)
+	{
+		HAPI_NodeId InputNodeId = -1;
+		FHoudiniApi::QueryNodeInput(FHoudiniEngine::Get().GetSession(), HAC->GetAssetId(), 0, &InputNodeId);
+		return InputNodeId;
+	}
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestSessionRecoveryRestart, "Houdini.UnitTests.SessionRecovery.Restart", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestSessionRecoveryRestart::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Kill the session after a cook, and check that the HDA is recovered from the session journal in the new session
+	/// with its parameter values, without being cooked. Then measure the time to recover it by reinstantiating
+	/// and recooking it instead.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	const bool bWasSessionRecoveryEnabled = GetDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery;
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/HoudiniEngine/Test/hda/TestParams"), FTransform::Identity, false));
+	HOUDINI_TEST_EQUAL_ON_FAIL(Context->IsValid(), true, return false);
+
+	// Cook with a non default parameter value, with the journal enabled so that the cook is recorded
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery = true;
+		FHoudiniSessionJournal::Clear();
+
+		UHoudiniParameterInt* Parameter = FHoudiniEditorUnitTestUtils::GetTypedParameter<UHoudiniParameterInt>(Context->HAC, "int_numboxes");
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(Parameter, return true);
+
+		Parameter->SetValueAt(RecordedNumBoxes, 0);
+		Parameter->MarkChanged(true);
+		Context->bCookInProgress = true;
+		Context->bPostOutputDelegateCalled = false;
+		return true;
+	}));
+
+	// Kill the session, the HDA is recovered over the next ticks once the new session is started
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		UHoudiniAssetComponent* HAC = Context->HAC;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniSessionJournal::Contains(HAC), true, return true);
+
+		Context->Data.Add(TEXT("CookCount"), FString::FromInt(HAC->GetAssetCookCount()));
+		Context->Data.Add(TEXT("OldAssetId"), FString::FromInt(HAC->GetAssetId()));
+		Context->Data.Add(TEXT("StartTime"), FString::SanitizeFloat(FPlatformTime::Seconds()));
+
+		HOUDINI_TEST_EQUAL_ON_FAIL(KillAndRestartSession(), true, return true);
+		HOUDINI_TEST_EQUAL(FHoudiniSessionJournal::IsRehydrating(HAC), true);
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		if (FHoudiniSessionJournal::IsRehydrating())
+			return false;
+
+		const double RecoveryTime = FPlatformTime::Seconds() - FCString::Atod(*Context->Data[TEXT("StartTime")]);
+
+		UHoudiniAssetComponent* HAC = Context->HAC;
+		HOUDINI_TEST_NOT_EQUAL(HAC->GetAssetId(), FCString::Atoi(*Context->Data[TEXT("OldAssetId")]));
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::IsHoudiniNodeValid(HAC->GetAssetId()), true);
+		HOUDINI_TEST_EQUAL((int32)HAC->GetAssetState(), (int32)EHoudiniAssetState::None);
+		HOUDINI_TEST_EQUAL(HAC->GetAssetCookCount(), FCString::Atoi(*Context->Data[TEXT("CookCount")]));
+
+		// The new node was not cooked
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetCookCount(HAC->GetAssetId()), 0);
+
+		// The parameter values were restored on the new node
+		int32 NumBoxes = 0;
+		FHoudiniApi::GetParmIntValue(FHoudiniEngine::Get().GetSession(), HAC->GetAssetId(), "int_numboxes", 0, &NumBoxes);
+		HOUDINI_TEST_EQUAL(NumBoxes, RecordedNumBoxes);
+
+		AddInfo(FString::Printf(TEXT("Session restart with recovery from the journal: %.3fs (recovery: %.3fs)"),
+			RecoveryTime, FHoudiniSessionJournal::GetLastRehydrateTime()));
+		return true;
+	}));
+
+	// Kill the session again without the journal: the HDA is reinstantiated and recooked
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery = false;
+
+		Context->Data.Add(TEXT("StartTime"), FString::SanitizeFloat(FPlatformTime::Seconds()));
+		HOUDINI_TEST_EQUAL_ON_FAIL(KillAndRestartSession(), true, return true);
+		HOUDINI_TEST_EQUAL((int32)Context->HAC->GetAssetState(), (int32)EHoudiniAssetState::NeedInstantiation);
+
+		Context->StartCookingHDA();
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, bWasSessionRecoveryEnabled]()
+	{
+		const double RecookTime = FPlatformTime::Seconds() - FCString::Atod(*Context->Data[TEXT("StartTime")]);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::IsHoudiniNodeValid(Context->HAC->GetAssetId()), true);
+
+		AddInfo(FString::Printf(TEXT("Session restart with reinstantiation and recook: %.3fs"), RecookTime));
+
+		FHoudiniSessionJournal::Clear();
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery = bWasSessionRecoveryEnabled;
+		return true;
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestSessionRecoveryAssetChain, "Houdini.UnitTests.SessionRecovery.AssetChain", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestSessionRecoveryAssetChain::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Kill the session in a level with several HDAs, two of them chained through asset inputs, and check that they
+	/// are all recovered from the session journal without being cooked, with the chain reconnected. Recovering them
+	/// must be faster than reinstantiating and recooking them.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	const bool bWasSessionRecoveryEnabled = GetDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery;
+
+	// The box feeds the first echo, which feeds the second one. The other HDAs are independent.
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/HoudiniEngine/Test/hda/TestBox"), FTransform::Identity, false));
+	HOUDINI_TEST_EQUAL_ON_FAIL(Context->IsValid(), true, return false);
+
+	TSharedRef<TArray<UHoudiniAssetComponent*>> HACs = MakeShared<TArray<UHoudiniAssetComponent*>>();
+	HACs->Add(Context->HAC);
+	for (const TCHAR* HDAName : { TEXT("InputEcho"), TEXT("InputEcho"), TEXT("TestParams"), TEXT("TestParams"), TEXT("TestBox") })
+	{
+		UHoudiniAssetComponent* HAC = FHoudiniEditorUnitTestUtils::LoadHDAIntoWorld(
+			FString(TEXT("/HoudiniEngine/Test/hda/")) + HDAName, Context->HAC->GetWorld(), FTransform(FVector(200.0 * HACs->Num(), 0.0, 0.0)));
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(HAC, return false);
+		HACs->Add(HAC);
+	}
+
+	// Chain the echos once they have their inputs
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, HACs]()
+	{
+		if (!AreAllCooked(*HACs))
+			return false;
+
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery = true;
+		FHoudiniSessionJournal::Clear();
+
+		for (int32 Idx = 1; Idx <= 2; Idx++)
+		{
+			UHoudiniAssetComponent* HAC = (*HACs)[Idx];
+			HOUDINI_TEST_EQUAL_ON_FAIL(HAC->GetInputs().Num() > 0, true, return true);
+
+			UHoudiniInput* Input = HAC->GetInputs()[0];
+			bool bBlueprintStructureModified = false;
+			Input->SetInputType(EHoudiniInputType::World, bBlueprintStructureModified);
+			Input->SetInputObjectAt(EHoudiniInputType::World, 0, (*HACs)[Idx - 1]);
+			Input->MarkChanged(true);
+		}
+
+		// Recook everything, so that all the HDAs are recorded in the journal
+		for (UHoudiniAssetComponent* HAC : *HACs)
+			HAC->MarkAsNeedCook();
+
+		return true;
+	}));
+
+	// Kill the session once all the HDAs are recorded
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, HACs]()
+	{
+		if (!AreAllCooked(*HACs))
+			return false;
+
+		for (UHoudiniAssetComponent* HAC : *HACs)
+		{
+			if (!FHoudiniSessionJournal::Contains(HAC))
+				return false;
+		}
+
+		HOUDINI_TEST_EQUAL((*HACs)[1]->GetInputs()[0]->IsAssetInput(), true);
+
+		Context->Data.Add(TEXT("StartTime"), FString::SanitizeFloat(FPlatformTime::Seconds()));
+		HOUDINI_TEST_EQUAL_ON_FAIL(KillAndRestartSession(), true, return true);
+
+		for (UHoudiniAssetComponent* HAC : *HACs)
+			HOUDINI_TEST_EQUAL(FHoudiniSessionJournal::IsRehydrating(HAC), true);
+
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, HACs]()
+	{
+		if (FHoudiniSessionJournal::IsRehydrating())
+			return false;
+
+		const double RecoveryTime = FPlatformTime::Seconds() - FCString::Atod(*Context->Data[TEXT("StartTime")]);
+		Context->Data.Add(TEXT("RecoveryTime"), FString::SanitizeFloat(RecoveryTime));
+
+		for (UHoudiniAssetComponent* HAC : *HACs)
+		{
+			HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::IsHoudiniNodeValid(HAC->GetAssetId()), true, continue);
+			HOUDINI_TEST_EQUAL((int32)HAC->GetAssetState(), (int32)EHoudiniAssetState::None);
+			HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetCookCount(HAC->GetAssetId()), 0);
+		}
+
+		// The asset inputs connect the new nodes
+		HOUDINI_TEST_EQUAL(GetConnectedInputNode((*HACs)[1]), (*HACs)[0]->GetAssetId());
+		HOUDINI_TEST_EQUAL(GetConnectedInputNode((*HACs)[2]), (*HACs)[1]->GetAssetId());
+
+		AddInfo(FString::Printf(TEXT("Session restart with recovery of %d HDAs from the journal: %.3fs"), HACs->Num(), RecoveryTime));
+		return true;
+	}));
+
+	// Kill the session again without the journal: the HDAs are reinstantiated and recooked
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, HACs]()
+	{
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery = false;
+
+		Context->Data.Add(TEXT("StartTime"), FString::SanitizeFloat(FPlatformTime::Seconds()));
+		HOUDINI_TEST_EQUAL_ON_FAIL(KillAndRestartSession(), true, return true);
+
+		for (UHoudiniAssetComponent* HAC : *HACs)
+			HAC->MarkAsNeedCook();
+
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, HACs, bWasSessionRecoveryEnabled]()
+	{
+		if (!AreAllCooked(*HACs))
+			return false;
+
+		const double RecookTime = FPlatformTime::Seconds() - FCString::Atod(*Context->Data[TEXT("StartTime")]);
+		const double RecoveryTime = FCString::Atod(*Context->Data[TEXT("RecoveryTime")]);
+		AddInfo(FString::Printf(TEXT("Session restart with reinstantiation and recook of %d HDAs: %.3fs"), HACs->Num(), RecookTime));
+
+		HOUDINI_TEST_EQUAL(RecoveryTime < RecookTime, true);
+
+		FHoudiniSessionJournal::Clear();
+		GetMutableDefault<UHoudiniRuntimeSettings>()->bEnableSessionRecovery = bWasSessionRecoveryEnabled;
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,182 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestStringResolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "Misc/AutomationTest.h"
+
+FHoudiniAttributeResolver
+FHoudiniEditorTestStringResolver::MakeResolver()
+{
+	TMap<FString, FString> Tokens;
+	Tokens.Add(TEXT("object_name"), TEXT("SM_Rock"));
+	Tokens.Add(TEXT("guid8"), TEXT("A1B2C3D4"));
+	Tokens.Add(TEXT("hda_name"), TEXT("rock_generator"));
+	Tokens.Add(TEXT("hda_actor_name"), TEXT("RockGenerator1"));
+	Tokens.Add(TEXT("temp"), TEXT("/Game/HoudiniEngine/Temp"));
+	Tokens.Add(TEXT("bake"), TEXT("/Game/HoudiniEngine/Bake"));
+	Tokens.Add(TEXT("out"), TEXT("/Game/HoudiniEngine/Temp/rock_generator"));
+	Tokens.Add(TEXT("out_basedir"), TEXT("/Game/HoudiniEngine/Temp"));
+	Tokens.Add(TEXT("geo"), TEXT("3"));
+	Tokens.Add(TEXT("part_id"), TEXT("0"));
+	// Braces in values are sanitized
+	Tokens.Add(TEXT("braces"), TEXT("{object_name}"));
+
+	FHoudiniAttributeResolver Resolver;
+	Resolver.SetTokensFromStringMap(Tokens);
+	return Resolver;
+}
+
+TArray<FString>
+FHoudiniEditorTestStringResolver::GetTemplates()
+{
+	return
+	{
+		TEXT(""),
+		TEXT("SM_Rock_0"),
+		TEXT("{object_name}"),
+		TEXT("{object_name}_{guid8}"),
+		TEXT("{temp}/{hda_name}/{geo}_{part_id}"),
+		TEXT("{out}"),
+		TEXT("prefix_{OBJECT_NAME}_suffix"),
+		TEXT("{object_name}{object_name}{guid8}"),
+		TEXT("{braces}"),
+		TEXT("{unknown_token}"),
+		TEXT("{object_name}_{unknown_token}_{guid8}"),
+		TEXT("{}"),
+		TEXT("{ object_name }"),
+		TEXT("{object name}"),
+		TEXT("{object_name"),
+		TEXT("object_name}"),
+		TEXT("{{object_name}}"),
+		TEXT("{a{object_name}}"),
+		TEXT("`{object_name}"),
+		TEXT("``{object_name}"),
+		TEXT("`x{object_name}"),
+		TEXT("{object_name}`"),
+	};
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestStringResolverTemplates, "Houdini.UnitTests.StringResolver.Templates", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestStringResolverTemplates::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that resolving through the parsed templates gives the same strings as FString::Format.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const bool bWasEnabled = FHoudiniStringResolver::IsStringTemplateCacheEnabled();
+	FHoudiniStringResolver::SetStringTemplateCacheEnabled(true);
+
+	FHoudiniAttributeResolver Resolver = FHoudiniEditorTestStringResolver::MakeResolver();
+	const FHoudiniAttributeResolver& ConstResolver = Resolver;
+
+	for (const FString& Template : FHoudiniEditorTestStringResolver::GetTemplates())
+	{
+		const FString Expected = FString::Format(*Template, ConstResolver.GetCachedTokens());
+
+		// Once parsing the template, once from the resolved strings
+		HOUDINI_TEST_EQUAL_ON_FAIL(Resolver.ResolveString(Template), Expected, AddError(FString::Printf(TEXT("Template: %s"), *Template)));
+		HOUDINI_TEST_EQUAL_ON_FAIL(Resolver.ResolveString(Template), Expected, AddError(FString::Printf(TEXT("Template: %s"), *Template)));
+
+		// From the parsed template, in another resolver
+		FHoudiniAttributeResolver OtherResolver = FHoudiniEditorTestStringResolver::MakeResolver();
+		HOUDINI_TEST_EQUAL_ON_FAIL(OtherResolver.ResolveString(Template), Expected, AddError(FString::Printf(TEXT("Template: %s"), *Template)));
+	}
+
+	// Changing the tokens must not return the previously resolved strings
+	HOUDINI_TEST_EQUAL(Resolver.ResolveString(TEXT("{object_name}_{guid8}")), FString(TEXT("SM_Rock_A1B2C3D4")));
+	Resolver.SetToken(TEXT("object_name"), TEXT("SM_Tree"));
+	HOUDINI_TEST_EQUAL(Resolver.ResolveString(TEXT("{object_name}_{guid8}")), FString(TEXT("SM_Tree_A1B2C3D4")));
+	Resolver.GetCachedTokens().Add(TEXT("guid8"), FString(TEXT("00000000")));
+	HOUDINI_TEST_EQUAL(Resolver.ResolveString(TEXT("{object_name}_{guid8}")), FString(TEXT("SM_Tree_00000000")));
+
+	// Tokens that aren't strings are converted by FString::Format
+	Resolver.GetCachedTokens().Add(TEXT("geo"), 42);
+	HOUDINI_TEST_EQUAL(Resolver.ResolveString(TEXT("geo_{geo}")), FString::Format(TEXT("geo_{geo}"), ConstResolver.GetCachedTokens()));
+
+	// Attributes resolve their value, or the default
+	Resolver.SetAttribute(TEXT("unreal_output_name"), TEXT("{object_name}_custom"));
+	HOUDINI_TEST_EQUAL(Resolver.ResolveOutputName(), FString(TEXT("SM_Tree_custom")));
+	HOUDINI_TEST_EQUAL(Resolver.ResolveAttribute(TEXT("missing_attribute"), TEXT("{object_name}_default")), FString(TEXT("SM_Tree_default")));
+
+	FHoudiniStringResolver::SetStringTemplateCacheEnabled(bWasEnabled);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestStringResolverBenchmark, "Houdini.UnitTests.StringResolver.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestStringResolverBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Resolve 100k strings with FString::Format and through the parsed templates. Each resolver resolves the temp folder,
+	/// bake folder, output name and level path of an output, as outputs are created or baked.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumResolutions = 100000;
+	const TArray<FString> Templates = { TEXT("{temp}"), TEXT("{bake}"), TEXT("{object_name}_{guid8}"), TEXT("{out}") };
+	const FHoudiniAttributeResolver TemplateResolver = FHoudiniEditorTestStringResolver::MakeResolver();
+
+	const bool bWasEnabled = FHoudiniStringResolver::IsStringTemplateCacheEnabled();
+
+	const auto ResolveAll = [&]()
+	{
+		int64 TotalLength = 0;
+		for (int32 OutputIdx = 0; OutputIdx < NumResolutions / Templates.Num(); ++OutputIdx)
+		{
+			// A new resolver per output
+			FHoudiniAttributeResolver Resolver = TemplateResolver;
+			for (const FString& Template : Templates)
+				TotalLength += Resolver.ResolveString(Template).Len();
+		}
+		return TotalLength;
+	};
+
+	FHoudiniStringResolver::SetStringTemplateCacheEnabled(false);
+	double StartTime = FPlatformTime::Seconds();
+	const int64 FormatLength = ResolveAll();
+	const double FormatTime = FPlatformTime::Seconds() - StartTime;
+
+	FHoudiniStringResolver::SetStringTemplateCacheEnabled(true);
+	StartTime = FPlatformTime::Seconds();
+	const int64 TemplateLength = ResolveAll();
+	const double TemplateTime = FPlatformTime::Seconds() - StartTime;
+
+	HOUDINI_TEST_EQUAL(TemplateLength, FormatLength);
+
+	AddInfo(FString::Printf(TEXT("%d resolutions: %.3fs with FString::Format, %.3fs with parsed templates."),
+		NumResolutions, FormatTime, TemplateTime));
+
+	FHoudiniStringResolver::SetStringTemplateCacheEnabled(bWasEnabled);
+
+	return true;
+}
+
+#endif
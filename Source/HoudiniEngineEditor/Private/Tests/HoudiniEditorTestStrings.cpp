@@ -0,0 +1,271 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEditorTestStrings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineString.h"
+
+#include "Async/ParallelFor.h"
+#include "Misc/AutomationTest.h"
+
+FHoudiniTestFakeStringTable::FHoudiniTestFakeStringTable(int32 InNumStrings, const FString& InPrefix)
+	: FHoudiniTestFakeHoudiniApi(this)
+{
+	// String handle 0 is invalid
+	Strings.SetNum(InNumStrings + 1);
+	SetStrings(InPrefix);
+
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetStringBufLength);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetString);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetStringBatchSize);
+	HOUDINI_TEST_FAKE_HAPI_FUNCTION(GetStringBatch);
+}
+
+void
+FHoudiniTestFakeStringTable::SetStrings(const FString& InPrefix)
+{
+	FScopeLock ScopeLock(&Lock);
+	for (int32 Handle = 1; Handle < Strings.Num(); ++Handle)
+		Strings[Handle] = TCHAR_TO_UTF8(*FString::Printf(TEXT("%s%d"), *InPrefix, Handle));
+}
+
+FString
+FHoudiniTestFakeStringTable::GetExpectedString(HAPI_StringHandle InHandle) const
+{
+	return UTF8_TO_TCHAR(Strings[InHandle].c_str());
+}
+
+HAPI_Result
+FHoudiniTestFakeStringTable::GetStringBufLength(const HAPI_Session* Session, HAPI_StringHandle StringHandle, int* BufferLength)
+{
+	Active()->NumCalls++;
+	if (!Active()->Strings.IsValidIndex(StringHandle))
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	*BufferLength = static_cast<int>(Active()->Strings[StringHandle].size()) + 1;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeStringTable::GetString(const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length)
+{
+	Active()->NumCalls++;
+	if (!Active()->Strings.IsValidIndex(StringHandle) || Length <= 0)
+		return HAPI_RESULT_INVALID_ARGUMENT;
+
+	const std::string& Value = Active()->Strings[StringHandle];
+	const int32 NumChars = FMath::Min(static_cast<int32>(Value.size()), Length - 1);
+	FMemory::Memcpy(StringValue, Value.c_str(), NumChars);
+	StringValue[NumChars] = '\0';
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeStringTable::GetStringBatchSize(const HAPI_Session* Session, const int* StringHandles, int Count, int* BufferSize)
+{
+	Active()->NumCalls++;
+
+	FScopeLock ScopeLock(&Active()->Lock);
+	Active()->PendingStringBatch.Reset();
+
+	int32 Size = 0;
+	for (int32 Idx = 0; Idx < Count; ++Idx)
+	{
+		if (!Active()->Strings.IsValidIndex(StringHandles[Idx]))
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		Active()->PendingStringBatch.Add(StringHandles[Idx]);
+		Size += static_cast<int32>(Active()->Strings[StringHandles[Idx]].size()) + 1;
+	}
+
+	*BufferSize = Size;
+	return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniTestFakeStringTable::GetStringBatch(const HAPI_Session* Session, char* Buffer, int Length)
+{
+	Active()->NumCalls++;
+
+	FScopeLock ScopeLock(&Active()->Lock);
+	int32 Offset = 0;
+	for (const HAPI_StringHandle Handle : Active()->PendingStringBatch)
+	{
+		const std::string& Value = Active()->Strings[Handle];
+		if (Offset + static_cast<int32>(Value.size()) + 1 > Length)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FMemory::Memcpy(Buffer + Offset, Value.c_str(), Value.size() + 1);
+		Offset += static_cast<int32>(Value.size()) + 1;
+	}
+
+	Active()->PendingStringBatch.Reset();
+	return HAPI_RESULT_SUCCESS;
+}
+
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestStringsHandleCache, "Houdini.UnitTests.Strings.HandleCache", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestStringsHandleCache::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Check that resolved string handles are reused within a cook, and that handles reused by the next cook resolve to
+	/// their new strings.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumStrings = 1000;
+
+	const bool bWasCacheEnabled = FHoudiniEngineString::IsStringCacheEnabled();
+	FHoudiniEngineString::SetStringCacheEnabled(true);
+
+	FHoudiniTestFakeStringTable StringTable(NumStrings, TEXT("first_cook_"));
+
+	// Material/instancer/group names come back many times in the same array
+	TArray<int32> Handles;
+	for (int32 Idx = 0; Idx < NumStrings * 10; ++Idx)
+		Handles.Add(Idx % NumStrings + 1);
+
+	const auto ResolveAndCheck = [&]()
+	{
+		TArray<FString> Resolved;
+		if (!FHoudiniEngineString::SHArrayToFStringArray(Handles, Resolved))
+			return false;
+
+		for (int32 Idx = 0; Idx < Handles.Num(); ++Idx)
+		{
+			if (Resolved[Idx] != StringTable.GetExpectedString(Handles[Idx]))
+				return false;
+		}
+		return true;
+	};
+
+	// First conversion goes through HAPI, with one string batch
+	HOUDINI_TEST_EQUAL(ResolveAndCheck(), true);
+	HOUDINI_TEST_EQUAL(StringTable.NumCalls.load(), 2);
+
+	// Then every handle is cached
+	HOUDINI_TEST_EQUAL(ResolveAndCheck(), true);
+	FString Single;
+	HOUDINI_TEST_EQUAL(FHoudiniEngineString::ToFString(42, Single), true);
+	HOUDINI_TEST_EQUAL(Single, StringTable.GetExpectedString(42));
+	HOUDINI_TEST_EQUAL(StringTable.NumCalls.load(), 2);
+
+	// A cook reuses the same handles for different strings
+	StringTable.SetStrings(TEXT("second_cook_"));
+	FHoudiniEngineString::InvalidateStringCache();
+
+	HOUDINI_TEST_EQUAL(FHoudiniEngineString::ToFString(42, Single), true);
+	HOUDINI_TEST_EQUAL(Single, StringTable.GetExpectedString(42));
+	HOUDINI_TEST_EQUAL(ResolveAndCheck(), true);
+	HOUDINI_TEST_EQUAL(StringTable.NumCalls.load(), 6);
+
+	// Invalid handles are never resolved
+	HOUDINI_TEST_EQUAL(FHoudiniEngineString::ToFString(0, Single), false);
+
+	// Without the cache, every conversion calls HAPI
+	FHoudiniEngineString::SetStringCacheEnabled(false);
+	HOUDINI_TEST_EQUAL(ResolveAndCheck(), true);
+	HOUDINI_TEST_EQUAL(ResolveAndCheck(), true);
+	HOUDINI_TEST_EQUAL(StringTable.NumCalls.load(), 10);
+
+	FHoudiniEngineString::SetStringCacheEnabled(bWasCacheEnabled);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestStringsConcurrentResolve, "Houdini.UnitTests.Strings.ConcurrentResolve", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestStringsConcurrentResolve::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Resolve overlapping handle arrays from many threads, with and without the string cache, and compare the times.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	constexpr int32 NumStrings = 4096;
+	constexpr int32 NumTasks = 64;
+	constexpr int32 NumHandlesPerTask = 2048;
+	constexpr int32 NumRounds = 8;
+
+	const bool bWasCacheEnabled = FHoudiniEngineString::IsStringCacheEnabled();
+	FHoudiniTestFakeStringTable StringTable(NumStrings, TEXT("concurrent_"));
+
+	const auto RunTasks = [&](bool bUseCache, double& OutSeconds, int32& OutCalls)
+	{
+		FHoudiniEngineString::SetStringCacheEnabled(bUseCache);
+		StringTable.NumCalls = 0;
+
+		std::atomic<int32> NumErrors{ 0 };
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < NumRounds; ++Round)
+		{
+			ParallelFor(NumTasks, [&](int32 TaskIdx)
+			{
+				TArray<int32> Handles;
+				Handles.SetNum(NumHandlesPerTask);
+				for (int32 Idx = 0; Idx < NumHandlesPerTask; ++Idx)
+					Handles[Idx] = (TaskIdx * 97 + Idx * 7) % NumStrings + 1;
+
+				TArray<FString> Resolved;
+				if (!FHoudiniEngineString::SHArrayToFStringArray(Handles, Resolved))
+				{
+					NumErrors++;
+					return;
+				}
+
+				for (int32 Idx = 0; Idx < NumHandlesPerTask; ++Idx)
+				{
+					if (Resolved[Idx] != StringTable.GetExpectedString(Handles[Idx]))
+						NumErrors++;
+				}
+			});
+		}
+		OutSeconds = FPlatformTime::Seconds() - StartTime;
+		OutCalls = StringTable.NumCalls;
+		return NumErrors.load() == 0;
+	};
+
+	double SecondsWithoutCache = 0.0;
+	double SecondsWithCache = 0.0;
+	int32 CallsWithoutCache = 0;
+	int32 CallsWithCache = 0;
+	HOUDINI_TEST_EQUAL(RunTasks(false, SecondsWithoutCache, CallsWithoutCache), true);
+	HOUDINI_TEST_EQUAL(RunTasks(true, SecondsWithCache, CallsWithCache), true);
+
+	AddInfo(FString::Printf(TEXT("%d threaded conversions of %d handles: %.3fs / %d HAPI calls without the string cache, %.3fs / %d HAPI calls with it."),
+		NumTasks * NumRounds, NumHandlesPerTask, SecondsWithoutCache, CallsWithoutCache, SecondsWithCache, CallsWithCache));
+
+	// Once resolved, strings are only fetched again after a cook
+	HOUDINI_TEST_EQUAL(CallsWithCache < CallsWithoutCache, true);
+
+	FHoudiniEngineString::SetStringCacheEnabled(bWasCacheEnabled);
+	return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+#include "HoudiniEditorUnitTestUtils.h"
+#include "HAL/CriticalSection.h"
+
+#include <atomic>
+#include <string>
+
+// Replaces the HAPI string functions with fakes backed by a string table, so that string handle
+// conversions can be tested without a session. The table can be changed to simulate a cook.
+// Counts the HAPI calls made. The original functions are restored on destruction.
+class FHoudiniTestFakeStringTable : public FHoudiniTestFakeHoudiniApi
+{
+public:
+	FHoudiniTestFakeStringTable(int32 InNumStrings, const FString& InPrefix);
+
+	// Replaces the content of all the handles, as a cook would.
+	void SetStrings(const FString& InPrefix);
+
+	// The string the given handle should resolve to
+	FString GetExpectedString(HAPI_StringHandle InHandle) const;
+
+private:
+	static FHoudiniTestFakeStringTable* Active() { return GetActive<FHoudiniTestFakeStringTable>(); }
+
+	FCriticalSection Lock;
+	TArray<std::string> Strings;
+	TArray<HAPI_StringHandle> PendingStringBatch;
+
+	static HAPI_Result GetStringBufLength(const HAPI_Session* Session, HAPI_StringHandle StringHandle, int* BufferLength);
+	static HAPI_Result GetString(const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length);
+	static HAPI_Result GetStringBatchSize(const HAPI_Session* Session, const int* StringHandles, int Count, int* BufferSize);
+	static HAPI_Result GetStringBatch(const HAPI_Session* Session, char* Buffer, int Length);
+};
+
+#endif
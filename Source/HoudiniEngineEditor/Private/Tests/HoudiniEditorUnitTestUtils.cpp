@@ -32,6 +32,17 @@ UHoudiniAssetComponent* FHoudiniEditorUnitTestUtils::LoadHDAIntoNewMap(
 
 	UWorld* World = UEditorLoadingAndSavingUtils::NewMapFromTemplate(MapName, false);
 
+	return LoadHDAIntoWorld(PackageName, World, Transform);
+}
+
+UHoudiniAssetComponent* FHoudiniEditorUnitTestUtils::LoadHDAIntoWorld(
+	const FString& PackageName,
+	UWorld* World,
+	const FTransform& Transform)
+{
+	if (!IsValid(World))
+		return nullptr;
+
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	TArray<FAssetData> AssetData;
 	AssetRegistryModule.Get().GetAssetsByPackageName(FName(PackageName), AssetData);
@@ -272,4 +283,11 @@ TArray<AActor*> FHoudiniEditorUnitTestUtils::GetOutputActors(TArray<FHoudiniBake
 	return Results;
 }
 
+FHoudiniTestFakeHoudiniApi::~FHoudiniTestFakeHoudiniApi()
+{
+	// Restore in reverse order, in case a function was replaced more than once
+	for (int32 Idx = RestoreFunctions.Num() - 1; Idx >= 0; --Idx)
+		RestoreFunctions[Idx]();
+}
+
 #endif
\ No newline at end of file
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Templates/Identity.h"
 #include "HoudiniEditorAssetStateSubsystem.h"
 #include "HoudiniEditorTestUtils.h"
 #include "HoudiniEngineBakeUtils.h"
@@ -47,6 +48,8 @@
 #include "Misc/AutomationTest.h"
 #endif
 
+#include <atomic>
+
 //#include "HoudiniEditorLatentUtils.generated.h"
 class UHoudiniAssetComponent;
 
@@ -71,6 +74,9 @@ struct FHoudiniEditorUnitTestUtils
 {
 	static UHoudiniAssetComponent* LoadHDAIntoNewMap(const FString& PackageName, const FTransform& Transform, bool bOpenWorld);
 
+	// Adds an actor for the HDA to an existing world, eg. the world of another test HDA
+	static UHoudiniAssetComponent* LoadHDAIntoWorld(const FString& PackageName, UWorld* World, const FTransform& Transform);
+
 	static FString GetAbsolutePathOfProjectFile(const FString & Object);
 
 	// Helper function to returns components from an output.
@@ -321,4 +327,53 @@ public:
 
 #if WITH_DEV_AUTOMATION_TESTS
 
+// Replaces FHoudiniApi functions with fakes for its lifetime, so that code calling HAPI can be tested without
+// a Houdini Engine session. Derived fixtures install their static fake functions with HOUDINI_TEST_FAKE_HAPI_FUNCTION
+// in their constructor, and the fakes reach the fixture with GetActive(). The original functions are restored
+// on destruction. Only one fixture of each type can be active at a time, fixtures of different types can be
+// combined as long as they fake different functions.
+class FHoudiniTestFakeHoudiniApi
+{
+public:
+	virtual ~FHoudiniTestFakeHoudiniApi();
+
+	// Number of calls made to the fake HAPI functions (they can be called from worker threads)
+	std::atomic<int32> NumCalls{ 0 };
+
+protected:
+	// InFake is the derived fixture being constructed, returned by GetActive until it is destroyed
+	template<typename FAKE_TYPE>
+	explicit FHoudiniTestFakeHoudiniApi(FAKE_TYPE* InFake)
+	{
+		check(!GetActive<FAKE_TYPE>());
+		ActiveFixture<FAKE_TYPE>() = InFake;
+		RestoreFunctions.Add([]() { ActiveFixture<FAKE_TYPE>() = nullptr; });
+	}
+
+	// Returns the active fixture of the given type
+	template<typename FAKE_TYPE>
+	static FAKE_TYPE* GetActive() { return ActiveFixture<FAKE_TYPE>(); }
+
+	// Replaces InOutFunction with InFake, until this fixture is destroyed
+	template<typename FUNCTION_TYPE>
+	void ReplaceFunction(FUNCTION_TYPE& InOutFunction, TIdentity_T<FUNCTION_TYPE> InFake)
+	{
+		RestoreFunctions.Add([&InOutFunction, Original = InOutFunction]() { InOutFunction = Original; });
+		InOutFunction = InFake;
+	}
+
+private:
+	template<typename FAKE_TYPE>
+	static FAKE_TYPE*& ActiveFixture()
+	{
+		static FAKE_TYPE* Active = nullptr;
+		return Active;
+	}
+
+	TArray<TFunction<void()>> RestoreFunctions;
+};
+
+// Replaces FHoudiniApi::FunctionName with the fixture's static function of the same name.
+#define HOUDINI_TEST_FAKE_HAPI_FUNCTION(FunctionName) ReplaceFunction(FHoudiniApi::FunctionName, &FunctionName)
+
 #endif
\ No newline at end of file
@@ -63,6 +63,10 @@ public:
 	UPROPERTY()
 	bool bSyncWorldInput = false;
 
+	// When replacing existing assets, only import again the fetch paths whose nodes have changed since the last fetch
+	UPROPERTY(Category = "HoudiniNodeSync", EditAnywhere)
+	bool bOnlyFetchChangedNodes = true;
+
 	// Generation properties for the Static Meshes generated by this Houdini Asset
 	UPROPERTY(Category = "HoudiniMeshGeneration", EditAnywhere, meta = (DisplayPriority = 1)/*, meta = (ShowOnlyInnerProperties)*/)
 	FHoudiniStaticMeshGenerationProperties StaticMeshGenerationProperties;
@@ -136,6 +140,30 @@ public:
 };
 
 
+// State of a Houdini node when it was fetched to the content browser
+struct FHoudiniNodeSyncFetchedNode
+{
+	FString NodePath;
+	// Hash of the node's geometry, see FHoudiniEngineUtils::HapiGetGeoContentHash()
+	uint64 ContentHash = 0;
+
+	bool operator==(const FHoudiniNodeSyncFetchedNode& InOther) const
+	{
+		return NodePath == InOther.NodePath && ContentHash == InOther.ContentHash;
+	}
+};
+
+// A fetch path imported to the content browser, with the nodes it was imported from and the assets created for it
+struct FHoudiniNodeSyncFetchedPath
+{
+	// Hash of the options used for the import
+	uint64 OptionsHash = 0;
+	TArray<FHoudiniNodeSyncFetchedNode> Nodes;
+	TArray<TWeakObjectPtr<UObject>> OutputObjects;
+
+	// Returns true if this import can be kept for a fetch of the given nodes and options
+	bool IsUpToDate(const FHoudiniNodeSyncFetchedPath& InFetch) const;
+};
 
 UCLASS()
 class HOUDINIENGINEEDITOR_API UHoudiniEditorNodeSyncSubsystem : public UAssetEditorUISubsystem
@@ -182,6 +210,17 @@ public:
 		const FString& InFetchedNodePath,
 		HAPI_NodeId& OutFetchedNodeId);
 
+	// Gets the path and content hash of a cooked SOP node
+	static bool GetFetchedNodeState(
+		HAPI_NodeId InNodeId,
+		FHoudiniNodeSyncFetchedNode& OutNodeState);
+
+	// Fetch paths that were imported by the last fetch, the other paths had not changed.
+	const TArray<FString>& GetLastFetchImportedPaths() const { return LastFetchImportedPaths; }
+
+	// Forgets the previously fetched nodes, the next fetch will import all the paths again.
+	void InvalidateFetchedNodes();
+
 	// Node Sync ticks
 	void StartTicking();
 	void StopTicking();
@@ -232,4 +271,9 @@ private:
 
 	// Last time we ticked NodeSync
 	double dLastTick;
+
+	// Fetch paths imported to the content browser, used to skip the paths that haven't changed
+	TMap<FString, FHoudiniNodeSyncFetchedPath> FetchedPaths;
+
+	TArray<FString> LastFetchImportedPaths;
 };
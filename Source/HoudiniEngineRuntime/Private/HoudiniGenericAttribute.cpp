@@ -38,6 +38,90 @@
 #include "Engine/StaticMesh.h"
 #include "Landscape.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "Internationalization/Internationalization.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+#include <atomic>
+
+namespace
+{
+	// Results of TryToFindProperty, per struct and property name.
+	// Only native structs are cached: their properties only change on hot reload, which empties the cache.
+	class FHoudiniGenericAttributePropertyCache
+	{
+	public:
+		struct FEntry
+		{
+			// Found property, exact or partial match, null if none
+			FProperty* Property = nullptr;
+			bool bExact = false;
+			// Offset of the property's container from the struct's container
+			SIZE_T ContainerOffset = 0;
+			// Properties added to the chain for an exact match: the struct properties leading to it, then the property
+			TArray<FProperty*> Chain;
+		};
+
+		using FKey = TTuple<FObjectKey, FString>;
+
+		static bool CanCache(const UStruct* InStruct)
+		{
+			if (const UClass* Class = Cast<UClass>(InStruct))
+				return Class->HasAnyClassFlags(CLASS_Native);
+			if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(InStruct))
+				return (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+			return false;
+		}
+
+		static bool Find(const FKey& InKey, FEntry& OutEntry)
+		{
+			FReadScopeLock ScopeLock(Lock);
+			if (const FEntry* Found = Entries.Find(InKey))
+			{
+				OutEntry = *Found;
+				return true;
+			}
+			return false;
+		}
+
+		static void Add(const FKey& InKey, const FEntry& InEntry)
+		{
+			BindInvalidationEvents();
+
+			FWriteScopeLock ScopeLock(Lock);
+			Entries.Add(InKey, InEntry);
+		}
+
+		static void Empty()
+		{
+			FWriteScopeLock ScopeLock(Lock);
+			Entries.Empty();
+		}
+
+		static std::atomic<bool> bEnabled;
+
+	private:
+		static void BindInvalidationEvents()
+		{
+			if (bEventsBound.exchange(true))
+				return;
+
+			// Properties are recreated on hot reload, and display names depend on the culture
+			FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason) { Empty(); });
+			FInternationalization::Get().OnCultureChanged().AddStatic(&FHoudiniGenericAttributePropertyCache::Empty);
+		}
+
+		static FRWLock Lock;
+		static TMap<FKey, FEntry> Entries;
+		static std::atomic<bool> bEventsBound;
+	};
+
+	FRWLock FHoudiniGenericAttributePropertyCache::Lock;
+	TMap<FHoudiniGenericAttributePropertyCache::FKey, FHoudiniGenericAttributePropertyCache::FEntry> FHoudiniGenericAttributePropertyCache::Entries;
+	std::atomic<bool> FHoudiniGenericAttributePropertyCache::bEventsBound(false);
+	std::atomic<bool> FHoudiniGenericAttributePropertyCache::bEnabled(true);
+}
 
 
 
@@ -875,6 +959,92 @@ FHoudiniGenericAttribute::TryToFindProperty(
 	void*& OutContainer,
 	bool bDumpAttributes)
 {
+#if WITH_EDITOR
+	if (!InContainer)
+		return false;
+
+	if (!IsValid(InStruct))
+		return false;
+
+	if (InPropertyName.IsEmpty() || bDumpAttributes || bOutExactPropertyHasBeenFound
+		|| !IsPropertyCacheEnabled() || !FHoudiniGenericAttributePropertyCache::CanCache(InStruct))
+	{
+		return TryToFindPropertyInStruct(
+			InContainer, InStruct, InPropertyName, InPropertyChain, OutFoundProperty, bOutExactPropertyHasBeenFound, OutContainer, bDumpAttributes);
+	}
+
+	const FHoudiniGenericAttributePropertyCache::FKey Key(FObjectKey(InStruct), InPropertyName);
+	FHoudiniGenericAttributePropertyCache::FEntry Entry;
+	if (!FHoudiniGenericAttributePropertyCache::Find(Key, Entry))
+	{
+		// Walk the struct once, then record what was found
+		FEditPropertyChain FoundChain;
+		FProperty* FoundProperty = nullptr;
+		bool bExactFound = false;
+		void* FoundContainer = nullptr;
+		TryToFindPropertyInStruct(InContainer, InStruct, InPropertyName, FoundChain, FoundProperty, bExactFound, FoundContainer, false);
+
+		Entry.Property = FoundProperty;
+		Entry.bExact = bExactFound;
+		if (FoundProperty)
+			Entry.ContainerOffset = static_cast<uint8*>(FoundContainer) - static_cast<uint8*>(InContainer);
+		if (bExactFound)
+		{
+			for (FProperty* ChainProperty : FoundChain)
+				Entry.Chain.Add(ChainProperty);
+		}
+
+		FHoudiniGenericAttributePropertyCache::Add(Key, Entry);
+	}
+
+	if (!Entry.Property)
+		return OutFoundProperty != nullptr;
+
+	OutFoundProperty = Entry.Property;
+	OutContainer = static_cast<uint8*>(InContainer) + Entry.ContainerOffset;
+	if (Entry.bExact)
+	{
+		bOutExactPropertyHasBeenFound = true;
+		for (FProperty* ChainProperty : Entry.Chain)
+			InPropertyChain.AddTail(ChainProperty);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void
+FHoudiniGenericAttribute::SetPropertyCacheEnabled(bool bInEnabled)
+{
+	FHoudiniGenericAttributePropertyCache::bEnabled = bInEnabled;
+	FHoudiniGenericAttributePropertyCache::Empty();
+}
+
+bool
+FHoudiniGenericAttribute::IsPropertyCacheEnabled()
+{
+	return FHoudiniGenericAttributePropertyCache::bEnabled;
+}
+
+void
+FHoudiniGenericAttribute::InvalidatePropertyCache()
+{
+	FHoudiniGenericAttributePropertyCache::Empty();
+}
+
+bool
+FHoudiniGenericAttribute::TryToFindPropertyInStruct(
+	void* InContainer,
+	UStruct* InStruct,
+	const FString& InPropertyName,
+	FEditPropertyChain& InPropertyChain,
+	FProperty*& OutFoundProperty,
+	bool& bOutExactPropertyHasBeenFound,
+	void*& OutContainer,
+	bool bDumpAttributes)
+{
 #if WITH_EDITOR
 	if (!InContainer)
 		return false;
@@ -942,7 +1112,7 @@ FHoudiniGenericAttribute::TryToFindProperty(
 				continue;
 
 			InPropertyChain.AddTail(StructProperty);
-			TryToFindProperty(
+			TryToFindPropertyInStruct(
 				StructProperty->ContainerPtrToValuePtr<void>(InContainer, 0),
 				Struct,
 				InPropertyName,
@@ -181,6 +181,7 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 		EAttribStorageType& OutAttributeStorageType);
 
 	// Recursive search for a given property on a UObject
+	// The results for native structs are cached per struct and property name.
 	static bool TryToFindProperty(
 		void* InContainer,
 		UStruct* InStruct,
@@ -191,6 +192,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 		void*& OutContainer,
 		bool bDumpAttributes);
 
+	// Enables/disables the cache of the properties found by TryToFindProperty. Disabling it also empties it.
+	static void SetPropertyCacheEnabled(bool bInEnabled);
+	static bool IsPropertyCacheEnabled();
+	// Empties the cache of the properties found by TryToFindProperty
+	static void InvalidatePropertyCache();
+
 	// Helper to call PostEditChangePropertyChain on InObject for the InPropertyChain. 
 	static bool HandlePostEditChangeProperty(
 		UObject* InObject,
@@ -201,5 +208,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 	// returns true if the property is supported
 	static bool DumpGenericAttributeForProperty(FProperty* InProperty, int32 InPropChainNumber);
 
+private:
+	// Walks the properties of InStruct, and of its struct properties, looking for the property. Used by TryToFindProperty.
+	static bool TryToFindPropertyInStruct(
+		void* InContainer,
+		UStruct* InStruct,
+		const FString& InPropertyName,
+		FEditPropertyChain& InPropertyChain,
+		FProperty*& OutFoundProperty,
+		bool& bOutExactPropertyHasBeenFound,
+		void*& OutContainer,
+		bool bDumpAttributes);
 
 };
\ No newline at end of file
@@ -2393,6 +2393,7 @@ void
 UHoudiniInputActor::InvalidateSplinesMeshData()
 {
 	GeneratedSplinesMesh = nullptr;
+	GeneratedSplinesMeshHash = 0;
 	// If valid, mark our input nodes for deletion.
 	if (!CanDeleteHoudiniNodes())
 	{
@@ -778,6 +778,12 @@ public:
 	// Setter for temp merged SM of all spline mesh components of this actor (if any)
 	void SetGeneratedSplineMesh(UStaticMesh* const InSM) { GeneratedSplinesMesh = InSM; }
 
+	// Hash of the spline mesh components the temp merged SM was generated from (see FHoudiniMeshUtils::GetMergeMeshesHash)
+	uint64 GetGeneratedSplinesMeshHash() const { return GeneratedSplinesMeshHash; }
+	// Location of the temp merged SM, as returned by the merge
+	const FVector& GetGeneratedSplinesMeshLocation() const { return GeneratedSplinesMeshLocation; }
+	void SetGeneratedSplinesMeshHash(const uint64 InHash, const FVector& InLocation) { GeneratedSplinesMeshHash = InHash; GeneratedSplinesMeshLocation = InLocation; }
+
 protected:
 	virtual bool HasRootComponentTransformChanged() const;
 	virtual bool HasComponentsTransformChanged() const;
@@ -861,6 +867,13 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UStaticMesh> GeneratedSplinesMesh;
 
+	// Hash of the spline mesh components GeneratedSplinesMesh was merged from, 0 if unknown. Not saved: the merged
+	// mesh is generated again once after loading.
+	uint64 GeneratedSplinesMeshHash = 0;
+
+	// The location returned when merging GeneratedSplinesMesh.
+	FVector GeneratedSplinesMeshLocation = FVector::ZeroVector;
+
 	// True if the merged spline mesh was sent at the last translation.
 	UPROPERTY()
 	bool bUsedMergeSplinesMeshAtLastTranslate;
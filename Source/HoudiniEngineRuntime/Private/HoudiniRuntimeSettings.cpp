@@ -64,6 +64,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
 	bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
 	AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+	bEnableSessionRecovery = false;
 
 	SharedMemoryBufferSize = 500;
 	bSharedMemoryBufferCyclic = true;
@@ -83,6 +84,11 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	bDisplaySlateCookingNotifications = true;
 	DefaultTemporaryCookFolder = HAPI_UNREAL_DEFAULT_TEMP_COOK_FOLDER;
 	DefaultBakeFolder = HAPI_UNREAL_DEFAULT_BAKE_FOLDER;
+	bBakeDeduplicateStaticMeshes = false;
+	BakeInstancedActorsBatchSize = 500;
+	bEnableCookCache = false;
+	CookCacheMaxEntries = 64;
+	CookCacheMaxSizeMB = 1024;
 
 	// Instances
 	bEnableDeprecatedInstanceVariations = false;
@@ -35,6 +35,7 @@
 #include "HoudiniRuntimeSettings.generated.h"
 
 class UFoliageType_InstancedStaticMesh;
+class UHoudiniAsset;
 
 UENUM()
 enum EHoudiniRuntimeSettingsSessionType
@@ -216,6 +217,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session)
 		float AutomaticServerTimeout;
 
+		// Keeps a journal of the state of the cooked Houdini Assets, so that after the session is restarted they are recreated
+		// directly from it in the new session, in bulk and without cooking, instead of being reinstantiated and recooked one by one. (default: disabled)
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session, meta = (DisplayName = "Fast session recovery"))
+		bool bEnableSessionRecovery;
+
 		// If enabled, changes made in Houdini, when connected to Houdini running in Session Sync mode will be automatically be pushed to Unreal.
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session)
 		bool bSyncWithHoudiniCook;
@@ -252,6 +258,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Instantiating)
 		bool bPreferHdaMemoryCopyOverHdaSourceFile;
 
+		// HDAs loaded into every Houdini Engine session when it starts, so their first instantiation
+		// does not have to wait for the library to load.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Instantiating, meta = (DisplayName = "Preloaded HDAs"))
+		TArray<TSoftObjectPtr<UHoudiniAsset>> PreloadedHoudiniAssets;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Cooking options.
 		//-------------------------------------------------------------------------------------------------------------
@@ -272,6 +283,30 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		FString DefaultBakeFolder;
 
+		// When baking, outputs whose static meshes have identical geometry, materials and build settings
+		// (for example the same variant generated by many PDG work items) share a single baked static mesh asset.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Bake - Deduplicate identical static meshes"))
+		bool bBakeDeduplicateStaticMeshes;
+
+		// Number of instanced actors spawned per batch when baking actor instancers. Each batch is its own undo transaction.
+		// Bakes from the details panel spawn one batch per tick, others update their progress between two batches.
+		// Both can be cancelled between two batches.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Bake - Instanced actors batch size", ClampMin = "1", UIMin = "1"))
+		int32 BakeInstancedActorsBatchSize;
+
+		// Keeps the static meshes generated by cooks on disk, keyed by the HDA, its parameter values and its inputs,
+		// so that cooking an asset again in a state it was already cooked in restores its outputs without cooking.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Cook cache - Enabled"))
+		bool bEnableCookCache;
+
+		// Maximum number of cooks kept in the cook cache, the least recently used ones are evicted first.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Cook cache - Max entries", ClampMin = "1", UIMin = "1", EditCondition = "bEnableCookCache"))
+		int32 CookCacheMaxEntries;
+
+		// Maximum size on disk of the cook cache, in megabytes.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Cook cache - Max size (MB)", ClampMin = "1", UIMin = "1", EditCondition = "bEnableCookCache"))
+		int32 CookCacheMaxSizeMB;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Deprecated instance settings.
 		//-------------------------------------------------------------------------------------------------------------